@@ -0,0 +1,2810 @@
+/* Orx - Portable Game Engine
+ *
+ * Copyright (c) 2008-2018 Orx-Project
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ *    1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ *
+ *    2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ *
+ *    3. This notice may not be removed or altered from any source
+ *    distribution.
+ */
+
+/**
+ * @file orxBench.c
+ * @date 19/10/2026
+ *
+ * Headless microbenchmarks & sanity checks for core modules
+ *
+ * Usage: orxBench [ResultFile [NamePrefix]]
+ * Results are written as JSON to ResultFile (default: orxbench.json), only benchmarks & checks whose name start with NamePrefix are run.
+ * The exit code is the number of failed checks.
+ *
+ * Only core modules are initialized upfront. Benchmarks & checks that need scene modules (objects, spawners, particle systems, ...)
+ * initialize them on demand, which is only done when no window nor audio device can get opened: in builds made with the headless
+ * option (embedded Dummy display, sound & input plugins) or in Core builds (no plugin gets loaded, modules that need a display fail
+ * to init). Otherwise, or when their modules fail to init, they're skipped.
+ *
+ */
+
+
+/** Includes
+ */
+#include "orx.h"
+
+
+/** Misc defines
+ */
+#define orxBENCH_KZ_RESULT_FILE           "orxbench.json"       /**< Default result file */
+#define orxBENCH_KZ_LOG_FILE              "orxbench.log"        /**< Log file used by log benchmarks & checks */
+#define orxBENCH_KZ_TRACE_FILE            "orxbench-trace.json" /**< Trace file used by profiler checks */
+#define orxBENCH_KZ_REPORT_FILE           "orxbench-report.txt" /**< Report file used by profiler & memory checks */
+#define orxBENCH_KZ_CONFIG_FILE           "orxbench-config.ini" /**< Config file used by cost report checks */
+#define orxBENCH_KZ_CONFIG_SECTION        "Bench"               /**< Config section used by config & command benchmarks */
+#define orxBENCH_KZ_CONFIG_SPAWNER        "BenchSpawner"        /**< Object config section used by spawner benchmarks */
+#define orxBENCH_KZ_CONFIG_PARTICLESYSTEM "BenchParticleSystem" /**< Object config section used by particle system benchmarks */
+#define orxBENCH_KZ_CONFIG_TILE           "BenchTile"           /**< Object config section used by tile benchmarks */
+
+#define orxBENCH_KU32_RUN_NUMBER          5                     /**< Runs per benchmark, best one is kept */
+#define orxBENCH_KU32_KEY_NUMBER          65536                 /**< Hash table keys / bank cells */
+#define orxBENCH_KU32_TABLE_SIZE          16384                 /**< Hash table initial size */
+#define orxBENCH_KU32_STRING_NUMBER       4096                  /**< Strings for ID/CRC benchmarks */
+#define orxBENCH_KU32_CONFIG_KEY_NUMBER   64                    /**< Config keys */
+#define orxBENCH_KU32_FRAME_DEPTH         4                     /**< Frame chain depth */
+#define orxBENCH_KU32_FRAME_NUMBER        1024                  /**< Frame chains */
+#define orxBENCH_KU32_OBJECT_NUMBER       4096                  /**< Objects */
+#define orxBENCH_KU32_CHURNED_NUMBER      50000                 /**< Objects used by storage comparisons */
+#define orxBENCH_KU32_GUID_NUMBER         16384                 /**< Structures resolved from GUIDs */
+#define orxBENCH_KU32_THREAD_NUMBER       4                     /**< Threads used by concurrent checks */
+#define orxBENCH_KU32_LOG_NUMBER          250000                /**< Lines logged per thread by log checks */
+#define orxBENCH_KU32_INTERN_THREAD_NUMBER 8                    /**< Threads used by the large string interning check */
+#define orxBENCH_KU32_INTERN_NUMBER       1000000               /**< Strings interned by the large string interning check */
+#define orxBENCH_KU32_MARKER_NUMBER       2048                  /**< Distinct profiler markers */
+#define orxBENCH_KU32_CHURN_NUMBER        4096                  /**< Blocks allocated per level by memory churn benchmarks */
+#define orxBENCH_KU32_CHURN_PERSISTENT    1024                  /**< Long-lived blocks kept across levels by memory churn benchmarks */
+#define orxBENCH_KU32_PARTICLE_NUMBER     10000                 /**< Live particles */
+#define orxBENCH_KU32_ANIMATED_NUMBER     10000                 /**< Live animated objects */
+#define orxBENCH_KU32_TILEMAP_SIZE        512                   /**< Tile grid width & height */
+#define orxBENCH_KU32_TILE_BLOCK_SIZE     128                   /**< Tile grid block width & height, when made of objects (structure item IDs cap live objects to 65536) */
+#define orxBENCH_KU32_SAMPLING_FREQUENCY  1000                  /**< Sampling profiler frequency */
+#define orxBENCH_KF_FRAME_DT              orx2F(1.0f / 60.0f)   /**< Fixed DT used when updating scenes */
+#define orxBENCH_KU32_RESULT_NUMBER       128                   /**< Maximum number of results */
+
+
+/***************************************************************************
+ * Structure declaration                                                   *
+ ***************************************************************************/
+
+/** Benchmark function: runs _u32Count operations and returns the time they took (setup excluded)
+ */
+typedef orxDOUBLE (orxFASTCALL *orxBENCH_FUNCTION)(orxU32 _u32Count);
+
+/** Check function
+ */
+typedef orxSTATUS (orxFASTCALL *orxBENCH_CHECK_FUNCTION)();
+
+/** Benchmark
+ */
+typedef struct __orxBENCH_t
+{
+  const orxSTRING         zName;
+  orxBENCH_FUNCTION       pfnRun;
+  orxU32                  u32Count;
+  orxMODULE_ID            eModuleID;                    /**< Scene module initialized on demand, orxMODULE_ID_NONE for core only */
+
+} orxBENCH;
+
+/** Check
+ */
+typedef struct __orxBENCH_CHECK_t
+{
+  const orxSTRING         zName;
+  orxBENCH_CHECK_FUNCTION pfnRun;
+  orxMODULE_ID            eModuleID;                    /**< Scene module initialized on demand, orxMODULE_ID_NONE for core only */
+
+} orxBENCH_CHECK;
+
+/** Benchmark result
+ */
+typedef struct __orxBENCH_RESULT_t
+{
+  const orxSTRING         zName;
+  orxU32                  u32Count;
+  orxDOUBLE               dBestTime;
+  orxDOUBLE               dMeanTime;
+
+} orxBENCH_RESULT;
+
+/** Check result
+ */
+typedef struct __orxBENCH_CHECK_RESULT_t
+{
+  const orxSTRING         zName;
+  orxBOOL                 bPassed;
+  orxDOUBLE               dTime;
+
+} orxBENCH_CHECK_RESULT;
+
+/** Static structure
+ */
+typedef struct __orxBENCH_STATIC_t
+{
+  orxBENCH_RESULT         astResultList[orxBENCH_KU32_RESULT_NUMBER];
+  orxBENCH_CHECK_RESULT   astCheckResultList[orxBENCH_KU32_RESULT_NUMBER];
+  orxCHAR                 aacStringList[orxBENCH_KU32_STRING_NUMBER][32];
+  orxCHAR                 aacKeyList[orxBENCH_KU32_CONFIG_KEY_NUMBER][16];
+  orxCHAR                 acBuffer[4096];
+  orxU32                  au32IDList[orxBENCH_KU32_THREAD_NUMBER][orxBENCH_KU32_STRING_NUMBER];
+  void                   *apCellList[orxBENCH_KU32_KEY_NUMBER];
+  orxBANK                *pstSharedBank;
+  orxU32                  au32LiveList[orxBENCH_KU32_THREAD_NUMBER];
+  orxU32                 *au32InternIDList;
+  orxS32                  as32MarkerList[orxBENCH_KU32_MARKER_NUMBER];
+  const orxSTRING         zResultFile;
+  const orxSTRING         zPrefix;
+  orxU32                  u32ResultCount;
+  orxU32                  u32CheckCount;
+  orxU32                  u32FailureCount;
+  volatile orxU32         u32EventCount;
+
+} orxBENCH_STATIC;
+
+
+/***************************************************************************
+ * Static variables                                                        *
+ ***************************************************************************/
+
+/** Static data
+ */
+static orxBENCH_STATIC sstBench;
+
+
+/***************************************************************************
+ * Private functions                                                       *
+ ***************************************************************************/
+
+/** Gets a pseudo-random value (xorshift, deterministic across platforms)
+ */
+static orxINLINE orxU32 orxBench_GetRandom(orxU32 *_pu32Seed)
+{
+  orxU32 u32Value;
+
+  /* Updates seed */
+  u32Value = *_pu32Seed;
+  u32Value ^= u32Value << 13;
+  u32Value ^= u32Value >> 17;
+  u32Value ^= u32Value << 5;
+  *_pu32Seed = u32Value;
+
+  /* Done! */
+  return u32Value;
+}
+
+/** Gets a hash table key from an index
+ */
+static orxINLINE orxU64 orxBench_GetKey(orxU32 _u32Index)
+{
+  /* Done! */
+  return (orxU64)(_u32Index + 1) * 2654435761u;
+}
+
+/** Event handler
+ */
+static orxSTATUS orxFASTCALL orxBench_EventHandler(const orxEVENT *_pstEvent)
+{
+  /* Updates count */
+  sstBench.u32EventCount++;
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
+/** Benchmark: hash table insertions, for a given layout
+ */
+static orxDOUBLE orxFASTCALL orxBench_HashTableAdd(orxU32 _u32Count, orxU32 _u32Flags)
+{
+  orxHASHTABLE *pstTable;
+  orxDOUBLE     dTime;
+  orxU32        i;
+
+  /* Creates table */
+  pstTable = orxHashTable_Create(orxBENCH_KU32_TABLE_SIZE, _u32Flags, orxMEMORY_TYPE_TEMP);
+
+  /* Inserts keys */
+  dTime = orxSystem_GetTime();
+  for(i = 0; i < _u32Count; i++)
+  {
+    orxHashTable_Add(pstTable, orxBench_GetKey(i), (void *)(size_t)(i + 1));
+  }
+  dTime = orxSystem_GetTime() - dTime;
+
+  /* Deletes table */
+  orxHashTable_Delete(pstTable);
+
+  /* Done! */
+  return dTime;
+}
+
+/** Benchmark: hash table lookups, for a given layout & key number
+ */
+static orxDOUBLE orxFASTCALL orxBench_HashTableGet(orxU32 _u32Count, orxU32 _u32Flags, orxU32 _u32KeyNumber)
+{
+  orxHASHTABLE   *pstTable;
+  orxDOUBLE       dTime;
+  volatile orxU32 u32Sum = 0;
+  orxU32          i;
+
+  /* Creates & fills table */
+  pstTable = orxHashTable_Create(orxBENCH_KU32_TABLE_SIZE, _u32Flags, orxMEMORY_TYPE_TEMP);
+  for(i = 0; i < _u32KeyNumber; i++)
+  {
+    orxHashTable_Add(pstTable, orxBench_GetKey(i), (void *)(size_t)(i + 1));
+  }
+
+  /* Looks keys up */
+  dTime = orxSystem_GetTime();
+  for(i = 0; i < _u32Count; i++)
+  {
+    u32Sum += (orxU32)(size_t)orxHashTable_Get(pstTable, orxBench_GetKey((i * 7919) % _u32KeyNumber));
+  }
+  dTime = orxSystem_GetTime() - dTime;
+
+  /* Deletes table */
+  orxHashTable_Delete(pstTable);
+
+  /* Done! */
+  return dTime;
+}
+
+static orxDOUBLE orxFASTCALL orxBench_HashTableAddChained(orxU32 _u32Count)  {return orxBench_HashTableAdd(_u32Count, orxHASHTABLE_KU32_FLAG_NONE);}
+static orxDOUBLE orxFASTCALL orxBench_HashTableAddOpen(orxU32 _u32Count)     {return orxBench_HashTableAdd(_u32Count, orxHASHTABLE_KU32_FLAG_OPEN_ADDRESSING);}
+static orxDOUBLE orxFASTCALL orxBench_HashTableGetChained(orxU32 _u32Count)  {return orxBench_HashTableGet(_u32Count, orxHASHTABLE_KU32_FLAG_NONE, orxBENCH_KU32_KEY_NUMBER);}
+static orxDOUBLE orxFASTCALL orxBench_HashTableGetOpen(orxU32 _u32Count)     {return orxBench_HashTableGet(_u32Count, orxHASHTABLE_KU32_FLAG_OPEN_ADDRESSING, orxBENCH_KU32_KEY_NUMBER);}
+static orxDOUBLE orxFASTCALL orxBench_HashTableGetChained1K(orxU32 _u32Count)   {return orxBench_HashTableGet(_u32Count, orxHASHTABLE_KU32_FLAG_NONE, 1000);}
+static orxDOUBLE orxFASTCALL orxBench_HashTableGetOpen1K(orxU32 _u32Count)      {return orxBench_HashTableGet(_u32Count, orxHASHTABLE_KU32_FLAG_OPEN_ADDRESSING, 1000);}
+static orxDOUBLE orxFASTCALL orxBench_HashTableGetChained100K(orxU32 _u32Count) {return orxBench_HashTableGet(_u32Count, orxHASHTABLE_KU32_FLAG_NONE, 100000);}
+static orxDOUBLE orxFASTCALL orxBench_HashTableGetOpen100K(orxU32 _u32Count)    {return orxBench_HashTableGet(_u32Count, orxHASHTABLE_KU32_FLAG_OPEN_ADDRESSING, 100000);}
+static orxDOUBLE orxFASTCALL orxBench_HashTableGetChained1M(orxU32 _u32Count)   {return orxBench_HashTableGet(_u32Count, orxHASHTABLE_KU32_FLAG_NONE, 1000000);}
+static orxDOUBLE orxFASTCALL orxBench_HashTableGetOpen1M(orxU32 _u32Count)      {return orxBench_HashTableGet(_u32Count, orxHASHTABLE_KU32_FLAG_OPEN_ADDRESSING, 1000000);}
+
+/** Benchmark: bank allocations & frees (one allocation + one free per operation), for given flags
+ */
+static orxDOUBLE orxFASTCALL orxBench_Bank(orxU32 _u32Count, orxU32 _u32Flags)
+{
+  orxBANK  *pstBank;
+  orxDOUBLE dTime;
+  orxU32    i, j, u32Seed = 0x12345678;
+
+  /* Creates bank */
+  pstBank = orxBank_Create(256, 32, _u32Flags, orxMEMORY_TYPE_TEMP);
+
+  /* Fills half of it */
+  for(i = 0; i < orxBENCH_KU32_KEY_NUMBER; i++)
+  {
+    sstBench.apCellList[i] = (i & 1) ? orxBank_Allocate(pstBank) : orxNULL;
+  }
+
+  /* Allocates/frees at random places */
+  dTime = orxSystem_GetTime();
+  for(i = 0, j = 0; i < _u32Count; j++)
+  {
+    void **ppCell;
+
+    /* Gets random cell */
+    ppCell = &(sstBench.apCellList[orxBench_GetRandom(&u32Seed) & (orxBENCH_KU32_KEY_NUMBER - 1)]);
+
+    /* Allocated? */
+    if(*ppCell != orxNULL)
+    {
+      /* Frees it */
+      orxBank_Free(pstBank, *ppCell);
+      *ppCell = orxNULL;
+      i++;
+    }
+    else
+    {
+      /* Allocates it */
+      *ppCell = orxBank_Allocate(pstBank);
+    }
+  }
+  dTime = orxSystem_GetTime() - dTime;
+
+  /* Deletes bank */
+  orxBank_Delete(pstBank);
+
+  /* Done! */
+  return dTime;
+}
+
+static orxDOUBLE orxFASTCALL orxBench_BankDefault(orxU32 _u32Count)           {return orxBench_Bank(_u32Count, orxBANK_KU32_FLAG_NONE);}
+static orxDOUBLE orxFASTCALL orxBench_BankThreadSafe(orxU32 _u32Count)        {return orxBench_Bank(_u32Count, orxBANK_KU32_FLAG_THREAD_SAFE);}
+
+/** Benchmark: bank cell lookups from indices, across thousands of segments
+ */
+static orxDOUBLE orxFASTCALL orxBench_BankGetAtIndex(orxU32 _u32Count)
+{
+  orxBANK        *pstBank;
+  orxDOUBLE       dTime;
+  volatile size_t uSum = 0;
+  orxU32          i, u32Seed = 0x2545F491;
+
+  /* Creates bank with small segments & fills it */
+  pstBank = orxBank_Create(16, sizeof(orxU32), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_TEMP);
+  for(i = 0; i < orxBENCH_KU32_KEY_NUMBER; i++)
+  {
+    orxBank_Allocate(pstBank);
+  }
+
+  /* Gets cells at random indices */
+  dTime = orxSystem_GetTime();
+  for(i = 0; i < _u32Count; i++)
+  {
+    uSum += (size_t)orxBank_GetAtIndex(pstBank, orxBench_GetRandom(&u32Seed) & (orxBENCH_KU32_KEY_NUMBER - 1));
+  }
+  dTime = orxSystem_GetTime() - dTime;
+
+  /* Deletes bank */
+  orxBank_Delete(pstBank);
+
+  /* Done! */
+  return dTime;
+}
+
+/** Benchmark: string IDs of already interned strings
+ */
+static orxDOUBLE orxFASTCALL orxBench_StringGetID(orxU32 _u32Count)
+{
+  orxDOUBLE       dTime;
+  volatile orxU32 u32Sum = 0;
+  orxU32          i;
+
+  /* Interns all strings */
+  for(i = 0; i < orxBENCH_KU32_STRING_NUMBER; i++)
+  {
+    orxString_GetID(sstBench.aacStringList[i]);
+  }
+
+  /* Gets their IDs */
+  dTime = orxSystem_GetTime();
+  for(i = 0; i < _u32Count; i++)
+  {
+    u32Sum += orxString_GetID(sstBench.aacStringList[i & (orxBENCH_KU32_STRING_NUMBER - 1)]);
+  }
+  dTime = orxSystem_GetTime() - dTime;
+
+  /* Done! */
+  return dTime;
+}
+
+/** Benchmark: CRCs of short strings
+ */
+static orxDOUBLE orxFASTCALL orxBench_StringToCRC(orxU32 _u32Count)
+{
+  orxDOUBLE       dTime;
+  volatile orxU32 u32Sum = 0;
+  orxU32          i;
+
+  /* Computes CRCs */
+  dTime = orxSystem_GetTime();
+  for(i = 0; i < _u32Count; i++)
+  {
+    u32Sum += orxString_ToCRC(sstBench.aacStringList[i & (orxBENCH_KU32_STRING_NUMBER - 1)]);
+  }
+  dTime = orxSystem_GetTime() - dTime;
+
+  /* Done! */
+  return dTime;
+}
+
+/** Benchmark: CRCs of short keys (8 to 32 characters)
+ */
+static orxDOUBLE orxFASTCALL orxBench_StringNToCRCShort(orxU32 _u32Count)
+{
+  orxDOUBLE       dTime;
+  volatile orxU32 u32Sum = 0;
+  orxU32          i;
+
+  /* Computes CRCs */
+  dTime = orxSystem_GetTime();
+  for(i = 0; i < _u32Count; i++)
+  {
+    u32Sum += orxString_NToCRC(sstBench.acBuffer + (i & 255), 8 + (i % 25));
+  }
+  dTime = orxSystem_GetTime() - dTime;
+
+  /* Done! */
+  return dTime;
+}
+
+/** Benchmark: CRCs of long buffers (one whole buffer per operation)
+ */
+static orxDOUBLE orxFASTCALL orxBench_StringNToCRCLong(orxU32 _u32Count)
+{
+  orxDOUBLE       dTime;
+  volatile orxU32 u32Sum = 0;
+  orxU32          i;
+
+  /* Computes CRCs */
+  dTime = orxSystem_GetTime();
+  for(i = 0; i < _u32Count; i++)
+  {
+    u32Sum += orxString_NToCRC(sstBench.acBuffer, sizeof(sstBench.acBuffer));
+  }
+  dTime = orxSystem_GetTime() - dTime;
+
+  /* Done! */
+  return dTime;
+}
+
+/** Benchmark: config value lookups
+ */
+static orxDOUBLE orxFASTCALL orxBench_ConfigGetU32(orxU32 _u32Count)
+{
+  orxDOUBLE       dTime;
+  volatile orxU32 u32Sum = 0;
+  orxU32          i;
+
+  /* Pushes section */
+  orxConfig_PushSection(orxBENCH_KZ_CONFIG_SECTION);
+
+  /* Gets values */
+  dTime = orxSystem_GetTime();
+  for(i = 0; i < _u32Count; i++)
+  {
+    u32Sum += orxConfig_GetU32(sstBench.aacKeyList[i & (orxBENCH_KU32_CONFIG_KEY_NUMBER - 1)]);
+  }
+  dTime = orxSystem_GetTime() - dTime;
+
+  /* Pops section */
+  orxConfig_PopSection();
+
+  /* Done! */
+  return dTime;
+}
+
+/** Benchmark: command evaluation (parsing + config lookup)
+ */
+static orxDOUBLE orxFASTCALL orxBench_CommandEvaluate(orxU32 _u32Count)
+{
+  orxCHAR         acBuffer[64];
+  orxCOMMAND_VAR  stResult;
+  orxDOUBLE       dTime;
+  orxU32          i;
+
+  /* Evaluates commands */
+  dTime = orxSystem_GetTime();
+  for(i = 0; i < _u32Count; i++)
+  {
+    /* Evaluation consumes its input */
+    orxString_NPrint(acBuffer, sizeof(acBuffer) - 1, "Config.GetValue " orxBENCH_KZ_CONFIG_SECTION " %s", sstBench.aacKeyList[i & (orxBENCH_KU32_CONFIG_KEY_NUMBER - 1)]);
+    orxCommand_Evaluate(acBuffer, &stResult);
+  }
+  dTime = orxSystem_GetTime() - dTime;
+
+  /* Done! */
+  return dTime;
+}
+
+/** Benchmark: event sending to a single handler
+ */
+static orxDOUBLE orxFASTCALL orxBench_EventSend(orxU32 _u32Count)
+{
+  orxDOUBLE dTime;
+  orxU32    i;
+
+  /* Adds handler */
+  orxEvent_AddHandler(orxEVENT_TYPE_USER_DEFINED, orxBench_EventHandler);
+
+  /* Sends events */
+  dTime = orxSystem_GetTime();
+  for(i = 0; i < _u32Count; i++)
+  {
+    orxEVENT_SEND(orxEVENT_TYPE_USER_DEFINED, i & 0xFF, orxNULL, orxNULL, orxNULL);
+  }
+  dTime = orxSystem_GetTime() - dTime;
+
+  /* Removes handler */
+  orxEvent_RemoveHandler(orxEVENT_TYPE_USER_DEFINED, orxBench_EventHandler);
+
+  /* Done! */
+  return dTime;
+}
+
+/** Creates frame chains
+ */
+static void orxFASTCALL orxBench_CreateFrames(orxFRAME **_apstRootList, orxFRAME **_apstLeafList)
+{
+  orxU32 i, j;
+
+  /* For all chains */
+  for(i = 0; i < orxBENCH_KU32_FRAME_NUMBER; i++)
+  {
+    orxVECTOR vPosition;
+
+    /* Creates root */
+    _apstRootList[i] = _apstLeafList[i] = orxFrame_Create(orxFRAME_KU32_FLAG_NONE);
+
+    /* Creates children */
+    orxVector_Set(&vPosition, orx2F(1.0f), orx2F(2.0f), orxFLOAT_0);
+    for(j = 1; j < orxBENCH_KU32_FRAME_DEPTH; j++)
+    {
+      orxFRAME *pstFrame;
+
+      pstFrame = orxFrame_Create(orxFRAME_KU32_FLAG_NONE);
+      orxFrame_SetParent(pstFrame, _apstLeafList[i]);
+      orxFrame_SetPosition(pstFrame, orxFRAME_SPACE_LOCAL, &vPosition);
+      orxFrame_SetRotation(pstFrame, orxFRAME_SPACE_LOCAL, orx2F(0.1f));
+      _apstLeafList[i] = pstFrame;
+    }
+  }
+}
+
+/** Deletes frame chains
+ */
+static void orxFASTCALL orxBench_DeleteFrames(orxFRAME **_apstLeafList)
+{
+  orxU32 i;
+
+  /* For all chains */
+  for(i = 0; i < orxBENCH_KU32_FRAME_NUMBER; i++)
+  {
+    orxFRAME *pstFrame, *pstParent;
+
+    /* Deletes from leaf to root */
+    for(pstFrame = _apstLeafList[i]; pstFrame != orxNULL; pstFrame = pstParent)
+    {
+      pstParent = orxFrame_GetParent(pstFrame);
+      orxFrame_Delete(pstFrame);
+    }
+  }
+}
+
+/** Benchmark: frame hierarchy update (moves a root then gets its leaf's global position)
+ */
+static orxDOUBLE orxFASTCALL orxBench_FrameUpdate(orxU32 _u32Count)
+{
+  orxFRAME  *apstRootList[orxBENCH_KU32_FRAME_NUMBER], *apstLeafList[orxBENCH_KU32_FRAME_NUMBER];
+  orxVECTOR  vPosition;
+  orxDOUBLE  dTime;
+  orxU32     i;
+
+  /* Creates frames */
+  orxBench_CreateFrames(apstRootList, apstLeafList);
+
+  /* Updates them */
+  dTime = orxSystem_GetTime();
+  for(i = 0; i < _u32Count; i++)
+  {
+    orxU32 u32Index;
+
+    u32Index = i & (orxBENCH_KU32_FRAME_NUMBER - 1);
+    orxVector_Set(&vPosition, orxU2F(i & 0xFF), orxFLOAT_1, orxFLOAT_0);
+    orxFrame_SetPosition(apstRootList[u32Index], orxFRAME_SPACE_LOCAL, &vPosition);
+    orxFrame_GetPosition(apstLeafList[u32Index], orxFRAME_SPACE_GLOBAL, &vPosition);
+  }
+  dTime = orxSystem_GetTime() - dTime;
+
+  /* Deletes frames */
+  orxBench_DeleteFrames(apstLeafList);
+
+  /* Done! */
+  return dTime;
+}
+
+/** Creates objects with a given storage type, deletes & recreates some of them, then compacts their storage, as done by every object update
+ */
+static orxOBJECT **orxFASTCALL orxBench_CreateChurnedObjects(orxU32 _u32ObjectNumber, orxSTRUCTURE_STORAGE_TYPE _eStorageType, const orxSTRING _zConfigID)
+{
+  orxOBJECT **apstResult;
+  orxU32      i;
+
+  /* Uses requested storage */
+  orxStructure_SetStorageType(orxSTRUCTURE_ID_OBJECT, _eStorageType);
+
+  /* Allocates object list */
+  apstResult = (orxOBJECT **)orxMemory_Allocate(_u32ObjectNumber * sizeof(orxOBJECT *), orxMEMORY_TYPE_TEMP);
+
+  /* Creates objects */
+  for(i = 0; i < _u32ObjectNumber; i++)
+  {
+    apstResult[i] = (_zConfigID != orxNULL) ? orxObject_CreateFromConfig(_zConfigID) : orxObject_Create();
+  }
+
+  /* Deletes & recreates some of them */
+  for(i = 0; i < _u32ObjectNumber; i += 3)
+  {
+    orxObject_Delete(apstResult[i]);
+  }
+  for(i = 0; i < _u32ObjectNumber; i += 3)
+  {
+    apstResult[i] = (_zConfigID != orxNULL) ? orxObject_CreateFromConfig(_zConfigID) : orxObject_Create();
+  }
+
+  /* Compacts their storage */
+  orxStructure_Compact(orxSTRUCTURE_ID_OBJECT);
+
+  /* Done! */
+  return apstResult;
+}
+
+/** Deletes objects created with orxBench_CreateChurnedObjects & restores the default object storage
+ */
+static void orxFASTCALL orxBench_DeleteChurnedObjects(orxOBJECT **_apstObjectList, orxU32 _u32ObjectNumber)
+{
+  orxU32 i;
+
+  /* Deletes objects */
+  for(i = 0; i < _u32ObjectNumber; i++)
+  {
+    orxObject_Delete(_apstObjectList[i]);
+  }
+  orxMemory_Free(_apstObjectList);
+
+  /* Restores default storage */
+  orxStructure_SetStorageType(orxSTRUCTURE_ID_OBJECT, orxSTRUCTURE_STORAGE_TYPE_ARRAY);
+
+  /* Done! */
+  return;
+}
+
+/** Benchmark: structure iteration over objects, after some churn & a compaction (one structure visited per operation)
+ */
+static orxDOUBLE orxFASTCALL orxBench_StructureIterate(orxU32 _u32Count, orxU32 _u32ObjectNumber, orxSTRUCTURE_STORAGE_TYPE _eStorageType)
+{
+  orxOBJECT     **apstObjectList;
+  orxDOUBLE       dTime;
+  volatile orxU32 u32Sum = 0;
+  orxU32          i;
+
+  /* Creates objects */
+  apstObjectList = orxBench_CreateChurnedObjects(_u32ObjectNumber, _eStorageType, orxNULL);
+
+  /* Iterates over them */
+  dTime = orxSystem_GetTime();
+  for(i = 0; i < _u32Count;)
+  {
+    orxSTRUCTURE *pstStructure;
+
+    for(pstStructure = orxStructure_GetFirst(orxSTRUCTURE_ID_OBJECT);
+        (pstStructure != orxNULL) && (i < _u32Count);
+        pstStructure = orxStructure_GetNext(pstStructure), i++)
+    {
+      u32Sum += orxStructure_GetFlags(pstStructure, 0xFFFFFFFF);
+    }
+  }
+  dTime = orxSystem_GetTime() - dTime;
+
+  /* Deletes objects */
+  orxBench_DeleteChurnedObjects(apstObjectList, _u32ObjectNumber);
+
+  /* Done! */
+  return dTime;
+}
+
+static orxDOUBLE orxFASTCALL orxBench_StructureIterateDefault(orxU32 _u32Count) {return orxBench_StructureIterate(_u32Count, orxBENCH_KU32_OBJECT_NUMBER, orxSTRUCTURE_STORAGE_TYPE_ARRAY);}
+static orxDOUBLE orxFASTCALL orxBench_StructureIterate50K(orxU32 _u32Count)     {return orxBench_StructureIterate(_u32Count, orxBENCH_KU32_CHURNED_NUMBER, orxSTRUCTURE_STORAGE_TYPE_ARRAY);}
+static orxDOUBLE orxFASTCALL orxBench_StructureIterate50KList(orxU32 _u32Count) {return orxBench_StructureIterate(_u32Count, orxBENCH_KU32_CHURNED_NUMBER, orxSTRUCTURE_STORAGE_TYPE_LINKLIST);}
+
+/** Benchmark: object update (orxObject_UpdateAll), after some churn & a compaction (one object update per operation, a frame every orxBENCH_KU32_CHURNED_NUMBER)
+ */
+static orxDOUBLE orxFASTCALL orxBench_ObjectUpdate(orxU32 _u32Count, orxSTRUCTURE_STORAGE_TYPE _eStorageType)
+{
+  orxOBJECT **apstObjectList;
+  orxCLOCK   *pstClock;
+  orxDOUBLE   dTime;
+  orxU32      i;
+
+  /* Fixes core clock's DT */
+  pstClock = orxClock_FindFirst(orx2F(-1.0f), orxCLOCK_TYPE_CORE);
+  orxClock_SetModifier(pstClock, orxCLOCK_MOD_TYPE_FIXED, orxBENCH_KF_FRAME_DT);
+
+  /* Creates objects with a frame & a graphic */
+  apstObjectList = orxBench_CreateChurnedObjects(orxBENCH_KU32_CHURNED_NUMBER, _eStorageType, orxBENCH_KZ_CONFIG_TILE);
+
+  /* Updates frames */
+  dTime = orxSystem_GetTime();
+  for(i = 0; i < _u32Count; i += orxBENCH_KU32_CHURNED_NUMBER)
+  {
+    orxClock_Update();
+  }
+  dTime = orxSystem_GetTime() - dTime;
+
+  /* Deletes objects */
+  orxBench_DeleteChurnedObjects(apstObjectList, orxBENCH_KU32_CHURNED_NUMBER);
+
+  /* Restores core clock's DT */
+  orxClock_SetModifier(pstClock, orxCLOCK_MOD_TYPE_NONE, orxFLOAT_0);
+
+  /* Done! */
+  return dTime;
+}
+
+static orxDOUBLE orxFASTCALL orxBench_ObjectUpdate50K(orxU32 _u32Count)        {return orxBench_ObjectUpdate(_u32Count, orxSTRUCTURE_STORAGE_TYPE_ARRAY);}
+static orxDOUBLE orxFASTCALL orxBench_ObjectUpdate50KList(orxU32 _u32Count)    {return orxBench_ObjectUpdate(_u32Count, orxSTRUCTURE_STORAGE_TYPE_LINKLIST);}
+
+/** Benchmark: structure lookups from GUIDs (frames)
+ */
+static orxDOUBLE orxFASTCALL orxBench_StructureGet(orxU32 _u32Count)
+{
+  orxU64         *au64GUIDList;
+  orxDOUBLE       dTime;
+  volatile size_t uSum = 0;
+  orxU32          i, u32Seed = 0x9E3779B9;
+
+  /* Creates frames & stores their GUIDs */
+  au64GUIDList = (orxU64 *)orxMemory_Allocate(orxBENCH_KU32_GUID_NUMBER * sizeof(orxU64), orxMEMORY_TYPE_TEMP);
+  for(i = 0; i < orxBENCH_KU32_GUID_NUMBER; i++)
+  {
+    au64GUIDList[i] = orxStructure_GetGUID(orxFrame_Create(orxFRAME_KU32_FLAG_NONE));
+  }
+
+  /* Gets them at random */
+  dTime = orxSystem_GetTime();
+  for(i = 0; i < _u32Count; i++)
+  {
+    uSum += (size_t)orxStructure_Get(au64GUIDList[orxBench_GetRandom(&u32Seed) & (orxBENCH_KU32_GUID_NUMBER - 1)]);
+  }
+  dTime = orxSystem_GetTime() - dTime;
+
+  /* Deletes frames */
+  for(i = 0; i < orxBENCH_KU32_GUID_NUMBER; i++)
+  {
+    orxFrame_Delete(orxFRAME(orxStructure_Get(au64GUIDList[i])));
+  }
+  orxMemory_Free(au64GUIDList);
+
+  /* Done! */
+  return dTime;
+}
+
+/** Benchmark: a level load/unload, mixing short-lived config, text & temp blocks with long-lived ones (one level per operation)
+ */
+static orxDOUBLE orxFASTCALL orxBench_MemoryChurn(orxU32 _u32Count)
+{
+  static const orxMEMORY_TYPE saeTypeList[] = {orxMEMORY_TYPE_CONFIG, orxMEMORY_TYPE_TEXT, orxMEMORY_TYPE_TEMP, orxMEMORY_TYPE_MAIN};
+  void     *apPersistentList[orxBENCH_KU32_CHURN_PERSISTENT];
+  orxDOUBLE dTime;
+  orxU32    i, j, u32Seed = 0x600DF00D;
+
+  /* Clears long-lived blocks */
+  orxMemory_Zero(apPersistentList, sizeof(apPersistentList));
+
+  /* For all levels */
+  dTime = orxSystem_GetTime();
+  for(i = 0; i < _u32Count; i++)
+  {
+    /* Loads level */
+    for(j = 0; j < orxBENCH_KU32_CHURN_NUMBER; j++)
+    {
+      orxU32 u32Random;
+
+      u32Random = orxBench_GetRandom(&u32Seed);
+      sstBench.apCellList[j] = orxMemory_Allocate(16 + (u32Random & 1023), saeTypeList[(u32Random >> 10) & 3]);
+    }
+
+    /* Replaces some long-lived blocks */
+    for(j = 0; j < orxBENCH_KU32_CHURN_NUMBER / 16; j++)
+    {
+      void **ppBlock;
+
+      ppBlock = &(apPersistentList[orxBench_GetRandom(&u32Seed) & (orxBENCH_KU32_CHURN_PERSISTENT - 1)]);
+      if(*ppBlock != orxNULL)
+      {
+        orxMemory_Free(*ppBlock);
+      }
+      *ppBlock = orxMemory_Allocate(64 + (j & 255), orxMEMORY_TYPE_MAIN);
+    }
+
+    /* Unloads level */
+    for(j = 0; j < orxBENCH_KU32_CHURN_NUMBER; j++)
+    {
+      orxMemory_Free(sstBench.apCellList[j]);
+    }
+  }
+  dTime = orxSystem_GetTime() - dTime;
+
+  /* Frees long-lived blocks */
+  for(i = 0; i < orxBENCH_KU32_CHURN_PERSISTENT; i++)
+  {
+    if(apPersistentList[i] != orxNULL)
+    {
+      orxMemory_Free(apPersistentList[i]);
+    }
+  }
+
+  /* Done! */
+  return dTime;
+}
+
+/** Benchmark: profiler marker push/pop pairs
+ */
+static orxDOUBLE orxFASTCALL orxBench_ProfilerMarker(orxU32 _u32Count)
+{
+  orxDOUBLE dTime;
+  orxS32    s32MarkerID;
+  orxU32    i;
+
+  /* Gets marker */
+  s32MarkerID = orxProfiler_GetIDFromName("orxBench");
+
+  /* Pushes/pops it */
+  dTime = orxSystem_GetTime();
+  for(i = 0; i < _u32Count; i++)
+  {
+    orxProfiler_PushMarker(s32MarkerID);
+    orxProfiler_PopMarker();
+  }
+  dTime = orxSystem_GetTime() - dTime;
+
+  /* Resets markers */
+  orxProfiler_ResetAllMarkers();
+
+  /* Done! */
+  return dTime;
+}
+
+/** Benchmark: profiler marker push/pop pairs, spread over thousands of markers
+ */
+static orxDOUBLE orxFASTCALL orxBench_ProfilerMarkerSparse(orxU32 _u32Count)
+{
+  orxDOUBLE dTime;
+  orxU32    i;
+
+  /* Gets markers */
+  for(i = 0; i < orxBENCH_KU32_MARKER_NUMBER; i++)
+  {
+    orxCHAR acName[32];
+
+    orxString_NPrint(acName, sizeof(acName) - 1, "orxBench/Marker%u", i);
+    sstBench.as32MarkerList[i] = orxProfiler_GetIDFromName(acName);
+  }
+
+  /* Pushes/pops them */
+  dTime = orxSystem_GetTime();
+  for(i = 0; i < _u32Count; i++)
+  {
+    orxProfiler_PushMarker(sstBench.as32MarkerList[(i * 7) & (orxBENCH_KU32_MARKER_NUMBER - 1)]);
+    orxProfiler_PopMarker();
+  }
+  dTime = orxSystem_GetTime() - dTime;
+
+  /* Resets markers */
+  orxProfiler_ResetAllMarkers();
+
+  /* Done! */
+  return dTime;
+}
+
+/** Benchmark: CRCs of long buffers while the sampling profiler is running (compare with String.NToCRC.Long to get its cost)
+ */
+static orxDOUBLE orxFASTCALL orxBench_ProfilerSampling(orxU32 _u32Count)
+{
+  orxDOUBLE dTime;
+  orxSTATUS eSampling;
+
+  /* Starts sampling (Linux only) */
+  eSampling = orxProfiler_StartSampling(orxBENCH_KU32_SAMPLING_FREQUENCY);
+
+  /* Computes CRCs */
+  dTime = orxBench_StringNToCRCLong(_u32Count);
+
+  /* Was sampling? */
+  if(eSampling != orxSTATUS_FAILURE)
+  {
+    /* Stops it */
+    orxProfiler_StopSampling();
+  }
+
+  /* Done! */
+  return dTime;
+}
+
+/** Benchmark: log lines to file (caller side)
+ */
+static orxDOUBLE orxFASTCALL orxBench_LogFile(orxU32 _u32Count)
+{
+  orxDOUBLE dTime;
+  orxU32    u32DebugFlags, i;
+
+  /* Logs to file only */
+  _orxDebug_SetLogFile(orxBENCH_KZ_LOG_FILE);
+  u32DebugFlags = _orxDebug_GetFlags();
+  _orxDebug_SetFlags(orxDEBUG_KU32_STATIC_FLAG_FILE, orxDEBUG_KU32_STATIC_MASK_USER_ALL);
+
+  /* Logs lines */
+  dTime = orxSystem_GetTime();
+  for(i = 0; i < _u32Count; i++)
+  {
+    orxLOG("orxBench %u", i);
+  }
+  dTime = orxSystem_GetTime() - dTime;
+
+  /* Restores output */
+  _orxDebug_Flush();
+  _orxDebug_SetFlags(u32DebugFlags, orxDEBUG_KU32_STATIC_MASK_USER_ALL);
+  _orxDebug_SetLogFile(orxNULL);
+  orxFile_Remove(orxBENCH_KZ_LOG_FILE);
+
+  /* Done! */
+  return dTime;
+}
+
+/** Benchmark: particle effect update, with a spawner or a particle system (one particle update per operation, a frame every orxBENCH_KU32_PARTICLE_NUMBER)
+ */
+static orxDOUBLE orxFASTCALL orxBench_Particles(orxU32 _u32Count, orxBOOL _bParticleSystem)
+{
+  orxOBJECT  *pstObject;
+  orxCLOCK   *pstClock;
+  orxDOUBLE   dTime;
+  orxU32      i;
+
+  /* Fixes core clock's DT */
+  pstClock = orxClock_FindFirst(orx2F(-1.0f), orxCLOCK_TYPE_CORE);
+  orxClock_SetModifier(pstClock, orxCLOCK_MOD_TYPE_FIXED, orxBENCH_KF_FRAME_DT);
+
+  /* Creates effect, updates it once (particle systems need to know their owner) & emits all its particles */
+  if(_bParticleSystem != orxFALSE)
+  {
+    pstObject = orxObject_CreateFromConfig(orxBENCH_KZ_CONFIG_PARTICLESYSTEM);
+    orxClock_Update();
+    orxParticleSystem_Emit(orxOBJECT_GET_STRUCTURE(pstObject, PARTICLESYSTEM), orxBENCH_KU32_PARTICLE_NUMBER);
+  }
+  else
+  {
+    pstObject = orxObject_CreateFromConfig(orxBENCH_KZ_CONFIG_SPAWNER);
+    orxClock_Update();
+    orxSpawner_Spawn(orxOBJECT_GET_STRUCTURE(pstObject, SPAWNER), orxBENCH_KU32_PARTICLE_NUMBER);
+  }
+
+  /* Updates frames */
+  dTime = orxSystem_GetTime();
+  for(i = 0; i < _u32Count; i += orxBENCH_KU32_PARTICLE_NUMBER)
+  {
+    orxClock_Update();
+  }
+  dTime = orxSystem_GetTime() - dTime;
+
+  /* Deletes effect & flushes its spawned objects */
+  orxObject_Delete(pstObject);
+  orxClock_Update();
+
+  /* Restores core clock's DT */
+  orxClock_SetModifier(pstClock, orxCLOCK_MOD_TYPE_NONE, orxFLOAT_0);
+
+  /* Done! */
+  return dTime;
+}
+
+static orxDOUBLE orxFASTCALL orxBench_ParticlesSpawner(orxU32 _u32Count)      {return orxBench_Particles(_u32Count, orxFALSE);}
+static orxDOUBLE orxFASTCALL orxBench_ParticlesSystem(orxU32 _u32Count)       {return orxBench_Particles(_u32Count, orxTRUE);}
+
+/** Creates an AnimSet with two anims keyed on a frame, its loop count making anim pointers use their own link table
+ */
+static orxANIMSET *orxFASTCALL orxBench_CreateAnimSet(orxFRAME *_pstFrame, orxANIM **_apstAnimList)
+{
+  orxANIMSET *pstAnimSet;
+  orxU32      i;
+
+  /* Creates AnimSet */
+  pstAnimSet = orxAnimSet_Create(2);
+
+  /* Adds anims */
+  for(i = 0; i < 2; i++)
+  {
+    _apstAnimList[i] = orxAnim_Create(orxANIM_KU32_FLAG_2D, 1, 0);
+    orxAnim_AddKey(_apstAnimList[i], orxSTRUCTURE(_pstFrame), orxFLOAT_1);
+    orxAnimSet_AddAnim(pstAnimSet, _apstAnimList[i]);
+  }
+
+  /* Adds links: 0 -> 1 & 1 -> 1 (looping once) */
+  orxAnimSet_AddLink(pstAnimSet, 0, 1);
+  orxAnimSet_SetLinkProperty(pstAnimSet, orxAnimSet_AddLink(pstAnimSet, 1, 1), orxANIMSET_KU32_LINK_FLAG_LOOP_COUNT, 1);
+
+  /* Done! */
+  return pstAnimSet;
+}
+
+/** Deletes an AnimSet created with orxBench_CreateAnimSet, along with its anims
+ */
+static void orxFASTCALL orxBench_DeleteAnimSet(orxANIMSET *_pstAnimSet, orxANIM **_apstAnimList)
+{
+  orxU32 i;
+
+  /* Deletes AnimSet */
+  orxAnimSet_Delete(_pstAnimSet);
+
+  /* Deletes anims */
+  for(i = 0; i < 2; i++)
+  {
+    orxAnim_Delete(_apstAnimList[i]);
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Creates an animated object
+ */
+static orxOBJECT *orxFASTCALL orxBench_CreateAnimatedObject(orxANIMSET *_pstAnimSet)
+{
+  orxOBJECT *pstObject;
+
+  /* Creates object & gives it its own anim pointer */
+  pstObject = orxObject_Create();
+  orxObject_SetAnimSet(pstObject, _pstAnimSet);
+
+  /* Done! */
+  return pstObject;
+}
+
+/** Benchmark: animated object creation, orxBENCH_KU32_ANIMATED_NUMBER of them alive at once (one object per operation)
+ */
+static orxDOUBLE orxFASTCALL orxBench_AnimObjects(orxU32 _u32Count)
+{
+  orxOBJECT **apstObjectList;
+  orxANIMSET *pstAnimSet;
+  orxANIM    *apstAnimList[2];
+  orxFRAME   *pstFrame;
+  orxDOUBLE   dTime = orxDOUBLE_0;
+  orxU32      i, j;
+
+  /* Creates AnimSet */
+  pstFrame    = orxFrame_Create(orxFRAME_KU32_FLAG_NONE);
+  pstAnimSet  = orxBench_CreateAnimSet(pstFrame, apstAnimList);
+
+  /* Allocates object list */
+  apstObjectList = (orxOBJECT **)orxMemory_Allocate(orxBENCH_KU32_ANIMATED_NUMBER * sizeof(orxOBJECT *), orxMEMORY_TYPE_TEMP);
+
+  /* For all batches */
+  for(i = 0; i < _u32Count; i += orxBENCH_KU32_ANIMATED_NUMBER)
+  {
+    orxDOUBLE dStartTime;
+
+    /* Creates animated objects */
+    dStartTime = orxSystem_GetTime();
+    for(j = 0; j < orxBENCH_KU32_ANIMATED_NUMBER; j++)
+    {
+      apstObjectList[j] = orxBench_CreateAnimatedObject(pstAnimSet);
+    }
+    dTime += orxSystem_GetTime() - dStartTime;
+
+    /* Deletes them */
+    for(j = 0; j < orxBENCH_KU32_ANIMATED_NUMBER; j++)
+    {
+      orxObject_Delete(apstObjectList[j]);
+    }
+  }
+
+  /* Deletes all */
+  orxMemory_Free(apstObjectList);
+  orxBench_DeleteAnimSet(pstAnimSet, apstAnimList);
+  orxFrame_Delete(pstFrame);
+
+  /* Done! */
+  return dTime;
+}
+
+/** Creates a block of a tile grid, made of one object per tile
+ */
+static void orxFASTCALL orxBench_CreateTileObjects(orxOBJECT **_apstObjectList, orxU32 _u32Block)
+{
+  orxU32 u32X, u32Y, i;
+
+  /* Gets block's top left tile */
+  u32X = (_u32Block % (orxBENCH_KU32_TILEMAP_SIZE / orxBENCH_KU32_TILE_BLOCK_SIZE)) * orxBENCH_KU32_TILE_BLOCK_SIZE;
+  u32Y = (_u32Block / (orxBENCH_KU32_TILEMAP_SIZE / orxBENCH_KU32_TILE_BLOCK_SIZE)) * orxBENCH_KU32_TILE_BLOCK_SIZE;
+
+  /* For all its tiles */
+  for(i = 0; i < orxBENCH_KU32_TILE_BLOCK_SIZE * orxBENCH_KU32_TILE_BLOCK_SIZE; i++)
+  {
+    orxVECTOR vPosition;
+
+    /* Creates it at its grid position */
+    _apstObjectList[i] = orxObject_CreateFromConfig(orxBENCH_KZ_CONFIG_TILE);
+    orxObject_SetPosition(_apstObjectList[i], orxVector_Set(&vPosition, orxU2F(u32X + (i % orxBENCH_KU32_TILE_BLOCK_SIZE)), orxU2F(u32Y + (i / orxBENCH_KU32_TILE_BLOCK_SIZE)), orxFLOAT_0));
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Creates a tile grid made of a single tile map
+ */
+static orxTILEMAP *orxFASTCALL orxBench_CreateTileMap()
+{
+  orxTILEMAP *pstResult;
+  orxVECTOR   vTileSize;
+  orxU32      i;
+
+  /* Creates tile map */
+  pstResult = orxTileMap_Create(orxBENCH_KU32_TILEMAP_SIZE, orxBENCH_KU32_TILEMAP_SIZE, orxVector_Set(&vTileSize, orxFLOAT_1, orxFLOAT_1, orxFLOAT_0));
+
+  /* For all tiles */
+  for(i = 0; i < orxBENCH_KU32_TILEMAP_SIZE * orxBENCH_KU32_TILEMAP_SIZE; i++)
+  {
+    /* Sets it */
+    orxTileMap_SetTile(pstResult, i % orxBENCH_KU32_TILEMAP_SIZE, i / orxBENCH_KU32_TILEMAP_SIZE, 1);
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Benchmark: orxBENCH_KU32_TILEMAP_SIZE^2 grid creation, with one object per tile, a block at a time (one tile per operation)
+ */
+static orxDOUBLE orxFASTCALL orxBench_TileObjects(orxU32 _u32Count)
+{
+  orxOBJECT **apstObjectList;
+  orxDOUBLE   dTime = orxDOUBLE_0;
+  orxU32      i, j;
+
+  /* Allocates object list */
+  apstObjectList = (orxOBJECT **)orxMemory_Allocate(orxBENCH_KU32_TILE_BLOCK_SIZE * orxBENCH_KU32_TILE_BLOCK_SIZE * sizeof(orxOBJECT *), orxMEMORY_TYPE_TEMP);
+
+  /* For all blocks */
+  for(i = 0; i < _u32Count; i += orxBENCH_KU32_TILE_BLOCK_SIZE * orxBENCH_KU32_TILE_BLOCK_SIZE)
+  {
+    orxDOUBLE dStartTime;
+
+    /* Creates it */
+    dStartTime = orxSystem_GetTime();
+    orxBench_CreateTileObjects(apstObjectList, (i / (orxBENCH_KU32_TILE_BLOCK_SIZE * orxBENCH_KU32_TILE_BLOCK_SIZE)) % ((orxBENCH_KU32_TILEMAP_SIZE / orxBENCH_KU32_TILE_BLOCK_SIZE) * (orxBENCH_KU32_TILEMAP_SIZE / orxBENCH_KU32_TILE_BLOCK_SIZE)));
+    dTime += orxSystem_GetTime() - dStartTime;
+
+    /* Deletes it */
+    for(j = 0; j < orxBENCH_KU32_TILE_BLOCK_SIZE * orxBENCH_KU32_TILE_BLOCK_SIZE; j++)
+    {
+      orxObject_Delete(apstObjectList[j]);
+    }
+  }
+
+  /* Deletes list */
+  orxMemory_Free(apstObjectList);
+
+  /* Done! */
+  return dTime;
+}
+
+/** Benchmark: orxBENCH_KU32_TILEMAP_SIZE^2 grid creation, with a single tile map (one tile per operation)
+ */
+static orxDOUBLE orxFASTCALL orxBench_TileMap(orxU32 _u32Count)
+{
+  orxDOUBLE dTime = orxDOUBLE_0;
+  orxU32    i;
+
+  /* For all grids */
+  for(i = 0; i < _u32Count; i += orxBENCH_KU32_TILEMAP_SIZE * orxBENCH_KU32_TILEMAP_SIZE)
+  {
+    orxTILEMAP *pstTileMap;
+    orxDOUBLE   dStartTime;
+
+    /* Creates it */
+    dStartTime = orxSystem_GetTime();
+    pstTileMap = orxBench_CreateTileMap();
+    dTime += orxSystem_GetTime() - dStartTime;
+
+    /* Deletes it */
+    orxTileMap_Delete(pstTileMap);
+  }
+
+  /* Done! */
+  return dTime;
+}
+
+/** Check: bank indices stay consistent through random allocations/frees
+ */
+static orxSTATUS orxFASTCALL orxBench_CheckBank()
+{
+  orxBANK  *pstBank;
+  orxU32    i, u32Count = 0, u32Seed = 0xBADC0DE;
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Creates bank */
+  pstBank = orxBank_Create(37, 24, orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_TEMP);
+
+  /* Clears cells */
+  orxMemory_Zero(sstBench.apCellList, sizeof(sstBench.apCellList));
+
+  /* Allocates/frees at random places */
+  for(i = 0; i < 200000; i++)
+  {
+    void **ppCell;
+
+    /* Gets random cell */
+    ppCell = &(sstBench.apCellList[orxBench_GetRandom(&u32Seed) % 20000]);
+
+    /* Allocated? */
+    if(*ppCell != orxNULL)
+    {
+      /* Frees it */
+      orxBank_Free(pstBank, *ppCell);
+      *ppCell = orxNULL;
+      u32Count--;
+    }
+    else
+    {
+      orxU32 u32Index;
+      void  *pPrevious;
+
+      /* Allocates it */
+      *ppCell = orxBank_AllocateIndexed(pstBank, &u32Index, &pPrevious);
+      u32Count++;
+
+      /* Inconsistent index? */
+      if((orxBank_GetAtIndex(pstBank, u32Index) != *ppCell) || (orxBank_GetIndex(pstBank, *ppCell) != u32Index))
+      {
+        eResult = orxSTATUS_FAILURE;
+      }
+    }
+
+    /* Halfway? */
+    if(i == 100000)
+    {
+      /* Compacts bank */
+      orxBank_Compact(pstBank);
+    }
+  }
+
+  /* Wrong count? */
+  if(orxBank_GetCount(pstBank) != u32Count)
+  {
+    eResult = orxSTATUS_FAILURE;
+  }
+
+  /* Deletes bank */
+  orxBank_Delete(pstBank);
+
+  /* Done! */
+  return eResult;
+}
+
+/** Allocates & frees cells from a thread, in a shared bank
+ */
+static orxSTATUS orxFASTCALL orxBench_ShareCells(void *_pContext)
+{
+  orxU32  **apu32CellList;
+  orxU32    u32Thread, u32Count, u32Live = 0, u32Seed, i;
+
+  /* Gets thread index & cell range */
+  u32Thread     = (orxU32)(size_t)_pContext;
+  u32Count      = orxBENCH_KU32_KEY_NUMBER / orxBENCH_KU32_THREAD_NUMBER;
+  apu32CellList = (orxU32 **)&(sstBench.apCellList[u32Thread * u32Count]);
+  u32Seed       = 0xFACE + u32Thread;
+
+  /* Allocates/frees at random places */
+  for(i = 0; i < 400000; i++)
+  {
+    orxU32 **ppu32Cell;
+
+    /* Gets random cell */
+    ppu32Cell = &(apu32CellList[orxBench_GetRandom(&u32Seed) % u32Count]);
+
+    /* Allocated? */
+    if(*ppu32Cell != orxNULL)
+    {
+      /* Stamp was overwritten by another owner? */
+      if((*ppu32Cell)[0] != u32Thread)
+      {
+        /* Flags it */
+        sstBench.au32LiveList[u32Thread] = orxU32_UNDEFINED;
+        return orxSTATUS_FAILURE;
+      }
+
+      /* Frees it */
+      (*ppu32Cell)[0] = orxU32_UNDEFINED;
+      orxBank_Free(sstBench.pstSharedBank, *ppu32Cell);
+      *ppu32Cell = orxNULL;
+      u32Live--;
+    }
+    else
+    {
+      /* Allocates it */
+      *ppu32Cell = (orxU32 *)orxBank_Allocate(sstBench.pstSharedBank);
+
+      /* Already owned? */
+      if((*ppu32Cell)[0] != orxU32_UNDEFINED)
+      {
+        /* Flags it */
+        sstBench.au32LiveList[u32Thread] = orxU32_UNDEFINED;
+        return orxSTATUS_FAILURE;
+      }
+
+      /* Stamps it */
+      (*ppu32Cell)[0] = u32Thread;
+      (*ppu32Cell)[1] = (orxU32)(ppu32Cell - apu32CellList);
+      u32Live++;
+    }
+  }
+
+  /* Stores live count */
+  sstBench.au32LiveList[u32Thread] = u32Live;
+
+  /* Done! Runs only once */
+  return orxSTATUS_FAILURE;
+}
+
+/** Check: a thread-safe bank never hands out a cell twice and keeps exact counts under concurrent use
+ */
+static orxSTATUS orxFASTCALL orxBench_CheckBankThreads()
+{
+  orxU32    au32ThreadList[orxBENCH_KU32_THREAD_NUMBER];
+  orxU32   *pu32Cell;
+  orxU32    u32Count, u32Live = 0, i;
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Creates bank */
+  sstBench.pstSharedBank = orxBank_Create(64, 2 * sizeof(orxU32), orxBANK_KU32_FLAG_THREAD_SAFE, orxMEMORY_TYPE_TEMP);
+
+  /* Pre-fills it with unowned cells so that recycled & fresh cells both start unstamped */
+  for(i = 0; i < orxBENCH_KU32_KEY_NUMBER; i++)
+  {
+    sstBench.apCellList[i] = orxBank_Allocate(sstBench.pstSharedBank);
+    ((orxU32 *)sstBench.apCellList[i])[0] = orxU32_UNDEFINED;
+  }
+  for(i = 0; i < orxBENCH_KU32_KEY_NUMBER; i++)
+  {
+    orxBank_Free(sstBench.pstSharedBank, sstBench.apCellList[i]);
+    sstBench.apCellList[i] = orxNULL;
+  }
+
+  /* Shares it between all threads */
+  for(i = 1; i < orxBENCH_KU32_THREAD_NUMBER; i++)
+  {
+    au32ThreadList[i] = orxThread_Start(orxBench_ShareCells, "orxBench", (void *)(size_t)i);
+  }
+  orxBench_ShareCells((void *)0);
+  for(i = 1; i < orxBENCH_KU32_THREAD_NUMBER; i++)
+  {
+    orxThread_Join(au32ThreadList[i]);
+  }
+
+  /* Gathers live counts */
+  for(i = 0; i < orxBENCH_KU32_THREAD_NUMBER; i++)
+  {
+    if(sstBench.au32LiveList[i] == orxU32_UNDEFINED)
+    {
+      eResult = orxSTATUS_FAILURE;
+    }
+    else
+    {
+      u32Live += sstBench.au32LiveList[i];
+    }
+  }
+
+  /* Checks owners of all live cells */
+  u32Count = orxBENCH_KU32_KEY_NUMBER / orxBENCH_KU32_THREAD_NUMBER;
+  for(i = 0; i < orxBENCH_KU32_KEY_NUMBER; i++)
+  {
+    pu32Cell = (orxU32 *)sstBench.apCellList[i];
+    if((pu32Cell != orxNULL) && ((pu32Cell[0] != i / u32Count) || (pu32Cell[1] != i % u32Count)))
+    {
+      eResult = orxSTATUS_FAILURE;
+    }
+  }
+
+  /* Checks counts */
+  if(orxBank_GetCount(sstBench.pstSharedBank) != u32Live)
+  {
+    eResult = orxSTATUS_FAILURE;
+  }
+  for(i = 0, pu32Cell = (orxU32 *)orxBank_GetNext(sstBench.pstSharedBank, orxNULL); pu32Cell != orxNULL; pu32Cell = (orxU32 *)orxBank_GetNext(sstBench.pstSharedBank, pu32Cell), i++);
+  if(i != u32Live)
+  {
+    eResult = orxSTATUS_FAILURE;
+  }
+
+  /* Deletes bank */
+  orxBank_Delete(sstBench.pstSharedBank);
+  sstBench.pstSharedBank = orxNULL;
+
+  /* Done! */
+  return eResult;
+}
+
+/** Check: chained & open addressing hash tables behave the same
+ */
+static orxSTATUS orxFASTCALL orxBench_CheckHashTable()
+{
+  orxHASHTABLE *pstChained, *pstOpen;
+  orxU32        i, u32Seed = 0xC0FFEE;
+  orxSTATUS     eResult = orxSTATUS_SUCCESS;
+
+  /* Creates tables */
+  pstChained  = orxHashTable_Create(8, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_TEMP);
+  pstOpen     = orxHashTable_Create(8, orxHASHTABLE_KU32_FLAG_OPEN_ADDRESSING, orxMEMORY_TYPE_TEMP);
+
+  /* Applies the same random operations to both */
+  for(i = 0; i < 200000; i++)
+  {
+    orxU64  u64Key;
+    void   *pData;
+
+    u64Key  = orxBench_GetKey(orxBench_GetRandom(&u32Seed) % 5000);
+    pData   = (void *)(size_t)((orxBench_GetRandom(&u32Seed) & 0xFFFF) + 1);
+
+    switch(orxBench_GetRandom(&u32Seed) & 3)
+    {
+      case 0:
+      {
+        if(orxHashTable_Add(pstChained, u64Key, pData) != orxHashTable_Add(pstOpen, u64Key, pData))
+        {
+          eResult = orxSTATUS_FAILURE;
+        }
+        break;
+      }
+
+      case 1:
+      {
+        orxHashTable_Set(pstChained, u64Key, pData);
+        orxHashTable_Set(pstOpen, u64Key, pData);
+        break;
+      }
+
+      case 2:
+      {
+        if(orxHashTable_Remove(pstChained, u64Key) != orxHashTable_Remove(pstOpen, u64Key))
+        {
+          eResult = orxSTATUS_FAILURE;
+        }
+        break;
+      }
+
+      default:
+      {
+        if(orxHashTable_Get(pstChained, u64Key) != orxHashTable_Get(pstOpen, u64Key))
+        {
+          eResult = orxSTATUS_FAILURE;
+        }
+        break;
+      }
+    }
+  }
+
+  /* Different counts? */
+  if(orxHashTable_GetCount(pstChained) != orxHashTable_GetCount(pstOpen))
+  {
+    eResult = orxSTATUS_FAILURE;
+  }
+
+  /* Deletes tables */
+  orxHashTable_Delete(pstChained);
+  orxHashTable_Delete(pstOpen);
+
+  /* Done! */
+  return eResult;
+}
+
+/** Interns strings from a thread, in a thread-specific order
+ */
+static orxSTATUS orxFASTCALL orxBench_InternStrings(void *_pContext)
+{
+  orxU32 u32Thread, i;
+
+  /* Gets thread index */
+  u32Thread = (orxU32)(size_t)_pContext;
+
+  /* Interns all strings */
+  for(i = 0; i < orxBENCH_KU32_STRING_NUMBER; i++)
+  {
+    orxU32 u32Index;
+
+    u32Index = (i * 7 + u32Thread * 1031) & (orxBENCH_KU32_STRING_NUMBER - 1);
+    sstBench.au32IDList[u32Thread][u32Index] = orxString_GetID(orxString_GetFromID(orxString_GetID(sstBench.aacStringList[u32Index])));
+  }
+
+  /* Done! Runs only once */
+  return orxSTATUS_FAILURE;
+}
+
+/** Check: string interning gives the same IDs from any thread
+ */
+static orxSTATUS orxFASTCALL orxBench_CheckStringThreads()
+{
+  orxU32    au32ThreadList[orxBENCH_KU32_THREAD_NUMBER];
+  orxU32    i, j;
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Interns strings from all threads */
+  for(i = 1; i < orxBENCH_KU32_THREAD_NUMBER; i++)
+  {
+    au32ThreadList[i] = orxThread_Start(orxBench_InternStrings, "orxBench", (void *)(size_t)i);
+  }
+  orxBench_InternStrings((void *)0);
+  for(i = 1; i < orxBENCH_KU32_THREAD_NUMBER; i++)
+  {
+    orxThread_Join(au32ThreadList[i]);
+  }
+
+  /* Compares IDs */
+  for(i = 0; i < orxBENCH_KU32_STRING_NUMBER; i++)
+  {
+    for(j = 0; j < orxBENCH_KU32_THREAD_NUMBER; j++)
+    {
+      if(sstBench.au32IDList[j][i] != orxString_GetID(sstBench.aacStringList[i]))
+      {
+        eResult = orxSTATUS_FAILURE;
+      }
+    }
+    if(orxString_Compare(orxString_GetFromID(sstBench.au32IDList[0][i]), sstBench.aacStringList[i]) != 0)
+    {
+      eResult = orxSTATUS_FAILURE;
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Check: CRCs computed in chunks match CRCs computed at once, for all lengths & alignments
+ */
+static orxSTATUS orxFASTCALL orxBench_CheckCRC()
+{
+  orxCHAR   acBuffer[512];
+  orxU32    i, j;
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Fills buffer */
+  for(i = 0; i < sizeof(acBuffer); i++)
+  {
+    acBuffer[i] = (orxCHAR)('a' + (i * 7) % 26);
+  }
+
+  /* For all offsets & lengths */
+  for(i = 0; i < 16; i++)
+  {
+    for(j = 0; j < sizeof(acBuffer) - 16; j += 3)
+    {
+      orxU32 u32CRC;
+
+      /* Computes chunked CRC */
+      u32CRC = orxString_NContinueCRC(acBuffer + i + j / 2, orxString_NToCRC(acBuffer + i, j / 2), j - j / 2);
+
+      /* Doesn't match? */
+      if(u32CRC != orxString_NToCRC(acBuffer + i, j))
+      {
+        eResult = orxSTATUS_FAILURE;
+      }
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Check: profiler trace export produces a JSON object
+ */
+static orxSTATUS orxFASTCALL orxBench_CheckTrace()
+{
+  orxFILE  *pstFile;
+  orxS32    s32MarkerID, i;
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Records a few frames */
+  orxProfiler_EnableTrace(orxTRUE);
+  s32MarkerID = orxProfiler_GetIDFromName("orxBench \"Trace\"");
+  for(i = 0; i < 4; i++)
+  {
+    orxProfiler_PushMarker(s32MarkerID);
+    orxProfiler_PopMarker();
+    orxProfiler_ResetAllMarkers();
+  }
+  orxProfiler_EnableTrace(orxFALSE);
+
+  /* Dumps them */
+  if(orxProfiler_DumpTrace(orxBENCH_KZ_TRACE_FILE) != orxSTATUS_FAILURE)
+  {
+    /* Opens file */
+    pstFile = orxFile_Open(orxBENCH_KZ_TRACE_FILE, orxFILE_KU32_FLAG_OPEN_READ | orxFILE_KU32_FLAG_OPEN_BINARY);
+
+    /* Success? */
+    if(pstFile != orxNULL)
+    {
+      orxCHAR acBuffer[4096];
+      orxS64  s64Size;
+
+      /* Reads it */
+      s64Size = orxFile_Read(acBuffer, sizeof(orxCHAR), sizeof(acBuffer) - 1, pstFile);
+      acBuffer[s64Size] = orxCHAR_NULL;
+
+      /* Looks like a trace? */
+      if((acBuffer[0] == '{')
+      && (orxString_SearchString(acBuffer, "\"traceEvents\"") != orxNULL)
+      && (orxString_SearchString(acBuffer, "orxBench \\\"Trace\\\"") != orxNULL))
+      {
+        /* Updates result */
+        eResult = orxSTATUS_SUCCESS;
+      }
+
+      /* Closes file */
+      orxFile_Close(pstFile);
+    }
+
+    /* Removes it */
+    orxFile_Remove(orxBENCH_KZ_TRACE_FILE);
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Logs lines from a thread
+ */
+static orxSTATUS orxFASTCALL orxBench_LogLines(void *_pContext)
+{
+  orxU32 u32Thread, i;
+
+  /* Gets thread index */
+  u32Thread = (orxU32)(size_t)_pContext;
+
+  /* Logs lines */
+  for(i = 0; i < orxBENCH_KU32_LOG_NUMBER; i++)
+  {
+    orxLOG("T%u %u", u32Thread, i);
+  }
+
+  /* Done! Runs only once */
+  return orxSTATUS_FAILURE;
+}
+
+/** Check: lines logged from several threads are all written, in order for each thread
+ */
+static orxSTATUS orxFASTCALL orxBench_CheckLog()
+{
+  orxU32    au32ThreadList[orxBENCH_KU32_THREAD_NUMBER], au32NextList[orxBENCH_KU32_THREAD_NUMBER];
+  orxFILE  *pstFile;
+  orxU32    u32DebugFlags, i;
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Logs to a fresh file, without decorations */
+  orxFile_Remove(orxBENCH_KZ_LOG_FILE);
+  _orxDebug_SetLogFile(orxBENCH_KZ_LOG_FILE);
+  u32DebugFlags = _orxDebug_GetFlags();
+  _orxDebug_SetFlags(orxDEBUG_KU32_STATIC_FLAG_FILE, orxDEBUG_KU32_STATIC_MASK_USER_ALL);
+
+  /* Logs from all threads */
+  for(i = 1; i < orxBENCH_KU32_THREAD_NUMBER; i++)
+  {
+    au32ThreadList[i] = orxThread_Start(orxBench_LogLines, "orxBench", (void *)(size_t)i);
+  }
+  orxBench_LogLines((void *)0);
+  for(i = 1; i < orxBENCH_KU32_THREAD_NUMBER; i++)
+  {
+    orxThread_Join(au32ThreadList[i]);
+  }
+
+  /* Restores output */
+  _orxDebug_Flush();
+  _orxDebug_SetFlags(u32DebugFlags, orxDEBUG_KU32_STATIC_MASK_USER_ALL);
+  _orxDebug_SetLogFile(orxNULL);
+
+  /* Opens file */
+  pstFile = orxFile_Open(orxBENCH_KZ_LOG_FILE, orxFILE_KU32_FLAG_OPEN_READ | orxFILE_KU32_FLAG_OPEN_BINARY);
+
+  /* Success? */
+  if(pstFile != orxNULL)
+  {
+    orxCHAR  *acBuffer;
+    orxS64    s64Size;
+
+    /* Reads it */
+    s64Size   = orxFile_GetSize(pstFile);
+    acBuffer  = (orxCHAR *)orxMemory_Allocate((orxU32)s64Size + 1, orxMEMORY_TYPE_TEMP);
+    s64Size   = orxFile_Read(acBuffer, sizeof(orxCHAR), s64Size, pstFile);
+    acBuffer[s64Size] = orxCHAR_NULL;
+
+    /* Closes file */
+    orxFile_Close(pstFile);
+
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+
+    /* For all lines */
+    orxMemory_Zero(au32NextList, sizeof(au32NextList));
+    for(i = 0; (i < (orxU32)s64Size) && (eResult != orxSTATUS_FAILURE);)
+    {
+      orxCHAR  *pcEnd;
+      orxU32    u32Thread, u32Index;
+
+      /* Terminates line (scanning doesn't have to go through the whole buffer) */
+      pcEnd = (orxCHAR *)orxString_SearchChar(acBuffer + i, '\n');
+      if(pcEnd != orxNULL)
+      {
+        *pcEnd = orxCHAR_NULL;
+      }
+
+      /* Gets thread & line index */
+      if((orxString_Scan(acBuffer + i, "T%u %u", &u32Thread, &u32Index) != 2)
+      || (u32Thread >= orxBENCH_KU32_THREAD_NUMBER)
+      || (u32Index != au32NextList[u32Thread]))
+      {
+        /* Out of order or corrupted */
+        eResult = orxSTATUS_FAILURE;
+      }
+      else
+      {
+        /* Updates next index */
+        au32NextList[u32Thread]++;
+      }
+
+      /* Goes to next line */
+      i = (pcEnd != orxNULL) ? (orxU32)(pcEnd - acBuffer) + 1 : (orxU32)s64Size;
+    }
+
+    /* Checks completeness */
+    for(i = 0; i < orxBENCH_KU32_THREAD_NUMBER; i++)
+    {
+      if(au32NextList[i] != orxBENCH_KU32_LOG_NUMBER)
+      {
+        eResult = orxSTATUS_FAILURE;
+      }
+    }
+
+    /* Deletes buffer */
+    orxMemory_Free(acBuffer);
+  }
+
+  /* Removes file */
+  orxFile_Remove(orxBENCH_KZ_LOG_FILE);
+
+  /* Done! */
+  return eResult;
+}
+
+/** Interns a large set of strings from a thread, in a thread-specific order
+ */
+static orxSTATUS orxFASTCALL orxBench_InternManyStrings(void *_pContext)
+{
+  orxCHAR acString[32];
+  orxU32  u32Thread, u32Index, i;
+
+  /* Gets thread index */
+  u32Thread = (orxU32)(size_t)_pContext;
+
+  /* Interns all strings */
+  for(i = 0, u32Index = u32Thread * 7919; i < orxBENCH_KU32_INTERN_NUMBER; i++)
+  {
+    /* Gets next index */
+    u32Index = (u32Index + 104729) % orxBENCH_KU32_INTERN_NUMBER;
+
+    /* Interns string */
+    orxString_NPrint(acString, sizeof(acString) - 1, "orxBench/Intern%u", u32Index);
+    sstBench.au32InternIDList[u32Thread * orxBENCH_KU32_INTERN_NUMBER + u32Index] = orxString_GetID(acString);
+  }
+
+  /* Done! Runs only once */
+  return orxSTATUS_FAILURE;
+}
+
+/** Check: interning the same million strings from 8 threads gives the same IDs
+ */
+static orxSTATUS orxFASTCALL orxBench_CheckStringManyThreads()
+{
+  orxU32    au32ThreadList[orxBENCH_KU32_INTERN_THREAD_NUMBER];
+  orxU32    i, j;
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Allocates IDs */
+  sstBench.au32InternIDList = (orxU32 *)orxMemory_Allocate(orxBENCH_KU32_INTERN_THREAD_NUMBER * orxBENCH_KU32_INTERN_NUMBER * sizeof(orxU32), orxMEMORY_TYPE_TEMP);
+
+  /* Interns strings from all threads */
+  for(i = 1; i < orxBENCH_KU32_INTERN_THREAD_NUMBER; i++)
+  {
+    au32ThreadList[i] = orxThread_Start(orxBench_InternManyStrings, "orxBench", (void *)(size_t)i);
+  }
+  orxBench_InternManyStrings((void *)0);
+  for(i = 1; i < orxBENCH_KU32_INTERN_THREAD_NUMBER; i++)
+  {
+    orxThread_Join(au32ThreadList[i]);
+  }
+
+  /* For all strings */
+  for(i = 0; (i < orxBENCH_KU32_INTERN_NUMBER) && (eResult != orxSTATUS_FAILURE); i++)
+  {
+    orxCHAR acString[32];
+
+    /* Compares IDs */
+    for(j = 1; j < orxBENCH_KU32_INTERN_THREAD_NUMBER; j++)
+    {
+      if(sstBench.au32InternIDList[j * orxBENCH_KU32_INTERN_NUMBER + i] != sstBench.au32InternIDList[i])
+      {
+        eResult = orxSTATUS_FAILURE;
+      }
+    }
+
+    /* Compares string */
+    orxString_NPrint(acString, sizeof(acString) - 1, "orxBench/Intern%u", i);
+    if(orxString_Compare(orxString_GetFromID(sstBench.au32InternIDList[i]), acString) != 0)
+    {
+      eResult = orxSTATUS_FAILURE;
+    }
+  }
+
+  /* Frees IDs */
+  orxMemory_Free(sstBench.au32InternIDList);
+  sstBench.au32InternIDList = orxNULL;
+
+  /* Done! */
+  return eResult;
+}
+
+/** Reads a whole file (null-terminated), orxNULL if not found
+ */
+static orxCHAR *orxFASTCALL orxBench_ReadFile(const orxSTRING _zFileName)
+{
+  orxFILE  *pstFile;
+  orxCHAR  *acResult = orxNULL;
+
+  /* Opens file */
+  pstFile = orxFile_Open(_zFileName, orxFILE_KU32_FLAG_OPEN_READ | orxFILE_KU32_FLAG_OPEN_BINARY);
+
+  /* Success? */
+  if(pstFile != orxNULL)
+  {
+    orxS64 s64Size;
+
+    /* Reads it */
+    s64Size   = orxFile_GetSize(pstFile);
+    acResult  = (orxCHAR *)orxMemory_Allocate((orxU32)s64Size + 1, orxMEMORY_TYPE_TEMP);
+    s64Size   = orxFile_Read(acResult, sizeof(orxCHAR), s64Size, pstFile);
+    acResult[s64Size] = orxCHAR_NULL;
+
+    /* Closes file */
+    orxFile_Close(pstFile);
+  }
+
+  /* Done! */
+  return acResult;
+}
+
+/** Check: sampling profiler records samples, logs their cost (passes without sampling when not supported)
+ */
+static orxSTATUS orxFASTCALL orxBench_CheckSampling()
+{
+  orxDOUBLE dTime, dSampledTime;
+  orxU32    i;
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Gets reference time (best run) */
+  for(i = 0, dTime = orxDOUBLE_0; i < orxBENCH_KU32_RUN_NUMBER; i++)
+  {
+    orxDOUBLE dRunTime;
+
+    dRunTime  = orxBench_StringNToCRCLong(20000);
+    dTime     = ((i == 0) || (dRunTime < dTime)) ? dRunTime : dTime;
+  }
+
+  /* Supported? */
+  if(orxProfiler_StartSampling(orxBENCH_KU32_SAMPLING_FREQUENCY) != orxSTATUS_FAILURE)
+  {
+    orxCHAR *acBuffer;
+
+    /* Gets sampled time (best run, all runs are sampled) */
+    for(i = 0, dSampledTime = orxDOUBLE_0; i < orxBENCH_KU32_RUN_NUMBER; i++)
+    {
+      orxDOUBLE dRunTime;
+
+      dRunTime      = orxBench_StringNToCRCLong(20000);
+      dSampledTime  = ((i == 0) || (dRunTime < dSampledTime)) ? dRunTime : dSampledTime;
+    }
+    orxProfiler_StopSampling();
+
+    /* Updates result */
+    eResult = orxSTATUS_FAILURE;
+
+    /* Dumps & reads samples */
+    if((orxProfiler_DumpSamples(orxBENCH_KZ_REPORT_FILE) != orxSTATUS_FAILURE)
+    && ((acBuffer = orxBench_ReadFile(orxBENCH_KZ_REPORT_FILE)) != orxNULL))
+    {
+      const orxCHAR  *pcLine;
+      orxU32          u32SampleCount = 0;
+
+      /* For all lines */
+      for(pcLine = acBuffer; *pcLine != orxCHAR_NULL;)
+      {
+        const orxCHAR  *pcEnd, *pcCount;
+        orxU32          u32Count;
+
+        /* Finds its end */
+        for(pcEnd = pcLine; (*pcEnd != orxCHAR_NULL) && (*pcEnd != '\n'); pcEnd++);
+
+        /* Finds its count */
+        for(pcCount = pcEnd; (pcCount > pcLine) && (*(pcCount - 1) != ' '); pcCount--);
+
+        /* Valid? */
+        if((pcCount > pcLine) && (orxString_ToU32(pcCount, &u32Count, orxNULL) != orxSTATUS_FAILURE))
+        {
+          /* Updates sample count */
+          u32SampleCount += u32Count;
+        }
+
+        /* Goes to next line */
+        pcLine = (*pcEnd != orxCHAR_NULL) ? pcEnd + 1 : pcEnd;
+      }
+
+      /* Got samples? */
+      if(u32SampleCount != 0)
+      {
+        /* Logs their cost, if measurable */
+        if(dSampledTime > dTime)
+        {
+          orxLOG("%-24s %u samples, %.2f us/sample", "Profiler.Sampling", u32SampleCount, (dSampledTime - dTime) * 1e6 * orxBENCH_KU32_RUN_NUMBER / u32SampleCount);
+        }
+        else
+        {
+          orxLOG("%-24s %u samples, cost below noise level", "Profiler.Sampling", u32SampleCount);
+        }
+
+        /* Updates result */
+        eResult = orxSTATUS_SUCCESS;
+      }
+
+      /* Deletes buffer */
+      orxMemory_Free(acBuffer);
+    }
+
+    /* Removes file */
+    orxFile_Remove(orxBENCH_KZ_REPORT_FILE);
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Check: cost report lists the config file, inheritance resolves & created objects of a synthetic config set
+ */
+static orxSTATUS orxFASTCALL orxBench_CheckCostReport()
+{
+  orxFILE  *pstFile;
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Writes config file */
+  pstFile = orxFile_Open(orxBENCH_KZ_CONFIG_FILE, orxFILE_KU32_FLAG_OPEN_WRITE | orxFILE_KU32_FLAG_OPEN_BINARY);
+  if(pstFile != orxNULL)
+  {
+    orxU32 i;
+
+    orxFile_Print(pstFile, "[BenchCostParent]\nScale = 2\nRotation = 45\nLifeTime = 1000\n\n");
+    orxFile_Print(pstFile, "[BenchCostChild@BenchCostParent]\nPosition = (1, 2, 0)\n\n");
+    orxFile_Print(pstFile, "[BenchCostObject@BenchCostParent]\nChildList = BenchCostChild");
+    for(i = 1; i < 16; i++)
+    {
+      orxFile_Print(pstFile, " # BenchCostChild");
+    }
+    orxFile_Print(pstFile, "\n");
+    orxFile_Close(pstFile);
+
+    /* Starts recording */
+    if(orxProfiler_StartCostReport() != orxSTATUS_FAILURE)
+    {
+      orxOBJECT  *apstObjectList[64];
+      orxCHAR    *acBuffer;
+      orxU32      i;
+
+      /* Loads config & creates objects */
+      orxConfig_Load(orxBENCH_KZ_CONFIG_FILE);
+      for(i = 0; i < orxARRAY_GET_ITEM_COUNT(apstObjectList); i++)
+      {
+        apstObjectList[i] = orxObject_CreateFromConfig("BenchCostObject");
+      }
+
+      /* Writes & reads report */
+      if((orxProfiler_StopCostReport(orxBENCH_KZ_REPORT_FILE) != orxSTATUS_FAILURE)
+      && ((acBuffer = orxBench_ReadFile(orxBENCH_KZ_REPORT_FILE)) != orxNULL))
+      {
+        /* Lists the file, an inheritance resolve & objects? */
+        if((orxString_SearchString(acBuffer, orxBENCH_KZ_CONFIG_FILE) != orxNULL)
+        && (orxString_SearchString(acBuffer, "BenchCostChild") != orxNULL)
+        && (orxString_SearchString(acBuffer, "BenchCostObject") != orxNULL))
+        {
+          /* Updates result */
+          eResult = orxSTATUS_SUCCESS;
+        }
+
+        /* Deletes buffer */
+        orxMemory_Free(acBuffer);
+      }
+
+      /* Deletes objects & flushes their owned children */
+      for(i = 0; i < orxARRAY_GET_ITEM_COUNT(apstObjectList); i++)
+      {
+        if(apstObjectList[i] != orxNULL)
+        {
+          orxObject_Delete(apstObjectList[i]);
+        }
+      }
+      orxClock_Update();
+
+      /* Removes report */
+      orxFile_Remove(orxBENCH_KZ_REPORT_FILE);
+    }
+
+    /* Removes config */
+    orxFile_Remove(orxBENCH_KZ_CONFIG_FILE);
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Check: anim pointer link tables don't get modified by later AnimSet changes, logs the memory used per animated object
+ */
+static orxSTATUS orxFASTCALL orxBench_CheckAnimObjects()
+{
+  orxOBJECT            **apstObjectList;
+  orxANIMSET_LINK_TABLE *pstLinkTable, *pstNewLinkTable;
+  orxANIMSET            *pstAnimSet;
+  orxANIM               *apstAnimList[2];
+  orxFRAME              *pstFrame;
+  orxFLOAT               fTime, fNewTime;
+  orxBOOL                bCut, bClearTarget;
+  orxDOUBLE              dTime;
+  orxU32                 i;
+  orxSTATUS              eResult = orxSTATUS_FAILURE;
+#ifdef __orxPROFILER__
+  orxU32                 u32StartSize = 0, u32Size = 0;
+#endif /* __orxPROFILER__ */
+
+  /* Creates AnimSet */
+  pstFrame    = orxFrame_Create(orxFRAME_KU32_FLAG_NONE);
+  pstAnimSet  = orxBench_CreateAnimSet(pstFrame, apstAnimList);
+
+  /* Creates animated objects */
+  apstObjectList = (orxOBJECT **)orxMemory_Allocate(orxBENCH_KU32_ANIMATED_NUMBER * sizeof(orxOBJECT *), orxMEMORY_TYPE_TEMP);
+#ifdef __orxPROFILER__
+  orxMemory_GetUsage(orxMEMORY_TYPE_MAIN, orxNULL, orxNULL, &u32StartSize, orxNULL, orxNULL);
+#endif /* __orxPROFILER__ */
+  dTime = orxSystem_GetTime();
+  for(i = 0; i < orxBENCH_KU32_ANIMATED_NUMBER; i++)
+  {
+    apstObjectList[i] = orxBench_CreateAnimatedObject(pstAnimSet);
+  }
+  dTime = orxSystem_GetTime() - dTime;
+
+  /* Logs creation time */
+  orxLOG("%-24s %.2f ns per animated object creation", "Anim.Objects", (dTime * 1e9) / orxBENCH_KU32_ANIMATED_NUMBER);
+
+#ifdef __orxPROFILER__
+
+  /* Tracked memory? */
+  orxMemory_GetUsage(orxMEMORY_TYPE_MAIN, orxNULL, orxNULL, &u32Size, orxNULL, orxNULL);
+  if(u32Size > u32StartSize)
+  {
+    /* Logs it */
+    orxLOG("%-24s %u bytes per animated object", "Anim.Objects", (u32Size - u32StartSize) / orxBENCH_KU32_ANIMATED_NUMBER);
+  }
+
+#endif /* __orxPROFILER__ */
+
+  /* Deletes them (unlocks AnimSet) */
+  for(i = 0; i < orxBENCH_KU32_ANIMATED_NUMBER; i++)
+  {
+    orxObject_Delete(apstObjectList[i]);
+  }
+  orxMemory_Free(apstObjectList);
+
+  /* Clones link table, then replaces AnimSet's 0 -> 1 link with 0 -> 0 & clones it again */
+  pstLinkTable = orxAnimSet_CloneLinkTable(pstAnimSet);
+  orxAnimSet_RemoveLink(pstAnimSet, orxAnimSet_GetLink(pstAnimSet, 0, 1));
+  orxAnimSet_AddLink(pstAnimSet, 0, 0);
+  pstNewLinkTable = orxAnimSet_CloneLinkTable(pstAnimSet);
+
+  /* Does each clone follow its own links at the end of anim 0? */
+  fTime     = orx2F(1.5f);
+  fNewTime  = orx2F(1.5f);
+  if((orxAnimSet_ComputeAnim(pstAnimSet, 0, orxU32_UNDEFINED, &fTime, pstLinkTable, &bCut, &bClearTarget) == 1)
+  && (orxAnimSet_ComputeAnim(pstAnimSet, 0, orxU32_UNDEFINED, &fNewTime, pstNewLinkTable, &bCut, &bClearTarget) == 0))
+  {
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
+
+  /* Deletes all */
+  orxAnimSet_DeleteLinkTable(pstLinkTable);
+  orxAnimSet_DeleteLinkTable(pstNewLinkTable);
+  orxBench_DeleteAnimSet(pstAnimSet, apstAnimList);
+  orxFrame_Delete(pstFrame);
+
+  /* Done! */
+  return eResult;
+}
+
+/** Check: spawners & particle systems get all their particles alive, for particle benchmarks
+ */
+static orxSTATUS orxFASTCALL orxBench_CheckParticles()
+{
+  orxOBJECT  *pstSpawnerObject, *pstSystemObject;
+  orxSTATUS   eResult = orxSTATUS_FAILURE;
+
+  /* Creates effects */
+  pstSpawnerObject  = orxObject_CreateFromConfig(orxBENCH_KZ_CONFIG_SPAWNER);
+  pstSystemObject   = orxObject_CreateFromConfig(orxBENCH_KZ_CONFIG_PARTICLESYSTEM);
+
+  /* Valid? */
+  if((orxOBJECT_GET_STRUCTURE(pstSpawnerObject, SPAWNER) != orxNULL)
+  && (orxOBJECT_GET_STRUCTURE(pstSystemObject, PARTICLESYSTEM) != orxNULL))
+  {
+    /* Updates them once (particle systems need to know their owner) */
+    orxClock_Update();
+
+    /* Emits all particles */
+    orxSpawner_Spawn(orxOBJECT_GET_STRUCTURE(pstSpawnerObject, SPAWNER), orxBENCH_KU32_PARTICLE_NUMBER);
+    orxParticleSystem_Emit(orxOBJECT_GET_STRUCTURE(pstSystemObject, PARTICLESYSTEM), orxBENCH_KU32_PARTICLE_NUMBER);
+
+    /* Are all alive? */
+    if((orxSpawner_GetActiveObjectCount(orxOBJECT_GET_STRUCTURE(pstSpawnerObject, SPAWNER)) == orxBENCH_KU32_PARTICLE_NUMBER)
+    && (orxParticleSystem_GetParticleCount(orxOBJECT_GET_STRUCTURE(pstSystemObject, PARTICLESYSTEM)) == orxBENCH_KU32_PARTICLE_NUMBER))
+    {
+      /* Updates result */
+      eResult = orxSTATUS_SUCCESS;
+    }
+  }
+
+  /* Deletes effects & flushes spawned objects */
+  if(pstSpawnerObject != orxNULL)
+  {
+    orxObject_Delete(pstSpawnerObject);
+  }
+  if(pstSystemObject != orxNULL)
+  {
+    orxObject_Delete(pstSystemObject);
+  }
+  orxClock_Update();
+
+  /* Done! */
+  return eResult;
+}
+
+/** Check: compacted object storage is iterated in memory order
+ */
+static orxSTATUS orxFASTCALL orxBench_CheckStructureOrder()
+{
+  orxOBJECT    *apstObjectList[orxBENCH_KU32_OBJECT_NUMBER];
+  orxSTRUCTURE *pstStructure, *pstPrevious;
+  orxU32        i;
+  orxSTATUS     eResult = orxSTATUS_SUCCESS;
+
+  /* Creates objects */
+  for(i = 0; i < orxBENCH_KU32_OBJECT_NUMBER; i++)
+  {
+    apstObjectList[i] = orxObject_Create();
+  }
+
+  /* Deletes every other one & creates new ones, reusing their cells */
+  for(i = 0; i < orxBENCH_KU32_OBJECT_NUMBER / 2; i++)
+  {
+    orxObject_Delete(apstObjectList[i * 2]);
+  }
+  for(i = 0; i < orxBENCH_KU32_OBJECT_NUMBER / 2; i++)
+  {
+    apstObjectList[i] = apstObjectList[(i * 2) + 1];
+  }
+  for(; i < orxBENCH_KU32_OBJECT_NUMBER; i++)
+  {
+    apstObjectList[i] = orxObject_Create();
+  }
+
+  /* Compacts storage */
+  orxStructure_Compact(orxSTRUCTURE_ID_OBJECT);
+
+  /* Iterates over objects, in memory order */
+  for(pstStructure = orxStructure_GetFirst(orxSTRUCTURE_ID_OBJECT), pstPrevious = orxNULL, i = 0;
+      (pstStructure != orxNULL) && (i < orxBENCH_KU32_OBJECT_NUMBER);
+      pstPrevious = pstStructure, pstStructure = orxStructure_GetNext(pstStructure), i++)
+  {
+    /* Out of order? */
+    if(pstStructure < pstPrevious)
+    {
+      /* Updates result */
+      eResult = orxSTATUS_FAILURE;
+      break;
+    }
+  }
+
+  /* Missing or extra objects? */
+  if((i != orxBENCH_KU32_OBJECT_NUMBER) || (pstStructure != orxNULL))
+  {
+    /* Updates result */
+    eResult = orxSTATUS_FAILURE;
+  }
+
+  /* Deletes objects */
+  for(i = 0; i < orxBENCH_KU32_OBJECT_NUMBER; i++)
+  {
+    orxObject_Delete(apstObjectList[i]);
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Check: tile maps reject grids too large to be addressed, logs the memory used per tile by objects & tile maps
+ */
+static orxSTATUS orxFASTCALL orxBench_CheckTileMap()
+{
+  orxOBJECT **apstObjectList;
+  orxTILEMAP *pstTileMap;
+  orxVECTOR   vTileSize;
+  orxDOUBLE   dObjectTime, dTileMapTime;
+  orxU32      i;
+  orxSTATUS   eResult = orxSTATUS_FAILURE;
+#ifdef __orxPROFILER__
+  orxU32      u32StartSize = 0, u32ObjectSize = 0, u32TileMapSize = 0;
+#endif /* __orxPROFILER__ */
+
+  /* Creates a grid block with objects */
+  apstObjectList = (orxOBJECT **)orxMemory_Allocate(orxBENCH_KU32_TILE_BLOCK_SIZE * orxBENCH_KU32_TILE_BLOCK_SIZE * sizeof(orxOBJECT *), orxMEMORY_TYPE_TEMP);
+#ifdef __orxPROFILER__
+  orxMemory_GetUsage(orxMEMORY_TYPE_MAIN, orxNULL, orxNULL, &u32StartSize, orxNULL, orxNULL);
+#endif /* __orxPROFILER__ */
+  dObjectTime = orxSystem_GetTime();
+  orxBench_CreateTileObjects(apstObjectList, 0);
+  dObjectTime = orxSystem_GetTime() - dObjectTime;
+#ifdef __orxPROFILER__
+  orxMemory_GetUsage(orxMEMORY_TYPE_MAIN, orxNULL, orxNULL, &u32ObjectSize, orxNULL, orxNULL);
+  u32ObjectSize -= u32StartSize;
+#endif /* __orxPROFILER__ */
+
+  /* Deletes it */
+  for(i = 0; i < orxBENCH_KU32_TILE_BLOCK_SIZE * orxBENCH_KU32_TILE_BLOCK_SIZE; i++)
+  {
+    orxObject_Delete(apstObjectList[i]);
+  }
+  orxMemory_Free(apstObjectList);
+
+  /* Creates grid with a tile map */
+#ifdef __orxPROFILER__
+  orxMemory_GetUsage(orxMEMORY_TYPE_MAIN, orxNULL, orxNULL, &u32StartSize, orxNULL, orxNULL);
+#endif /* __orxPROFILER__ */
+  dTileMapTime = orxSystem_GetTime();
+  pstTileMap = orxBench_CreateTileMap();
+  dTileMapTime = orxSystem_GetTime() - dTileMapTime;
+#ifdef __orxPROFILER__
+  orxMemory_GetUsage(orxMEMORY_TYPE_MAIN, orxNULL, orxNULL, &u32TileMapSize, orxNULL, orxNULL);
+  u32TileMapSize -= u32StartSize;
+#endif /* __orxPROFILER__ */
+
+  /* Logs creation times */
+  orxLOG("%-24s %.2f ns per tile object, %.2f ns per tile map tile (%ux%u)", "TileMap.Memory", (dObjectTime * 1e9) / (orxBENCH_KU32_TILE_BLOCK_SIZE * orxBENCH_KU32_TILE_BLOCK_SIZE), (dTileMapTime * 1e9) / (orxBENCH_KU32_TILEMAP_SIZE * orxBENCH_KU32_TILEMAP_SIZE), orxBENCH_KU32_TILEMAP_SIZE, orxBENCH_KU32_TILEMAP_SIZE);
+
+#ifdef __orxPROFILER__
+
+  /* Tracked memory? */
+  if(u32ObjectSize != 0)
+  {
+    /* Logs it */
+    orxLOG("%-24s %u bytes per tile object, %u bytes per tile map tile (%ux%u)", "TileMap.Memory", u32ObjectSize / (orxBENCH_KU32_TILE_BLOCK_SIZE * orxBENCH_KU32_TILE_BLOCK_SIZE), u32TileMapSize / (orxBENCH_KU32_TILEMAP_SIZE * orxBENCH_KU32_TILEMAP_SIZE), orxBENCH_KU32_TILEMAP_SIZE, orxBENCH_KU32_TILEMAP_SIZE);
+  }
+
+#endif /* __orxPROFILER__ */
+
+  /* Valid tile map that rejects grids whose size would overflow? */
+  if((pstTileMap != orxNULL)
+  && (orxTileMap_GetTile(pstTileMap, orxBENCH_KU32_TILEMAP_SIZE - 1, orxBENCH_KU32_TILEMAP_SIZE - 1) == 1)
+  && (orxTileMap_Create(0x10000, 0x10000, orxVector_Set(&vTileSize, orxFLOAT_1, orxFLOAT_1, orxFLOAT_0)) == orxNULL))
+  {
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
+
+  /* Deletes tile map */
+  if(pstTileMap != orxNULL)
+  {
+    orxTileMap_Delete(pstTileMap);
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+#ifdef __orxMEMORY_PROFILER__
+
+/** Check: memory profiler reports a known allocation pattern under its tag
+ */
+static orxSTATUS orxFASTCALL orxBench_CheckMemoryProfile()
+{
+  const orxSTRING zPreviousTag;
+  orxCHAR        *acBuffer;
+  orxU32          i;
+  orxSTATUS       eResult = orxSTATUS_FAILURE;
+
+  /* Allocates 10 blocks of 1000 bytes under a tag & frees 4 of them */
+  zPreviousTag = orxMemory_SetProfilerTag("orxBench/Profile");
+  for(i = 0; i < 10; i++)
+  {
+    sstBench.apCellList[i] = orxMemory_Allocate(1000, orxMEMORY_TYPE_MAIN);
+  }
+  orxMemory_SetProfilerTag(zPreviousTag);
+  for(i = 0; i < 4; i++)
+  {
+    orxMemory_Free(sstBench.apCellList[i]);
+  }
+
+  /* Dumps & reads report */
+  if((orxMemory_DumpProfile(orxBENCH_KZ_REPORT_FILE) != orxSTATUS_FAILURE)
+  && ((acBuffer = orxBench_ReadFile(orxBENCH_KZ_REPORT_FILE)) != orxNULL))
+  {
+    const orxCHAR *pcTag;
+
+    /* Finds tag */
+    pcTag = orxString_SearchString(acBuffer, "[orxBench/Profile]");
+
+    /* Found? */
+    if(pcTag != orxNULL)
+    {
+      const orxCHAR *pcLine;
+      orxU32         u32Size, u32PeakSize, u32Count, u32AllocationCount, u32FreeCount;
+
+      /* Finds its line */
+      for(pcLine = pcTag; (pcLine > acBuffer) && (*(pcLine - 1) != '\n'); pcLine--);
+
+      /* Matches pattern: 6000 live bytes, 10000 peak bytes, 6 live blocks, 10 allocations, 4 frees? */
+      if((orxString_Scan(pcLine, "%u %u %u %u %u", &u32Size, &u32PeakSize, &u32Count, &u32AllocationCount, &u32FreeCount) == 5)
+      && (u32Size == 6000)
+      && (u32PeakSize == 10000)
+      && (u32Count == 6)
+      && (u32AllocationCount == 10)
+      && (u32FreeCount == 4))
+      {
+        /* Updates result */
+        eResult = orxSTATUS_SUCCESS;
+      }
+    }
+
+    /* Deletes buffer */
+    orxMemory_Free(acBuffer);
+  }
+
+  /* Frees remaining blocks & removes report */
+  for(i = 4; i < 10; i++)
+  {
+    orxMemory_Free(sstBench.apCellList[i]);
+  }
+  orxFile_Remove(orxBENCH_KZ_REPORT_FILE);
+
+  /* Done! */
+  return eResult;
+}
+
+#endif /* __orxMEMORY_PROFILER__ */
+
+#ifdef __orxMEMORY_ARENAS__
+
+/** Check: level churn gives all its memory back to the arenas, logs their fragmentation
+ */
+static orxSTATUS orxFASTCALL orxBench_CheckMemoryChurn()
+{
+  static const orxMEMORY_TYPE saeTypeList[] = {orxMEMORY_TYPE_MAIN, orxMEMORY_TYPE_CONFIG, orxMEMORY_TYPE_TEMP};
+  orxU32    au32InUseList[orxARRAY_GET_ITEM_COUNT(saeTypeList)];
+  orxU32    i;
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Gets used sizes */
+  for(i = 0; i < orxARRAY_GET_ITEM_COUNT(saeTypeList); i++)
+  {
+    orxMemory_GetArenaFootprint(saeTypeList[i], &au32InUseList[i]);
+  }
+
+  /* Loads & unloads levels */
+  orxBench_MemoryChurn(64);
+
+  /* For all types */
+  for(i = 0; i < orxARRAY_GET_ITEM_COUNT(saeTypeList); i++)
+  {
+    orxU32 u32Footprint, u32InUse;
+
+    /* Gets footprint */
+    u32Footprint = orxMemory_GetArenaFootprint(saeTypeList[i], &u32InUse);
+
+    /* Logs it */
+    orxLOG("%-24s type %u: %u bytes footprint, %u bytes in use", "Memory.Churn", saeTypeList[i], u32Footprint, u32InUse);
+
+    /* Leaked? */
+    if(u32InUse > au32InUseList[i])
+    {
+      eResult = orxSTATUS_FAILURE;
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+#endif /* __orxMEMORY_ARENAS__ */
+
+/** Benchmarks
+ */
+static const orxBENCH sastBenchList[] =
+{
+  {"HashTable.Add",             orxBench_HashTableAddChained,     65536,    orxMODULE_ID_NONE},
+  {"HashTable.Add.Open",        orxBench_HashTableAddOpen,        65536,    orxMODULE_ID_NONE},
+  {"HashTable.Add.1K",          orxBench_HashTableAddChained,     1000,     orxMODULE_ID_NONE},
+  {"HashTable.Add.Open.1K",     orxBench_HashTableAddOpen,        1000,     orxMODULE_ID_NONE},
+  {"HashTable.Add.100K",        orxBench_HashTableAddChained,     100000,   orxMODULE_ID_NONE},
+  {"HashTable.Add.Open.100K",   orxBench_HashTableAddOpen,        100000,   orxMODULE_ID_NONE},
+  {"HashTable.Add.1M",          orxBench_HashTableAddChained,     1000000,  orxMODULE_ID_NONE},
+  {"HashTable.Add.Open.1M",     orxBench_HashTableAddOpen,        1000000,  orxMODULE_ID_NONE},
+  {"HashTable.Get",             orxBench_HashTableGetChained,     200000,   orxMODULE_ID_NONE},
+  {"HashTable.Get.Open",        orxBench_HashTableGetOpen,        200000,   orxMODULE_ID_NONE},
+  {"HashTable.Get.1K",          orxBench_HashTableGetChained1K,   1000000,  orxMODULE_ID_NONE},
+  {"HashTable.Get.Open.1K",     orxBench_HashTableGetOpen1K,      1000000,  orxMODULE_ID_NONE},
+  {"HashTable.Get.100K",        orxBench_HashTableGetChained100K, 1000000,  orxMODULE_ID_NONE},
+  {"HashTable.Get.Open.100K",   orxBench_HashTableGetOpen100K,    1000000,  orxMODULE_ID_NONE},
+  {"HashTable.Get.1M",          orxBench_HashTableGetChained1M,   1000000,  orxMODULE_ID_NONE},
+  {"HashTable.Get.Open.1M",     orxBench_HashTableGetOpen1M,      1000000,  orxMODULE_ID_NONE},
+  {"Bank.AllocateFree",         orxBench_BankDefault,             200000,   orxMODULE_ID_NONE},
+  {"Bank.AllocateFree.Safe",    orxBench_BankThreadSafe,          200000,   orxMODULE_ID_NONE},
+  {"Bank.GetAtIndex",           orxBench_BankGetAtIndex,          1000000,  orxMODULE_ID_NONE},
+  {"Memory.Churn",              orxBench_MemoryChurn,             200,      orxMODULE_ID_NONE},
+  {"String.GetID",              orxBench_StringGetID,             200000,   orxMODULE_ID_NONE},
+  {"String.ToCRC",              orxBench_StringToCRC,             1000000,  orxMODULE_ID_NONE},
+  {"String.NToCRC.Short",       orxBench_StringNToCRCShort,       1000000,  orxMODULE_ID_NONE},
+  {"String.NToCRC.Long",        orxBench_StringNToCRCLong,        20000,    orxMODULE_ID_NONE},
+  {"Config.GetU32",             orxBench_ConfigGetU32,            200000,   orxMODULE_ID_NONE},
+  {"Command.Evaluate",          orxBench_CommandEvaluate,         50000,    orxMODULE_ID_NONE},
+  {"Event.Send",                orxBench_EventSend,               200000,   orxMODULE_ID_NONE},
+  {"Frame.Update",              orxBench_FrameUpdate,             100000,   orxMODULE_ID_NONE},
+  {"Structure.Get",             orxBench_StructureGet,            1000000,  orxMODULE_ID_NONE},
+  {"Structure.Iterate",         orxBench_StructureIterateDefault, 1000000,  orxMODULE_ID_OBJECT},
+  {"Structure.Array.50K",       orxBench_StructureIterate50K,     1000000,  orxMODULE_ID_OBJECT},
+  {"Structure.List.50K",        orxBench_StructureIterate50KList, 1000000,  orxMODULE_ID_OBJECT},
+  {"Object.Update.Array.50K",   orxBench_ObjectUpdate50K,         1000000,  orxMODULE_ID_OBJECT},
+  {"Object.Update.List.50K",    orxBench_ObjectUpdate50KList,     1000000,  orxMODULE_ID_OBJECT},
+  {"Anim.Objects",              orxBench_AnimObjects,             100000,   orxMODULE_ID_ANIMPOINTER},
+  {"TileMap.Objects",           orxBench_TileObjects,             262144,   orxMODULE_ID_OBJECT},
+  {"TileMap.Grid",              orxBench_TileMap,                 2621440,  orxMODULE_ID_OBJECT},
+  {"Particles.Spawner",         orxBench_ParticlesSpawner,        600000,   orxMODULE_ID_PARTICLESYSTEM},
+  {"Particles.System",          orxBench_ParticlesSystem,         600000,   orxMODULE_ID_PARTICLESYSTEM},
+  {"Profiler.Marker",           orxBench_ProfilerMarker,          1000000,  orxMODULE_ID_NONE},
+  {"Profiler.Marker.Sparse",    orxBench_ProfilerMarkerSparse,    1000000,  orxMODULE_ID_NONE},
+  {"Profiler.Sampling",         orxBench_ProfilerSampling,        20000,    orxMODULE_ID_NONE},
+  {"Debug.LogFile",             orxBench_LogFile,                 20000,    orxMODULE_ID_NONE}
+};
+
+/** Checks
+ */
+static const orxBENCH_CHECK sastCheckList[] =
+{
+  {"Bank.Indices",              orxBench_CheckBank,               orxMODULE_ID_NONE},
+  {"Bank.Threads",              orxBench_CheckBankThreads,        orxMODULE_ID_NONE},
+  {"HashTable.Layouts",         orxBench_CheckHashTable,          orxMODULE_ID_NONE},
+#ifdef __orxMEMORY_PROFILER__
+  {"Memory.Profile",            orxBench_CheckMemoryProfile,      orxMODULE_ID_NONE},
+#endif /* __orxMEMORY_PROFILER__ */
+#ifdef __orxMEMORY_ARENAS__
+  {"Memory.Churn",              orxBench_CheckMemoryChurn,        orxMODULE_ID_NONE},
+#endif /* __orxMEMORY_ARENAS__ */
+  {"String.Threads",            orxBench_CheckStringThreads,      orxMODULE_ID_NONE},
+  {"String.Threads.1M",         orxBench_CheckStringManyThreads,  orxMODULE_ID_NONE},
+  {"String.CRC",                orxBench_CheckCRC,                orxMODULE_ID_NONE},
+  {"Structure.Order",           orxBench_CheckStructureOrder,     orxMODULE_ID_OBJECT},
+  {"Anim.Objects",              orxBench_CheckAnimObjects,        orxMODULE_ID_ANIMPOINTER},
+  {"TileMap.Memory",            orxBench_CheckTileMap,            orxMODULE_ID_OBJECT},
+  {"Particles.Live",            orxBench_CheckParticles,          orxMODULE_ID_PARTICLESYSTEM},
+  {"Profiler.Trace",            orxBench_CheckTrace,              orxMODULE_ID_NONE},
+  {"Profiler.Sampling",         orxBench_CheckSampling,           orxMODULE_ID_NONE},
+  {"Profiler.CostReport",       orxBench_CheckCostReport,         orxMODULE_ID_OBJECT},
+  {"Debug.LogThreads",          orxBench_CheckLog,                orxMODULE_ID_NONE}
+};
+
+/** Inits a benchmark's or check's scene module on demand, only when no window nor audio device can get opened
+ */
+static orxSTATUS orxFASTCALL orxBench_InitModule(orxMODULE_ID _eModuleID)
+{
+  orxSTATUS eResult;
+
+  /* Core only? */
+  if(_eModuleID == orxMODULE_ID_NONE)
+  {
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
+  else
+  {
+#if defined(__orxHEADLESS__) || defined(__orxSTATIC__)
+
+    /* Inits object & concerned modules */
+    eResult = ((orxModule_Init(orxMODULE_ID_OBJECT) != orxSTATUS_FAILURE)
+            && (orxModule_Init(_eModuleID) != orxSTATUS_FAILURE))
+            ? orxSTATUS_SUCCESS
+            : orxSTATUS_FAILURE;
+
+#else /* __orxHEADLESS__ || __orxSTATIC__ */
+
+    /* Would open a window */
+    eResult = orxSTATUS_FAILURE;
+
+#endif /* __orxHEADLESS__ || __orxSTATIC__ */
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Runs a benchmark
+ */
+static void orxFASTCALL orxBench_Run(const orxBENCH *_pstBench)
+{
+  /* Inits its module */
+  if(orxBench_InitModule(_pstBench->eModuleID) != orxSTATUS_FAILURE)
+  {
+    orxBENCH_RESULT  *pstResult;
+    orxDOUBLE         dTotalTime = orxDOUBLE_0;
+    orxU32            i;
+
+    /* Gets result */
+    pstResult = &(sstBench.astResultList[sstBench.u32ResultCount++]);
+
+    /* Inits it */
+    pstResult->zName      = _pstBench->zName;
+    pstResult->u32Count   = _pstBench->u32Count;
+    pstResult->dBestTime  = orxDOUBLE_0;
+
+    /* Warms up */
+    _pstBench->pfnRun(_pstBench->u32Count / 10 + 1);
+
+    /* For all runs */
+    for(i = 0; i < orxBENCH_KU32_RUN_NUMBER; i++)
+    {
+      orxDOUBLE dTime;
+
+      /* Runs it */
+      dTime = _pstBench->pfnRun(_pstBench->u32Count);
+
+      /* Updates result */
+      if((i == 0) || (dTime < pstResult->dBestTime))
+      {
+        pstResult->dBestTime = dTime;
+      }
+      dTotalTime += dTime;
+    }
+    pstResult->dMeanTime = dTotalTime / orxBENCH_KU32_RUN_NUMBER;
+
+    /* Logs it */
+    orxLOG("%-24s %10.2f ns/op (mean %.2f)", pstResult->zName, pstResult->dBestTime * 1e9 / pstResult->u32Count, pstResult->dMeanTime * 1e9 / pstResult->u32Count);
+  }
+  else
+  {
+    /* Logs it */
+    orxLOG("%-24s %10s (needs module <%s>, build headless)", _pstBench->zName, "skipped", orxModule_GetName(_pstBench->eModuleID));
+  }
+}
+
+/** Runs a check
+ */
+static void orxFASTCALL orxBench_RunCheck(const orxBENCH_CHECK *_pstCheck)
+{
+  /* Inits its module */
+  if(orxBench_InitModule(_pstCheck->eModuleID) != orxSTATUS_FAILURE)
+  {
+    orxBENCH_CHECK_RESULT *pstResult;
+
+    /* Gets result */
+    pstResult = &(sstBench.astCheckResultList[sstBench.u32CheckCount++]);
+
+    /* Runs check */
+    pstResult->zName    = _pstCheck->zName;
+    pstResult->dTime    = orxSystem_GetTime();
+    pstResult->bPassed  = (_pstCheck->pfnRun() != orxSTATUS_FAILURE) ? orxTRUE : orxFALSE;
+    pstResult->dTime    = orxSystem_GetTime() - pstResult->dTime;
+
+    /* Failed? */
+    if(pstResult->bPassed == orxFALSE)
+    {
+      /* Updates failure count */
+      sstBench.u32FailureCount++;
+    }
+
+    /* Logs it */
+    orxLOG("%-24s %10s (%.3fs)", pstResult->zName, (pstResult->bPassed != orxFALSE) ? "passed" : "FAILED", pstResult->dTime);
+  }
+  else
+  {
+    /* Logs it */
+    orxLOG("%-24s %10s (needs module <%s>, build headless)", _pstCheck->zName, "skipped", orxModule_GetName(_pstCheck->eModuleID));
+  }
+}
+
+/** Writes all results
+ */
+static orxSTATUS orxFASTCALL orxBench_WriteResults()
+{
+  orxFILE  *pstFile;
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Opens file */
+  pstFile = orxFile_Open(sstBench.zResultFile, orxFILE_KU32_FLAG_OPEN_WRITE | orxFILE_KU32_FLAG_OPEN_BINARY);
+
+  /* Success? */
+  if(pstFile != orxNULL)
+  {
+    orxU32 i;
+
+    /* Writes header */
+    orxFile_Print(pstFile, "{\n  \"version\": \"%s\",\n  \"unit\": \"ns/op\",\n  \"benchmarks\":\n  [", orxSystem_GetVersionFullString());
+
+    /* Writes benchmarks */
+    for(i = 0; i < sstBench.u32ResultCount; i++)
+    {
+      const orxBENCH_RESULT *pstResult = &(sstBench.astResultList[i]);
+
+      orxFile_Print(pstFile, "%s\n    {\"name\": \"%s\", \"count\": %u, \"best\": %.3f, \"mean\": %.3f}", (i != 0) ? "," : "", pstResult->zName, pstResult->u32Count, pstResult->dBestTime * 1e9 / pstResult->u32Count, pstResult->dMeanTime * 1e9 / pstResult->u32Count);
+    }
+
+    /* Writes checks */
+    orxFile_Print(pstFile, "\n  ],\n  \"checks\":\n  [");
+    for(i = 0; i < sstBench.u32CheckCount; i++)
+    {
+      const orxBENCH_CHECK_RESULT *pstResult = &(sstBench.astCheckResultList[i]);
+
+      orxFile_Print(pstFile, "%s\n    {\"name\": \"%s\", \"passed\": %s, \"time\": %.6f}", (i != 0) ? "," : "", pstResult->zName, (pstResult->bPassed != orxFALSE) ? "true" : "false", pstResult->dTime);
+    }
+    orxFile_Print(pstFile, "\n  ]\n}\n");
+
+    /* Closes file */
+    orxFile_Close(pstFile);
+
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
+  else
+  {
+    /* Logs message */
+    orxLOG("Couldn't open <%s> to write results.", sstBench.zResultFile);
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Setups main module
+ */
+static void orxFASTCALL orxBench_Setup()
+{
+  /* Adds dependencies: core modules only, no display/sound/input plugins are needed */
+  orxModule_AddDependency(orxMODULE_ID_MAIN, orxMODULE_ID_PARAM);
+  orxModule_AddDependency(orxMODULE_ID_MAIN, orxMODULE_ID_CLOCK);
+  orxModule_AddDependency(orxMODULE_ID_MAIN, orxMODULE_ID_CONFIG);
+  orxModule_AddDependency(orxMODULE_ID_MAIN, orxMODULE_ID_COMMAND);
+  orxModule_AddDependency(orxMODULE_ID_MAIN, orxMODULE_ID_EVENT);
+  orxModule_AddDependency(orxMODULE_ID_MAIN, orxMODULE_ID_FILE);
+  orxModule_AddDependency(orxMODULE_ID_MAIN, orxMODULE_ID_FRAME);
+  orxModule_AddDependency(orxMODULE_ID_MAIN, orxMODULE_ID_PROFILER);
+  orxModule_AddDependency(orxMODULE_ID_MAIN, orxMODULE_ID_STRUCTURE);
+  orxModule_AddDependency(orxMODULE_ID_MAIN, orxMODULE_ID_THREAD);
+}
+
+/** Inits main module: runs everything
+ */
+static orxSTATUS orxFASTCALL orxBench_Init()
+{
+  orxU32 i, u32PrefixLength;
+
+  /* Inits strings & config keys */
+  for(i = 0; i < orxBENCH_KU32_STRING_NUMBER; i++)
+  {
+    orxString_NPrint(sstBench.aacStringList[i], sizeof(sstBench.aacStringList[i]) - 1, "orxBench/String%u", i);
+  }
+  orxConfig_PushSection(orxBENCH_KZ_CONFIG_SECTION);
+  for(i = 0; i < orxBENCH_KU32_CONFIG_KEY_NUMBER; i++)
+  {
+    orxString_NPrint(sstBench.aacKeyList[i], sizeof(sstBench.aacKeyList[i]) - 1, "Key%u", i);
+    orxConfig_SetU32(sstBench.aacKeyList[i], i);
+  }
+  orxConfig_PopSection();
+
+  /* Inits CRC buffer */
+  for(i = 0; i < sizeof(sstBench.acBuffer); i++)
+  {
+    sstBench.acBuffer[i] = (orxCHAR)('a' + (i * 13) % 26);
+  }
+
+  /* Inits particle configs: long-lived particles of the pixel texture, all emitted upfront */
+  orxConfig_PushSection("BenchParticleGraphic");
+  orxConfig_SetString("Texture", "pixel");
+  orxConfig_PopSection();
+  orxConfig_PushSection(orxBENCH_KZ_CONFIG_TILE);
+  orxConfig_SetString("Graphic", "BenchParticleGraphic");
+  orxConfig_PopSection();
+  orxConfig_PushSection("BenchParticle");
+  orxConfig_SetString("Graphic", "BenchParticleGraphic");
+  orxConfig_SetFloat("LifeTime", orx2F(1000.0f));
+  orxConfig_PopSection();
+  orxConfig_PushSection("BenchSpawnerEffect");
+  orxConfig_SetString("Object", "BenchParticle");
+  orxConfig_SetU32("ActiveObject", orxBENCH_KU32_PARTICLE_NUMBER);
+  orxConfig_SetString("ObjectSpeed", "(10, 10, 0)");
+  orxConfig_SetBool("CleanOnDelete", orxTRUE);
+  orxConfig_PopSection();
+  orxConfig_PushSection(orxBENCH_KZ_CONFIG_SPAWNER);
+  orxConfig_SetString("Spawner", "BenchSpawnerEffect");
+  orxConfig_PopSection();
+  orxConfig_PushSection("BenchParticleSystemEffect");
+  orxConfig_SetString("Graphic", "BenchParticleGraphic");
+  orxConfig_SetU32("ActiveParticle", orxBENCH_KU32_PARTICLE_NUMBER);
+  orxConfig_SetString("ParticleSpeed", "(10, 10, 0)");
+  orxConfig_SetFloat("LifeTime", orx2F(1000.0f));
+  orxConfig_PopSection();
+  orxConfig_PushSection(orxBENCH_KZ_CONFIG_PARTICLESYSTEM);
+  orxConfig_SetString("ParticleSystem", "BenchParticleSystemEffect");
+  orxConfig_PopSection();
+
+  /* Gets prefix length */
+  u32PrefixLength = (sstBench.zPrefix != orxNULL) ? orxString_GetLength(sstBench.zPrefix) : 0;
+
+  /* Runs matching checks */
+  for(i = 0; i < orxARRAY_GET_ITEM_COUNT(sastCheckList); i++)
+  {
+    if(orxString_NCompare(sastCheckList[i].zName, sstBench.zPrefix, u32PrefixLength) == 0)
+    {
+      orxBench_RunCheck(&sastCheckList[i]);
+    }
+  }
+
+  /* Runs matching benchmarks */
+  for(i = 0; i < orxARRAY_GET_ITEM_COUNT(sastBenchList); i++)
+  {
+    if(orxString_NCompare(sastBenchList[i].zName, sstBench.zPrefix, u32PrefixLength) == 0)
+    {
+      orxBench_Run(&sastBenchList[i]);
+    }
+  }
+
+  /* Writes results */
+  if(orxBench_WriteResults() == orxSTATUS_FAILURE)
+  {
+    /* Counts it as a failure */
+    sstBench.u32FailureCount++;
+  }
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
+/** Main function
+ */
+int main(int argc, char **argv)
+{
+  int iResult = 1;
+
+  /* Gets arguments */
+  sstBench.zResultFile  = (argc > 1) ? argv[1] : orxBENCH_KZ_RESULT_FILE;
+  sstBench.zPrefix      = (argc > 2) ? argv[2] : orxSTRING_EMPTY;
+
+  /* Inits the Debug System */
+  orxDEBUG_INIT();
+
+  /* Registers main module */
+  orxModule_Register(orxMODULE_ID_MAIN, "MAIN", orxBench_Setup, orxBench_Init, orxNULL);
+
+  /* Sends the command line arguments to orxParam module (only the executable name, ours aren't orx parameters) */
+  if(orxParam_SetArgs(1, argv) != orxSTATUS_FAILURE)
+  {
+    /* Inits the engine & runs benchmarks */
+    if(orxModule_Init(orxMODULE_ID_MAIN) != orxSTATUS_FAILURE)
+    {
+      /* Updates result */
+      iResult = (int)sstBench.u32FailureCount;
+
+      /* Exits from engine */
+      orxModule_Exit(orxMODULE_ID_MAIN);
+    }
+  }
+
+  /* Exits from the Debug system */
+  orxDEBUG_EXIT();
+
+  /* Done! */
+  return iResult;
+}
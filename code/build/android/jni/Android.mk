@@ -21,6 +21,7 @@ ORX_SRC_FILES := \
 	display/orxFont.c         \
 	display/orxText.c         \
 	display/orxTexture.c      \
+	display/orxTileMap.c      \
 	render/orxCamera.c        \
 	render/orxViewport.c      \
 	render/orxShaderPointer.c \
@@ -37,6 +38,7 @@ ORX_SRC_FILES := \
 	core/orxThread.c          \
 	core/orxClock.c           \
 	core/orxLocale.c          \
+	core/orxReplay.c          \
 	main/orxParam.c           \
 	physics/orxPhysics.c      \
 	physics/orxBody.c         \
@@ -46,6 +48,7 @@ ORX_SRC_FILES := \
 	object/orxFX.c            \
 	object/orxFXPointer.c     \
 	object/orxObject.c        \
+	object/orxParticleSystem.c \
 	object/orxSpawner.c       \
 	plugin/orxPlugin.c        \
 	sound/orxSoundPointer.c   \
@@ -86,6 +86,36 @@ newoption
     description = "Split target folders based on platforms"
 }
 
+newoption
+{
+    trigger = "crc32c",
+    description = "Use CRC32C for string IDs (hardware accelerated on SSE4.2 CPUs, not compatible with previously saved IDs)"
+}
+
+newoption
+{
+    trigger = "memprofiler",
+    description = "Record allocation sites (caller or tag) with live/peak bytes and call counts, report written to orxmemory.txt at exit"
+}
+
+newoption
+{
+    trigger = "memarenas",
+    description = "Use separate dlmalloc arenas (mspaces) for groups of memory types, to reduce fragmentation and lock contention"
+}
+
+newoption
+{
+    trigger = "dummyinput",
+    description = "Embed the Dummy keyboard, mouse & joystick plugins instead of the GLFW ones (for headless replays)"
+}
+
+newoption
+{
+    trigger = "headless",
+    description = "Embed the Dummy display, sound & input plugins: no window nor audio device is ever opened (for orxBench, replays & servers)"
+}
+
 if os.is ("macosx") then
     osname = "mac"
 else
@@ -170,6 +200,23 @@ solution "orx"
     configuration {"*Release*"}
         flags {"Optimize", "NoRTTI"}
 
+    configuration {}
+    if _OPTIONS["crc32c"] then
+        defines {"__orxSTRING_CRC32C__"}
+    end
+    if _OPTIONS["memprofiler"] then
+        defines {"__orxMEMORY_PROFILER__"}
+    end
+    if _OPTIONS["memarenas"] then
+        defines {"__orxMEMORY_ARENAS__"}
+    end
+    if _OPTIONS["dummyinput"] then
+        defines {"__orxDUMMY_INPUT__"}
+    end
+    if _OPTIONS["headless"] then
+        defines {"__orxHEADLESS__"}
+    end
+
 
 -- Linux
 
@@ -605,3 +652,66 @@ project "Bounce"
         links {"imporxp"}
     configuration {"windows", "*Core*", "*Release*"}
         links {"imporx"}
+
+
+--
+-- Project: orxBench
+--
+
+project "orxBench"
+
+    files {"../bench/orxBench.c"}
+
+    targetdir ("../bin")
+    if _OPTIONS["split-platforms"] then
+        configuration {"x32"}
+            targetdir ("../bin/x32")
+
+        configuration {"x64"}
+            targetdir ("../bin/x64")
+
+        configuration {}
+    end
+
+    kind ("ConsoleApp")
+
+    links {"orxLIB"}
+
+    configuration {"not xcode*", "*Core*"}
+        defines {"__orxSTATIC__"}
+
+
+-- Linux
+
+    configuration {"linux"}
+        linkoptions {"-Wl,-rpath ./"}
+
+    configuration {"linux", "*Core*"}
+        links
+        {
+            "dl",
+            "m",
+            "rt",
+            "pthread"
+        }
+
+
+-- Mac OS X
+
+    configuration {"macosx", "not xcode*", "*Core*"}
+        links
+        {
+            "Foundation.framework",
+            "IOKit.framework",
+            "AppKit.framework",
+            "pthread"
+        }
+
+
+-- Windows
+
+    configuration {"windows", "*Core*"}
+        links
+        {
+            "winmm"
+        }
@@ -130,6 +130,8 @@ extern orxDLLAPI void orxFASTCALL                   orxAnimSet_AddReference(orxA
 extern orxDLLAPI void orxFASTCALL                   orxAnimSet_RemoveReference(orxANIMSET *_pstAnimSet);
 
 /** Clones an AnimSet Link Table
+ * The clone shares a read-only snapshot of the AnimSet's link arrays (copy-on-write): they'll only get duplicated the first time the clone is modified (ie. when a loop count gets consumed).
+ * Modifying the AnimSet afterwards won't affect existing clones, as if they had been copied.
  * @param[in]   _pstAnimSet                         AnimSet to clone
  * @return An internally allocated clone of the AnimSet
  */
@@ -80,10 +80,12 @@ typedef enum __orxMODULE_ID_t
   orxMODULE_ID_MOUSE,
   orxMODULE_ID_OBJECT,
   orxMODULE_ID_PARAM,
+  orxMODULE_ID_PARTICLESYSTEM,
   orxMODULE_ID_PHYSICS,
   orxMODULE_ID_PLUGIN,
   orxMODULE_ID_PROFILER,
   orxMODULE_ID_RENDER,
+  orxMODULE_ID_REPLAY,
   orxMODULE_ID_RESOURCE,
   orxMODULE_ID_SCREENSHOT,
   orxMODULE_ID_SHADER,
@@ -98,6 +100,7 @@ typedef enum __orxMODULE_ID_t
   orxMODULE_ID_TEXT,
   orxMODULE_ID_TEXTURE,
   orxMODULE_ID_THREAD,
+  orxMODULE_ID_TILEMAP,
   orxMODULE_ID_TIMELINE,
   orxMODULE_ID_VIEWPORT,
 
@@ -120,6 +120,20 @@ typedef struct __orxEVENT_t
  */
 typedef orxSTATUS (orxFASTCALL *orxEVENT_HANDLER)(const orxEVENT *_pstEvent);
 
+/** Event handler stats structure (handler profiling)
+ */
+typedef struct __orxEVENT_HANDLER_STATS_t
+{
+  orxEVENT_HANDLER  pfnHandler;                       /**< Handler */
+  const orxSTRING   zName;                            /**< Handler name (symbol when available, address otherwise) */
+  orxDOUBLE         dTotalTime;                       /**< Total time spent in handler, including nested sends */
+  orxDOUBLE         dMaxTime;                         /**< Max time spent in a single call */
+  orxU32            u32CallCount;                     /**< Call count */
+  orxEVENT_TYPE     eType;                            /**< Event type */
+  orxENUM           eID;                              /**< Event ID */
+
+} orxEVENT_HANDLER_STATS;
+
 
 /** Event module setup
  */
@@ -182,6 +196,38 @@ extern orxDLLAPI orxSTATUS orxFASTCALL  orxEvent_SendShort(orxEVENT_TYPE _eEvent
  */
 extern orxDLLAPI orxBOOL orxFASTCALL    orxEvent_IsSending();
 
+
+/** Enables/disables handler profiling (main thread only, requires a build with __orxPROFILER__): each handler call is then timed, counted per event type, event ID & handler, and pushed as its own profiler marker
+ * @param[in] _bEnable              Enable / disable
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL  orxEvent_EnableProfiling(orxBOOL _bEnable);
+
+/** Is handler profiling enabled?
+ * @return orxTRUE / orxFALSE
+ */
+extern orxDLLAPI orxBOOL orxFASTCALL    orxEvent_IsProfilingEnabled();
+
+/** Gets handler stats count
+ * @return Number of recorded (event type, event ID, handler) entries
+ */
+extern orxDLLAPI orxU32 orxFASTCALL     orxEvent_GetHandlerStatsCount();
+
+/** Gets handler stats, sorted by decreasing total time
+ * @param[in] _u32Index             Index of the entry, in [0, orxEvent_GetHandlerStatsCount()[
+ * @return orxEVENT_HANDLER_STATS / orxNULL, only valid until next handler call or reset
+ */
+extern orxDLLAPI const orxEVENT_HANDLER_STATS *orxFASTCALL orxEvent_GetHandlerStats(orxU32 _u32Index);
+
+/** Resets all handler stats
+ */
+extern orxDLLAPI void orxFASTCALL       orxEvent_ResetHandlerStats();
+
+/** Logs handler stats, sorted by decreasing total time
+ * @param[in] _u32Count             Max number of entries to log, 0 for all
+ */
+extern orxDLLAPI void orxFASTCALL       orxEvent_LogHandlerStats(orxU32 _u32Count);
+
 #endif /*_orxEVENT_H_*/
 
 /** @} */
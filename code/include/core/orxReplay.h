@@ -0,0 +1,129 @@
+/* Orx - Portable Game Engine
+ *
+ * Copyright (c) 2008-2018 Orx-Project
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ *    1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ *
+ *    2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ *
+ *    3. This notice may not be removed or altered from any source
+ *    distribution.
+ */
+
+/**
+ * @file orxReplay.h
+ * @date 19/10/2026
+ * @author iarwain@orx-project.org
+ *
+ * @todo
+ */
+
+/**
+ * @addtogroup orxReplay
+ *
+ * Replay module
+ * Module that records the clock's DT and the input device values of every frame to a file,
+ * and that can play them back later, with a fixed time source, in order to get identical frames.
+ *
+ * Recording/playback can be started from config:
+ *
+ * [Replay]
+ * Record = orxreplay.bin ; Records the session to this file
+ * Play = orxreplay.bin ; Plays this file back instead (takes precedence over Record)
+ * QuitOnEnd = true ; Sends a close event when playback is over (default: true)
+ *
+ * @{
+ */
+
+
+#ifndef _orxREPLAY_H_
+#define _orxREPLAY_H_
+
+
+#include "orxInclude.h"
+
+#include "io/orxInput.h"
+
+
+/** Misc
+ */
+#define orxREPLAY_KZ_DEFAULT_FILE         "orxreplay.bin"
+
+
+/** Replay module setup
+ */
+extern orxDLLAPI void orxFASTCALL         orxReplay_Setup();
+
+/** Inits the replay module
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL    orxReplay_Init();
+
+/** Exits from the replay module
+ */
+extern orxDLLAPI void orxFASTCALL         orxReplay_Exit();
+
+
+/** Starts recording to a file, stops any current recording/playback
+ * @param[in]   _zFileName      File name, orxNULL for default one
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL    orxReplay_Record(const orxSTRING _zFileName);
+
+/** Starts playing back a file, stops any current recording/playback
+ * @param[in]   _zFileName      File name, orxNULL for default one
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL    orxReplay_Play(const orxSTRING _zFileName);
+
+/** Stops current recording/playback
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL    orxReplay_Stop();
+
+/** Is recording?
+ * @return orxTRUE / orxFALSE
+ */
+extern orxDLLAPI orxBOOL orxFASTCALL      orxReplay_IsRecording();
+
+/** Is playing back?
+ * @return orxTRUE / orxFALSE
+ */
+extern orxDLLAPI orxBOOL orxFASTCALL      orxReplay_IsPlaying();
+
+
+/** Processes a new frame's DT: records it or replaces it with the played back one (called by the clock module)
+ * @param[in]   _fDT            Natural DT
+ * @return      DT to use for this frame
+ */
+extern orxDLLAPI orxFLOAT orxFASTCALL     orxReplay_ProcessDT(orxFLOAT _fDT);
+
+/** Records an input device value, if it changed since last frame (called by the input module)
+ * @param[in]   _eType          Input type
+ * @param[in]   _eID            Input ID
+ * @param[in]   _fValue         Current device value
+ */
+extern orxDLLAPI void orxFASTCALL         orxReplay_RecordInputValue(orxINPUT_TYPE _eType, orxENUM _eID, orxFLOAT _fValue);
+
+/** Gets a played back input device value (called by the input module)
+ * @param[in]   _eType          Input type
+ * @param[in]   _eID            Input ID
+ * @return      Played back value
+ */
+extern orxDLLAPI orxFLOAT orxFASTCALL     orxReplay_GetInputValue(orxINPUT_TYPE _eType, orxENUM _eID);
+
+#endif /* _orxREPLAY_H_ */
+
+/** @} */
@@ -409,6 +409,9 @@ extern orxDLLAPI orxU32 orxFASTCALL           _orxDebug_GetFlags();
 /** Software break function */
 extern orxDLLAPI void orxFASTCALL             _orxDebug_Break();
 
+/** Waits for all the pending output to be written and flushed */
+extern orxDLLAPI void orxFASTCALL             _orxDebug_Flush();
+
 /** Sets debug file name
  * @param[in]   _zFileName                    Debug file name
  */
@@ -89,12 +89,30 @@
 
 #endif /* __orxPROFILER__ */
 
+#define orxPROFILER_KU32_BUDGET_DEFAULT_HISTORY   10
+
 
 /** Defines
  */
 #define orxPROFILER_KS32_MARKER_ID_NONE           -1
 
 
+/** Cost report type enum
+ */
+typedef enum __orxPROFILER_COST_t
+{
+  orxPROFILER_COST_CONFIG_FILE = 0,                   /**< Config file load, including its includes */
+  orxPROFILER_COST_CONFIG_INHERITANCE,                /**< Config value lookup resolved through inheritance, per section */
+  orxPROFILER_COST_OBJECT,                            /**< Object creation from config, including its children and body */
+  orxPROFILER_COST_RESOURCE,                          /**< Texture & sound resource load */
+
+  orxPROFILER_COST_NUMBER,
+
+  orxPROFILER_COST_NONE = orxENUM_NONE
+
+} orxPROFILER_COST;
+
+
 /** Setups Profiler module */
 extern orxDLLAPI void orxFASTCALL                 orxProfiler_Setup();
 
@@ -150,6 +168,113 @@ extern orxDLLAPI void orxFASTCALL                 orxProfiler_Pause(orxBOOL _bPa
 extern orxDLLAPI orxBOOL orxFASTCALL              orxProfiler_IsPaused();
 
 
+/** Enables/disables trace recording: when enabled, every marker push/pop is recorded with its time stamp in a per-thread ring buffer
+ * @param[in] _bEnable          Enable
+ */
+extern orxDLLAPI void orxFASTCALL                 orxProfiler_EnableTrace(orxBOOL _bEnable);
+
+/** Is trace recording enabled?
+ * @return orxTRUE / orxFALSE
+ */
+extern orxDLLAPI orxBOOL orxFASTCALL              orxProfiler_IsTraceEnabled();
+
+/** Dumps all the recorded trace events, for all threads, to a Chrome trace event (JSON) file, viewable with chrome://tracing
+ * @param[in] _zFileName        Name of the file, orxNULL for orxtrace.json
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL            orxProfiler_DumpTrace(const orxSTRING _zFileName);
+
+
+/** Starts the sampling profiler (Linux only): call stacks of all threads are sampled on SIGPROF and folded, regardless of markers; previous samples are discarded
+ * Samples are also dumped to orxsamples.txt when exiting while still sampling
+ * @param[in] _u32Frequency     Sampling frequency, in Hz, 0 for default (1000Hz)
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL            orxProfiler_StartSampling(orxU32 _u32Frequency);
+
+/** Stops the sampling profiler, samples are kept until the next start
+ */
+extern orxDLLAPI void orxFASTCALL                 orxProfiler_StopSampling();
+
+/** Is the sampling profiler running?
+ * @return orxTRUE / orxFALSE
+ */
+extern orxDLLAPI orxBOOL orxFASTCALL              orxProfiler_IsSampling();
+
+/** Dumps all the sampled call stacks in the folded format used by flame graph tools (one "Thread;Outermost;...;Innermost Count" line per call stack)
+ * @param[in] _zFileName        Name of the file, orxNULL for orxsamples.txt
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL            orxProfiler_DumpSamples(const orxSTRING _zFileName);
+
+
+/** Sets the frame budget: main thread frames lasting longer are counted as spikes and written, with their previous frames, to orxspikes.txt
+ * @param[in] _dBudget                Frame budget, in seconds, 0 to disable spike capture
+ * @param[in] _u32HistoryFrameNumber  Number of previous frames to write along with a spike (capped by the profiler's history length)
+ */
+extern orxDLLAPI void orxFASTCALL                 orxProfiler_SetFrameBudget(orxDOUBLE _dBudget, orxU32 _u32HistoryFrameNumber);
+
+/** Gets the frame budget
+ * @return Frame budget, in seconds, 0 if disabled
+ */
+extern orxDLLAPI orxDOUBLE orxFASTCALL            orxProfiler_GetFrameBudget();
+
+/** Gets a percentile of the main thread's frame time since the last stats reset
+ * @param[in] _fPercentile            Percentile, [0-100]
+ * @return Frame time, in seconds (approximated to 1/8th of an octave)
+ */
+extern orxDLLAPI orxDOUBLE orxFASTCALL            orxProfiler_GetFramePercentile(orxFLOAT _fPercentile);
+
+/** Gets a percentile of a top level marker's time per frame on the main thread, since the last stats reset
+ * @param[in] _s32MarkerID            Concerned marker ID
+ * @param[in] _fPercentile            Percentile, [0-100]
+ * @return Marker's time per frame, in seconds (approximated to 1/8th of an octave), 0 if never used as a top level marker
+ */
+extern orxDLLAPI orxDOUBLE orxFASTCALL            orxProfiler_GetMarkerPercentile(orxS32 _s32MarkerID, orxFLOAT _fPercentile);
+
+/** Logs the frame stats: frame count, spike count and p50/p95/p99/max of the frame time and of all the top level markers
+ */
+extern orxDLLAPI void orxFASTCALL                 orxProfiler_LogFrameStats();
+
+/** Resets the frame stats
+ */
+extern orxDLLAPI void orxFASTCALL                 orxProfiler_ResetFrameStats();
+
+
+/** Starts recording a cost report (main thread only): time spent per config file, per section inheritance resolve, per created object section and per resource; previous records are discarded
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL            orxProfiler_StartCostReport();
+
+/** Stops recording the cost report and writes it, sorted by total time within each category
+ * @param[in] _zFileName        Name of the file, orxNULL for orxcosts.txt
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL            orxProfiler_StopCostReport(const orxSTRING _zFileName);
+
+/** Is recording a cost report?
+ * @return orxTRUE / orxFALSE
+ */
+extern orxDLLAPI orxBOOL orxFASTCALL              orxProfiler_IsRecordingCosts();
+
+/** Pushes a cost record, does nothing if no cost report is being recorded
+ * @param[in] _eCost            Cost type
+ * @param[in] _zName            Name of the concerned file/section/resource
+ */
+extern orxDLLAPI void orxFASTCALL                 orxProfiler_PushCost(orxPROFILER_COST _eCost, const orxSTRING _zName);
+
+/** Pops the last pushed cost record, its time is removed from the self time of the enclosing record
+ */
+extern orxDLLAPI void orxFASTCALL                 orxProfiler_PopCost();
+
+/** Adds a time to a cost record, without nesting, does nothing if no cost report is being recorded
+ * @param[in] _eCost            Cost type
+ * @param[in] _zName            Name of the concerned file/section/resource
+ * @param[in] _dTime            Time to add, in seconds
+ */
+extern orxDLLAPI void orxFASTCALL                 orxProfiler_AddCost(orxPROFILER_COST _eCost, const orxSTRING _zName, orxDOUBLE _dTime);
+
+
 /** Resets all markers (usually called at the end of the frame)
  */
 extern orxDLLAPI void orxFASTCALL                 orxProfiler_ResetAllMarkers();
@@ -161,6 +161,39 @@ typedef enum __orxDISPLAY_BLEND_MODE_t
 
 } orxDISPLAY_BLEND_MODE;
 
+/** Flush reason enum (why batched vertices had to be drawn)
+ */
+typedef enum __orxDISPLAY_FLUSH_REASON_t
+{
+  orxDISPLAY_FLUSH_REASON_TEXTURE = 0,
+  orxDISPLAY_FLUSH_REASON_SMOOTHING,
+  orxDISPLAY_FLUSH_REASON_BLEND,
+  orxDISPLAY_FLUSH_REASON_SHADER,
+  orxDISPLAY_FLUSH_REASON_BUFFER_FULL,
+  orxDISPLAY_FLUSH_REASON_PRIMITIVE,
+  orxDISPLAY_FLUSH_REASON_DESTINATION,
+  orxDISPLAY_FLUSH_REASON_BITMAP_DATA,
+  orxDISPLAY_FLUSH_REASON_FRAME,
+
+  orxDISPLAY_FLUSH_REASON_NUMBER,
+
+  orxDISPLAY_FLUSH_REASON_NONE = orxENUM_NONE
+
+} orxDISPLAY_FLUSH_REASON;
+
+/** Frame stats structure
+ */
+typedef struct __orxDISPLAY_STATS_t
+{
+  orxU32  u32DrawCallCount;                                 /**< Draw call count : 4 */
+  orxU32  u32VertexCount;                                   /**< Drawn vertex count : 8 */
+  orxU32  u32TextureBindCount;                              /**< Texture bind count : 12 */
+  orxU32  u32ShaderSwitchCount;                             /**< Shader program switch count : 16 */
+  orxU32  u32UploadedByteCount;                             /**< Bytes uploaded to the GPU (vertices & textures) : 20 */
+  orxU32  au32FlushCountList[orxDISPLAY_FLUSH_REASON_NUMBER]; /**< Flush count, per reason : 56 */
+
+} orxDISPLAY_STATS;
+
 /** Color structure
  */
 typedef struct __orxCOLOR_t
@@ -1050,6 +1083,16 @@ extern orxDLLAPI orxSTATUS orxFASTCALL                orxDisplay_DrawOBox(const
  */
 extern orxDLLAPI orxSTATUS orxFASTCALL                orxDisplay_DrawMesh(const orxBITMAP *_pstBitmap, orxDISPLAY_SMOOTHING _eSmoothing, orxDISPLAY_BLEND_MODE _eBlendMode, orxU32 _u32VertexNumber, const orxDISPLAY_VERTEX *_astVertexList);
 
+/** Draws a list of independent textured quads
+ * @param[in]   _pstBitmap                            Bitmap to use for texturing, orxNULL to use the current one
+ * @param[in]   _eSmoothing                           Bitmap smoothing type
+ * @param[in]   _eBlendMode                           Blend mode
+ * @param[in]   _u32QuadNumber                        Number of quads in the list
+ * @param[in]   _astVertexList                        List of vertices, 4 per quad in bottom-left, top-left, bottom-right, top-right order (XY coordinates are in pixels and UV ones are in texels, ignoring the bitmap's clipping)
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL                orxDisplay_DrawQuads(const orxBITMAP *_pstBitmap, orxDISPLAY_SMOOTHING _eSmoothing, orxDISPLAY_BLEND_MODE _eBlendMode, orxU32 _u32QuadNumber, const orxDISPLAY_VERTEX *_astVertexList);
+
 /** Has shader support?
  * @return orxTRUE / orxFALSE
  */
@@ -1164,6 +1207,13 @@ extern orxDLLAPI orxSTATUS orxFASTCALL                orxDisplay_SetVideoMode(co
 extern orxDLLAPI orxBOOL orxFASTCALL                  orxDisplay_IsVideoModeAvailable(const orxDISPLAY_VIDEO_MODE *_pstVideoMode);
 
 
+/** Gets the stats of the last swapped frame: draw calls, vertices, texture binds, shader switches, uploaded bytes and flushes per reason
+ * @param[out] _pstStats                              Frame stats
+ * @return orxDISPLAY_STATS / orxNULL if not supported by the display plugin
+ */
+extern orxDLLAPI orxDISPLAY_STATS *orxFASTCALL        orxDisplay_GetFrameStats(orxDISPLAY_STATS *_pstStats);
+
+
 #endif /* _orxDISPLAY_H_ */
 
 /** @} */
@@ -59,8 +59,9 @@
 
 #define orxGRAPHIC_KU32_FLAG_2D               0x00000001  /**< 2D type graphic flag  */
 #define orxGRAPHIC_KU32_FLAG_TEXT             0x00000002  /**< Text type graphic flag  */
+#define orxGRAPHIC_KU32_FLAG_TILEMAP          0x00000400  /**< Tile map type graphic flag  */
 
-#define orxGRAPHIC_KU32_MASK_TYPE             0x00000003  /**< Type mask */
+#define orxGRAPHIC_KU32_MASK_TYPE             0x00000403  /**< Type mask */
 
 #define orxGRAPHIC_KU32_FLAG_FLIP_X           0x00000004  /**< X axis flipping flag */
 #define orxGRAPHIC_KU32_FLAG_FLIP_Y           0x00000008  /**< Y axis flipping flag */
@@ -83,6 +84,7 @@
 #define orxGRAPHIC_KZ_CONFIG_TEXTURE_ORIGIN   "TextureOrigin"
 #define orxGRAPHIC_KZ_CONFIG_TEXTURE_SIZE     "TextureSize"
 #define orxGRAPHIC_KZ_CONFIG_TEXT_NAME        "Text"
+#define orxGRAPHIC_KZ_CONFIG_TILEMAP_NAME     "TileMap"
 #define orxGRAPHIC_KZ_CONFIG_PIVOT            "Pivot"
 #define orxGRAPHIC_KZ_CONFIG_COLOR            "Color"
 #define orxGRAPHIC_KZ_CONFIG_ALPHA            "Alpha"
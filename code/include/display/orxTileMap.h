@@ -0,0 +1,176 @@
+/* Orx - Portable Game Engine
+ *
+ * Copyright (c) 2008-2018 Orx-Project
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ *    1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ *
+ *    2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ *
+ *    3. This notice may not be removed or altered from any source
+ *    distribution.
+ */
+
+/**
+ * @file orxTileMap.h
+ * @date 18/10/2026
+ * @author iarwain@orx-project.org
+ *
+ * @todo
+ */
+
+/**
+ * @addtogroup orxTileMap
+ *
+ * Tile map module
+ * Module that handles tile maps: grids of tile indices referencing a tileset texture.
+ * Tile maps are used as graphic data and only their visible tiles are rendered.
+ * Tile index 0 is empty, index N refers to the Nth tile of the tileset, read left to right, top to bottom.
+ *
+ * @{
+ */
+
+
+#ifndef _orxTILEMAP_H_
+#define _orxTILEMAP_H_
+
+#include "orxInclude.h"
+
+#include "display/orxTexture.h"
+#include "math/orxVector.h"
+
+
+/** Misc defines
+ */
+#define orxTILEMAP_KU32_TILE_NONE                 0           /**< Empty tile */
+#define orxTILEMAP_KU32_TILE_MAX                  0xFFFF      /**< Max tile index */
+
+
+/** Internal tile map structure */
+typedef struct __orxTILEMAP_t                     orxTILEMAP;
+
+
+/** Setups the tile map module
+ */
+extern orxDLLAPI void orxFASTCALL                 orxTileMap_Setup();
+
+/** Inits the tile map module
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL            orxTileMap_Init();
+
+/** Exits from the tile map module
+ */
+extern orxDLLAPI void orxFASTCALL                 orxTileMap_Exit();
+
+
+/** Creates an empty tile map
+ * @param[in]   _u32Width     Width, in tiles
+ * @param[in]   _u32Height    Height, in tiles
+ * @param[in]   _pvTileSize   Size of a tile, in pixels
+ * @return      orxTILEMAP / orxNULL
+ */
+extern orxDLLAPI orxTILEMAP *orxFASTCALL          orxTileMap_Create(orxU32 _u32Width, orxU32 _u32Height, const orxVECTOR *_pvTileSize);
+
+/** Creates a tile map from config
+ * @param[in]   _zConfigID    Config ID
+ * @return      orxTILEMAP / orxNULL
+ */
+extern orxDLLAPI orxTILEMAP *orxFASTCALL          orxTileMap_CreateFromConfig(const orxSTRING _zConfigID);
+
+/** Deletes a tile map
+ * @param[in]   _pstTileMap   Concerned tile map
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL            orxTileMap_Delete(orxTILEMAP *_pstTileMap);
+
+
+/** Gets tile map name
+ * @param[in]   _pstTileMap   Concerned tile map
+ * @return      Tile map name / orxSTRING_EMPTY
+ */
+extern orxDLLAPI const orxSTRING orxFASTCALL      orxTileMap_GetName(const orxTILEMAP *_pstTileMap);
+
+/** Sets tile map's tileset texture
+ * @param[in]   _pstTileMap   Concerned tile map
+ * @param[in]   _pstTexture   Tileset texture / orxNULL
+ * @param[in]   _pvOrigin     Origin of the tileset inside the texture, orxNULL for top left corner
+ * @param[in]   _pvSize       Size of the tileset inside the texture, orxNULL for the whole texture
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL            orxTileMap_SetTexture(orxTILEMAP *_pstTileMap, orxTEXTURE *_pstTexture, const orxVECTOR *_pvOrigin, const orxVECTOR *_pvSize);
+
+/** Gets tile map's tileset texture
+ * @param[in]   _pstTileMap   Concerned tile map
+ * @return      orxTEXTURE / orxNULL
+ */
+extern orxDLLAPI orxTEXTURE *orxFASTCALL          orxTileMap_GetTexture(const orxTILEMAP *_pstTileMap);
+
+/** Gets tile map's size, in tiles
+ * @param[in]   _pstTileMap   Concerned tile map
+ * @param[out]  _pu32Width    Width, in tiles
+ * @param[out]  _pu32Height   Height, in tiles
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL            orxTileMap_GetMapSize(const orxTILEMAP *_pstTileMap, orxU32 *_pu32Width, orxU32 *_pu32Height);
+
+/** Gets tile map's tile size, in pixels
+ * @param[in]   _pstTileMap   Concerned tile map
+ * @param[out]  _pvTileSize   Tile size
+ * @return      orxVECTOR / orxNULL
+ */
+extern orxDLLAPI orxVECTOR *orxFASTCALL           orxTileMap_GetTileSize(const orxTILEMAP *_pstTileMap, orxVECTOR *_pvTileSize);
+
+/** Gets tile map's size, in pixels
+ * @param[in]   _pstTileMap   Concerned tile map
+ * @param[out]  _pfWidth      Width, in pixels
+ * @param[out]  _pfHeight     Height, in pixels
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL            orxTileMap_GetSize(const orxTILEMAP *_pstTileMap, orxFLOAT *_pfWidth, orxFLOAT *_pfHeight);
+
+/** Sets a tile
+ * @param[in]   _pstTileMap   Concerned tile map
+ * @param[in]   _u32X         X coordinate, in tiles
+ * @param[in]   _u32Y         Y coordinate, in tiles
+ * @param[in]   _u32Tile      Tile index in the tileset (1-based), orxTILEMAP_KU32_TILE_NONE to clear it
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL            orxTileMap_SetTile(orxTILEMAP *_pstTileMap, orxU32 _u32X, orxU32 _u32Y, orxU32 _u32Tile);
+
+/** Gets a tile
+ * @param[in]   _pstTileMap   Concerned tile map
+ * @param[in]   _u32X         X coordinate, in tiles
+ * @param[in]   _u32Y         Y coordinate, in tiles
+ * @return      Tile index in the tileset (1-based) / orxTILEMAP_KU32_TILE_NONE
+ */
+extern orxDLLAPI orxU32 orxFASTCALL               orxTileMap_GetTile(const orxTILEMAP *_pstTileMap, orxU32 _u32X, orxU32 _u32Y);
+
+/** Gets tile map's raw tile list (row major, read only), used for fast iteration
+ * @param[in]   _pstTileMap   Concerned tile map
+ * @return      Tile list
+ */
+extern orxDLLAPI const orxU16 *orxFASTCALL        orxTileMap_GetTileList(const orxTILEMAP *_pstTileMap);
+
+/** Gets a tile's origin inside the tileset texture
+ * @param[in]   _pstTileMap   Concerned tile map
+ * @param[in]   _u32Tile      Tile index in the tileset (1-based)
+ * @param[out]  _pvOrigin     Tile's top left corner, in texels
+ * @return      orxVECTOR / orxNULL if the tile is empty or out of the tileset
+ */
+extern orxDLLAPI orxVECTOR *orxFASTCALL           orxTileMap_GetTileOrigin(const orxTILEMAP *_pstTileMap, orxU32 _u32Tile, orxVECTOR *_pvOrigin);
+
+#endif /* _orxTILEMAP_H_ */
+
+/** @} */
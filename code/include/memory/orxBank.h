@@ -58,6 +58,7 @@ typedef struct __orxBANK_t orxBANK;
 /* Define flags */
 #define orxBANK_KU32_FLAG_NONE              0x00000000  /**< No flags (default behaviour) */
 #define orxBANK_KU32_FLAG_NOT_EXPANDABLE    0x00000001  /**< The bank will not be expandable */
+#define orxBANK_KU32_FLAG_THREAD_SAFE       0x00000002  /**< Allocate / Free can be called concurrently from any thread (iteration, index lookups, Clear & Compact can't) */
 
 /** Setups the bank module
  */
@@ -95,7 +96,7 @@ extern orxDLLAPI void *orxFASTCALL          orxBank_Allocate(orxBANK *_pstBank);
 /** Allocates a new cell from the bank and returns its index
  * @param[in] _pstBank        Pointer on the memory bank to use
  * @param[out] _pu32ItemIndex Will be set with the allocated item index
- * @param[out] _ppPrevious    If non-null, will contain previous neighbor if found
+ * @param[out] _ppPrevious    If non-null, will contain previous neighbor if found (always orxNULL for thread-safe banks), found with a backward scan that grows with the number of fully free segments before the new cell: pass orxNULL when not needed
  * @return a new cell of memory (orxNULL if no allocation possible)
  */
 extern orxDLLAPI void *orxFASTCALL          orxBank_AllocateIndexed(orxBANK *_pstBank, orxU32 *_pu32ItemIndex, void **_ppPrevious);
@@ -84,6 +84,23 @@
   #warning !!WARNING!! This compiler does not have any hardware memory barrier builtin.
 #endif
 
+/** Atomic operation macros, all of them return the value held *before* the operation */
+#if defined(__orxGCC__) || defined(__orxLLVM__)
+  #define orxMEMORY_ATOMIC_OR32(PTR, VALUE)               __sync_fetch_and_or((PTR), (VALUE))
+  #define orxMEMORY_ATOMIC_AND32(PTR, VALUE)              __sync_fetch_and_and((PTR), (VALUE))
+  #define orxMEMORY_ATOMIC_ADD32(PTR, VALUE)              __sync_fetch_and_add((PTR), (VALUE))
+  #define orxMEMORY_ATOMIC_CAS32(PTR, OLD, NEW)           __sync_val_compare_and_swap((PTR), (OLD), (NEW))
+  #define orxMEMORY_ATOMIC_CASPTR(PTR, OLD, NEW)          __sync_val_compare_and_swap((PTR), (OLD), (NEW))
+#elif defined(__orxMSVC__)
+  #define orxMEMORY_ATOMIC_OR32(PTR, VALUE)               ((orxU32)InterlockedOr((volatile LONG *)(PTR), (LONG)(VALUE)))
+  #define orxMEMORY_ATOMIC_AND32(PTR, VALUE)              ((orxU32)InterlockedAnd((volatile LONG *)(PTR), (LONG)(VALUE)))
+  #define orxMEMORY_ATOMIC_ADD32(PTR, VALUE)              ((orxU32)InterlockedExchangeAdd((volatile LONG *)(PTR), (LONG)(VALUE)))
+  #define orxMEMORY_ATOMIC_CAS32(PTR, OLD, NEW)           ((orxU32)InterlockedCompareExchange((volatile LONG *)(PTR), (LONG)(NEW), (LONG)(OLD)))
+  #define orxMEMORY_ATOMIC_CASPTR(PTR, OLD, NEW)          InterlockedCompareExchangePointer((PVOID volatile *)(PTR), (PVOID)(NEW), (PVOID)(OLD))
+#else
+  #error "No atomic builtins available for this compiler."
+#endif
+
 
 /** Memory tracking macros */
 #ifdef __orxPROFILER__
@@ -92,6 +109,18 @@
   #define orxMEMORY_TRACK(TYPE, SIZE, ALLOCATE)
 #endif /* __orxPROFILER__ */
 
+/** Memory type mask, used to group types in arenas */
+#define orxMEMORY_TYPE_MASK(TYPE)                         ((orxU32)1 << (TYPE))
+
+/** Memory profiler macros (allocation site recording, only active when __orxMEMORY_PROFILER__ is defined) */
+#ifdef __orxMEMORY_PROFILER__
+  #define orxMEMORY_PROFILER_SET_TAG(TAG)                 orxMemory_SetProfilerTag(TAG)
+  #define orxMEMORY_PROFILER_DUMP(FILENAME)               orxMemory_DumpProfile(FILENAME)
+#else /* __orxMEMORY_PROFILER__ */
+  #define orxMEMORY_PROFILER_SET_TAG(TAG)
+  #define orxMEMORY_PROFILER_DUMP(FILENAME)
+#endif /* __orxMEMORY_PROFILER__ */
+
 
 /** Memory type
  */
@@ -134,6 +163,17 @@ extern orxDLLAPI void orxFASTCALL                         orxMemory_Exit();
  */
 extern orxDLLAPI void *orxFASTCALL                        orxMemory_Allocate(orxU32 _u32Size, orxMEMORY_TYPE _eMemType);
 
+/** Allocates a portion of memory whose underlying block starts on the given power-of-two boundary
+ * The returned pointer is located at a constant offset from that boundary (the size of the internal tracking header, if any),
+ * which means that, as long as this offset plus _u32Size doesn't exceed _u32Alignment, the block containing any address of the
+ * returned memory can be found by masking that address with ~(_u32Alignment - 1)
+ * @param[in]  _u32Size      Size of the memory to allocate
+ * @param[in]  _u32Alignment Alignment of the underlying block, has to be a power of two
+ * @param[in]  _eMemType     Memory zone where data will be allocated
+ * @return  returns a pointer on the memory allocated, or orxNULL if an error has occurred; has to be freed with orxMemory_Free
+ */
+extern orxDLLAPI void *orxFASTCALL                        orxMemory_AllocateAligned(orxU32 _u32Size, orxU32 _u32Alignment, orxMEMORY_TYPE _eMemType);
+
 /** Reallocates a previously allocated memory block, with the given new size and returns a pointer on it
  * If possible, it'll keep the current pointer and extend the memory block, if not it'll allocate a new block,
  * copy the data over and deallocates the original block
@@ -265,6 +305,44 @@ extern orxDLLAPI orxSTATUS orxFASTCALL                    orxMemory_Track(orxMEM
 
 #endif /* __orxPROFILER__  */
 
+#ifdef __orxMEMORY_PROFILER__
+
+/** Sets the memory profiler tag for the current thread: while set, allocations made by this thread are recorded under this tag instead of their caller's return address
+ * This is useful to attribute allocations made through helpers (banks, string duplication, ...) to the code path that triggered them
+ * @param[in] _zTag                   Tag to set (has to remain valid, literals are recommended), orxNULL to go back to caller recording
+ * @return Previous tag, orxNULL if none
+ */
+extern orxDLLAPI const orxSTRING orxFASTCALL              orxMemory_SetProfilerTag(const orxSTRING _zTag);
+
+/** Dumps the memory profiler report to a file: live bytes, peak bytes, live count, allocation & free counts per allocation site, sorted by live bytes
+ * A report is also written to orxmemory.txt when the memory module exits
+ * @param[in] _zFileName              Name of the report file, orxNULL for default (orxmemory.txt)
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL                    orxMemory_DumpProfile(const orxSTRING _zFileName);
+
+#endif /* __orxMEMORY_PROFILER__ */
+
+#ifdef __orxMEMORY_ARENAS__
+
+/** Creates a memory arena (separate heap) for a group of memory types, which keeps their blocks from interleaving with the other types' ones
+ * By default, CONFIG & TEXT share an arena, TEMP has its own and all the other types use the shared heap
+ * Blocks allocated before a type gets its arena remain valid and can be reallocated/freed as usual
+ * @param[in] _u32TypeMask            Memory types that will allocate from this arena, built with orxMEMORY_TYPE_MASK(), none of them should already have an arena
+ * @param[in] _bThreadSafe            orxTRUE if these types can be allocated/freed from multiple threads, orxFALSE to skip locking (single-threaded types only)
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL                    orxMemory_CreateArena(orxU32 _u32TypeMask, orxBOOL _bThreadSafe);
+
+/** Gets the footprint (memory obtained from the system) of the arena used by a memory type, used to measure fragmentation
+ * @param[in] _eMemType               Concerned memory type
+ * @param[out] _pu32InUseSize         Size currently allocated from the arena, can be orxNULL
+ * @return Arena footprint in bytes, shared heap footprint if the type doesn't have its own arena
+ */
+extern orxDLLAPI orxU32 orxFASTCALL                       orxMemory_GetArenaFootprint(orxMEMORY_TYPE _eMemType, orxU32 *_pu32InUseSize);
+
+#endif /* __orxMEMORY_ARENAS__ */
+
 #endif /* _orxMEMORY_H_ */
 
 /** @} */
@@ -75,6 +75,7 @@ typedef enum __orxOBJECT_EVENT_t
   orxOBJECT_EVENT_DISABLE,
   orxOBJECT_EVENT_PAUSE,
   orxOBJECT_EVENT_UNPAUSE,
+  orxOBJECT_EVENT_STATIC_UPDATE,
 
   orxOBJECT_EVENT_NUMBER,
 
@@ -164,6 +165,33 @@ extern orxDLLAPI void orxFASTCALL           orxObject_PauseRecursive(orxOBJECT *
  * @return      orxTRUE if paused, orxFALSE otherwise
  */
 extern orxDLLAPI orxBOOL orxFASTCALL        orxObject_IsPaused(const orxOBJECT *_pstObject);
+
+/** Sets an object as static/dynamic. Static objects are expected to (nearly) never change and can be baked by the render plugin:
+ * any change made to them, or to their ancestors, through the object API, their speed, angular velocity or dynamic bodies
+ * will send an orxOBJECT_EVENT_STATIC_UPDATE event.
+ * Modifying their frames directly (orxFrame_Set*) isn't tracked: call orxObject_SetStatic() again afterwards to get them re-baked.
+ * @param[in]   _pstObject    Concerned object
+ * @param[in]   _bStatic      Static / dynamic
+ */
+extern orxDLLAPI void orxFASTCALL           orxObject_SetStatic(orxOBJECT *_pstObject, orxBOOL _bStatic);
+
+/** Is object static?
+ * @param[in]   _pstObject    Concerned object
+ * @return      orxTRUE if static, orxFALSE otherwise
+ */
+extern orxDLLAPI orxBOOL orxFASTCALL        orxObject_IsStatic(const orxOBJECT *_pstObject);
+
+/** Sets whether a static object is currently baked by the render plugin, which then won't render it individually. Doesn't send any event.
+ * @param[in]   _pstObject    Concerned object
+ * @param[in]   _bBaked       Baked / not baked
+ */
+extern orxDLLAPI void orxFASTCALL           orxObject_SetBaked(orxOBJECT *_pstObject, orxBOOL _bBaked);
+
+/** Is object baked by the render plugin?
+ * @param[in]   _pstObject    Concerned object
+ * @return      orxTRUE if baked, orxFALSE otherwise
+ */
+extern orxDLLAPI orxBOOL orxFASTCALL        orxObject_IsBaked(const orxOBJECT *_pstObject);
 /** @} */
 
 
@@ -0,0 +1,165 @@
+/* Orx - Portable Game Engine
+ *
+ * Copyright (c) 2008-2018 Orx-Project
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ *    1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ *
+ *    2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ *
+ *    3. This notice may not be removed or altered from any source
+ *    distribution.
+ */
+
+/**
+ * @file orxParticleSystem.h
+ * @date 18/10/2026
+ * @author iarwain@orx-project.org
+ *
+ * @todo
+ */
+
+/**
+ * @addtogroup orxParticleSystem
+ *
+ * Particle system module
+ * Lightweight particle emitters that don't create any object per particle.
+ * Particles are stored as flat arrays (structure of arrays), updated in a
+ * single pass and rendered as one batch using the system's graphic.
+ * Particle systems are linked to objects, like spawners, and are entirely
+ * defined from config.
+ *
+ * @{
+ */
+
+
+#ifndef _orxPARTICLESYSTEM_H_
+#define _orxPARTICLESYSTEM_H_
+
+
+#include "orxInclude.h"
+
+#include "object/orxStructure.h"
+#include "display/orxGraphic.h"
+#include "math/orxAABox.h"
+
+
+/** Particle system flags
+ */
+#define orxPARTICLESYSTEM_KU32_FLAG_NONE                0x00000000  /**< No flags */
+
+#define orxPARTICLESYSTEM_KU32_FLAG_USE_ROTATION        0x00000001  /**< Use rotation flag */
+#define orxPARTICLESYSTEM_KU32_FLAG_USE_SCALE           0x00000002  /**< Use scale flag */
+#define orxPARTICLESYSTEM_KU32_FLAG_USE_RELATIVE_SPEED  0x00000004  /**< Use relative speed flag */
+
+#define orxPARTICLESYSTEM_KU32_MASK_USER_ALL            0x000000FF  /**< All mask */
+
+
+/** Internal particle system structure */
+typedef struct __orxPARTICLESYSTEM_t                    orxPARTICLESYSTEM;
+
+/** Particle list, read-only view on a system's live particles (world space)
+ */
+typedef struct __orxPARTICLE_LIST_t
+{
+  const orxFLOAT   *afX;                                /**< X positions */
+  const orxFLOAT   *afY;                                /**< Y positions */
+  const orxFLOAT   *afRotation;                         /**< Rotations */
+  const orxFLOAT   *afScale;                            /**< Scales */
+  const orxRGBA    *astRGBA;                            /**< Colors */
+  orxAABOX          stBox;                              /**< Bounding box of all positions */
+  orxFLOAT          fMaxScale;                          /**< Largest absolute scale */
+  orxFLOAT          fZ;                                 /**< Z coordinate */
+  orxU32            u32Count;                           /**< Number of live particles */
+
+} orxPARTICLE_LIST;
+
+
+/** Particle system module setup
+ */
+extern orxDLLAPI void orxFASTCALL                       orxParticleSystem_Setup();
+
+/** Inits the particle system module
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL                  orxParticleSystem_Init();
+
+/** Exits from the particle system module
+ */
+extern orxDLLAPI void orxFASTCALL                       orxParticleSystem_Exit();
+
+/** Creates a particle system from config
+ * @param[in]   _zConfigID    Config ID
+ * @return orxPARTICLESYSTEM / orxNULL
+ */
+extern orxDLLAPI orxPARTICLESYSTEM *orxFASTCALL         orxParticleSystem_CreateFromConfig(const orxSTRING _zConfigID);
+
+/** Deletes a particle system
+ * @param[in] _pstParticleSystem        Concerned particle system
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL                  orxParticleSystem_Delete(orxPARTICLESYSTEM *_pstParticleSystem);
+
+/** Enables/disables a particle system (live particles keep on being updated)
+ * @param[in]   _pstParticleSystem      Concerned particle system
+ * @param[in]   _bEnable                Enable / disable
+ */
+extern orxDLLAPI void orxFASTCALL                       orxParticleSystem_Enable(orxPARTICLESYSTEM *_pstParticleSystem, orxBOOL _bEnable);
+
+/** Is particle system enabled?
+ * @param[in]   _pstParticleSystem      Concerned particle system
+ * @return      orxTRUE if enabled, orxFALSE otherwise
+ */
+extern orxDLLAPI orxBOOL orxFASTCALL                    orxParticleSystem_IsEnabled(const orxPARTICLESYSTEM *_pstParticleSystem);
+
+/** Emits particles at the last known position of the particle system's owner
+ * @param[in]   _pstParticleSystem      Concerned particle system
+ * @param[in]   _u32Number              Number of particles to emit
+ * @return      Number of emitted particles
+ */
+extern orxDLLAPI orxU32 orxFASTCALL                     orxParticleSystem_Emit(orxPARTICLESYSTEM *_pstParticleSystem, orxU32 _u32Number);
+
+/** Clears all live particles and resets the total emitted count
+ * @param[in]   _pstParticleSystem      Concerned particle system
+ */
+extern orxDLLAPI void orxFASTCALL                       orxParticleSystem_Clear(orxPARTICLESYSTEM *_pstParticleSystem);
+
+/** Gets particle system's graphic
+ * @param[in]   _pstParticleSystem      Concerned particle system
+ * @return      orxGRAPHIC / orxNULL
+ */
+extern orxDLLAPI orxGRAPHIC *orxFASTCALL                orxParticleSystem_GetGraphic(const orxPARTICLESYSTEM *_pstParticleSystem);
+
+/** Gets particle system's live particle count
+ * @param[in]   _pstParticleSystem      Concerned particle system
+ * @return      Live particle count
+ */
+extern orxDLLAPI orxU32 orxFASTCALL                     orxParticleSystem_GetParticleCount(const orxPARTICLESYSTEM *_pstParticleSystem);
+
+/** Gets particle system's particle list (valid until its next update)
+ * @param[in]   _pstParticleSystem      Concerned particle system
+ * @param[out]  _pstParticleList        Particle list
+ * @return      orxPARTICLE_LIST / orxNULL
+ */
+extern orxDLLAPI orxPARTICLE_LIST *orxFASTCALL          orxParticleSystem_GetParticleList(const orxPARTICLESYSTEM *_pstParticleSystem, orxPARTICLE_LIST *_pstParticleList);
+
+/** Gets particle system config name
+ * @param[in]   _pstParticleSystem      Concerned particle system
+ * @return      orxSTRING / orxSTRING_EMPTY
+ */
+extern orxDLLAPI const orxSTRING orxFASTCALL            orxParticleSystem_GetName(const orxPARTICLESYSTEM *_pstParticleSystem);
+
+#endif /* _orxPARTICLESYSTEM_H_ */
+
+/** @} */
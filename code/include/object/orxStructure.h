@@ -70,6 +70,7 @@
 #define orxFXPOINTER(STRUCTURE)     orxSTRUCTURE_GET_POINTER(STRUCTURE, FXPOINTER)
 #define orxGRAPHIC(STRUCTURE)       orxSTRUCTURE_GET_POINTER(STRUCTURE, GRAPHIC)
 #define orxOBJECT(STRUCTURE)        orxSTRUCTURE_GET_POINTER(STRUCTURE, OBJECT)
+#define orxPARTICLESYSTEM(STRUCTURE) orxSTRUCTURE_GET_POINTER(STRUCTURE, PARTICLESYSTEM)
 #define orxSOUND(STRUCTURE)         orxSTRUCTURE_GET_POINTER(STRUCTURE, SOUND)
 #define orxSOUNDPOINTER(STRUCTURE)  orxSTRUCTURE_GET_POINTER(STRUCTURE, SOUNDPOINTER)
 #define orxSHADER(STRUCTURE)        orxSTRUCTURE_GET_POINTER(STRUCTURE, SHADER)
@@ -77,6 +78,7 @@
 #define orxSPAWNER(STRUCTURE)       orxSTRUCTURE_GET_POINTER(STRUCTURE, SPAWNER)
 #define orxTEXT(STRUCTURE)          orxSTRUCTURE_GET_POINTER(STRUCTURE, TEXT)
 #define orxTEXTURE(STRUCTURE)       orxSTRUCTURE_GET_POINTER(STRUCTURE, TEXTURE)
+#define orxTILEMAP(STRUCTURE)       orxSTRUCTURE_GET_POINTER(STRUCTURE, TILEMAP)
 #define orxTIMELINE(STRUCTURE)      orxSTRUCTURE_GET_POINTER(STRUCTURE, TIMELINE)
 #define orxVIEWPORT(STRUCTURE)      orxSTRUCTURE_GET_POINTER(STRUCTURE, VIEWPORT)
 
@@ -121,6 +123,7 @@ typedef enum __orxSTRUCTURE_ID_t
   orxSTRUCTURE_ID_FRAME,
   orxSTRUCTURE_ID_FXPOINTER,
   orxSTRUCTURE_ID_GRAPHIC,
+  orxSTRUCTURE_ID_PARTICLESYSTEM,
   orxSTRUCTURE_ID_SHADERPOINTER,
   orxSTRUCTURE_ID_SOUNDPOINTER,
   orxSTRUCTURE_ID_SPAWNER,
@@ -140,6 +143,7 @@ typedef enum __orxSTRUCTURE_ID_t
   orxSTRUCTURE_ID_SOUND,
   orxSTRUCTURE_ID_TEXT,
   orxSTRUCTURE_ID_TEXTURE,
+  orxSTRUCTURE_ID_TILEMAP,
   orxSTRUCTURE_ID_VIEWPORT,
 
   orxSTRUCTURE_ID_NUMBER,
@@ -154,6 +158,7 @@ typedef enum __orxSTRUCTURE_STORAGE_TYPE_t
 {
   orxSTRUCTURE_STORAGE_TYPE_LINKLIST = 0,
   orxSTRUCTURE_STORAGE_TYPE_TREE,
+  orxSTRUCTURE_STORAGE_TYPE_ARRAY,                      /**< Dense array: iterated sequentially in memory order, needs orxStructure_Compact() to be called when no iteration is in progress */
 
   orxSTRUCTURE_STORAGE_TYPE_NUMBER,
 
@@ -172,6 +177,7 @@ typedef struct __orxSTRUCTURE_t
   {
     orxLINKLIST_NODE  stLinkListNode; /**< Linklist node : 28/40 */
     orxTREE_NODE      stTreeNode;     /**< Tree node : 36/56 */
+    orxU32            u32ArrayIndex;  /**< Dense array index : 20/20 */
   } stStorage;                        /**< Storage node union : 36/56 */
 
   orxU32              u32Flags;       /**< Flags : 40/64 */
@@ -219,6 +225,7 @@ static orxINLINE const orxSTRING orxStructure_GetIDString(orxSTRUCTURE_ID _eID)
     orxSTRUCTURE_DECLARE_ID_ENTRY(FRAME);
     orxSTRUCTURE_DECLARE_ID_ENTRY(FXPOINTER);
     orxSTRUCTURE_DECLARE_ID_ENTRY(GRAPHIC);
+    orxSTRUCTURE_DECLARE_ID_ENTRY(PARTICLESYSTEM);
     orxSTRUCTURE_DECLARE_ID_ENTRY(SHADERPOINTER);
     orxSTRUCTURE_DECLARE_ID_ENTRY(SOUNDPOINTER);
     orxSTRUCTURE_DECLARE_ID_ENTRY(SPAWNER);
@@ -233,6 +240,7 @@ static orxINLINE const orxSTRING orxStructure_GetIDString(orxSTRUCTURE_ID _eID)
     orxSTRUCTURE_DECLARE_ID_ENTRY(SOUND);
     orxSTRUCTURE_DECLARE_ID_ENTRY(TEXT);
     orxSTRUCTURE_DECLARE_ID_ENTRY(TEXTURE);
+    orxSTRUCTURE_DECLARE_ID_ENTRY(TILEMAP);
     orxSTRUCTURE_DECLARE_ID_ENTRY(VIEWPORT);
 
     default: zResult = "INVALID STRUCTURE ID"; break;
@@ -276,6 +284,13 @@ extern orxDLLAPI orxSTATUS orxFASTCALL                  orxStructure_Register(or
  */
 extern orxDLLAPI orxSTATUS orxFASTCALL                  orxStructure_Unregister(orxSTRUCTURE_ID _eStructureID);
 
+/** Changes the storage type of a registered ID, only possible when none of its structures are alive
+ * @param[in]   _eStructureID   Concerned structure ID
+ * @param[in]   _eStorageType   Storage type to use for this structure type
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL                  orxStructure_SetStorageType(orxSTRUCTURE_ID _eStructureID, orxSTRUCTURE_STORAGE_TYPE _eStorageType);
+
 
 /** Creates a clean structure for given type
  * @param[in]   _eStructureID   Concerned structure ID
@@ -333,13 +348,22 @@ extern orxDLLAPI orxSTRUCTURE *orxFASTCALL              orxStructure_GetOwner(co
  */
 extern orxDLLAPI orxSTATUS orxFASTCALL                  orxStructure_SetOwner(void *_pStructure, void *_pOwner);
 
-/** Gets first stored structure (first list cell or tree root depending on storage type)
+/** Compacts a structure type's storage, only needed for orxSTRUCTURE_STORAGE_TYPE_ARRAY
+ * Deleted structures leave holes in the dense array and new ones are appended, so that iterations in progress are never disturbed:
+ * this squeezes the holes out and puts the array back in memory order (structures never move, only the array does)
+ * Should be called when no iteration over this structure type is in progress, GUIDs & pointers remain valid
+ * @param[in]   _eStructureID   Concerned structure ID
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL                  orxStructure_Compact(orxSTRUCTURE_ID _eStructureID);
+
+/** Gets first stored structure (first list cell, tree root or first array cell depending on storage type)
  * @param[in]   _eStructureID   Concerned structure ID
  * @return      orxSTRUCTURE
  */
 extern orxDLLAPI orxSTRUCTURE *orxFASTCALL              orxStructure_GetFirst(orxSTRUCTURE_ID _eStructureID);
 
-/** Gets last stored structure (last list cell or tree root depending on storage type)
+/** Gets last stored structure (last list cell, tree root or last array cell depending on storage type)
  * @param[in]   _eStructureID   Concerned structure ID
  * @return      orxSTRUCTURE
  */
@@ -363,13 +387,13 @@ extern orxDLLAPI orxSTRUCTURE *orxFASTCALL              orxStructure_GetChild(co
  */
 extern orxDLLAPI orxSTRUCTURE *orxFASTCALL              orxStructure_GetSibling(const void *_pStructure);
 
-/** Gets structure list previous
+/** Gets structure list/array previous
  * @param[in]   _pStructure    Concerned structure
  * @return      orxSTRUCTURE
  */
 extern orxDLLAPI orxSTRUCTURE *orxFASTCALL              orxStructure_GetPrevious(const void *_pStructure);
 
-/** Gets structure list next
+/** Gets structure list/array next
  * @param[in]   _pStructure    Concerned structure
  * @return      orxSTRUCTURE
  */
@@ -118,6 +118,7 @@ static void orxFASTCALL orx_MainSetup()
 
   orxModule_AddOptionalDependency(orxMODULE_ID_MAIN, orxMODULE_ID_CONSOLE);
   orxModule_AddOptionalDependency(orxMODULE_ID_MAIN, orxMODULE_ID_PROFILER);
+  orxModule_AddOptionalDependency(orxMODULE_ID_MAIN, orxMODULE_ID_REPLAY);
   orxModule_AddOptionalDependency(orxMODULE_ID_MAIN, orxMODULE_ID_SCREENSHOT);
 
   return;
@@ -56,6 +56,7 @@
 #include "core/orxConsole.h"
 #include "core/orxEvent.h"
 #include "core/orxLocale.h"
+#include "core/orxReplay.h"
 #include "core/orxResource.h"
 #include "core/orxSystem.h"
 #include "core/orxThread.h"
@@ -70,6 +71,7 @@
 #include "display/orxScreenshot.h"
 #include "display/orxText.h"
 #include "display/orxTexture.h"
+#include "display/orxTileMap.h"
 
 #include "io/orxFile.h"
 #include "io/orxInput.h"
@@ -91,6 +93,7 @@
 #include "object/orxFX.h"
 #include "object/orxFXPointer.h"
 #include "object/orxObject.h"
+#include "object/orxParticleSystem.h"
 #include "object/orxSpawner.h"
 #include "object/orxStructure.h"
 #include "object/orxTimeLine.h"
@@ -77,6 +77,7 @@ typedef enum __orxPLUGIN_FUNCTION_BASE_ID_DISPLAY_t
   orxPLUGIN_FUNCTION_BASE_ID_DISPLAY_DRAW_CIRCLE,
   orxPLUGIN_FUNCTION_BASE_ID_DISPLAY_DRAW_OBOX,
   orxPLUGIN_FUNCTION_BASE_ID_DISPLAY_DRAW_MESH,
+  orxPLUGIN_FUNCTION_BASE_ID_DISPLAY_DRAW_QUADS,
   orxPLUGIN_FUNCTION_BASE_ID_DISPLAY_HAS_SHADER_SUPPORT,
   orxPLUGIN_FUNCTION_BASE_ID_DISPLAY_CREATE_SHADER,
   orxPLUGIN_FUNCTION_BASE_ID_DISPLAY_DELETE_SHADER,
@@ -94,6 +95,7 @@ typedef enum __orxPLUGIN_FUNCTION_BASE_ID_DISPLAY_t
   orxPLUGIN_FUNCTION_BASE_ID_DISPLAY_GET_VIDEO_MODE,
   orxPLUGIN_FUNCTION_BASE_ID_DISPLAY_SET_VIDEO_MODE,
   orxPLUGIN_FUNCTION_BASE_ID_DISPLAY_IS_VIDEO_MODE_AVAILABLE,
+  orxPLUGIN_FUNCTION_BASE_ID_DISPLAY_GET_FRAME_STATS,
 
   orxPLUGIN_FUNCTION_BASE_ID_DISPLAY_NUMBER,
 
@@ -60,6 +60,10 @@
 #define orxRENDER_KZ_CONFIG_SHOW_PROFILER           "ShowProfiler"
 #define orxRENDER_KZ_CONFIG_MIN_FREQUENCY           "MinFrequency"
 #define orxRENDER_KZ_CONFIG_CONSOLE_COLOR           "ConsoleColor"
+#define orxRENDER_KZ_CONFIG_STATIC_GROUP_LIST       "StaticGroupList"
+#define orxRENDER_KZ_CONFIG_STATIC_CHUNK_SIZE       "StaticChunkSize"
+#define orxRENDER_KZ_CONFIG_PROFILER_BUDGET         "ProfilerBudget"
+#define orxRENDER_KZ_CONFIG_PROFILER_BUDGET_HISTORY "ProfilerBudgetHistory"
 
 
 /** Inputs
@@ -308,6 +308,58 @@ extern orxDLLAPI orxAABOX *orxFASTCALL        orxViewport_GetBox(const orxVIEWPO
  */
 extern orxDLLAPI orxFLOAT orxFASTCALL         orxViewport_GetCorrectionRatio(const orxVIEWPORT *_pstViewport);
 
+
+/** Enables / disables viewport cache: when enabled, the viewport is rendered into its own cache texture and only re-rendered when invalidated
+ * @param[in]   _pstViewport    Concerned viewport
+ * @param[in]   _bEnable        Enable / disable
+ */
+extern orxDLLAPI void orxFASTCALL             orxViewport_EnableCache(orxVIEWPORT *_pstViewport, orxBOOL _bEnable);
+
+/** Is viewport cache enabled?
+ * @param[in]   _pstViewport    Concerned viewport
+ * @return      orxTRUE / orxFALSE
+ */
+extern orxDLLAPI orxBOOL orxFASTCALL          orxViewport_IsCacheEnabled(const orxVIEWPORT *_pstViewport);
+
+/** Sets viewport cache refresh interval
+ * @param[in]   _pstViewport    Concerned viewport
+ * @param[in]   _fInterval      Interval, in seconds, after which the cache will be refreshed even if it hasn't been invalidated, 0 for no periodic refresh
+ */
+extern orxDLLAPI void orxFASTCALL             orxViewport_SetCacheInterval(orxVIEWPORT *_pstViewport, orxFLOAT _fInterval);
+
+/** Gets viewport cache refresh interval
+ * @param[in]   _pstViewport    Concerned viewport
+ * @return      Interval, in seconds
+ */
+extern orxDLLAPI orxFLOAT orxFASTCALL         orxViewport_GetCacheInterval(const orxVIEWPORT *_pstViewport);
+
+/** Invalidates viewport cache: it will be refreshed during next render
+ * @param[in]   _pstViewport    Concerned viewport
+ */
+extern orxDLLAPI void orxFASTCALL             orxViewport_InvalidateCache(orxVIEWPORT *_pstViewport);
+
+/** Is viewport cache still valid?
+ * @param[in]   _pstViewport    Concerned viewport
+ * @param[in]   _u32Key         Key describing the current rendering state (camera, size, ...), any change invalidates the cache
+ * @param[in]   _fTime          Current time
+ * @return      orxTRUE if the cache texture can be used as is, orxFALSE if it needs to be refreshed
+ */
+extern orxDLLAPI orxBOOL orxFASTCALL          orxViewport_IsCacheValid(const orxVIEWPORT *_pstViewport, orxU32 _u32Key, orxFLOAT _fTime);
+
+/** Validates viewport cache, after it has been refreshed
+ * @param[in]   _pstViewport    Concerned viewport
+ * @param[in]   _u32Key         Key describing the rendering state used for the refresh
+ * @param[in]   _fTime          Refresh time
+ */
+extern orxDLLAPI void orxFASTCALL             orxViewport_ValidateCache(orxVIEWPORT *_pstViewport, orxU32 _u32Key, orxFLOAT _fTime);
+
+/** Gets viewport cache texture, (re-)creating it if needed so as to match viewport's size
+ * @param[in]   _pstViewport    Concerned viewport
+ * @return      orxTEXTURE / orxNULL if cache isn't enabled or couldn't be created
+ */
+extern orxDLLAPI orxTEXTURE *orxFASTCALL      orxViewport_GetCacheTexture(orxVIEWPORT *_pstViewport);
+
+
 /** Gets viewport config name
  * @param[in]   _pstViewport    Concerned viewport
  * @return      orxSTRING / orxSTRING_EMPTY
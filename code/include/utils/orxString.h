@@ -81,13 +81,26 @@
 
 /** Defines
  */
-#define orxSTRING_KU32_CRC_POLYNOMIAL   0xEDB88320U       /**< Using 0x04C11DB7's reverse polynomial for CRC32B */
+#ifdef __orxSTRING_CRC32C__
+  #define orxSTRING_KU32_CRC_POLYNOMIAL 0x82F63B78U       /**< Using 0x1EDC6F41's reverse polynomial for CRC32C (Castagnoli): hardware accelerated with SSE4.2 & ARMv8 CRC, but IDs differ from CRC32B ones */
+#else /* __orxSTRING_CRC32C__ */
+  #define orxSTRING_KU32_CRC_POLYNOMIAL 0xEDB88320U       /**< Using 0x04C11DB7's reverse polynomial for CRC32B: hardware accelerated with ARMv8 CRC only */
+#endif /* __orxSTRING_CRC32C__ */
+
+
+/** CRC function prototype
+ */
+typedef orxU32 (orxFASTCALL *orxSTRING_CRC_FUNCTION)(const orxU8 *_pu8Data, orxU32 _u32Size, orxU32 _u32CRC);
 
 
 /** CRC Tables (slice-by-8)
  */
 extern orxDLLAPI orxU32 saau32CRCTable[8][256];
 
+/** Hardware CRC function, selected once when the string module is set up, orxNULL if not supported by the CPU
+ */
+extern orxDLLAPI orxSTRING_CRC_FUNCTION spfnStringHardwareCRC;
+
 
 /* *** String inlined functions *** */
 
@@ -1359,35 +1372,47 @@ static orxINLINE orxU32                                   orxString_NContinueCRC
   orxASSERT(_zString != orxNULL);
   orxASSERT(_u32CharNumber <= orxString_GetLength(_zString));
 
-  /* Inits CRC */
-  u32CRC = ~_u32CRC;
-
-  /* For all slices */
-  for(u32Length = _u32CharNumber, pu8 = (const orxU8 *)_zString; u32Length >= 8; u32Length -= 8, pu8 += 8)
+  /* Hardware accelerated? */
+  if(spfnStringHardwareCRC != orxNULL)
   {
-    orxU32 u32First, u32Second;
-
-    /* Gets the slice's data */
-    orxMemory_Copy(&u32First, pu8, sizeof(orxU32));
-    orxMemory_Copy(&u32Second, pu8 + 4, sizeof(orxU32));
-    u32First ^= orxCRC_GET_FIRST(u32CRC);
-
-    /* Updates the CRC */
-    u32CRC  = saau32CRCTable[orxCRC_INDEX_7][u32First & 0xFF]
-            ^ saau32CRCTable[orxCRC_INDEX_6][(u32First >> 8) & 0xFF]
-            ^ saau32CRCTable[orxCRC_INDEX_5][(u32First >> 16) & 0xFF]
-            ^ saau32CRCTable[orxCRC_INDEX_4][u32First >> 24]
-            ^ saau32CRCTable[orxCRC_INDEX_3][u32Second & 0xFF]
-            ^ saau32CRCTable[orxCRC_INDEX_2][(u32Second >> 8) & 0xFF]
-            ^ saau32CRCTable[orxCRC_INDEX_1][(u32Second >> 16) & 0xFF]
-            ^ saau32CRCTable[orxCRC_INDEX_0][u32Second >> 24];
+    /* Updates CRC */
+    u32CRC = spfnStringHardwareCRC((const orxU8 *)_zString, _u32CharNumber, _u32CRC);
   }
-
-  /* For all remaining characters */
-  for(; u32Length != 0; u32Length--, pu8++)
+  else
   {
-    /* Updates the CRC */
-    u32CRC = saau32CRCTable[0][((orxU8)(u32CRC & 0xFF)) ^ *pu8] ^ (u32CRC >> 8);
+    /* Inits CRC */
+    u32CRC = ~_u32CRC;
+
+    /* For all slices */
+    for(u32Length = _u32CharNumber, pu8 = (const orxU8 *)_zString; u32Length >= 8; u32Length -= 8, pu8 += 8)
+    {
+      orxU32 u32First, u32Second;
+
+      /* Gets the slice's data */
+      orxMemory_Copy(&u32First, pu8, sizeof(orxU32));
+      orxMemory_Copy(&u32Second, pu8 + 4, sizeof(orxU32));
+      u32First ^= orxCRC_GET_FIRST(u32CRC);
+
+      /* Updates the CRC */
+      u32CRC  = saau32CRCTable[orxCRC_INDEX_7][u32First & 0xFF]
+              ^ saau32CRCTable[orxCRC_INDEX_6][(u32First >> 8) & 0xFF]
+              ^ saau32CRCTable[orxCRC_INDEX_5][(u32First >> 16) & 0xFF]
+              ^ saau32CRCTable[orxCRC_INDEX_4][u32First >> 24]
+              ^ saau32CRCTable[orxCRC_INDEX_3][u32Second & 0xFF]
+              ^ saau32CRCTable[orxCRC_INDEX_2][(u32Second >> 8) & 0xFF]
+              ^ saau32CRCTable[orxCRC_INDEX_1][(u32Second >> 16) & 0xFF]
+              ^ saau32CRCTable[orxCRC_INDEX_0][u32Second >> 24];
+    }
+
+    /* For all remaining characters */
+    for(; u32Length != 0; u32Length--, pu8++)
+    {
+      /* Updates the CRC */
+      u32CRC = saau32CRCTable[0][((orxU8)(u32CRC & 0xFF)) ^ *pu8] ^ (u32CRC >> 8);
+    }
+
+    /* Finalizes CRC */
+    u32CRC = ~u32CRC;
   }
 
 #undef orxCRC_GET_FIRST
@@ -1401,7 +1426,7 @@ static orxINLINE orxU32                                   orxString_NContinueCRC
 #undef orxCRC_INDEX_7
 
   /* Done! */
-  return ~u32CRC;
+  return u32CRC;
 }
 
 /** Continues a CRC with a string one
@@ -1665,19 +1690,19 @@ extern orxDLLAPI orxSTATUS orxFASTCALL                    orxString_Init();
 extern orxDLLAPI void orxFASTCALL                         orxString_Exit();
 
 
-/** Gets a string's ID (and stores the string internally to prevent duplication)
+/** Gets a string's ID (and stores the string internally to prevent duplication), can be called from any thread
  * @param[in]   _zString        Concerned string
  * @return      String's ID
  */
 extern orxDLLAPI orxU32 orxFASTCALL                       orxString_GetID(const orxSTRING _zString);
 
-/** Gets a string from an ID (it should have already been stored internally with a call to orxString_GetID)
+/** Gets a string from an ID (it should have already been stored internally with a call to orxString_GetID), can be called from any thread
  * @param[in]   _u32ID          Concerned string ID
  * @return      orxSTRING if ID's found, orxSTRING_EMPTY otherwise
  */
 extern orxDLLAPI const orxSTRING orxFASTCALL              orxString_GetFromID(orxU32 _u32ID);
 
-/** Stores a string internally: equivalent to an optimized call to orxString_GetFromID(orxString_GetID(_zString))
+/** Stores a string internally: equivalent to an optimized call to orxString_GetFromID(orxString_GetID(_zString)), can be called from any thread
  * @param[in]   _zString        Concerned string
  * @return      Stored orxSTRING
  */
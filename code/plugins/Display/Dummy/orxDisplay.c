@@ -0,0 +1,630 @@
+/* Orx - Portable Game Engine
+ *
+ * Copyright (c) 2008-2018 Orx-Project
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ *    1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ *
+ *    2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ *
+ *    3. This notice may not be removed or altered from any source
+ *    distribution.
+ */
+
+/**
+ * @file orxDisplay.c
+ * @date 19/10/2026
+ *
+ * Dummy display plugin implementation
+ *
+ * Doesn't open any window nor talk to any GPU: bitmaps only keep their size & color so that textures, graphics
+ * and everything built on top of them can be created headless (benchmarks, replays, servers).
+ *
+ */
+
+
+#include "orxPluginAPI.h"
+
+
+/** Module flags
+ */
+#define orxDISPLAY_KU32_STATIC_FLAG_NONE        0x00000000 /**< No flags */
+
+#define orxDISPLAY_KU32_STATIC_FLAG_READY       0x00000001 /**< Ready flag */
+#define orxDISPLAY_KU32_STATIC_FLAG_VSYNC       0x00000002 /**< VSync flag */
+#define orxDISPLAY_KU32_STATIC_FLAG_FULL_SCREEN 0x00000004 /**< Full screen flag */
+
+#define orxDISPLAY_KU32_STATIC_MASK_ALL         0xFFFFFFFF /**< All mask */
+
+
+/** Misc defines
+ */
+#define orxDISPLAY_KU32_BITMAP_BANK_SIZE        256
+#define orxDISPLAY_KU32_DEFAULT_WIDTH           800
+#define orxDISPLAY_KU32_DEFAULT_HEIGHT          600
+#define orxDISPLAY_KU32_DEFAULT_DEPTH           32
+#define orxDISPLAY_KU32_DEFAULT_REFRESH_RATE    60
+
+
+/***************************************************************************
+ * Structure declaration                                                   *
+ ***************************************************************************/
+
+/** Internal bitmap structure
+ */
+struct __orxBITMAP_t
+{
+  orxFLOAT                  fWidth, fHeight;
+  orxRGBA                   stColor;
+  orxU32                    u32ID;
+};
+
+/** Static structure
+ */
+typedef struct __orxDISPLAY_STATIC_t
+{
+  orxBANK                  *pstBitmapBank;
+  orxBITMAP                 stScreen;
+  const orxBITMAP          *pstTempBitmap;
+  orxU32                    u32Depth;
+  orxU32                    u32RefreshRate;
+  orxU32                    u32NextID;
+  orxU32                    u32Flags;
+
+} orxDISPLAY_STATIC;
+
+
+/***************************************************************************
+ * Static variables                                                        *
+ ***************************************************************************/
+
+/** Static data
+ */
+static orxDISPLAY_STATIC sstDisplay;
+
+
+/***************************************************************************
+ * Private functions                                                       *
+ ***************************************************************************/
+
+
+/***************************************************************************
+ * Plugin related                                                          *
+ ***************************************************************************/
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_Init()
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Was not already initialized? */
+  if(!(sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY))
+  {
+    /* Cleans static controller */
+    orxMemory_Zero(&sstDisplay, sizeof(orxDISPLAY_STATIC));
+
+    /* Creates bitmap bank */
+    sstDisplay.pstBitmapBank = orxBank_Create(orxDISPLAY_KU32_BITMAP_BANK_SIZE, sizeof(orxBITMAP), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+
+    /* Success? */
+    if(sstDisplay.pstBitmapBank != orxNULL)
+    {
+      /* Pushes display section */
+      orxConfig_PushSection(orxDISPLAY_KZ_CONFIG_SECTION);
+
+      /* Inits screen from config */
+      sstDisplay.stScreen.fWidth  = orxU2F((orxConfig_HasValue(orxDISPLAY_KZ_CONFIG_WIDTH) != orxFALSE) ? orxConfig_GetU32(orxDISPLAY_KZ_CONFIG_WIDTH) : orxDISPLAY_KU32_DEFAULT_WIDTH);
+      sstDisplay.stScreen.fHeight = orxU2F((orxConfig_HasValue(orxDISPLAY_KZ_CONFIG_HEIGHT) != orxFALSE) ? orxConfig_GetU32(orxDISPLAY_KZ_CONFIG_HEIGHT) : orxDISPLAY_KU32_DEFAULT_HEIGHT);
+      sstDisplay.stScreen.stColor = orx2RGBA(0xFF, 0xFF, 0xFF, 0xFF);
+      sstDisplay.u32Depth         = (orxConfig_HasValue(orxDISPLAY_KZ_CONFIG_DEPTH) != orxFALSE) ? orxConfig_GetU32(orxDISPLAY_KZ_CONFIG_DEPTH) : orxDISPLAY_KU32_DEFAULT_DEPTH;
+      sstDisplay.u32RefreshRate   = (orxConfig_HasValue(orxDISPLAY_KZ_CONFIG_REFRESH_RATE) != orxFALSE) ? orxConfig_GetU32(orxDISPLAY_KZ_CONFIG_REFRESH_RATE) : orxDISPLAY_KU32_DEFAULT_REFRESH_RATE;
+
+      /* Pops config section */
+      orxConfig_PopSection();
+
+      /* Updates status */
+      sstDisplay.u32NextID  = 1;
+      sstDisplay.u32Flags   = orxDISPLAY_KU32_STATIC_FLAG_READY;
+
+      /* Updates result */
+      eResult = orxSTATUS_SUCCESS;
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+void orxFASTCALL orxDisplay_Dummy_Exit()
+{
+  /* Was initialized? */
+  if(sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY)
+  {
+    /* Deletes bitmap bank */
+    orxBank_Delete(sstDisplay.pstBitmapBank);
+
+    /* Cleans static controller */
+    orxMemory_Zero(&sstDisplay, sizeof(orxDISPLAY_STATIC));
+  }
+
+  /* Done! */
+  return;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_Swap()
+{
+  return orxSTATUS_SUCCESS;
+}
+
+orxBITMAP *orxFASTCALL orxDisplay_Dummy_GetScreenBitmap()
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Done! */
+  return &(sstDisplay.stScreen);
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_GetScreenSize(orxFLOAT *_pfWidth, orxFLOAT *_pfHeight)
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pfWidth != orxNULL);
+  orxASSERT(_pfHeight != orxNULL);
+
+  /* Updates result */
+  *_pfWidth   = sstDisplay.stScreen.fWidth;
+  *_pfHeight  = sstDisplay.stScreen.fHeight;
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
+orxBITMAP *orxFASTCALL orxDisplay_Dummy_CreateBitmap(orxU32 _u32Width, orxU32 _u32Height)
+{
+  orxBITMAP *pstResult;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Allocates bitmap */
+  pstResult = (orxBITMAP *)orxBank_Allocate(sstDisplay.pstBitmapBank);
+
+  /* Success? */
+  if(pstResult != orxNULL)
+  {
+    /* Inits it */
+    pstResult->fWidth   = orxU2F(_u32Width);
+    pstResult->fHeight  = orxU2F(_u32Height);
+    pstResult->stColor  = orx2RGBA(0xFF, 0xFF, 0xFF, 0xFF);
+    pstResult->u32ID    = sstDisplay.u32NextID++;
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+void orxFASTCALL orxDisplay_Dummy_DeleteBitmap(orxBITMAP *_pstBitmap)
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Not screen? */
+  if((_pstBitmap != orxNULL) && (_pstBitmap != &(sstDisplay.stScreen)))
+  {
+    /* Was temp bitmap? */
+    if(_pstBitmap == sstDisplay.pstTempBitmap)
+    {
+      /* Clears it */
+      sstDisplay.pstTempBitmap = orxNULL;
+    }
+
+    /* Frees it */
+    orxBank_Free(sstDisplay.pstBitmapBank, _pstBitmap);
+  }
+
+  /* Done! */
+  return;
+}
+
+orxBITMAP *orxFASTCALL orxDisplay_Dummy_LoadBitmap(const orxSTRING _zFileName)
+{
+  /* Nothing is decoded headless */
+  return orxNULL;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_SaveBitmap(const orxBITMAP *_pstBitmap, const orxSTRING _zFileName)
+{
+  return orxSTATUS_FAILURE;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_SetTempBitmap(const orxBITMAP *_pstBitmap)
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Stores it */
+  sstDisplay.pstTempBitmap = _pstBitmap;
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
+const orxBITMAP *orxFASTCALL orxDisplay_Dummy_GetTempBitmap()
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Done! */
+  return sstDisplay.pstTempBitmap;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_SetDestinationBitmaps(orxBITMAP **_apstBitmapList, orxU32 _u32Number)
+{
+  return orxSTATUS_SUCCESS;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_ClearBitmap(orxBITMAP *_pstBitmap, orxRGBA _stColor)
+{
+  return orxSTATUS_SUCCESS;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_SetBlendMode(orxDISPLAY_BLEND_MODE _eBlendMode)
+{
+  return orxSTATUS_SUCCESS;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_SetBitmapClipping(orxBITMAP *_pstBitmap, orxU32 _u32TLX, orxU32 _u32TLY, orxU32 _u32BRX, orxU32 _u32BRY)
+{
+  return orxSTATUS_SUCCESS;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_SetBitmapColorKey(orxBITMAP *_pstBitmap, orxRGBA _stColor, orxBOOL _bEnable)
+{
+  return orxSTATUS_SUCCESS;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_SetBitmapData(orxBITMAP *_pstBitmap, const orxU8 *_au8Data, orxU32 _u32ByteNumber)
+{
+  orxSTATUS eResult;
+
+  /* Checks */
+  orxASSERT(_pstBitmap != orxNULL);
+  orxASSERT(_au8Data != orxNULL);
+
+  /* Valid size? */
+  eResult = (_u32ByteNumber == orxF2U(_pstBitmap->fWidth) * orxF2U(_pstBitmap->fHeight) * 4 * sizeof(orxU8)) ? orxSTATUS_SUCCESS : orxSTATUS_FAILURE;
+
+  /* Done! */
+  return eResult;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_GetBitmapData(const orxBITMAP *_pstBitmap, orxU8 *_au8Data, orxU32 _u32ByteNumber)
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT(_pstBitmap != orxNULL);
+  orxASSERT(_au8Data != orxNULL);
+
+  /* Valid size? */
+  if(_u32ByteNumber == orxF2U(_pstBitmap->fWidth) * orxF2U(_pstBitmap->fHeight) * 4 * sizeof(orxU8))
+  {
+    /* Clears it */
+    orxMemory_Zero(_au8Data, _u32ByteNumber);
+
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_SetBitmapColor(orxBITMAP *_pstBitmap, orxRGBA _stColor)
+{
+  /* Checks */
+  orxASSERT(_pstBitmap != orxNULL);
+
+  /* Stores it */
+  _pstBitmap->stColor = _stColor;
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
+orxRGBA orxFASTCALL orxDisplay_Dummy_GetBitmapColor(const orxBITMAP *_pstBitmap)
+{
+  /* Checks */
+  orxASSERT(_pstBitmap != orxNULL);
+
+  /* Done! */
+  return _pstBitmap->stColor;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_GetBitmapSize(const orxBITMAP *_pstBitmap, orxFLOAT *_pfWidth, orxFLOAT *_pfHeight)
+{
+  /* Checks */
+  orxASSERT(_pstBitmap != orxNULL);
+  orxASSERT(_pfWidth != orxNULL);
+  orxASSERT(_pfHeight != orxNULL);
+
+  /* Updates result */
+  *_pfWidth   = _pstBitmap->fWidth;
+  *_pfHeight  = _pstBitmap->fHeight;
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
+orxU32 orxFASTCALL orxDisplay_Dummy_GetBitmapID(const orxBITMAP *_pstBitmap)
+{
+  /* Checks */
+  orxASSERT(_pstBitmap != orxNULL);
+
+  /* Done! */
+  return _pstBitmap->u32ID;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_TransformBitmap(const orxBITMAP *_pstSrc, const orxDISPLAY_TRANSFORM *_pstTransform, orxDISPLAY_SMOOTHING _eSmoothing, orxDISPLAY_BLEND_MODE _eBlendMode)
+{
+  return orxSTATUS_SUCCESS;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_TransformText(const orxSTRING _zString, const orxBITMAP *_pstFont, const orxCHARACTER_MAP *_pstMap, const orxDISPLAY_TRANSFORM *_pstTransform, orxDISPLAY_SMOOTHING _eSmoothing, orxDISPLAY_BLEND_MODE _eBlendMode)
+{
+  return orxSTATUS_SUCCESS;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_DrawLine(const orxVECTOR *_pvStart, const orxVECTOR *_pvEnd, orxRGBA _stColor)
+{
+  return orxSTATUS_SUCCESS;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_DrawPolyline(const orxVECTOR *_avVertexList, orxU32 _u32VertexNumber, orxRGBA _stColor)
+{
+  return orxSTATUS_SUCCESS;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_DrawPolygon(const orxVECTOR *_avVertexList, orxU32 _u32VertexNumber, orxRGBA _stColor, orxBOOL _bFill)
+{
+  return orxSTATUS_SUCCESS;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_DrawCircle(const orxVECTOR *_pvCenter, orxFLOAT _fRadius, orxRGBA _stColor, orxBOOL _bFill)
+{
+  return orxSTATUS_SUCCESS;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_DrawOBox(const orxOBOX *_pstBox, orxRGBA _stColor, orxBOOL _bFill)
+{
+  return orxSTATUS_SUCCESS;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_DrawMesh(const orxBITMAP *_pstBitmap, orxDISPLAY_SMOOTHING _eSmoothing, orxDISPLAY_BLEND_MODE _eBlendMode, orxU32 _u32VertexNumber, const orxDISPLAY_VERTEX *_astVertexList)
+{
+  return orxSTATUS_SUCCESS;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_DrawQuads(const orxBITMAP *_pstBitmap, orxDISPLAY_SMOOTHING _eSmoothing, orxDISPLAY_BLEND_MODE _eBlendMode, orxU32 _u32VertexNumber, const orxDISPLAY_VERTEX *_astVertexList)
+{
+  return orxSTATUS_SUCCESS;
+}
+
+orxBOOL orxFASTCALL orxDisplay_Dummy_HasShaderSupport()
+{
+  return orxFALSE;
+}
+
+orxHANDLE orxFASTCALL orxDisplay_Dummy_CreateShader(const orxSTRING *_azCodeList, orxU32 _u32Size, const orxLINKLIST *_pstParamList, orxBOOL _bUseCustomParam)
+{
+  return orxHANDLE_UNDEFINED;
+}
+
+void orxFASTCALL orxDisplay_Dummy_DeleteShader(orxHANDLE _hShader)
+{
+  return;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_StartShader(orxHANDLE _hShader)
+{
+  return orxSTATUS_FAILURE;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_StopShader(orxHANDLE _hShader)
+{
+  return orxSTATUS_FAILURE;
+}
+
+orxS32 orxFASTCALL orxDisplay_Dummy_GetParameterID(const orxHANDLE _hShader, const orxSTRING _zParam, orxS32 _s32Index, orxBOOL _bIsTexture)
+{
+  return -1;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_SetShaderBitmap(orxHANDLE _hShader, orxS32 _s32ID, const orxBITMAP *_pstValue)
+{
+  return orxSTATUS_FAILURE;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_SetShaderFloat(orxHANDLE _hShader, orxS32 _s32ID, orxFLOAT _fValue)
+{
+  return orxSTATUS_FAILURE;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_SetShaderVector(orxHANDLE _hShader, orxS32 _s32ID, const orxVECTOR *_pvValue)
+{
+  return orxSTATUS_FAILURE;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_EnableVSync(orxBOOL _bEnable)
+{
+  /* Updates status */
+  if(_bEnable != orxFALSE)
+  {
+    orxFLAG_SET(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_VSYNC, orxDISPLAY_KU32_STATIC_FLAG_NONE);
+  }
+  else
+  {
+    orxFLAG_SET(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_NONE, orxDISPLAY_KU32_STATIC_FLAG_VSYNC);
+  }
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
+orxBOOL orxFASTCALL orxDisplay_Dummy_IsVSyncEnabled()
+{
+  return orxFLAG_TEST(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_VSYNC);
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_SetFullScreen(orxBOOL _bFullScreen)
+{
+  /* Updates status */
+  if(_bFullScreen != orxFALSE)
+  {
+    orxFLAG_SET(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_FULL_SCREEN, orxDISPLAY_KU32_STATIC_FLAG_NONE);
+  }
+  else
+  {
+    orxFLAG_SET(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_NONE, orxDISPLAY_KU32_STATIC_FLAG_FULL_SCREEN);
+  }
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
+orxBOOL orxFASTCALL orxDisplay_Dummy_IsFullScreen()
+{
+  return orxFLAG_TEST(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_FULL_SCREEN);
+}
+
+orxU32 orxFASTCALL orxDisplay_Dummy_GetVideoModeCount()
+{
+  return 1;
+}
+
+orxDISPLAY_VIDEO_MODE *orxFASTCALL orxDisplay_Dummy_GetVideoMode(orxU32 _u32Index, orxDISPLAY_VIDEO_MODE *_pstVideoMode)
+{
+  orxDISPLAY_VIDEO_MODE *pstResult = orxNULL;
+
+  /* Checks */
+  orxASSERT(_pstVideoMode != orxNULL);
+
+  /* Only mode? */
+  if((_u32Index == 0) || (_u32Index == orxU32_UNDEFINED))
+  {
+    /* Stores it */
+    _pstVideoMode->u32Width       = orxF2U(sstDisplay.stScreen.fWidth);
+    _pstVideoMode->u32Height      = orxF2U(sstDisplay.stScreen.fHeight);
+    _pstVideoMode->u32Depth       = sstDisplay.u32Depth;
+    _pstVideoMode->u32RefreshRate = sstDisplay.u32RefreshRate;
+    _pstVideoMode->bFullScreen    = orxFLAG_TEST(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_FULL_SCREEN);
+
+    /* Updates result */
+    pstResult = _pstVideoMode;
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Dummy_SetVideoMode(const orxDISPLAY_VIDEO_MODE *_pstVideoMode)
+{
+  /* Has mode? */
+  if(_pstVideoMode != orxNULL)
+  {
+    /* Stores it */
+    sstDisplay.stScreen.fWidth  = orxU2F(_pstVideoMode->u32Width);
+    sstDisplay.stScreen.fHeight = orxU2F(_pstVideoMode->u32Height);
+    sstDisplay.u32Depth         = _pstVideoMode->u32Depth;
+    sstDisplay.u32RefreshRate   = _pstVideoMode->u32RefreshRate;
+    orxDisplay_Dummy_SetFullScreen(_pstVideoMode->bFullScreen);
+  }
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
+orxBOOL orxFASTCALL orxDisplay_Dummy_IsVideoModeAvailable(const orxDISPLAY_VIDEO_MODE *_pstVideoMode)
+{
+  return orxTRUE;
+}
+
+orxDISPLAY_STATS *orxFASTCALL orxDisplay_Dummy_GetFrameStats(orxDISPLAY_STATS *_pstStats)
+{
+  /* Checks */
+  orxASSERT(_pstStats != orxNULL);
+
+  /* Nothing is ever drawn */
+  orxMemory_Zero(_pstStats, sizeof(orxDISPLAY_STATS));
+
+  /* Done! */
+  return _pstStats;
+}
+
+
+/***************************************************************************
+ * Plugin related                                                          *
+ ***************************************************************************/
+
+orxPLUGIN_USER_CORE_FUNCTION_START(DISPLAY);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_Init, DISPLAY, INIT);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_Exit, DISPLAY, EXIT);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_Swap, DISPLAY, SWAP);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_GetScreenBitmap, DISPLAY, GET_SCREEN_BITMAP);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_GetScreenSize, DISPLAY, GET_SCREEN_SIZE);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_CreateBitmap, DISPLAY, CREATE_BITMAP);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_DeleteBitmap, DISPLAY, DELETE_BITMAP);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_LoadBitmap, DISPLAY, LOAD_BITMAP);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_SaveBitmap, DISPLAY, SAVE_BITMAP);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_SetTempBitmap, DISPLAY, SET_TEMP_BITMAP);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_GetTempBitmap, DISPLAY, GET_TEMP_BITMAP);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_SetDestinationBitmaps, DISPLAY, SET_DESTINATION_BITMAPS);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_ClearBitmap, DISPLAY, CLEAR_BITMAP);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_SetBlendMode, DISPLAY, SET_BLEND_MODE);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_SetBitmapClipping, DISPLAY, SET_BITMAP_CLIPPING);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_SetBitmapColorKey, DISPLAY, SET_BITMAP_COLOR_KEY);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_SetBitmapData, DISPLAY, SET_BITMAP_DATA);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_GetBitmapData, DISPLAY, GET_BITMAP_DATA);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_SetBitmapColor, DISPLAY, SET_BITMAP_COLOR);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_GetBitmapColor, DISPLAY, GET_BITMAP_COLOR);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_GetBitmapSize, DISPLAY, GET_BITMAP_SIZE);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_GetBitmapID, DISPLAY, GET_BITMAP_ID);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_TransformBitmap, DISPLAY, TRANSFORM_BITMAP);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_TransformText, DISPLAY, TRANSFORM_TEXT);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_DrawLine, DISPLAY, DRAW_LINE);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_DrawPolyline, DISPLAY, DRAW_POLYLINE);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_DrawPolygon, DISPLAY, DRAW_POLYGON);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_DrawCircle, DISPLAY, DRAW_CIRCLE);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_DrawOBox, DISPLAY, DRAW_OBOX);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_DrawMesh, DISPLAY, DRAW_MESH);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_DrawQuads, DISPLAY, DRAW_QUADS);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_HasShaderSupport, DISPLAY, HAS_SHADER_SUPPORT);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_CreateShader, DISPLAY, CREATE_SHADER);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_DeleteShader, DISPLAY, DELETE_SHADER);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_StartShader, DISPLAY, START_SHADER);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_StopShader, DISPLAY, STOP_SHADER);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_GetParameterID, DISPLAY, GET_PARAMETER_ID);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_SetShaderBitmap, DISPLAY, SET_SHADER_BITMAP);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_SetShaderFloat, DISPLAY, SET_SHADER_FLOAT);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_SetShaderVector, DISPLAY, SET_SHADER_VECTOR);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_EnableVSync, DISPLAY, ENABLE_VSYNC);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_IsVSyncEnabled, DISPLAY, IS_VSYNC_ENABLED);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_SetFullScreen, DISPLAY, SET_FULL_SCREEN);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_IsFullScreen, DISPLAY, IS_FULL_SCREEN);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_GetVideoModeCount, DISPLAY, GET_VIDEO_MODE_COUNT);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_GetVideoMode, DISPLAY, GET_VIDEO_MODE);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_SetVideoMode, DISPLAY, SET_VIDEO_MODE);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_IsVideoModeAvailable, DISPLAY, IS_VIDEO_MODE_AVAILABLE);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Dummy_GetFrameStats, DISPLAY, GET_FRAME_STATS);
+orxPLUGIN_USER_CORE_FUNCTION_END();
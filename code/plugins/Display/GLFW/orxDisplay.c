@@ -325,6 +325,8 @@ typedef struct __orxDISPLAY_STATIC_t
   orxU32                    u32DefaultRefreshRate;
   orxS32                    s32ActiveTextureUnit;
   stbi_io_callbacks         stSTBICallbacks;
+  orxDISPLAY_STATS          stStats;
+  orxDISPLAY_STATS          stFrameStats;
   GLenum                    aeDrawBufferList[orxDISPLAY_KU32_MAX_TEXTURE_UNIT_NUMBER];
   orxBITMAP                *apstDestinationBitmapList[orxDISPLAY_KU32_MAX_TEXTURE_UNIT_NUMBER];
   const orxBITMAP          *apstBoundBitmapList[orxDISPLAY_KU32_MAX_TEXTURE_UNIT_NUMBER];
@@ -619,6 +621,9 @@ static orxINLINE void orxDisplay_GLFW_BindBitmap(const orxBITMAP *_pstBitmap)
     glBindTexture(GL_TEXTURE_2D, _pstBitmap->uiTexture);
     glASSERT();
 
+    /* Updates stats */
+    sstDisplay.stStats.u32TextureBindCount++;
+
     /* Stores texture */
     sstDisplay.apstBoundBitmapList[s32BestCandidate] = _pstBitmap;
 
@@ -907,6 +912,13 @@ static orxSTATUS orxFASTCALL orxDisplay_GLFW_DecompressBitmapCallback(void *_pCo
     glASSERT();
     glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, (GLsizei)pstInfo->pstBitmap->u32RealWidth, (GLsizei)pstInfo->pstBitmap->u32RealHeight, 0, GL_RGBA, GL_UNSIGNED_BYTE, (pstInfo->pu8ImageBuffer != orxNULL) ? pstInfo->pu8ImageBuffer : NULL);
     glASSERT();
+
+    /* Had data? */
+    if(pstInfo->pu8ImageBuffer != orxNULL)
+    {
+      /* Updates stats */
+      sstDisplay.stStats.u32UploadedByteCount += pstInfo->pstBitmap->u32DataSize;
+    }
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
     glASSERT();
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
@@ -1496,6 +1508,9 @@ static void orxFASTCALL orxDisplay_GLFW_InitShader(orxDISPLAY_SHADER *_pstShader
   glUseProgramObjectARB(_pstShader->hProgram);
   glASSERT();
 
+  /* Updates stats */
+  sstDisplay.stStats.u32ShaderSwitchCount++;
+
   /* Has custom textures? */
   if(_pstShader->iTextureCount > 0)
   {
@@ -1516,7 +1531,7 @@ static void orxFASTCALL orxDisplay_GLFW_InitShader(orxDISPLAY_SHADER *_pstShader
   return;
 }
 
-static void orxFASTCALL orxDisplay_GLFW_DrawArrays()
+static void orxFASTCALL orxDisplay_GLFW_DrawArrays(orxDISPLAY_FLUSH_REASON _eReason)
 {
   /* Has data? */
   if(sstDisplay.s32BufferIndex > 0)
@@ -1526,6 +1541,13 @@ static void orxFASTCALL orxDisplay_GLFW_DrawArrays()
     /* Profiles */
     orxPROFILER_PUSH_MARKER("orxDisplay_DrawArrays");
 
+    /* Checks */
+    orxASSERT(_eReason < orxDISPLAY_FLUSH_REASON_NUMBER);
+
+    /* Updates stats */
+    sstDisplay.stStats.au32FlushCountList[_eReason]++;
+    sstDisplay.stStats.u32VertexCount += (orxU32)sstDisplay.s32BufferIndex;
+
     /* Has VBO support? */
     if(orxFLAG_TEST(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_VBO))
     {
@@ -1535,6 +1557,9 @@ static void orxFASTCALL orxDisplay_GLFW_DrawArrays()
       /* Copies vertex buffer */
       glBufferSubDataARB(GL_ARRAY_BUFFER_ARB, 0, sstDisplay.s32BufferIndex * sizeof(orxDISPLAY_GLFW_VERTEX), sstDisplay.astVertexList);
       glASSERT();
+
+      /* Updates stats */
+      sstDisplay.stStats.u32UploadedByteCount += (orxU32)(sstDisplay.s32BufferIndex * sizeof(orxDISPLAY_GLFW_VERTEX));
     }
     else
     {
@@ -1559,6 +1584,9 @@ static void orxFASTCALL orxDisplay_GLFW_DrawArrays()
         glDrawElements(GL_TRIANGLE_STRIP, (GLsizei)(sstDisplay.s32BufferIndex + (sstDisplay.s32BufferIndex >> 1)), GL_UNSIGNED_SHORT, pIndexContext);
         glASSERT();
 
+        /* Updates stats */
+        sstDisplay.stStats.u32DrawCallCount++;
+
         /* Gets next shader */
         pstNextShader = (orxDISPLAY_SHADER *)orxLinkList_GetNext(&(pstShader->stNode));
 
@@ -1594,6 +1622,9 @@ static void orxFASTCALL orxDisplay_GLFW_DrawArrays()
       /* Draws arrays */
       glDrawElements(GL_TRIANGLE_STRIP, (GLsizei)(sstDisplay.s32BufferIndex + (sstDisplay.s32BufferIndex >> 1)), GL_UNSIGNED_SHORT, pIndexContext);
       glASSERT();
+
+      /* Updates stats */
+      sstDisplay.stStats.u32DrawCallCount++;
     }
 
     /* Clears buffer index */
@@ -1618,7 +1649,7 @@ static void orxFASTCALL orxDisplay_GLFW_PrepareBitmap(const orxBITMAP *_pstBitma
   if(sstDisplay.s32PendingShaderCount != 0)
   {
     /* Draws remaining items */
-    orxDisplay_GLFW_DrawArrays();
+    orxDisplay_GLFW_DrawArrays(orxDISPLAY_FLUSH_REASON_SHADER);
 
     /* Checks */
     orxASSERT(sstDisplay.s32PendingShaderCount == 0);
@@ -1628,7 +1659,7 @@ static void orxFASTCALL orxDisplay_GLFW_PrepareBitmap(const orxBITMAP *_pstBitma
   if(_pstBitmap != sstDisplay.apstBoundBitmapList[sstDisplay.s32ActiveTextureUnit])
   {
     /* Draws remaining items */
-    orxDisplay_GLFW_DrawArrays();
+    orxDisplay_GLFW_DrawArrays(orxDISPLAY_FLUSH_REASON_TEXTURE);
 
     /* Binds source bitmap */
     orxDisplay_GLFW_BindBitmap(_pstBitmap);
@@ -1678,7 +1709,7 @@ static void orxFASTCALL orxDisplay_GLFW_PrepareBitmap(const orxBITMAP *_pstBitma
   if(bSmoothing != _pstBitmap->bSmoothing)
   {
     /* Draws remaining items */
-    orxDisplay_GLFW_DrawArrays();
+    orxDisplay_GLFW_DrawArrays(orxDISPLAY_FLUSH_REASON_SMOOTHING);
 
     /* Smoothing? */
     if(bSmoothing != orxFALSE)
@@ -1727,7 +1758,7 @@ static orxINLINE void orxDisplay_GLFW_DrawBitmap(const orxBITMAP *_pstBitmap, co
   if(sstDisplay.s32BufferIndex > orxDISPLAY_KU32_VERTEX_BUFFER_SIZE - 5)
   {
     /* Draws arrays */
-    orxDisplay_GLFW_DrawArrays();
+    orxDisplay_GLFW_DrawArrays(orxDISPLAY_FLUSH_REASON_BUFFER_FULL);
   }
 
   /* Fills the vertex list */
@@ -1812,8 +1843,15 @@ static void orxFASTCALL orxDisplay_GLFW_DrawPrimitive(orxU32 _u32VertexNumber, o
     /* Copies vertex buffer */
     glBufferSubDataARB(GL_ARRAY_BUFFER_ARB, 0, _u32VertexNumber * sizeof(orxDISPLAY_GLFW_VERTEX), sstDisplay.astVertexList);
     glASSERT();
+
+    /* Updates stats */
+    sstDisplay.stStats.u32UploadedByteCount += (orxU32)(_u32VertexNumber * sizeof(orxDISPLAY_GLFW_VERTEX));
   }
 
+  /* Updates stats */
+  sstDisplay.stStats.u32DrawCallCount++;
+  sstDisplay.stStats.u32VertexCount += _u32VertexNumber;
+
   /* Only 2 vertices? */
   if(_u32VertexNumber == 2)
   {
@@ -1884,7 +1922,7 @@ static orxSTATUS orxFASTCALL orxDisplay_GLFW_EventHandler(const orxEVENT *_pstEv
   if(_pstEvent->eID == orxRENDER_EVENT_STOP)
   {
     /* Draws remaining items */
-    orxDisplay_GLFW_DrawArrays();
+    orxDisplay_GLFW_DrawArrays(orxDISPLAY_FLUSH_REASON_FRAME);
 
     /* Polls events */
     glfwPollEvents();
@@ -1990,7 +2028,7 @@ orxSTATUS orxFASTCALL orxDisplay_GLFW_TransformText(const orxSTRING _zString, co
           if(sstDisplay.s32BufferIndex > orxDISPLAY_KU32_VERTEX_BUFFER_SIZE - 5)
           {
             /* Draws arrays */
-            orxDisplay_GLFW_DrawArrays();
+            orxDisplay_GLFW_DrawArrays(orxDISPLAY_FLUSH_REASON_BUFFER_FULL);
           }
 
           /* Outputs vertices and texture coordinates */
@@ -2049,7 +2087,7 @@ orxSTATUS orxFASTCALL orxDisplay_GLFW_DrawLine(const orxVECTOR *_pvStart, const
   orxASSERT(_pvEnd != orxNULL);
 
   /* Draws remaining items */
-  orxDisplay_GLFW_DrawArrays();
+  orxDisplay_GLFW_DrawArrays(orxDISPLAY_FLUSH_REASON_PRIMITIVE);
 
   /* Copies vertices */
   sstDisplay.astVertexList[0].fX = (GLfloat)(_pvStart->fX);
@@ -2079,7 +2117,7 @@ orxSTATUS orxFASTCALL orxDisplay_GLFW_DrawPolyline(const orxVECTOR *_avVertexLis
   orxASSERT(_u32VertexNumber > 0);
 
   /* Draws remaining items */
-  orxDisplay_GLFW_DrawArrays();
+  orxDisplay_GLFW_DrawArrays(orxDISPLAY_FLUSH_REASON_PRIMITIVE);
 
   /* For all vertices */
   for(i = 0; i < _u32VertexNumber; i++)
@@ -2110,7 +2148,7 @@ orxSTATUS orxFASTCALL orxDisplay_GLFW_DrawPolygon(const orxVECTOR *_avVertexList
   orxASSERT(_u32VertexNumber > 0);
 
   /* Draws remaining items */
-  orxDisplay_GLFW_DrawArrays();
+  orxDisplay_GLFW_DrawArrays(orxDISPLAY_FLUSH_REASON_PRIMITIVE);
 
   /* For all vertices */
   for(i = 0; i < _u32VertexNumber; i++)
@@ -2142,7 +2180,7 @@ orxSTATUS orxFASTCALL orxDisplay_GLFW_DrawCircle(const orxVECTOR *_pvCenter, orx
   orxASSERT(_fRadius >= orxFLOAT_0);
 
   /* Draws remaining items */
-  orxDisplay_GLFW_DrawArrays();
+  orxDisplay_GLFW_DrawArrays(orxDISPLAY_FLUSH_REASON_PRIMITIVE);
 
   /* For all vertices */
   for(i = 0, fAngle = orxFLOAT_0; i < orxDISPLAY_KU32_CIRCLE_LINE_NUMBER; i++, fAngle += orxMATH_KF_2_PI / orxDISPLAY_KU32_CIRCLE_LINE_NUMBER)
@@ -2172,7 +2210,7 @@ orxSTATUS orxFASTCALL orxDisplay_GLFW_DrawOBox(const orxOBOX *_pstBox, orxRGBA _
   orxASSERT(_pstBox != orxNULL);
 
   /* Draws remaining items */
-  orxDisplay_GLFW_DrawArrays();
+  orxDisplay_GLFW_DrawArrays(orxDISPLAY_FLUSH_REASON_PRIMITIVE);
 
   /* Gets origin */
   orxVector_Sub(&vOrigin, &(_pstBox->vPosition), &(_pstBox->vPivot));
@@ -2234,7 +2272,7 @@ orxSTATUS orxFASTCALL orxDisplay_GLFW_DrawMesh(const orxBITMAP *_pstBitmap, orxD
   if(sstDisplay.s32BufferIndex + (2 * _u32VertexNumber) > orxDISPLAY_KU32_VERTEX_BUFFER_SIZE - 3)
   {
     /* Draws arrays */
-    orxDisplay_GLFW_DrawArrays();
+    orxDisplay_GLFW_DrawArrays(orxDISPLAY_FLUSH_REASON_BUFFER_FULL);
 
     /* Too many vertices? */
     if(_u32VertexNumber > orxDISPLAY_KU32_VERTEX_BUFFER_SIZE / 2)
@@ -2291,6 +2329,50 @@ orxSTATUS orxFASTCALL orxDisplay_GLFW_DrawMesh(const orxBITMAP *_pstBitmap, orxD
   return eResult;
 }
 
+orxSTATUS orxFASTCALL orxDisplay_GLFW_DrawQuads(const orxBITMAP *_pstBitmap, orxDISPLAY_SMOOTHING _eSmoothing, orxDISPLAY_BLEND_MODE _eBlendMode, orxU32 _u32QuadNumber, const orxDISPLAY_VERTEX *_astVertexList)
+{
+  const orxBITMAP  *pstBitmap;
+  orxU32            i, u32VertexNumber;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT((_astVertexList != orxNULL) || (_u32QuadNumber == 0));
+
+  /* Gets bitmap to use */
+  pstBitmap = (_pstBitmap != orxNULL) ? _pstBitmap : sstDisplay.apstBoundBitmapList[sstDisplay.s32ActiveTextureUnit];
+
+  /* Prepares bitmap for drawing */
+  orxDisplay_GLFW_PrepareBitmap(pstBitmap, _eSmoothing, _eBlendMode);
+
+  /* For all vertices */
+  for(i = 0, u32VertexNumber = _u32QuadNumber << 2; i < u32VertexNumber; i++)
+  {
+    /* New quad and end of buffer? */
+    if(((i & 3) == 0) && (sstDisplay.s32BufferIndex > orxDISPLAY_KU32_VERTEX_BUFFER_SIZE - 5))
+    {
+      /* Draws arrays */
+      orxDisplay_GLFW_DrawArrays(orxDISPLAY_FLUSH_REASON_BUFFER_FULL);
+    }
+
+    /* Copies position */
+    sstDisplay.astVertexList[sstDisplay.s32BufferIndex].fX      = _astVertexList[i].fX;
+    sstDisplay.astVertexList[sstDisplay.s32BufferIndex].fY      = _astVertexList[i].fY;
+
+    /* Updates UV */
+    sstDisplay.astVertexList[sstDisplay.s32BufferIndex].fU      = (GLfloat)(pstBitmap->fRecRealWidth * _astVertexList[i].fU);
+    sstDisplay.astVertexList[sstDisplay.s32BufferIndex].fV      = (GLfloat)(pstBitmap->fRecRealHeight * _astVertexList[i].fV);
+
+    /* Copies color */
+    sstDisplay.astVertexList[sstDisplay.s32BufferIndex].stRGBA  = _astVertexList[i].stRGBA;
+
+    /* Updates index */
+    sstDisplay.s32BufferIndex++;
+  }
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
 void orxFASTCALL orxDisplay_GLFW_DeleteBitmap(orxBITMAP *_pstBitmap)
 {
   /* Checks */
@@ -2474,6 +2556,9 @@ orxSTATUS orxFASTCALL orxDisplay_GLFW_ClearBitmap(orxBITMAP *_pstBitmap, orxRGBA
       glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, (GLsizei)_pstBitmap->u32RealWidth, (GLsizei)_pstBitmap->u32RealHeight, GL_RGBA, GL_UNSIGNED_BYTE, astBuffer);
       glASSERT();
 
+      /* Updates stats */
+      sstDisplay.stStats.u32UploadedByteCount += _pstBitmap->u32DataSize;
+
       /* Restores previous texture */
       glBindTexture(GL_TEXTURE_2D, (sstDisplay.apstBoundBitmapList[sstDisplay.s32ActiveTextureUnit] != orxNULL) ? sstDisplay.apstBoundBitmapList[sstDisplay.s32ActiveTextureUnit]->uiTexture : 0);
       glASSERT();
@@ -2495,7 +2580,7 @@ orxSTATUS orxFASTCALL orxDisplay_GLFW_SetBlendMode(orxDISPLAY_BLEND_MODE _eBlend
   if(_eBlendMode != sstDisplay.eLastBlendMode)
   {
     /* Draws remaining items */
-    orxDisplay_GLFW_DrawArrays();
+    orxDisplay_GLFW_DrawArrays(orxDISPLAY_FLUSH_REASON_BLEND);
 
     /* Stores it */
     sstDisplay.eLastBlendMode = _eBlendMode;
@@ -2565,11 +2650,15 @@ orxSTATUS orxFASTCALL orxDisplay_GLFW_Swap()
   orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
 
   /* Draws remaining items */
-  orxDisplay_GLFW_DrawArrays();
+  orxDisplay_GLFW_DrawArrays(orxDISPLAY_FLUSH_REASON_FRAME);
 
   /* Swap buffers */
   glfwSwapBuffers();
 
+  /* Stores frame stats & starts new ones */
+  orxMemory_Copy(&(sstDisplay.stFrameStats), &(sstDisplay.stStats), sizeof(orxDISPLAY_STATS));
+  orxMemory_Zero(&(sstDisplay.stStats), sizeof(orxDISPLAY_STATS));
+
   /* Is fullscreen & VSync? */
   if(orxFLAG_TEST_ALL(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_FULLSCREEN | orxDISPLAY_KU32_STATIC_FLAG_VSYNC))
   {
@@ -2642,6 +2731,9 @@ orxSTATUS orxFASTCALL orxDisplay_GLFW_SetBitmapData(orxBITMAP *_pstBitmap, const
     glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, (GLsizei)_pstBitmap->u32RealWidth, (GLsizei)_pstBitmap->u32RealHeight, GL_RGBA, GL_UNSIGNED_BYTE, pu8ImageBuffer);
     glASSERT();
 
+    /* Updates stats */
+    sstDisplay.stStats.u32UploadedByteCount += _pstBitmap->u32DataSize;
+
     /* Restores previous texture */
     glBindTexture(GL_TEXTURE_2D, (sstDisplay.apstBoundBitmapList[sstDisplay.s32ActiveTextureUnit] != orxNULL) ? sstDisplay.apstBoundBitmapList[sstDisplay.s32ActiveTextureUnit]->uiTexture : 0);
     glASSERT();
@@ -2698,7 +2790,7 @@ orxSTATUS orxFASTCALL orxDisplay_GLFW_GetBitmapData(const orxBITMAP *_pstBitmap,
     orxU8  *pu8ImageBuffer;
 
     /* Draws remaining items */
-    orxDisplay_GLFW_DrawArrays();
+    orxDisplay_GLFW_DrawArrays(orxDISPLAY_FLUSH_REASON_BITMAP_DATA);
 
     /* Allocates buffer */
     pu8ImageBuffer = ((_pstBitmap != sstDisplay.pstScreen) && (orxFLAG_TEST(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_NPOT))) ? _au8Data : (orxU8 *)orxMemory_Allocate(_pstBitmap->u32RealWidth * _pstBitmap->u32RealHeight * 4 * sizeof(orxU8), orxMEMORY_TYPE_MAIN);
@@ -2999,7 +3091,7 @@ orxSTATUS orxFASTCALL orxDisplay_GLFW_SetDestinationBitmaps(orxBITMAP **_apstBit
         if(bDraw != orxFALSE)
         {
           /* Draws remaining items */
-          orxDisplay_GLFW_DrawArrays();
+          orxDisplay_GLFW_DrawArrays(orxDISPLAY_FLUSH_REASON_DESTINATION);
         }
 
         /* Using framebuffer? */
@@ -3234,7 +3326,7 @@ orxSTATUS orxFASTCALL orxDisplay_GLFW_TransformBitmap(const orxBITMAP *_pstSrc,
     if(sstDisplay.s32BufferIndex > 0)
     {
       /* Draws arrays */
-      orxDisplay_GLFW_DrawArrays();
+      orxDisplay_GLFW_DrawArrays(orxDISPLAY_FLUSH_REASON_PRIMITIVE);
     }
 
     /* Defines the vertex list */
@@ -3267,7 +3359,7 @@ orxSTATUS orxFASTCALL orxDisplay_GLFW_TransformBitmap(const orxBITMAP *_pstSrc,
     sstDisplay.s32BufferIndex = 4;
 
     /* Draws arrays */
-    orxDisplay_GLFW_DrawArrays();
+    orxDisplay_GLFW_DrawArrays(orxDISPLAY_FLUSH_REASON_PRIMITIVE);
   }
   else
   {
@@ -3337,7 +3429,7 @@ orxSTATUS orxFASTCALL orxDisplay_GLFW_TransformBitmap(const orxBITMAP *_pstSrc,
           if(sstDisplay.s32BufferIndex > orxDISPLAY_KU32_VERTEX_BUFFER_SIZE - 5)
           {
             /* Draws arrays */
-            orxDisplay_GLFW_DrawArrays();
+            orxDisplay_GLFW_DrawArrays(orxDISPLAY_FLUSH_REASON_BUFFER_FULL);
           }
 
           /* Outputs vertices and texture coordinates */
@@ -3555,7 +3647,7 @@ orxSTATUS orxFASTCALL orxDisplay_GLFW_SetBitmapClipping(orxBITMAP *_pstBitmap, o
     orxU32 u32ClipX, u32ClipY, u32ClipWidth, u32ClipHeight;
 
     /* Draws remaining items */
-    orxDisplay_GLFW_DrawArrays();
+    orxDisplay_GLFW_DrawArrays(orxDISPLAY_FLUSH_REASON_DESTINATION);
 
     /* Gets new clipping values */
     u32ClipX      = _u32TLX;
@@ -3771,7 +3863,7 @@ orxSTATUS orxFASTCALL orxDisplay_GLFW_SetVideoMode(const orxDISPLAY_VIDEO_MODE *
   orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
 
   /* Draws remaining items */
-  orxDisplay_GLFW_DrawArrays();
+  orxDisplay_GLFW_DrawArrays(orxDISPLAY_FLUSH_REASON_DESTINATION);
 
   /* Has specified video mode? */
   if(_pstVideoMode != orxNULL)
@@ -4225,6 +4317,9 @@ orxSTATUS orxFASTCALL orxDisplay_GLFW_SetVideoMode(const orxDISPLAY_VIDEO_MODE *
               glASSERT();
               glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, (GLsizei)pstBitmap->u32RealWidth, (GLsizei)pstBitmap->u32RealHeight, 0, GL_RGBA, GL_UNSIGNED_BYTE, (GLvoid *)aau8BufferArray[u32Index]);
               glASSERT();
+
+              /* Updates stats */
+              sstDisplay.stStats.u32UploadedByteCount += pstBitmap->u32DataSize;
               glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
               glASSERT();
               glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
@@ -5056,7 +5151,7 @@ orxSTATUS orxFASTCALL orxDisplay_GLFW_StartShader(orxHANDLE _hShader)
   if((pstShader->bPending == orxFALSE) || (pstShader->bUseCustomParam != orxFALSE))
   {
     /* Draw remaining items */
-    orxDisplay_GLFW_DrawArrays();
+    orxDisplay_GLFW_DrawArrays(orxDISPLAY_FLUSH_REASON_SHADER);
 
     /* Adds it to the active list */
     orxLinkList_AddEnd(&(sstDisplay.stActiveShaderList), &(pstShader->stNode));
@@ -5074,6 +5169,9 @@ orxSTATUS orxFASTCALL orxDisplay_GLFW_StartShader(orxHANDLE _hShader)
   glUseProgramObjectARB(pstShader->hProgram);
   glASSERT();
 
+  /* Updates stats */
+  sstDisplay.stStats.u32ShaderSwitchCount++;
+
   /* Done! */
   return eResult;
 }
@@ -5147,7 +5245,7 @@ orxSTATUS orxFASTCALL orxDisplay_GLFW_StopShader(orxHANDLE _hShader)
         if(sstDisplay.s32BufferIndex > 0)
         {
           /* Draws arrays */
-          orxDisplay_GLFW_DrawArrays();
+          orxDisplay_GLFW_DrawArrays(orxDISPLAY_FLUSH_REASON_SHADER);
 
           /* Don't reset shader */
           bResetShader = orxFALSE;
@@ -5188,6 +5286,9 @@ orxSTATUS orxFASTCALL orxDisplay_GLFW_StopShader(orxHANDLE _hShader)
     glUseProgramObjectARB(sstDisplay.pstDefaultShader->hProgram);
     glASSERT();
 
+    /* Updates stats */
+    sstDisplay.stStats.u32ShaderSwitchCount++;
+
     /* Updates its texture unit */
     glUNIFORM(1iARB, sstDisplay.pstDefaultShader->iTextureLocation, sstDisplay.s32ActiveTextureUnit);
   }
@@ -5335,7 +5436,7 @@ orxSTATUS orxFASTCALL orxDisplay_GLFW_SetShaderBitmap(orxHANDLE _hShader, orxS32
       if(pstShader->astTextureInfoList[i].pstBitmap != _pstValue)
       {
         /* Draws remaining items */
-        orxDisplay_GLFW_DrawArrays();
+        orxDisplay_GLFW_DrawArrays(orxDISPLAY_FLUSH_REASON_SHADER);
 
         /* Updates texture info */
         pstShader->astTextureInfoList[i].pstBitmap = _pstValue;
@@ -5459,6 +5560,20 @@ orxSTATUS orxFASTCALL orxDisplay_GLFW_SetShaderVector(orxHANDLE _hShader, orxS32
 }
 
 
+orxDISPLAY_STATS *orxFASTCALL orxDisplay_GLFW_GetFrameStats(orxDISPLAY_STATS *_pstStats)
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstStats != orxNULL);
+
+  /* Copies last frame stats */
+  orxMemory_Copy(_pstStats, &(sstDisplay.stFrameStats), sizeof(orxDISPLAY_STATS));
+
+  /* Done! */
+  return _pstStats;
+}
+
+
 /***************************************************************************
  * Plugin Related                                                          *
  ***************************************************************************/
@@ -5494,6 +5609,7 @@ orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_GLFW_DrawPolygon, DISPLAY, DRAW_POLY
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_GLFW_DrawCircle, DISPLAY, DRAW_CIRCLE);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_GLFW_DrawOBox, DISPLAY, DRAW_OBOX);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_GLFW_DrawMesh, DISPLAY, DRAW_MESH);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_GLFW_DrawQuads, DISPLAY, DRAW_QUADS);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_GLFW_HasShaderSupport, DISPLAY, HAS_SHADER_SUPPORT);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_GLFW_CreateShader, DISPLAY, CREATE_SHADER);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_GLFW_DeleteShader, DISPLAY, DELETE_SHADER);
@@ -5511,6 +5627,7 @@ orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_GLFW_GetVideoModeCount, DISPLAY, GET
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_GLFW_GetVideoMode, DISPLAY, GET_VIDEO_MODE);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_GLFW_SetVideoMode, DISPLAY, SET_VIDEO_MODE);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_GLFW_IsVideoModeAvailable, DISPLAY, IS_VIDEO_MODE_AVAILABLE);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_GLFW_GetFrameStats, DISPLAY, GET_FRAME_STATS);
 orxPLUGIN_USER_CORE_FUNCTION_END();
 
 #ifdef __orxGCC__
@@ -2389,6 +2389,50 @@ orxSTATUS orxFASTCALL orxDisplay_Android_DrawMesh(const orxBITMAP *_pstBitmap, o
   return eResult;
 }
 
+orxSTATUS orxFASTCALL orxDisplay_Android_DrawQuads(const orxBITMAP *_pstBitmap, orxDISPLAY_SMOOTHING _eSmoothing, orxDISPLAY_BLEND_MODE _eBlendMode, orxU32 _u32QuadNumber, const orxDISPLAY_VERTEX *_astVertexList)
+{
+  const orxBITMAP  *pstBitmap;
+  orxU32            i, u32VertexNumber;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT((_astVertexList != orxNULL) || (_u32QuadNumber == 0));
+
+  /* Gets bitmap to use */
+  pstBitmap = (_pstBitmap != orxNULL) ? _pstBitmap : sstDisplay.apstBoundBitmapList[sstDisplay.s32ActiveTextureUnit];
+
+  /* Prepares bitmap for drawing */
+  orxDisplay_Android_PrepareBitmap(pstBitmap, _eSmoothing, _eBlendMode);
+
+  /* For all vertices */
+  for(i = 0, u32VertexNumber = _u32QuadNumber << 2; i < u32VertexNumber; i++)
+  {
+    /* New quad and end of buffer? */
+    if(((i & 3) == 0) && (sstDisplay.s32BufferIndex > orxDISPLAY_KU32_VERTEX_BUFFER_SIZE - 5))
+    {
+      /* Draws arrays */
+      orxDisplay_Android_DrawArrays();
+    }
+
+    /* Copies position */
+    sstDisplay.astVertexList[sstDisplay.s32BufferIndex].fX      = _astVertexList[i].fX;
+    sstDisplay.astVertexList[sstDisplay.s32BufferIndex].fY      = _astVertexList[i].fY;
+
+    /* Updates UV */
+    sstDisplay.astVertexList[sstDisplay.s32BufferIndex].fU      = (GLfloat)(pstBitmap->fRecRealWidth * _astVertexList[i].fU);
+    sstDisplay.astVertexList[sstDisplay.s32BufferIndex].fV      = (GLfloat)(pstBitmap->fRecRealHeight * _astVertexList[i].fV);
+
+    /* Copies color */
+    sstDisplay.astVertexList[sstDisplay.s32BufferIndex].stRGBA  = _astVertexList[i].stRGBA;
+
+    /* Updates index */
+    sstDisplay.s32BufferIndex++;
+  }
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
 void orxFASTCALL orxDisplay_Android_DeleteBitmap(orxBITMAP *_pstBitmap)
 {
   /* Checks */
@@ -4842,6 +4886,16 @@ orxSTATUS orxFASTCALL orxDisplay_Android_SetShaderVector(orxHANDLE _hShader, orx
   return eResult;
 }
 
+orxDISPLAY_STATS *orxFASTCALL orxDisplay_Android_GetFrameStats(orxDISPLAY_STATS *_pstStats)
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstStats != orxNULL);
+
+  /* Not supported */
+  return orxNULL;
+}
+
 /***************************************************************************
  * Plugin Related                                                          *
  ***************************************************************************/
@@ -4876,6 +4930,7 @@ orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Android_DrawPolygon, DISPLAY, DRAW_P
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Android_DrawCircle, DISPLAY, DRAW_CIRCLE);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Android_DrawOBox, DISPLAY, DRAW_OBOX);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Android_DrawMesh, DISPLAY, DRAW_MESH);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Android_DrawQuads, DISPLAY, DRAW_QUADS);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Android_HasShaderSupport, DISPLAY, HAS_SHADER_SUPPORT);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Android_CreateShader, DISPLAY, CREATE_SHADER);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Android_DeleteShader, DISPLAY, DELETE_SHADER);
@@ -4893,4 +4948,5 @@ orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Android_GetVideoModeCount, DISPLAY,
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Android_GetVideoMode, DISPLAY, GET_VIDEO_MODE);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Android_SetVideoMode, DISPLAY, SET_VIDEO_MODE);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Android_IsVideoModeAvailable, DISPLAY, IS_VIDEO_MODE_AVAILABLE);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Android_GetFrameStats, DISPLAY, GET_FRAME_STATS);
 orxPLUGIN_USER_CORE_FUNCTION_END();
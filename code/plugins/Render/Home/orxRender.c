@@ -59,10 +59,27 @@
 #define orxRENDER_KU32_STATIC_MASK_ALL              0xFFFFFFFF /**< All mask */
 
 
+/** Static group flags
+ */
+#define orxRENDER_KU32_STATIC_GROUP_FLAG_NONE       0x00000000 /**< No flags */
+
+#define orxRENDER_KU32_STATIC_GROUP_FLAG_DIRTY      0x00000001 /**< Dirty flag */
+#define orxRENDER_KU32_STATIC_GROUP_FLAG_ALL        0x00000002 /**< Whole group is static flag */
+
+#define orxRENDER_KU32_STATIC_GROUP_MASK_ALL        0xFFFFFFFF /**< All mask */
+
+
 /** Defines
  */
 #define orxRENDER_KF_TICK_SIZE                      orx2F(1.0f / 10.0f)
 #define orxRENDER_KU32_ORDER_BANK_SIZE              1024
+#define orxRENDER_KU32_STATIC_GROUP_BANK_SIZE       16
+#define orxRENDER_KU32_STATIC_GROUP_TABLE_SIZE      16
+#define orxRENDER_KU32_STATIC_CHUNK_BANK_SIZE       128
+#define orxRENDER_KU32_STATIC_CHUNK_QUAD_SIZE       64
+#define orxRENDER_KF_STATIC_CHUNK_SIZE              orx2F(1024.0f)
+#define orxRENDER_KF_STATIC_BORDER_FIX              orx2F(0.1f)
+#define orxRENDER_KU32_QUAD_BATCH_SIZE              1024
 #define orxRENDER_KST_DEFAULT_COLOR                 orx2RGBA(255, 0, 0, 255)
 #define orxRENDER_KZ_FPS_FORMAT                     "FPS: %d"
 #define orxRENDER_KF_CONSOLE_BLINK_DELAY            orx2F(0.5f)
@@ -114,6 +131,38 @@
  * Structure declaration                                                   *
  ***************************************************************************/
 
+/** Static chunk structure: pre-transformed (world space) quads sharing the same group, cell, depth, texture & render states
+ */
+typedef struct __orxRENDER_STATIC_CHUNK_t
+{
+  orxLINKLIST_NODE      stNode;                     /**< Linklist node */
+  orxDISPLAY_VERTEX    *astVertexList;              /**< Vertex list (4 per quad) */
+  orxTEXTURE           *pstTexture;                 /**< Texture pointer */
+  orxAABOX              stBox;                      /**< World bounding box */
+  orxVECTOR             vCenter;                    /**< World center */
+  orxFLOAT              fBoundingRadius;            /**< Bounding radius */
+  orxFLOAT              fZ;                         /**< Z coordinate */
+  orxDISPLAY_BLEND_MODE eBlendMode;                 /**< Blend mode */
+  orxDISPLAY_SMOOTHING  eSmoothing;                 /**< Smoothing */
+  orxS32                s32CellX;                   /**< Cell X coordinate */
+  orxS32                s32CellY;                   /**< Cell Y coordinate */
+  orxU32                u32QuadCount;               /**< Quad count */
+  orxU32                u32QuadSize;                /**< Quad capacity */
+
+} orxRENDER_STATIC_CHUNK;
+
+/** Static group structure
+ */
+typedef struct __orxRENDER_STATIC_GROUP_t
+{
+  orxLINKLIST           stChunkList;                /**< Chunk list */
+  orxU32                u32GroupID;                 /**< Group ID */
+  orxU32                u32Flags;                   /**< Flags */
+
+} orxRENDER_STATIC_GROUP;
+
+/** Render node structure
+ */
 typedef struct __orxRENDER_RENDER_NODE_t
 {
   orxLINKLIST_NODE      stNode;                     /**< Linklist node : 12 */
@@ -124,6 +173,8 @@ typedef struct __orxRENDER_RENDER_NODE_t
   orxDISPLAY_SMOOTHING  eSmoothing;                 /**< Smoothing : 32 */
   orxOBJECT            *pstObject;                  /**< Object pointer : 36 */
   orxFLOAT              fDepthCoef;                 /**< Depth coef : 40 */
+  orxRENDER_STATIC_CHUNK *pstChunk;                 /**< Static chunk pointer : 44 */
+  orxPARTICLESYSTEM    *pstParticleSystem;          /**< Particle system pointer : 48 */
 
 } orxRENDER_NODE;
 
@@ -135,13 +186,23 @@ typedef struct __orxRENDER_STATIC_t
   orxCLOCK     *pstClock;                           /**< Rendering clock pointer */
   orxFRAME     *pstFrame;                           /**< Conversion frame */
   orxBANK      *pstRenderBank;                      /**< Rendering bank */
-  orxLINKLIST   stRenderList;                       /**< Rendering list */
+  orxLINKLIST   astRenderList[orxCAMERA_KU32_GROUP_ID_NUMBER]; /**< Rendering lists, one per camera group */
+  orxLINKLIST  *pstRenderList;                      /**< Current rendering list */
+  const orxCAMERA *pstRenderCamera;                 /**< Camera whose render nodes are currently stored */
+  orxU32        u32RenderCameraKey;                 /**< Key of the camera whose render nodes are currently stored */
   orxFLOAT      fDefaultConsoleOffset;              /**< Default console offset */
   orxFLOAT      fConsoleOffset;                     /**< Console offset */
   orxU32        u32SelectedFrame;                   /**< Selected frame */
   orxU32        u32SelectedThread;                  /**< Selected thread */
   orxU32        u32SelectedMarkerDepth;             /**< Selected marker depth */
   orxU32        u32MaxMarkerDepth;                  /**< Maximum marker depth */
+  orxBANK      *pstStaticGroupBank;                 /**< Static group bank */
+  orxBANK      *pstStaticChunkBank;                 /**< Static chunk bank */
+  orxHASHTABLE *pstStaticGroupTable;                /**< Static group table */
+  orxDISPLAY_VERTEX *astVertexList;                 /**< Vertex list (screen space) */
+  orxU32        u32VertexListSize;                  /**< Vertex list size */
+  orxAABOX      stClipBox;                          /**< Current viewport clipping box (screen space) */
+  orxFLOAT      fStaticChunkSize;                   /**< Static chunk size */
 
 } orxRENDER_STATIC;
 
@@ -1136,6 +1197,60 @@ static orxINLINE void orxRender_Home_RenderProfiler()
     }
   }
 
+  /* Draws display stats */
+  {
+    static const orxSTRING  azReasonList[orxDISPLAY_FLUSH_REASON_NUMBER] = {"FLUSH_TEX", "FLUSH_SMOOTH", "FLUSH_BLEND", "FLUSH_SHADER", "FLUSH_FULL", "FLUSH_PRIM", "FLUSH_DEST", "FLUSH_DATA", "FLUSH_FRAME"};
+    orxDISPLAY_STATS        stStats;
+
+    /* Gets last frame stats */
+    if(orxDisplay_GetFrameStats(&stStats) != orxNULL)
+    {
+      /* Updates position */
+      if(bLandscape != orxFALSE)
+      {
+        stTransform.fDstY += 40.0f;
+      }
+      else
+      {
+        stTransform.fDstX += 40.0f;
+      }
+
+      /* Draws counters */
+      orxDisplay_SetBitmapColor(pstFontBitmap, orx2RGBA(0xFF, 0xFF, 0xFF, 0xCC));
+      orxString_NPrint(acLabel, sizeof(acLabel) - 1, "%-12s[%u calls] [%u vertices]", "DRAW", stStats.u32DrawCallCount, stStats.u32VertexCount);
+      orxDisplay_TransformText(acLabel, pstFontBitmap, orxFont_GetMap(pstFont), &stTransform, orxDISPLAY_SMOOTHING_NONE, orxDISPLAY_BLEND_MODE_ALPHA);
+      if(bLandscape != orxFALSE)
+      {
+        stTransform.fDstY += 20.0f;
+      }
+      else
+      {
+        stTransform.fDstX += 20.0f;
+      }
+      orxString_NPrint(acLabel, sizeof(acLabel) - 1, "%-12s[%u binds] [%u shaders] [%.2fKB]", "STATE", stStats.u32TextureBindCount, stStats.u32ShaderSwitchCount, orxU2F(stStats.u32UploadedByteCount) * orx2F(1.0f/1024.0f));
+      orxDisplay_TransformText(acLabel, pstFontBitmap, orxFont_GetMap(pstFont), &stTransform, orxDISPLAY_SMOOTHING_NONE, orxDISPLAY_BLEND_MODE_ALPHA);
+
+      /* For all flush reasons */
+      for(i = 0; i < orxDISPLAY_FLUSH_REASON_NUMBER; i++)
+      {
+        /* Updates position */
+        if(bLandscape != orxFALSE)
+        {
+          stTransform.fDstY += 20.0f;
+        }
+        else
+        {
+          stTransform.fDstX += 20.0f;
+        }
+
+        /* Draws it (greyed out if unused) */
+        orxDisplay_SetBitmapColor(pstFontBitmap, (stStats.au32FlushCountList[i] != 0) ? orx2RGBA(0xFF, 0xFF, 0xFF, 0xCC) : orx2RGBA(0x66, 0x66, 0x66, 0xCC));
+        orxString_NPrint(acLabel, sizeof(acLabel) - 1, "%-12s[%u]", azReasonList[i], stStats.au32FlushCountList[i]);
+        orxDisplay_TransformText(acLabel, pstFontBitmap, orxFont_GetMap(pstFont), &stTransform, orxDISPLAY_SMOOTHING_NONE, orxDISPLAY_BLEND_MODE_ALPHA);
+      }
+    }
+  }
+
 #endif /* __orxPROFILER__ */
 
   /* Deletes pixel texture */
@@ -1368,14 +1483,847 @@ static orxINLINE void orxRender_Home_RenderConsole()
   /* Deletes pixel texture */
   orxTexture_Delete(pstTexture);
 
-  /* Re-enables marker operations */
-  orxProfiler_EnableMarkerOperations(orxTRUE);
+  /* Re-enables marker operations */
+  orxProfiler_EnableMarkerOperations(orxTRUE);
+
+  /* Profiles */
+  orxPROFILER_POP_MARKER();
+
+  /* Done! */
+  return;
+}
+
+/** Adds a render node to the sorted render list
+ * @param[in]   _pstRenderNode    Render node to add
+ */
+static orxINLINE void orxRender_Home_AddRenderNode(orxRENDER_NODE *_pstRenderNode)
+{
+  /* Cleans its internal node */
+  orxMemory_Zero(_pstRenderNode, sizeof(orxLINKLIST_NODE));
+
+  /* Empty list? */
+  if(orxLinkList_GetCount(sstRender.pstRenderList) == 0)
+  {
+    /* Adds node at beginning */
+    orxLinkList_AddStart(sstRender.pstRenderList, (orxLINKLIST_NODE *)_pstRenderNode);
+  }
+  else
+  {
+    orxRENDER_NODE *pstNode;
+
+    /* Finds correct node position */
+    for(pstNode = (orxRENDER_NODE *)orxLinkList_GetFirst(sstRender.pstRenderList);
+        (pstNode != orxNULL)
+     && ((_pstRenderNode->fZ < pstNode->fZ)
+      || ((_pstRenderNode->fZ == pstNode->fZ)
+       && ((_pstRenderNode->pstTexture < pstNode->pstTexture)
+        || ((_pstRenderNode->pstTexture == pstNode->pstTexture)
+         && ((_pstRenderNode->pstShader < pstNode->pstShader)
+          || ((_pstRenderNode->pstShader == pstNode->pstShader)
+           && (_pstRenderNode->eBlendMode < pstNode->eBlendMode))
+            || ((_pstRenderNode->eBlendMode == pstNode->eBlendMode)
+             && (_pstRenderNode->eSmoothing < pstNode->eSmoothing)))))));
+        pstNode = (orxRENDER_NODE *)orxLinkList_GetNext(&(pstNode->stNode)));
+
+    /* End of list reached? */
+    if(pstNode == orxNULL)
+    {
+      /* Adds it at end */
+      orxLinkList_AddEnd(sstRender.pstRenderList, &(_pstRenderNode->stNode));
+    }
+    else
+    {
+      /* Adds it before found node */
+      orxLinkList_AddBefore(&(pstNode->stNode), &(_pstRenderNode->stNode));
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Clears all the stored render nodes
+ */
+static orxINLINE void orxRender_Home_ClearRenderNodes()
+{
+  /* Cleans rendering bank */
+  orxBank_Clear(sstRender.pstRenderBank);
+
+  /* Cleans rendering lists */
+  orxMemory_Zero(sstRender.astRenderList, sizeof(sstRender.astRenderList));
+
+  /* Clears stored camera */
+  sstRender.pstRenderCamera     = orxNULL;
+  sstRender.u32RenderCameraKey  = 0;
+
+  /* Done! */
+  return;
+}
+
+/** Gets the texture of a static object that can be baked
+ * @param[in]   _pstObject        Concerned object
+ * @return      orxTEXTURE / orxNULL if the object can't be baked
+ */
+static orxINLINE orxTEXTURE *orxRender_Home_GetStaticTexture(const orxOBJECT *_pstObject)
+{
+  orxTEXTURE *pstResult = orxNULL;
+
+  /* Is static & enabled, without animation, shader nor particle system? */
+  if((orxObject_IsStatic(_pstObject) != orxFALSE)
+  && (orxObject_IsEnabled(_pstObject) != orxFALSE)
+  && (orxOBJECT_GET_STRUCTURE(_pstObject, ANIMPOINTER) == orxNULL)
+  && (orxOBJECT_GET_STRUCTURE(_pstObject, SHADERPOINTER) == orxNULL)
+  && (orxOBJECT_GET_STRUCTURE(_pstObject, PARTICLESYSTEM) == orxNULL))
+  {
+    orxGRAPHIC *pstGraphic;
+    orxFRAME   *pstFrame;
+    orxBODY    *pstBody;
+
+    /* Gets its graphic, frame & body */
+    pstGraphic  = orxOBJECT_GET_STRUCTURE(_pstObject, GRAPHIC);
+    pstFrame    = orxOBJECT_GET_STRUCTURE(_pstObject, FRAME);
+    pstBody     = orxOBJECT_GET_STRUCTURE(_pstObject, BODY);
+
+    /* Valid 2D graphic, non-scrolling frame and no dynamic body? */
+    if((pstGraphic != orxNULL)
+    && (pstFrame != orxNULL)
+    && (orxStructure_TestFlags(pstGraphic, orxGRAPHIC_KU32_FLAG_2D) != orxFALSE)
+    && (orxStructure_TestFlags(pstFrame, orxFRAME_KU32_MASK_SCROLL_BOTH | orxFRAME_KU32_FLAG_DEPTH_SCALE) == orxFALSE)
+    && ((pstBody == orxNULL)
+     || (orxBody_GetDefFlags(pstBody, orxBODY_DEF_KU32_FLAG_DYNAMIC) == orxBODY_DEF_KU32_FLAG_NONE)))
+    {
+      orxFLOAT fRepeatX, fRepeatY;
+
+      /* Gets its repeat values */
+      orxObject_GetRepeat(_pstObject, &fRepeatX, &fRepeatY);
+
+      /* Not repeated? */
+      if((fRepeatX == orxFLOAT_1) && (fRepeatY == orxFLOAT_1))
+      {
+        /* Updates result */
+        pstResult = orxTEXTURE(orxGraphic_GetData(pstGraphic));
+      }
+    }
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Gets a static group
+ * @param[in]   _u32GroupID       Concerned group ID
+ * @param[in]   _bCreate          Creates it if not found
+ * @return      orxRENDER_STATIC_GROUP / orxNULL
+ */
+static orxRENDER_STATIC_GROUP *orxFASTCALL orxRender_Home_GetStaticGroup(orxU32 _u32GroupID, orxBOOL _bCreate)
+{
+  orxRENDER_STATIC_GROUP *pstResult;
+
+  /* Gets it */
+  pstResult = (orxRENDER_STATIC_GROUP *)orxHashTable_Get(sstRender.pstStaticGroupTable, _u32GroupID);
+
+  /* Not found and should create it? */
+  if((pstResult == orxNULL) && (_bCreate != orxFALSE))
+  {
+    /* Allocates it */
+    pstResult = (orxRENDER_STATIC_GROUP *)orxBank_Allocate(sstRender.pstStaticGroupBank);
+
+    /* Success? */
+    if(pstResult != orxNULL)
+    {
+      /* Inits it */
+      orxMemory_Zero(pstResult, sizeof(orxRENDER_STATIC_GROUP));
+      pstResult->u32GroupID = _u32GroupID;
+      pstResult->u32Flags   = orxRENDER_KU32_STATIC_GROUP_FLAG_DIRTY;
+
+      /* Stores it */
+      orxHashTable_Add(sstRender.pstStaticGroupTable, _u32GroupID, pstResult);
+    }
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Clears a static group
+ * @param[in]   _pstGroup         Concerned static group
+ */
+static void orxFASTCALL orxRender_Home_ClearStaticGroup(orxRENDER_STATIC_GROUP *_pstGroup)
+{
+  orxRENDER_STATIC_CHUNK *pstChunk;
+
+  /* For all its chunks */
+  while((pstChunk = (orxRENDER_STATIC_CHUNK *)orxLinkList_GetFirst(&(_pstGroup->stChunkList))) != orxNULL)
+  {
+    /* Removes it */
+    orxLinkList_Remove(&(pstChunk->stNode));
+
+    /* Frees its vertices */
+    orxMemory_Free(pstChunk->astVertexList);
+
+    /* Deletes it */
+    orxBank_Free(sstRender.pstStaticChunkBank, pstChunk);
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Bakes a static object into its group
+ * @param[in]   _pstGroup         Concerned static group
+ * @param[in]   _pstObject        Object to bake
+ * @param[in]   _pstTexture       Object's texture
+ */
+static void orxFASTCALL orxRender_Home_BakeStaticObject(orxRENDER_STATIC_GROUP *_pstGroup, const orxOBJECT *_pstObject, orxTEXTURE *_pstTexture)
+{
+  orxRENDER_STATIC_CHUNK *pstChunk;
+  orxGRAPHIC             *pstGraphic;
+  orxFRAME               *pstFrame;
+  orxDISPLAY_BLEND_MODE   eBlendMode;
+  orxDISPLAY_SMOOTHING    eSmoothing;
+  orxVECTOR               vPosition, vScale, vPivot, vOrigin, vSize;
+  orxFLOAT                fRotation;
+  orxS32                  s32CellX, s32CellY;
+
+  /* Gets its graphic & frame */
+  pstGraphic  = orxOBJECT_GET_STRUCTURE(_pstObject, GRAPHIC);
+  pstFrame    = orxOBJECT_GET_STRUCTURE(_pstObject, FRAME);
+
+  /* Gets its world transform */
+  orxFrame_GetPosition(pstFrame, orxFRAME_SPACE_GLOBAL, &vPosition);
+  orxFrame_GetScale(pstFrame, orxFRAME_SPACE_GLOBAL, &vScale);
+  fRotation = orxFrame_GetRotation(pstFrame, orxFRAME_SPACE_GLOBAL);
+
+  /* Gets graphic smoothing */
+  eSmoothing = orxGraphic_GetSmoothing(pstGraphic);
+
+  /* Default? */
+  if(eSmoothing == orxDISPLAY_SMOOTHING_DEFAULT)
+  {
+    /* Gets object smoothing */
+    eSmoothing = orxObject_GetSmoothing(_pstObject);
+  }
+
+  /* Gets object blend mode */
+  eBlendMode = orxObject_GetBlendMode(_pstObject);
+
+  /* Gets its cell */
+  s32CellX = orxF2S(orxMath_Floor(vPosition.fX / sstRender.fStaticChunkSize));
+  s32CellY = orxF2S(orxMath_Floor(vPosition.fY / sstRender.fStaticChunkSize));
+
+  /* Finds matching chunk */
+  for(pstChunk = (orxRENDER_STATIC_CHUNK *)orxLinkList_GetFirst(&(_pstGroup->stChunkList));
+      (pstChunk != orxNULL)
+   && ((pstChunk->s32CellX != s32CellX)
+    || (pstChunk->s32CellY != s32CellY)
+    || (pstChunk->fZ != vPosition.fZ)
+    || (pstChunk->pstTexture != _pstTexture)
+    || (pstChunk->eBlendMode != eBlendMode)
+    || (pstChunk->eSmoothing != eSmoothing));
+      pstChunk = (orxRENDER_STATIC_CHUNK *)orxLinkList_GetNext(&(pstChunk->stNode)));
+
+  /* Not found? */
+  if(pstChunk == orxNULL)
+  {
+    /* Allocates it */
+    pstChunk = (orxRENDER_STATIC_CHUNK *)orxBank_Allocate(sstRender.pstStaticChunkBank);
+    orxASSERT(pstChunk != orxNULL);
+
+    /* Inits it */
+    orxMemory_Zero(pstChunk, sizeof(orxRENDER_STATIC_CHUNK));
+    pstChunk->pstTexture  = _pstTexture;
+    pstChunk->fZ          = vPosition.fZ;
+    pstChunk->eBlendMode  = eBlendMode;
+    pstChunk->eSmoothing  = eSmoothing;
+    pstChunk->s32CellX    = s32CellX;
+    pstChunk->s32CellY    = s32CellY;
+    orxVector_Set(&(pstChunk->stBox.vTL), orxFLOAT_MAX, orxFLOAT_MAX, vPosition.fZ);
+    orxVector_Set(&(pstChunk->stBox.vBR), -orxFLOAT_MAX, -orxFLOAT_MAX, vPosition.fZ);
+
+    /* Adds it to the group */
+    orxLinkList_AddEnd(&(_pstGroup->stChunkList), &(pstChunk->stNode));
+  }
+
+  /* Full? */
+  if(pstChunk->u32QuadCount == pstChunk->u32QuadSize)
+  {
+    /* Updates its size */
+    pstChunk->u32QuadSize = (pstChunk->u32QuadSize == 0) ? orxRENDER_KU32_STATIC_CHUNK_QUAD_SIZE : pstChunk->u32QuadSize << 1;
+
+    /* Allocates its vertices */
+    pstChunk->astVertexList = (orxDISPLAY_VERTEX *)((pstChunk->astVertexList == orxNULL)
+                                                    ? orxMemory_Allocate(4 * pstChunk->u32QuadSize * sizeof(orxDISPLAY_VERTEX), orxMEMORY_TYPE_VIDEO)
+                                                    : orxMemory_Reallocate(pstChunk->astVertexList, 4 * pstChunk->u32QuadSize * sizeof(orxDISPLAY_VERTEX)));
+    orxASSERT(pstChunk->astVertexList != orxNULL);
+  }
+
+  /* Gets graphic's pivot, origin & size */
+  orxGraphic_GetPivot(pstGraphic, &vPivot);
+  orxGraphic_GetOrigin(pstGraphic, &vOrigin);
+  orxGraphic_GetSize(pstGraphic, &vSize);
+
+  /* Valid scale? */
+  if((vScale.fX != orxFLOAT_0) && (vScale.fY != orxFLOAT_0))
+  {
+    orxDISPLAY_VERTEX  *astVertexList;
+    orxBOOL             bGraphicFlipX, bGraphicFlipY, bObjectFlipX, bObjectFlipY;
+    orxCOLOR            stColor;
+    orxRGBA             stRGBA;
+    orxFLOAT            fCos, fSin, fLeft, fTop, fRight, fBottom;
+    orxU32              i;
+
+    /* Gets object & graphic flipping */
+    orxObject_GetFlip(_pstObject, &bObjectFlipX, &bObjectFlipY);
+    orxGraphic_GetFlip(pstGraphic, &bGraphicFlipX, &bGraphicFlipY);
+
+    /* Updates scale using combined flipping */
+    if(bObjectFlipX ^ bGraphicFlipX)
+    {
+      vScale.fX = -vScale.fX;
+    }
+    if(bObjectFlipY ^ bGraphicFlipY)
+    {
+      vScale.fY = -vScale.fY;
+    }
+
+    /* Gets its color */
+    stRGBA = (orxObject_HasColor(_pstObject) != orxFALSE) ? orxColor_ToRGBA(orxObject_GetColor(_pstObject, &stColor)) : orx2RGBA(0xFF, 0xFF, 0xFF, 0xFF);
+
+    /* Gets cos/sin */
+    if(fRotation != orxFLOAT_0)
+    {
+      fCos = orxMath_Cos(fRotation);
+      fSin = orxMath_Sin(fRotation);
+    }
+    else
+    {
+      fCos = orxFLOAT_1;
+      fSin = orxFLOAT_0;
+    }
+
+    /* Gets local corners */
+    fLeft   = -vScale.fX * vPivot.fX;
+    fTop    = -vScale.fY * vPivot.fY;
+    fRight  = vScale.fX * (vSize.fX - vPivot.fX);
+    fBottom = vScale.fY * (vSize.fY - vPivot.fY);
+
+    /* Gets its vertices */
+    astVertexList = &(pstChunk->astVertexList[pstChunk->u32QuadCount << 2]);
+
+    /* Stores local positions (BL, TL, BR, TR) */
+    astVertexList[0].fX = fLeft;
+    astVertexList[0].fY = fBottom;
+    astVertexList[1].fX = fLeft;
+    astVertexList[1].fY = fTop;
+    astVertexList[2].fX = fRight;
+    astVertexList[2].fY = fBottom;
+    astVertexList[3].fX = fRight;
+    astVertexList[3].fY = fTop;
+
+    /* Stores texel coordinates */
+    astVertexList[0].fU = astVertexList[1].fU = vOrigin.fX + orxRENDER_KF_STATIC_BORDER_FIX;
+    astVertexList[2].fU = astVertexList[3].fU = vOrigin.fX + vSize.fX - orxRENDER_KF_STATIC_BORDER_FIX;
+    astVertexList[1].fV = astVertexList[3].fV = vOrigin.fY + orxRENDER_KF_STATIC_BORDER_FIX;
+    astVertexList[0].fV = astVertexList[2].fV = vOrigin.fY + vSize.fY - orxRENDER_KF_STATIC_BORDER_FIX;
+
+    /* For all vertices */
+    for(i = 0; i < 4; i++)
+    {
+      orxFLOAT fX, fY;
+
+      /* Gets its world position */
+      fX = vPosition.fX + (fCos * astVertexList[i].fX) - (fSin * astVertexList[i].fY);
+      fY = vPosition.fY + (fSin * astVertexList[i].fX) + (fCos * astVertexList[i].fY);
+
+      /* Stores it */
+      astVertexList[i].fX     = fX;
+      astVertexList[i].fY     = fY;
+      astVertexList[i].stRGBA = stRGBA;
+
+      /* Updates chunk's box */
+      pstChunk->stBox.vTL.fX  = orxMIN(pstChunk->stBox.vTL.fX, fX);
+      pstChunk->stBox.vTL.fY  = orxMIN(pstChunk->stBox.vTL.fY, fY);
+      pstChunk->stBox.vBR.fX  = orxMAX(pstChunk->stBox.vBR.fX, fX);
+      pstChunk->stBox.vBR.fY  = orxMAX(pstChunk->stBox.vBR.fY, fY);
+    }
+
+    /* Updates quad count */
+    pstChunk->u32QuadCount++;
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Updates a static group
+ * @param[in]   _pstGroup         Concerned static group
+ */
+static void orxFASTCALL orxRender_Home_UpdateStaticGroup(orxRENDER_STATIC_GROUP *_pstGroup)
+{
+  orxRENDER_STATIC_CHUNK *pstChunk;
+  orxOBJECT              *pstObject;
+
+  /* Profiles */
+  orxPROFILER_PUSH_MARKER("orxRender_UpdateStaticGroup");
+
+  /* Clears it */
+  orxRender_Home_ClearStaticGroup(_pstGroup);
+
+  /* For all objects in this group */
+  for(pstObject = orxObject_GetNext(orxNULL, _pstGroup->u32GroupID);
+      pstObject != orxNULL;
+      pstObject = orxObject_GetNext(pstObject, _pstGroup->u32GroupID))
+  {
+    orxTEXTURE *pstTexture;
+
+    /* Whole group is static and object isn't tagged yet? */
+    if((orxFLAG_TEST(_pstGroup->u32Flags, orxRENDER_KU32_STATIC_GROUP_FLAG_ALL))
+    && (orxObject_IsStatic(pstObject) == orxFALSE))
+    {
+      /* Tags object as static */
+      orxObject_SetStatic(pstObject, orxTRUE);
+    }
+
+    /* Can be baked? */
+    if((pstTexture = orxRender_Home_GetStaticTexture(pstObject)) != orxNULL)
+    {
+      /* Bakes it */
+      orxRender_Home_BakeStaticObject(_pstGroup, pstObject, pstTexture);
+
+      /* Keeps it out of the regular render path */
+      orxObject_SetBaked(pstObject, orxTRUE);
+    }
+    else
+    {
+      /* Renders it with the regular path */
+      orxObject_SetBaked(pstObject, orxFALSE);
+    }
+  }
+
+  /* For all chunks */
+  for(pstChunk = (orxRENDER_STATIC_CHUNK *)orxLinkList_GetFirst(&(_pstGroup->stChunkList));
+      pstChunk != orxNULL;
+      pstChunk = (orxRENDER_STATIC_CHUNK *)orxLinkList_GetNext(&(pstChunk->stNode)))
+  {
+    orxVECTOR vSize;
+
+    /* Gets its center & bounding radius */
+    orxAABox_GetCenter(&(pstChunk->stBox), &(pstChunk->vCenter));
+    orxVector_Sub(&vSize, &(pstChunk->stBox.vBR), &(pstChunk->stBox.vTL));
+    pstChunk->fBoundingRadius = orx2F(0.5f) * orxMath_Sqrt((vSize.fX * vSize.fX) + (vSize.fY * vSize.fY));
+  }
+
+  /* Updates flags (set last as tagging objects above will dirty the group) */
+  orxFLAG_SET(_pstGroup->u32Flags, orxRENDER_KU32_STATIC_GROUP_FLAG_NONE, orxRENDER_KU32_STATIC_GROUP_FLAG_DIRTY);
+
+  /* Profiles */
+  orxPROFILER_POP_MARKER();
+
+  /* Done! */
+  return;
+}
+
+/** Gets the shared vertex list, growing it if needed
+ * @param[in]   _u32VertexNumber  Number of needed vertices
+ * @return      orxDISPLAY_VERTEX list
+ */
+static orxINLINE orxDISPLAY_VERTEX *orxRender_Home_GetVertexList(orxU32 _u32VertexNumber)
+{
+  /* Not enough room? */
+  if(_u32VertexNumber > sstRender.u32VertexListSize)
+  {
+    /* Allocates vertex list */
+    sstRender.astVertexList = (orxDISPLAY_VERTEX *)((sstRender.astVertexList == orxNULL)
+                                                    ? orxMemory_Allocate(_u32VertexNumber * sizeof(orxDISPLAY_VERTEX), orxMEMORY_TYPE_VIDEO)
+                                                    : orxMemory_Reallocate(sstRender.astVertexList, _u32VertexNumber * sizeof(orxDISPLAY_VERTEX)));
+    orxASSERT(sstRender.astVertexList != orxNULL);
+
+    /* Updates its size */
+    sstRender.u32VertexListSize = _u32VertexNumber;
+  }
+
+  /* Done! */
+  return sstRender.astVertexList;
+}
+
+/** Renders a static chunk
+ * @param[in]   _pstChunk         Chunk to render
+ * @param[in]   _pvCameraCenter   Camera center (world space)
+ * @param[in]   _fScaleX          Render scale on X axis
+ * @param[in]   _fScaleY          Render scale on Y axis
+ * @param[in]   _fRotation        Render rotation
+ * @param[in]   _pvScreenCenter   Screen center (viewport space)
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxSTATUS orxFASTCALL orxRender_Home_RenderStaticChunk(const orxRENDER_STATIC_CHUNK *_pstChunk, const orxVECTOR *_pvCameraCenter, orxFLOAT _fScaleX, orxFLOAT _fScaleY, orxFLOAT _fRotation, const orxVECTOR *_pvScreenCenter)
+{
+  orxBITMAP  *pstBitmap;
+  orxSTATUS   eResult = orxSTATUS_FAILURE;
+
+  /* Profiles */
+  orxPROFILER_PUSH_MARKER("orxRender_RenderStaticChunk");
+
+  /* Gets its bitmap */
+  pstBitmap = orxTexture_GetBitmap(_pstChunk->pstTexture);
+
+  /* Valid? */
+  if(pstBitmap != orxNULL)
+  {
+    orxDISPLAY_VERTEX  *astVertexList;
+    orxFLOAT            fCos, fSin;
+    orxU32              i, u32VertexNumber;
+
+    /* Gets vertex number */
+    u32VertexNumber = _pstChunk->u32QuadCount << 2;
+
+    /* Gets vertex list */
+    astVertexList = orxRender_Home_GetVertexList(u32VertexNumber);
+
+    /* Gets cos/sin */
+    if(_fRotation != orxFLOAT_0)
+    {
+      fCos = orxMath_Cos(-_fRotation);
+      fSin = orxMath_Sin(-_fRotation);
+    }
+    else
+    {
+      fCos = orxFLOAT_1;
+      fSin = orxFLOAT_0;
+    }
+
+    /* For all vertices */
+    for(i = 0; i < u32VertexNumber; i++)
+    {
+      const orxDISPLAY_VERTEX  *pstSrc;
+      orxDISPLAY_VERTEX        *pstDst;
+      orxFLOAT                  fX, fY;
+
+      /* Gets source & destination */
+      pstSrc = &(_pstChunk->astVertexList[i]);
+      pstDst = &(astVertexList[i]);
+
+      /* Gets position in camera space */
+      fX = (pstSrc->fX - _pvCameraCenter->fX) * _fScaleX;
+      fY = (pstSrc->fY - _pvCameraCenter->fY) * _fScaleY;
+
+      /* Stores position in screen space */
+      pstDst->fX      = (fCos * fX) - (fSin * fY) + _pvScreenCenter->fX;
+      pstDst->fY      = (fSin * fX) + (fCos * fY) + _pvScreenCenter->fY;
+      pstDst->fU      = pstSrc->fU;
+      pstDst->fV      = pstSrc->fV;
+      pstDst->stRGBA  = pstSrc->stRGBA;
+    }
+
+    /* Draws all quads at once */
+    eResult = orxDisplay_DrawQuads(pstBitmap, _pstChunk->eSmoothing, _pstChunk->eBlendMode, _pstChunk->u32QuadCount, astVertexList);
+  }
+
+  /* Profiles */
+  orxPROFILER_POP_MARKER();
+
+  /* Done! */
+  return eResult;
+}
+
+/** Renders all the live particles of a particle system
+ * @param[in]   _pstParticleSystem  Particle system to render
+ * @param[in]   _eSmoothing       Smoothing
+ * @param[in]   _eBlendMode       Blend mode
+ * @param[in]   _pvCameraCenter   Camera center (world space)
+ * @param[in]   _fScaleX          Render scale on X axis
+ * @param[in]   _fScaleY          Render scale on Y axis
+ * @param[in]   _fRotation        Render rotation
+ * @param[in]   _pvScreenCenter   Screen center (viewport space)
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxSTATUS orxFASTCALL orxRender_Home_RenderParticleSystem(const orxPARTICLESYSTEM *_pstParticleSystem, orxDISPLAY_SMOOTHING _eSmoothing, orxDISPLAY_BLEND_MODE _eBlendMode, const orxVECTOR *_pvCameraCenter, orxFLOAT _fScaleX, orxFLOAT _fScaleY, orxFLOAT _fRotation, const orxVECTOR *_pvScreenCenter)
+{
+  orxGRAPHIC *pstGraphic;
+  orxBITMAP  *pstBitmap;
+  orxSTATUS   eResult = orxSTATUS_FAILURE;
+
+  /* Profiles */
+  orxPROFILER_PUSH_MARKER("orxRender_RenderParticleSystem");
+
+  /* Gets its graphic & bitmap */
+  pstGraphic  = orxParticleSystem_GetGraphic(_pstParticleSystem);
+  pstBitmap   = orxTexture_GetBitmap(orxTEXTURE(orxGraphic_GetData(pstGraphic)));
+
+  /* Valid? */
+  if(pstBitmap != orxNULL)
+  {
+    orxPARTICLE_LIST    stParticleList;
+    orxDISPLAY_VERTEX  *astVertexList;
+    orxVECTOR           vOrigin, vSize, vPivot;
+    orxFLOAT            fCos, fSin, fLeft, fTop, fRight, fBottom, fU0, fV0, fU1, fV1;
+    orxU32              i, u32QuadCount;
+
+    /* Gets particles */
+    orxParticleSystem_GetParticleList(_pstParticleSystem, &stParticleList);
+
+    /* Gets graphic's texture area & pivot */
+    orxGraphic_GetOrigin(pstGraphic, &vOrigin);
+    orxGraphic_GetSize(pstGraphic, &vSize);
+    orxGraphic_GetPivot(pstGraphic, &vPivot);
+
+    /* Gets local corners */
+    fLeft   = -vPivot.fX;
+    fTop    = -vPivot.fY;
+    fRight  = vSize.fX - vPivot.fX;
+    fBottom = vSize.fY - vPivot.fY;
+
+    /* Gets texel coordinates */
+    fU0 = vOrigin.fX + orxRENDER_KF_STATIC_BORDER_FIX;
+    fV0 = vOrigin.fY + orxRENDER_KF_STATIC_BORDER_FIX;
+    fU1 = vOrigin.fX + vSize.fX - orxRENDER_KF_STATIC_BORDER_FIX;
+    fV1 = vOrigin.fY + vSize.fY - orxRENDER_KF_STATIC_BORDER_FIX;
+
+    /* Gets camera cos/sin */
+    if(_fRotation != orxFLOAT_0)
+    {
+      fCos = orxMath_Cos(-_fRotation);
+      fSin = orxMath_Sin(-_fRotation);
+    }
+    else
+    {
+      fCos = orxFLOAT_1;
+      fSin = orxFLOAT_0;
+    }
+
+    /* Gets vertex list */
+    astVertexList = orxRender_Home_GetVertexList(orxRENDER_KU32_QUAD_BATCH_SIZE << 2);
+
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+
+    /* For all particles */
+    for(i = 0, u32QuadCount = 0; i < stParticleList.u32Count; i++)
+    {
+      orxDISPLAY_VERTEX  *astQuad;
+      orxFLOAT            fParticleCos, fParticleSin, fScale, fX, fY;
+      orxU32              j;
+
+      /* Gets its quad */
+      astQuad = &(astVertexList[u32QuadCount << 2]);
+
+      /* Gets its transform */
+      fScale        = stParticleList.afScale[i];
+      fParticleCos  = fScale * orxMath_Cos(stParticleList.afRotation[i]);
+      fParticleSin  = fScale * orxMath_Sin(stParticleList.afRotation[i]);
+
+      /* Stores local positions (BL, TL, BR, TR) */
+      astQuad[0].fX = fLeft;
+      astQuad[0].fY = fBottom;
+      astQuad[1].fX = fLeft;
+      astQuad[1].fY = fTop;
+      astQuad[2].fX = fRight;
+      astQuad[2].fY = fBottom;
+      astQuad[3].fX = fRight;
+      astQuad[3].fY = fTop;
+
+      /* Stores texel coordinates */
+      astQuad[0].fU = astQuad[1].fU = fU0;
+      astQuad[2].fU = astQuad[3].fU = fU1;
+      astQuad[1].fV = astQuad[3].fV = fV0;
+      astQuad[0].fV = astQuad[2].fV = fV1;
+
+      /* For all its vertices */
+      for(j = 0; j < 4; j++)
+      {
+        /* Gets its position in camera space */
+        fX = (stParticleList.afX[i] + (fParticleCos * astQuad[j].fX) - (fParticleSin * astQuad[j].fY) - _pvCameraCenter->fX) * _fScaleX;
+        fY = (stParticleList.afY[i] + (fParticleSin * astQuad[j].fX) + (fParticleCos * astQuad[j].fY) - _pvCameraCenter->fY) * _fScaleY;
+
+        /* Stores it in screen space */
+        astQuad[j].fX     = (fCos * fX) - (fSin * fY) + _pvScreenCenter->fX;
+        astQuad[j].fY     = (fSin * fX) + (fCos * fY) + _pvScreenCenter->fY;
+        astQuad[j].stRGBA = stParticleList.astRGBA[i];
+      }
+
+      /* Batch full? */
+      if(++u32QuadCount == orxRENDER_KU32_QUAD_BATCH_SIZE)
+      {
+        /* Draws it */
+        if(orxDisplay_DrawQuads(pstBitmap, _eSmoothing, _eBlendMode, u32QuadCount, astVertexList) == orxSTATUS_FAILURE)
+        {
+          /* Updates result */
+          eResult = orxSTATUS_FAILURE;
+        }
+
+        /* Resets quad count */
+        u32QuadCount = 0;
+      }
+    }
+
+    /* Has remaining quads? */
+    if(u32QuadCount != 0)
+    {
+      /* Draws them */
+      if(orxDisplay_DrawQuads(pstBitmap, _eSmoothing, _eBlendMode, u32QuadCount, astVertexList) == orxSTATUS_FAILURE)
+      {
+        /* Updates result */
+        eResult = orxSTATUS_FAILURE;
+      }
+    }
+  }
+
+  /* Profiles */
+  orxPROFILER_POP_MARKER();
+
+  /* Done! */
+  return eResult;
+}
+
+/** Renders the visible tiles of a tile map
+ * @param[in]   _pstTileMap       Tile map to render
+ * @param[in]   _pstBitmap        Tileset bitmap
+ * @param[in]   _pstTransform     Object's transform (screen space)
+ * @param[in]   _stRGBA           Object's color
+ * @param[in]   _eSmoothing       Smoothing
+ * @param[in]   _eBlendMode       Blend mode
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxSTATUS orxFASTCALL orxRender_Home_RenderTileMap(const orxTILEMAP *_pstTileMap, const orxBITMAP *_pstBitmap, const orxDISPLAY_TRANSFORM *_pstTransform, orxRGBA _stRGBA, orxDISPLAY_SMOOTHING _eSmoothing, orxDISPLAY_BLEND_MODE _eBlendMode)
+{
+  const orxU16       *au16TileList;
+  orxDISPLAY_VERTEX  *astVertexList;
+  orxVECTOR           vTileSize, vCorner, vLocalTL, vLocalBR, vAxisX, vAxisY, vOrigin;
+  orxFLOAT            fCos, fSin;
+  orxU32              u32Width, u32Height, u32MinX, u32MinY, u32MaxX, u32MaxY, u32QuadCount, u32X, u32Y, i;
+  orxSTATUS           eResult = orxSTATUS_SUCCESS;
+
+  /* Profiles */
+  orxPROFILER_PUSH_MARKER("orxRender_RenderTileMap");
+
+  /* Gets map & tile sizes */
+  orxTileMap_GetMapSize(_pstTileMap, &u32Width, &u32Height);
+  orxTileMap_GetTileSize(_pstTileMap, &vTileSize);
+
+  /* Gets cos/sin */
+  if(_pstTransform->fRotation != orxFLOAT_0)
+  {
+    fCos = orxMath_Cos(_pstTransform->fRotation);
+    fSin = orxMath_Sin(_pstTransform->fRotation);
+  }
+  else
+  {
+    fCos = orxFLOAT_1;
+    fSin = orxFLOAT_0;
+  }
+
+  /* For all clipping box corners */
+  orxVector_Set(&vLocalTL, orxFLOAT_MAX, orxFLOAT_MAX, orxFLOAT_0);
+  orxVector_Set(&vLocalBR, -orxFLOAT_MAX, -orxFLOAT_MAX, orxFLOAT_0);
+  for(i = 0; i < 4; i++)
+  {
+    orxFLOAT fX, fY;
+
+    /* Gets corner relative to object */
+    fX = ((i & 1) ? sstRender.stClipBox.vBR.fX : sstRender.stClipBox.vTL.fX) - _pstTransform->fDstX;
+    fY = ((i & 2) ? sstRender.stClipBox.vBR.fY : sstRender.stClipBox.vTL.fY) - _pstTransform->fDstY;
+
+    /* Gets it in tile map space */
+    vCorner.fX = ((fCos * fX) + (fSin * fY)) / _pstTransform->fScaleX + _pstTransform->fSrcX;
+    vCorner.fY = ((fCos * fY) - (fSin * fX)) / _pstTransform->fScaleY + _pstTransform->fSrcY;
+
+    /* Updates local box */
+    vLocalTL.fX = orxMIN(vLocalTL.fX, vCorner.fX);
+    vLocalTL.fY = orxMIN(vLocalTL.fY, vCorner.fY);
+    vLocalBR.fX = orxMAX(vLocalBR.fX, vCorner.fX);
+    vLocalBR.fY = orxMAX(vLocalBR.fY, vCorner.fY);
+  }
+
+  /* Gets visible tile range */
+  u32MinX = (vLocalTL.fX > orxFLOAT_0) ? orxMIN(orxF2U(orxMath_Floor(vLocalTL.fX / vTileSize.fX)), u32Width) : 0;
+  u32MinY = (vLocalTL.fY > orxFLOAT_0) ? orxMIN(orxF2U(orxMath_Floor(vLocalTL.fY / vTileSize.fY)), u32Height) : 0;
+  u32MaxX = (vLocalBR.fX > orxFLOAT_0) ? orxMIN(orxF2U(orxMath_Ceil(vLocalBR.fX / vTileSize.fX)), u32Width) : 0;
+  u32MaxY = (vLocalBR.fY > orxFLOAT_0) ? orxMIN(orxF2U(orxMath_Ceil(vLocalBR.fY / vTileSize.fY)), u32Height) : 0;
+
+  /* Gets screen axes for one tile step */
+  orxVector_Set(&vAxisX, fCos * _pstTransform->fScaleX * vTileSize.fX, fSin * _pstTransform->fScaleX * vTileSize.fX, orxFLOAT_0);
+  orxVector_Set(&vAxisY, -fSin * _pstTransform->fScaleY * vTileSize.fY, fCos * _pstTransform->fScaleY * vTileSize.fY, orxFLOAT_0);
+
+  /* Gets tile map's origin in screen space */
+  vOrigin.fX = _pstTransform->fDstX - (fCos * _pstTransform->fScaleX * _pstTransform->fSrcX) + (fSin * _pstTransform->fScaleY * _pstTransform->fSrcY);
+  vOrigin.fY = _pstTransform->fDstY - (fSin * _pstTransform->fScaleX * _pstTransform->fSrcX) - (fCos * _pstTransform->fScaleY * _pstTransform->fSrcY);
+
+  /* Gets tile list & vertex list */
+  au16TileList  = orxTileMap_GetTileList(_pstTileMap);
+  astVertexList = orxRender_Home_GetVertexList(orxRENDER_KU32_QUAD_BATCH_SIZE << 2);
+
+  /* For all visible rows */
+  for(u32Y = u32MinY, u32QuadCount = 0; u32Y < u32MaxY; u32Y++)
+  {
+    /* For all visible columns */
+    for(u32X = u32MinX; u32X < u32MaxX; u32X++)
+    {
+      orxVECTOR vUV;
+
+      /* Non empty tile? */
+      if(orxTileMap_GetTileOrigin(_pstTileMap, (orxU32)au16TileList[u32Y * u32Width + u32X], &vUV) != orxNULL)
+      {
+        orxDISPLAY_VERTEX *astQuad;
+        orxFLOAT           fX, fY;
+
+        /* Gets its quad */
+        astQuad = &(astVertexList[u32QuadCount << 2]);
+
+        /* Gets its top left corner */
+        fX = vOrigin.fX + (orxU2F(u32X) * vAxisX.fX) + (orxU2F(u32Y) * vAxisY.fX);
+        fY = vOrigin.fY + (orxU2F(u32X) * vAxisX.fY) + (orxU2F(u32Y) * vAxisY.fY);
+
+        /* Stores positions (BL, TL, BR, TR) */
+        astQuad[0].fX = fX + vAxisY.fX;
+        astQuad[0].fY = fY + vAxisY.fY;
+        astQuad[1].fX = fX;
+        astQuad[1].fY = fY;
+        astQuad[2].fX = fX + vAxisX.fX + vAxisY.fX;
+        astQuad[2].fY = fY + vAxisX.fY + vAxisY.fY;
+        astQuad[3].fX = fX + vAxisX.fX;
+        astQuad[3].fY = fY + vAxisX.fY;
+
+        /* Stores texel coordinates */
+        astQuad[0].fU = astQuad[1].fU = vUV.fX + orxRENDER_KF_STATIC_BORDER_FIX;
+        astQuad[2].fU = astQuad[3].fU = vUV.fX + vTileSize.fX - orxRENDER_KF_STATIC_BORDER_FIX;
+        astQuad[1].fV = astQuad[3].fV = vUV.fY + orxRENDER_KF_STATIC_BORDER_FIX;
+        astQuad[0].fV = astQuad[2].fV = vUV.fY + vTileSize.fY - orxRENDER_KF_STATIC_BORDER_FIX;
+
+        /* Stores color */
+        astQuad[0].stRGBA = astQuad[1].stRGBA = astQuad[2].stRGBA = astQuad[3].stRGBA = _stRGBA;
+
+        /* Batch full? */
+        if(++u32QuadCount == orxRENDER_KU32_QUAD_BATCH_SIZE)
+        {
+          /* Draws it */
+          if(orxDisplay_DrawQuads(_pstBitmap, _eSmoothing, _eBlendMode, u32QuadCount, astVertexList) == orxSTATUS_FAILURE)
+          {
+            /* Updates result */
+            eResult = orxSTATUS_FAILURE;
+          }
+
+          /* Resets quad count */
+          u32QuadCount = 0;
+        }
+      }
+    }
+  }
+
+  /* Has remaining quads? */
+  if(u32QuadCount != 0)
+  {
+    /* Draws them */
+    if(orxDisplay_DrawQuads(_pstBitmap, _eSmoothing, _eBlendMode, u32QuadCount, astVertexList) == orxSTATUS_FAILURE)
+    {
+      /* Updates result */
+      eResult = orxSTATUS_FAILURE;
+    }
+  }
 
   /* Profiles */
   orxPROFILER_POP_MARKER();
 
   /* Done! */
-  return;
+  return eResult;
 }
 
 /** Renders a viewport
@@ -1398,10 +2346,11 @@ static orxSTATUS orxFASTCALL orxRender_Home_RenderObject(const orxOBJECT *_pstOb
 
   /* Valid? */
   if((pstGraphic != orxNULL)
-  && (orxStructure_TestFlags(pstGraphic, orxGRAPHIC_KU32_FLAG_2D | orxGRAPHIC_KU32_FLAG_TEXT)))
+  && (orxStructure_TestFlags(pstGraphic, orxGRAPHIC_KU32_FLAG_2D | orxGRAPHIC_KU32_FLAG_TEXT | orxGRAPHIC_KU32_FLAG_TILEMAP)))
   {
     orxTEXTURE             *pstTexture;
-    orxTEXT                *pstText;
+    orxTEXT                *pstText = orxNULL;
+    orxTILEMAP             *pstTileMap = orxNULL;
     orxFONT                *pstFont;
     orxBITMAP              *pstBitmap = orxNULL;
     orxBOOL                 bIs2D;
@@ -1417,6 +2366,12 @@ static orxSTATUS orxFASTCALL orxRender_Home_RenderObject(const orxOBJECT *_pstOb
       /* Profiles */
       orxPROFILER_PUSH_MARKER("RenderObject <2D>");
     }
+    /* Is tile map? */
+    else if(orxStructure_TestFlags(pstGraphic, orxGRAPHIC_KU32_FLAG_TILEMAP))
+    {
+      /* Profiles */
+      orxPROFILER_PUSH_MARKER("RenderObject <TileMap>");
+    }
     else
     {
       /* Profiles */
@@ -1452,6 +2407,26 @@ static orxSTATUS orxFASTCALL orxRender_Home_RenderObject(const orxOBJECT *_pstOb
       /* Updates its clipping (before event start for updated texture coordinates in shader) */
       orxDisplay_SetBitmapClipping(pstBitmap, orxF2U(vClipTL.fX), orxF2U(vClipTL.fY), orxF2U(vClipBR.fX), orxF2U(vClipBR.fY));
     }
+    /* Is tile map? */
+    else if(orxStructure_TestFlags(pstGraphic, orxGRAPHIC_KU32_FLAG_TILEMAP))
+    {
+      /* Gets tile map */
+      pstTileMap = orxTILEMAP(orxGraphic_GetData(pstGraphic));
+
+      /* Valid? */
+      if(pstTileMap != orxNULL)
+      {
+        /* Gets its texture */
+        pstTexture = orxTileMap_GetTexture(pstTileMap);
+
+        /* Valid? */
+        if(pstTexture != orxNULL)
+        {
+          /* Gets its bitmap */
+          pstBitmap = orxTexture_GetBitmap(pstTexture);
+        }
+      }
+    }
     else
     {
       /* Gets text */
@@ -1484,6 +2459,7 @@ static orxSTATUS orxFASTCALL orxRender_Home_RenderObject(const orxOBJECT *_pstOb
       {
         orxBOOL   bGraphicFlipX, bGraphicFlipY, bObjectFlipX, bObjectFlipY;
         orxVECTOR vPivot;
+        orxRGBA   stRGBA;
 
         /* Gets graphic's pivot */
         orxGraphic_GetPivot(pstGraphic, &vPivot);
@@ -1511,21 +2487,30 @@ static orxSTATUS orxFASTCALL orxRender_Home_RenderObject(const orxOBJECT *_pstOb
         {
           orxCOLOR stColor;
 
-          /* Updates display color */
-          orxDisplay_SetBitmapColor(pstBitmap, orxColor_ToRGBA(orxObject_GetColor(_pstObject, &stColor)));
+          /* Gets its color */
+          stRGBA = orxColor_ToRGBA(orxObject_GetColor(_pstObject, &stColor));
         }
         else
         {
-          /* Applies white color */
-          orxDisplay_SetBitmapColor(pstBitmap, orx2RGBA(0xFF, 0xFF, 0xFF, 0xFF));
+          /* Uses white color */
+          stRGBA = orx2RGBA(0xFF, 0xFF, 0xFF, 0xFF);
         }
 
+        /* Updates display color */
+        orxDisplay_SetBitmapColor(pstBitmap, stRGBA);
+
         /* Is 2D? */
         if(bIs2D != orxFALSE)
         {
           /* Transforms bitmap */
           eResult = orxDisplay_TransformBitmap(pstBitmap, stPayload.stObject.pstTransform, _eSmoothing, _eBlendMode);
         }
+        /* Is tile map? */
+        else if(pstTileMap != orxNULL)
+        {
+          /* Renders its visible tiles */
+          eResult = orxRender_Home_RenderTileMap(pstTileMap, pstBitmap, stPayload.stObject.pstTransform, stRGBA, _eSmoothing, _eBlendMode);
+        }
         else
         {
           /* Transforms text */
@@ -1560,7 +2545,7 @@ static orxSTATUS orxFASTCALL orxRender_Home_RenderObject(const orxOBJECT *_pstOb
   else
   {
     /* Logs message */
-    orxDEBUG_PRINT(orxDEBUG_LEVEL_RENDER, "Invalid graphic or non-2D/text graphic detected.");
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_RENDER, "Invalid graphic or non-2D/text/tile map graphic detected.");
   }
 
   /* Profiles */
@@ -1570,10 +2555,126 @@ static orxSTATUS orxFASTCALL orxRender_Home_RenderObject(const orxOBJECT *_pstOb
   return eResult;
 }
 
+/** Gets a key describing a camera's state (transform, frustum & groups)
+ * @param[in]   _pstCamera      Concerned camera
+ * @param[in]   _u32Key         Key to continue
+ * @return      Key
+ */
+static orxU32 orxFASTCALL orxRender_Home_GetCameraKey(const orxCAMERA *_pstCamera, orxU32 _u32Key)
+{
+  orxFRAME *pstFrame;
+  orxAABOX  stFrustum;
+  orxVECTOR vPosition, vScale;
+  orxFLOAT  fRotation;
+  orxU32    i, u32Number, u32Result;
+
+  /* Gets camera's frame */
+  pstFrame = orxCamera_GetFrame(_pstCamera);
+
+  /* Gets its frustum & world transform */
+  orxCamera_GetFrustum(_pstCamera, &stFrustum);
+  orxFrame_GetPosition(pstFrame, orxFRAME_SPACE_GLOBAL, &vPosition);
+  orxFrame_GetScale(pstFrame, orxFRAME_SPACE_GLOBAL, &vScale);
+  fRotation = orxFrame_GetRotation(pstFrame, orxFRAME_SPACE_GLOBAL);
+
+  /* Updates result */
+  u32Result = orxString_NContinueCRC((const orxSTRING)&_pstCamera, _u32Key, sizeof(orxCAMERA *));
+  u32Result = orxString_NContinueCRC((const orxSTRING)&stFrustum, u32Result, sizeof(orxAABOX));
+  u32Result = orxString_NContinueCRC((const orxSTRING)&vPosition, u32Result, sizeof(orxVECTOR));
+  u32Result = orxString_NContinueCRC((const orxSTRING)&vScale, u32Result, sizeof(orxVECTOR));
+  u32Result = orxString_NContinueCRC((const orxSTRING)&fRotation, u32Result, sizeof(orxFLOAT));
+
+  /* For all its groups */
+  for(i = 0, u32Number = orxCamera_GetGroupIDCount(_pstCamera); i < u32Number; i++)
+  {
+    orxU32 u32GroupID;
+
+    /* Gets it */
+    u32GroupID = orxCamera_GetGroupID(_pstCamera, i);
+
+    /* Updates result */
+    u32Result = orxString_NContinueCRC((const orxSTRING)&u32GroupID, u32Result, sizeof(orxU32));
+  }
+
+  /* Done! */
+  return u32Result;
+}
+
+/** Gets a key describing a viewport's rendering state (camera & size), used to validate its cache
+ * @param[in]   _pstViewport    Concerned viewport
+ * @param[in]   _pstBox         Viewport's box
+ * @return      Key
+ */
+static orxU32 orxFASTCALL orxRender_Home_GetViewportCacheKey(const orxVIEWPORT *_pstViewport, const orxAABOX *_pstBox)
+{
+  orxCAMERA  *pstCamera;
+  orxFLOAT    afSize[2];
+  orxU32      u32Result;
+
+  /* Gets viewport size */
+  afSize[0] = _pstBox->vBR.fX - _pstBox->vTL.fX;
+  afSize[1] = _pstBox->vBR.fY - _pstBox->vTL.fY;
+
+  /* Gets camera */
+  pstCamera = orxViewport_GetCamera(_pstViewport);
+
+  /* Updates result */
+  u32Result = orxString_NContinueCRC((const orxSTRING)afSize, 0, sizeof(afSize));
+
+  /* Valid? */
+  if(pstCamera != orxNULL)
+  {
+    /* Updates result */
+    u32Result = orxRender_Home_GetCameraKey(pstCamera, u32Result);
+  }
+
+  /* Done! */
+  return u32Result;
+}
+
+/** Invalidates the cache of all the viewports whose camera renders a given group
+ * @param[in]   _u32GroupID     Concerned group ID
+ */
+static void orxFASTCALL orxRender_Home_InvalidateViewportCaches(orxU32 _u32GroupID)
+{
+  orxVIEWPORT *pstViewport;
+
+  /* For all viewports */
+  for(pstViewport = orxVIEWPORT(orxStructure_GetFirst(orxSTRUCTURE_ID_VIEWPORT));
+      pstViewport != orxNULL;
+      pstViewport = orxVIEWPORT(orxStructure_GetNext(pstViewport)))
+  {
+    orxCAMERA *pstCamera;
+
+    /* Uses cache and has camera? */
+    if((orxViewport_IsCacheEnabled(pstViewport) != orxFALSE)
+    && ((pstCamera = orxViewport_GetCamera(pstViewport)) != orxNULL))
+    {
+      orxU32 i, u32Number;
+
+      /* For all camera group IDs */
+      for(i = 0, u32Number = orxCamera_GetGroupIDCount(pstCamera); i < u32Number; i++)
+      {
+        /* Found? */
+        if(orxCamera_GetGroupID(pstCamera, i) == _u32GroupID)
+        {
+          /* Invalidates cache */
+          orxViewport_InvalidateCache(pstViewport);
+
+          break;
+        }
+      }
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
 /** Renders a viewport
  * @param[in]   _pstViewport    Viewport to render
  */
-static orxINLINE void orxRender_Home_RenderViewport(const orxVIEWPORT *_pstViewport)
+static orxINLINE void orxRender_Home_RenderViewport(orxVIEWPORT *_pstViewport)
 {
   /* Profiles */
   orxPROFILER_PUSH_MARKER("orxRender_RenderViewport");
@@ -1626,9 +2727,13 @@ static orxINLINE void orxRender_Home_RenderViewport(const orxVIEWPORT *_pstViewp
       /* Sends start event */
       if(orxEvent_Send(&stEvent) != orxSTATUS_FAILURE)
       {
-        orxAABOX  stViewportBox, stTextureBox;
-        orxFLOAT  fTextureWidth, fTextureHeight;
-        orxVECTOR vViewportCenter;
+        orxAABOX    stViewportBox, stTextureBox, stCacheBox;
+        orxFLOAT    fTextureWidth, fTextureHeight, fCacheTime = orxFLOAT_0;
+        orxVECTOR   vViewportCenter;
+        orxTEXTURE *pstCacheTexture;
+        orxBITMAP  *pstCacheBitmap = orxNULL, *pstTargetBitmap = orxNULL;
+        orxU32      u32CacheKey = 0;
+        orxBOOL     bRender = orxTRUE;
 
         /* Gets texture size */
         orxTexture_GetSize(apstTextureList[0], &fTextureWidth, &fTextureHeight);
@@ -1643,11 +2748,46 @@ static orxINLINE void orxRender_Home_RenderViewport(const orxVIEWPORT *_pstViewp
         /* Gets its center */
         orxAABox_GetCenter(&stViewportBox, &vViewportCenter);
 
+        /* Uses a single target texture and a valid cache? */
+        if((u32TextureCount == 1)
+        && (orxViewport_IsCacheEnabled(_pstViewport) != orxFALSE)
+        && ((pstCacheTexture = orxViewport_GetCacheTexture(_pstViewport)) != orxNULL)
+        && ((pstCacheBitmap = orxTexture_GetBitmap(pstCacheTexture)) != orxNULL))
+        {
+          /* Gets cache key & time */
+          u32CacheKey = orxRender_Home_GetViewportCacheKey(_pstViewport, &stViewportBox);
+          fCacheTime  = orxClock_GetInfo(sstRender.pstClock)->fTime;
+
+          /* Stores target bitmap & viewport box */
+          pstTargetBitmap = apstBitmapList[0];
+          orxAABox_Copy(&stCacheBox, &stViewportBox);
+
+          /* Is cache still valid? */
+          if(orxViewport_IsCacheValid(_pstViewport, u32CacheKey, fCacheTime) != orxFALSE)
+          {
+            /* Skips rendering */
+            bRender = orxFALSE;
+          }
+          else
+          {
+            /* Renders into cache bitmap instead, viewport covering it entirely */
+            apstBitmapList[0] = pstCacheBitmap;
+            orxVector_SetAll(&(stViewportBox.vTL), orxFLOAT_0);
+            orxVector_Set(&(stViewportBox.vBR), stCacheBox.vBR.fX - stCacheBox.vTL.fX, stCacheBox.vBR.fY - stCacheBox.vTL.fY, orxFLOAT_0);
+            orxAABox_Copy(&stTextureBox, &stViewportBox);
+            orxAABox_GetCenter(&stViewportBox, &vViewportCenter);
+
+            /* Clears it */
+            orxDisplay_ClearBitmap(pstCacheBitmap, orx2RGBA(0x00, 0x00, 0x00, 0x00));
+          }
+        }
+
         /* Sets destination bitmap */
         orxDisplay_SetDestinationBitmaps(apstBitmapList, u32TextureCount);
 
-        /* Does it intersect with texture? */
-        if(orxAABox_Test2DIntersection(&stTextureBox, &stViewportBox) != orxFALSE)
+        /* Should render and does it intersect with texture? */
+        if((bRender != orxFALSE)
+        && (orxAABox_Test2DIntersection(&stTextureBox, &stViewportBox) != orxFALSE))
         {
           orxFLOAT    fCorrectionRatio;
           orxCOLOR    stColor;
@@ -1700,6 +2840,9 @@ static orxINLINE void orxRender_Home_RenderViewport(const orxVIEWPORT *_pstViewp
             orxDisplay_SetBitmapClipping(apstBitmapList[i], orxF2U(stViewportBox.vTL.fX), orxF2U(stViewportBox.vTL.fY), orxF2U(stViewportBox.vBR.fX), orxF2U(stViewportBox.vBR.fY));
           }
 
+          /* Stores clipping box */
+          orxAABox_Copy(&(sstRender.stClipBox), &stViewportBox);
+
           /* Does viewport have a background color? */
           if(bHasColor != orxFALSE)
           {
@@ -1728,11 +2871,12 @@ static orxINLINE void orxRender_Home_RenderViewport(const orxVIEWPORT *_pstViewp
             if((fCameraWidth > orxFLOAT_0)
             && (fCameraHeight > orxFLOAT_0))
             {
-              orxU32          u32Number;
+              orxU32          u32Number, u32CameraKey;
+              orxBOOL         bReuseNodes;
               orxOBJECT      *pstObject;
               orxFRAME       *pstCameraFrame;
               orxRENDER_NODE *pstRenderNode;
-              orxVECTOR       vCameraScale, vCameraCenter, vCameraPosition;
+              orxVECTOR       vCameraScale, vCameraCenter, vCameraPosition, vScreenCenter;
               orxFLOAT        fCameraDepth, fRenderScaleX, fRenderScaleY, fRecZoom, fRenderRotation, fCameraBoundingRadius;
 
               /* Gets camera frame */
@@ -1768,30 +2912,119 @@ static orxINLINE void orxRender_Home_RenderViewport(const orxVIEWPORT *_pstViewp
               /* Gets camera rotation */
               fRenderRotation = orxFrame_GetRotation(pstCameraFrame, orxFRAME_SPACE_GLOBAL);
 
+              /* Gets screen center */
+              orxVector_Add(&vScreenCenter, &vViewportCenter, &(stTextureBox.vTL));
+
+              /* Gets camera key */
+              u32CameraKey = orxRender_Home_GetCameraKey(pstCamera, 0);
+
+              /* Were render nodes already culled & sorted for this camera, in the same state, by a previous viewport this frame? */
+              if((sstRender.pstRenderCamera == pstCamera)
+              && (sstRender.u32RenderCameraKey == u32CameraKey))
+              {
+                /* Reuses them */
+                bReuseNodes = orxTRUE;
+              }
+              else
+              {
+                /* Clears previous ones */
+                orxRender_Home_ClearRenderNodes();
+
+                /* Stores camera */
+                sstRender.pstRenderCamera     = pstCamera;
+                sstRender.u32RenderCameraKey  = u32CameraKey;
+
+                /* Doesn't reuse them */
+                bReuseNodes = orxFALSE;
+              }
+
               /* For all camera group IDs */
               for(i = 0, u32Number = orxCamera_GetGroupIDCount(pstCamera); i < u32Number; i++)
               {
-                orxU32 u32GroupID;
+                orxRENDER_STATIC_GROUP *pstStaticGroup;
+                orxU32                  u32GroupID;
 
                 /* Gets it */
                 u32GroupID = orxCamera_GetGroupID(pstCamera, i);
 
-                /* For all objects in this group */
-                for(pstObject = orxObject_GetNext(orxNULL, u32GroupID);
+                /* Selects its render list */
+                sstRender.pstRenderList = &(sstRender.astRenderList[i]);
+
+                /* Profiles */
+                orxPROFILER_PUSH_MARKER("orxRender_CullAndSort");
+
+                /* Gets its static group, if any, unless reusing nodes */
+                pstStaticGroup = (bReuseNodes == orxFALSE) ? orxRender_Home_GetStaticGroup(u32GroupID, orxFALSE) : orxNULL;
+
+                /* Valid? */
+                if(pstStaticGroup != orxNULL)
+                {
+                  orxRENDER_STATIC_CHUNK *pstChunk;
+
+                  /* Dirty? */
+                  if(orxFLAG_TEST(pstStaticGroup->u32Flags, orxRENDER_KU32_STATIC_GROUP_FLAG_DIRTY))
+                  {
+                    /* Updates it */
+                    orxRender_Home_UpdateStaticGroup(pstStaticGroup);
+                  }
+
+                  /* For all its chunks */
+                  for(pstChunk = (orxRENDER_STATIC_CHUNK *)orxLinkList_GetFirst(&(pstStaticGroup->stChunkList));
+                      pstChunk != orxNULL;
+                      pstChunk = (orxRENDER_STATIC_CHUNK *)orxLinkList_GetNext(&(pstChunk->stNode)))
+                  {
+                    /* Is chunk in Z frustum? */
+                    if((pstChunk->fZ >= vCameraPosition.fZ) && (pstChunk->fZ >= stFrustum.vTL.fZ) && (pstChunk->fZ <= stFrustum.vBR.fZ))
+                    {
+                      orxVECTOR vDist;
+
+                      /* Gets 2D distance vector */
+                      orxVector_Sub(&vDist, &(pstChunk->vCenter), &vCameraCenter);
+                      vDist.fZ = orxFLOAT_0;
+
+                      /* Circle test between chunk & camera */
+                      if(orxVector_GetSquareSize(&vDist) <= (fCameraBoundingRadius + pstChunk->fBoundingRadius) * (fCameraBoundingRadius + pstChunk->fBoundingRadius))
+                      {
+                        /* Creates a render node */
+                        pstRenderNode = (orxRENDER_NODE *)orxBank_Allocate(sstRender.pstRenderBank);
+
+                        /* Stores chunk */
+                        pstRenderNode->pstObject          = orxNULL;
+                        pstRenderNode->pstChunk           = pstChunk;
+                        pstRenderNode->pstParticleSystem  = orxNULL;
+                        pstRenderNode->pstTexture         = pstChunk->pstTexture;
+                        pstRenderNode->pstShader          = orxNULL;
+                        pstRenderNode->eSmoothing         = pstChunk->eSmoothing;
+                        pstRenderNode->eBlendMode         = pstChunk->eBlendMode;
+                        pstRenderNode->fZ                 = pstChunk->fZ;
+                        pstRenderNode->fDepthCoef         = orxFLOAT_1;
+
+                        /* Adds it */
+                        orxRender_Home_AddRenderNode(pstRenderNode);
+                      }
+                    }
+                  }
+                }
+
+                /* For all objects in this group, unless reusing nodes */
+                for(pstObject = (bReuseNodes == orxFALSE) ? orxObject_GetNext(orxNULL, u32GroupID) : orxNULL;
                     pstObject != orxNULL;
                     pstObject = orxObject_GetNext(pstObject, u32GroupID))
                 {
-                  /* Is object enabled? */
-                  if(orxObject_IsEnabled(pstObject) != orxFALSE)
+                  /* Is object enabled and not already baked? */
+                  if((orxObject_IsEnabled(pstObject) != orxFALSE)
+                  && ((pstStaticGroup == orxNULL)
+                   || (orxObject_IsBaked(pstObject) == orxFALSE)))
                   {
-                    orxGRAPHIC *pstGraphic;
+                    orxGRAPHIC         *pstGraphic;
+                    orxPARTICLESYSTEM  *pstParticleSystem;
 
                     /* Gets object's graphic */
                     pstGraphic = orxOBJECT_GET_STRUCTURE(pstObject, GRAPHIC);
 
                     /* Valid 2D graphic? */
                     if((pstGraphic != orxNULL)
-                    && (orxStructure_TestFlags(pstGraphic, orxGRAPHIC_KU32_FLAG_2D | orxGRAPHIC_KU32_FLAG_TEXT) != orxFALSE))
+                    && (orxStructure_TestFlags(pstGraphic, orxGRAPHIC_KU32_FLAG_2D | orxGRAPHIC_KU32_FLAG_TEXT | orxGRAPHIC_KU32_FLAG_TILEMAP) != orxFALSE))
                     {
                       orxFRAME     *pstFrame;
                       orxSTRUCTURE *pstData;
@@ -1803,15 +3036,22 @@ static orxINLINE void orxRender_Home_RenderViewport(const orxVIEWPORT *_pstViewp
                       /* Gets graphic data */
                       pstData = orxGraphic_GetData(pstGraphic);
 
-                      /* Valid and has text/texture data? */
+                      /* Valid and has text/texture/tile map data? */
                       if((pstFrame != orxNULL)
                       && (((pstTexture = orxTEXTURE(pstData)) != orxNULL)
-                       || (orxTEXT(pstData) != orxNULL)))
+                       || (orxTEXT(pstData) != orxNULL)
+                       || (orxTILEMAP(pstData) != orxNULL)))
                       {
                         orxVECTOR vObjectPos;
 
-                        /* Not a texture? */
-                        if(pstTexture == orxNULL)
+                        /* Tile map? */
+                        if(orxTILEMAP(pstData) != orxNULL)
+                        {
+                          /* Gets its tileset texture */
+                          pstTexture = orxTileMap_GetTexture(orxTILEMAP(pstData));
+                        }
+                        /* Text? */
+                        else if(pstTexture == orxNULL)
                         {
                           /* Gets texture from text */
                           pstTexture = orxFont_GetTexture(orxText_GetFont(orxTEXT(pstData)));
@@ -1954,15 +3194,14 @@ static orxINLINE void orxRender_Home_RenderViewport(const orxVIEWPORT *_pstViewp
                             /* Creates a render node */
                             pstRenderNode = (orxRENDER_NODE *)orxBank_Allocate(sstRender.pstRenderBank);
 
-                            /* Cleans its internal node */
-                            orxMemory_Zero(pstRenderNode, sizeof(orxLINKLIST_NODE));
-
                             /* Stores object */
-                            pstRenderNode->pstObject  = pstObject;
-                            pstRenderNode->pstTexture = pstTexture;
-                            pstRenderNode->pstShader  = pstShader;
-                            pstRenderNode->eSmoothing = eSmoothing;
-                            pstRenderNode->eBlendMode = eBlendMode;
+                            pstRenderNode->pstObject          = pstObject;
+                            pstRenderNode->pstChunk           = orxNULL;
+                            pstRenderNode->pstParticleSystem  = orxNULL;
+                            pstRenderNode->pstTexture         = pstTexture;
+                            pstRenderNode->pstShader          = pstShader;
+                            pstRenderNode->eSmoothing         = eSmoothing;
+                            pstRenderNode->eBlendMode         = eBlendMode;
 
                             /* Stores its Z coordinate */
                             pstRenderNode->fZ = vObjectPos.fZ;
@@ -1970,158 +3209,212 @@ static orxINLINE void orxRender_Home_RenderViewport(const orxVIEWPORT *_pstViewp
                             /* Stores its depth coef */
                             pstRenderNode->fDepthCoef = fDepthCoef;
 
-                            /* Empty list? */
-                            if(orxLinkList_GetCount(&(sstRender.stRenderList)) == 0)
-                            {
-                              /* Adds node at beginning */
-                              orxLinkList_AddStart(&(sstRender.stRenderList), (orxLINKLIST_NODE *)pstRenderNode);
-                            }
-                            else
-                            {
-                              orxRENDER_NODE *pstNode;
-
-                              /* Finds correct node position */
-                              for(pstNode = (orxRENDER_NODE *)orxLinkList_GetFirst(&(sstRender.stRenderList));
-                                  (pstNode != orxNULL)
-                               && ((vObjectPos.fZ < pstNode->fZ)
-                                || ((vObjectPos.fZ == pstNode->fZ)
-                                 && ((pstTexture < pstNode->pstTexture)
-                                  || ((pstTexture == pstNode->pstTexture)
-                                   && ((pstShader < pstNode->pstShader)
-                                    || ((pstShader == pstNode->pstShader)
-                                     && (eBlendMode < pstNode->eBlendMode))
-                                      || ((eBlendMode == pstNode->eBlendMode)
-                                       && (eSmoothing < pstNode->eSmoothing)))))));
-                                  pstNode = (orxRENDER_NODE *)orxLinkList_GetNext(&(pstNode->stNode)));
-
-                              /* End of list reached? */
-                              if(pstNode == orxNULL)
-                              {
-                                /* Adds it at end */
-                                orxLinkList_AddEnd(&(sstRender.stRenderList), &(pstRenderNode->stNode));
-                              }
-                              else
-                              {
-                                /* Adds it before found node */
-                                orxLinkList_AddBefore(&(pstNode->stNode), &(pstRenderNode->stNode));
-                              }
-                            }
+                            /* Adds it */
+                            orxRender_Home_AddRenderNode(pstRenderNode);
+                          }
+                        }
+                      }
+                    }
+
+                    /* Gets object's particle system */
+                    pstParticleSystem = orxOBJECT_GET_STRUCTURE(pstObject, PARTICLESYSTEM);
+
+                    /* Has live particles? */
+                    if((pstParticleSystem != orxNULL)
+                    && (orxParticleSystem_GetParticleCount(pstParticleSystem) != 0))
+                    {
+                      orxPARTICLE_LIST  stParticleList;
+                      orxTEXTURE       *pstTexture = orxNULL;
+
+                      /* Gets its graphic & particles */
+                      pstGraphic = orxParticleSystem_GetGraphic(pstParticleSystem);
+                      orxParticleSystem_GetParticleList(pstParticleSystem, &stParticleList);
+
+                      /* Valid 2D graphic in Z frustum? */
+                      if((pstGraphic != orxNULL)
+                      && ((pstTexture = orxTEXTURE(orxGraphic_GetData(pstGraphic))) != orxNULL)
+                      && (stParticleList.fZ >= vCameraPosition.fZ) && (stParticleList.fZ >= stFrustum.vTL.fZ) && (stParticleList.fZ <= stFrustum.vBR.fZ))
+                      {
+                        orxVECTOR vSize, vDist;
+                        orxFLOAT  fBoundingRadius;
+
+                        /* Gets particles' bounding radius, including the largest particle's extent */
+                        orxVector_Sub(&vSize, &(stParticleList.stBox.vBR), &(stParticleList.stBox.vTL));
+                        fBoundingRadius = orx2F(0.5f) * orxMath_Sqrt((vSize.fX * vSize.fX) + (vSize.fY * vSize.fY));
+                        orxGraphic_GetSize(pstGraphic, &vSize);
+                        fBoundingRadius += stParticleList.fMaxScale * orxMath_Sqrt((vSize.fX * vSize.fX) + (vSize.fY * vSize.fY));
+
+                        /* Gets 2D distance vector */
+                        orxAABox_GetCenter(&(stParticleList.stBox), &vDist);
+                        orxVector_Sub(&vDist, &vDist, &vCameraCenter);
+                        vDist.fZ = orxFLOAT_0;
+
+                        /* Circle test between particles & camera */
+                        if(orxVector_GetSquareSize(&vDist) <= (fCameraBoundingRadius + fBoundingRadius) * (fCameraBoundingRadius + fBoundingRadius))
+                        {
+                          orxDISPLAY_SMOOTHING eSmoothing;
+
+                          /* Gets graphic smoothing */
+                          eSmoothing = orxGraphic_GetSmoothing(pstGraphic);
+
+                          /* Default? */
+                          if(eSmoothing == orxDISPLAY_SMOOTHING_DEFAULT)
+                          {
+                            /* Gets object smoothing */
+                            eSmoothing = orxObject_GetSmoothing(pstObject);
                           }
+
+                          /* Creates a render node */
+                          pstRenderNode = (orxRENDER_NODE *)orxBank_Allocate(sstRender.pstRenderBank);
+
+                          /* Stores particle system */
+                          pstRenderNode->pstObject          = pstObject;
+                          pstRenderNode->pstChunk           = orxNULL;
+                          pstRenderNode->pstParticleSystem  = pstParticleSystem;
+                          pstRenderNode->pstTexture         = pstTexture;
+                          pstRenderNode->pstShader          = orxNULL;
+                          pstRenderNode->eSmoothing         = eSmoothing;
+                          pstRenderNode->eBlendMode         = orxGraphic_GetBlendMode(pstGraphic);
+                          pstRenderNode->fZ                 = stParticleList.fZ;
+                          pstRenderNode->fDepthCoef         = orxFLOAT_1;
+
+                          /* Adds it */
+                          orxRender_Home_AddRenderNode(pstRenderNode);
                         }
                       }
                     }
                   }
                 }
 
+                /* Profiles */
+                orxPROFILER_POP_MARKER();
+
                 /* For all render nodes */
-                for(pstRenderNode = (orxRENDER_NODE *)orxLinkList_GetFirst(&(sstRender.stRenderList));
+                for(pstRenderNode = (orxRENDER_NODE *)orxLinkList_GetFirst(sstRender.pstRenderList);
                     pstRenderNode != orxNULL;
                     pstRenderNode = (orxRENDER_NODE *)orxLinkList_GetNext((orxLINKLIST_NODE *)pstRenderNode))
                 {
-                  orxFRAME             *pstFrame;
-                  orxVECTOR             vObjectPos, vRenderPos, vObjectScale;
-                  orxFLOAT              fObjectRotation, fObjectScaleX, fObjectScaleY, fRepeatX, fRepeatY;
-                  orxDISPLAY_TRANSFORM  stTransform;
+                  /* Static chunk? */
+                  if(pstRenderNode->pstChunk != orxNULL)
+                  {
+                    /* Renders it */
+                    if(orxRender_Home_RenderStaticChunk(pstRenderNode->pstChunk, &vCameraCenter, fRenderScaleX, fRenderScaleY, fRenderRotation, &vScreenCenter) == orxSTATUS_FAILURE)
+                    {
+                      /* Prints error message */
+                      orxDEBUG_PRINT(orxDEBUG_LEVEL_RENDER, "Static chunk (%d, %d) of group [%s] couldn't be rendered.", pstRenderNode->pstChunk->s32CellX, pstRenderNode->pstChunk->s32CellY, orxString_GetFromID(u32GroupID));
+                    }
+                  }
+                  /* Particle system? */
+                  else if(pstRenderNode->pstParticleSystem != orxNULL)
+                  {
+                    /* Renders it */
+                    if(orxRender_Home_RenderParticleSystem(pstRenderNode->pstParticleSystem, pstRenderNode->eSmoothing, pstRenderNode->eBlendMode, &vCameraCenter, fRenderScaleX, fRenderScaleY, fRenderRotation, &vScreenCenter) == orxSTATUS_FAILURE)
+                    {
+                      /* Prints error message */
+                      orxDEBUG_PRINT(orxDEBUG_LEVEL_RENDER, "Particle system [%s] of [orxOBJECT %p / %s] couldn't be rendered.", orxParticleSystem_GetName(pstRenderNode->pstParticleSystem), pstRenderNode->pstObject, orxObject_GetName(pstRenderNode->pstObject));
+                    }
+                  }
+                  else
+                  {
+                    orxFRAME             *pstFrame;
+                    orxVECTOR             vObjectPos, vRenderPos, vObjectScale;
+                    orxFLOAT              fObjectRotation, fObjectScaleX, fObjectScaleY, fRepeatX, fRepeatY;
+                    orxDISPLAY_TRANSFORM  stTransform;
 
-                  /* Gets object */
-                  pstObject = pstRenderNode->pstObject;
+                    /* Gets object */
+                    pstObject = pstRenderNode->pstObject;
 
-                  /* Gets object's position */
-                  orxObject_GetWorldPosition(pstObject, &vObjectPos);
+                    /* Gets object's position */
+                    orxObject_GetWorldPosition(pstObject, &vObjectPos);
 
-                  /* Gets object's frame */
-                  pstFrame = orxOBJECT_GET_STRUCTURE(pstObject, FRAME);
+                    /* Gets object's frame */
+                    pstFrame = orxOBJECT_GET_STRUCTURE(pstObject, FRAME);
 
-                  /* Gets object's scales */
-                  orxFrame_GetScale(pstFrame, orxFRAME_SPACE_GLOBAL, &vObjectScale);
+                    /* Gets object's scales */
+                    orxFrame_GetScale(pstFrame, orxFRAME_SPACE_GLOBAL, &vObjectScale);
 
-                  /* Gets object's rotation */
-                  fObjectRotation = orxFrame_GetRotation(pstFrame, orxFRAME_SPACE_GLOBAL);
+                    /* Gets object's rotation */
+                    fObjectRotation = orxFrame_GetRotation(pstFrame, orxFRAME_SPACE_GLOBAL);
 
-                  /* Gets object scale */
-                  fObjectScaleX = fRenderScaleX;
-                  fObjectScaleY = fRenderScaleY;
+                    /* Gets object scale */
+                    fObjectScaleX = fRenderScaleX;
+                    fObjectScaleY = fRenderScaleY;
 
-                  /* Gets position in camera space */
-                  orxVector_Sub(&vRenderPos, &vObjectPos, &vCameraCenter);
-                  vRenderPos.fX  *= fObjectScaleX;
-                  vRenderPos.fY  *= fObjectScaleY;
+                    /* Gets position in camera space */
+                    orxVector_Sub(&vRenderPos, &vObjectPos, &vCameraCenter);
+                    vRenderPos.fX  *= fObjectScaleX;
+                    vRenderPos.fY  *= fObjectScaleY;
 
-                  /* Uses differential scrolling or depth scaling? */
-                  if((orxStructure_TestFlags(pstFrame, orxFRAME_KU32_MASK_SCROLL_BOTH) != orxFALSE)
-                  || (orxStructure_TestFlags(pstFrame, orxFRAME_KU32_FLAG_DEPTH_SCALE) != orxFALSE))
-                  {
-                    /* X-axis scroll? */
-                    if(orxStructure_TestFlags(pstFrame, orxFRAME_KU32_FLAG_SCROLL_X) != orxFALSE)
+                    /* Uses differential scrolling or depth scaling? */
+                    if((orxStructure_TestFlags(pstFrame, orxFRAME_KU32_MASK_SCROLL_BOTH) != orxFALSE)
+                    || (orxStructure_TestFlags(pstFrame, orxFRAME_KU32_FLAG_DEPTH_SCALE) != orxFALSE))
                     {
-                      /* Updates render position */
-                      vRenderPos.fX *= pstRenderNode->fDepthCoef;
-                    }
+                      /* X-axis scroll? */
+                      if(orxStructure_TestFlags(pstFrame, orxFRAME_KU32_FLAG_SCROLL_X) != orxFALSE)
+                      {
+                        /* Updates render position */
+                        vRenderPos.fX *= pstRenderNode->fDepthCoef;
+                      }
 
-                    /* Y-axis scroll? */
-                    if(orxStructure_TestFlags(pstFrame, orxFRAME_KU32_FLAG_SCROLL_Y) != orxFALSE)
-                    {
-                      /* Updates render position */
-                      vRenderPos.fY *= pstRenderNode->fDepthCoef;
+                      /* Y-axis scroll? */
+                      if(orxStructure_TestFlags(pstFrame, orxFRAME_KU32_FLAG_SCROLL_Y) != orxFALSE)
+                      {
+                        /* Updates render position */
+                        vRenderPos.fY *= pstRenderNode->fDepthCoef;
+                      }
+
+                      /* Depth scale? */
+                      if(orxStructure_TestFlags(pstFrame, orxFRAME_KU32_FLAG_DEPTH_SCALE) != orxFALSE)
+                      {
+                        /* Updates object scales */
+                        vObjectScale.fX *= pstRenderNode->fDepthCoef;
+                        vObjectScale.fY *= pstRenderNode->fDepthCoef;
+                      }
                     }
 
-                    /* Depth scale? */
-                    if(orxStructure_TestFlags(pstFrame, orxFRAME_KU32_FLAG_DEPTH_SCALE) != orxFALSE)
+                    /* Has camera rotation? */
+                    if(fRenderRotation != orxFLOAT_0)
                     {
-                      /* Updates object scales */
-                      vObjectScale.fX *= pstRenderNode->fDepthCoef;
-                      vObjectScale.fY *= pstRenderNode->fDepthCoef;
+                      /* Rotates it */
+                      orxVector_2DRotate(&vRenderPos, &vRenderPos, -fRenderRotation);
                     }
-                  }
 
-                  /* Has camera rotation? */
-                  if(fRenderRotation != orxFLOAT_0)
-                  {
-                    /* Rotates it */
-                    orxVector_2DRotate(&vRenderPos, &vRenderPos, -fRenderRotation);
-                  }
+                    /* Gets position in screen space */
+                    orxVector_Add(&vRenderPos, &vRenderPos, &vViewportCenter);
+                    orxVector_Add(&vRenderPos, &vRenderPos, &(stTextureBox.vTL));
 
-                  /* Gets position in screen space */
-                  orxVector_Add(&vRenderPos, &vRenderPos, &vViewportCenter);
-                  orxVector_Add(&vRenderPos, &vRenderPos, &(stTextureBox.vTL));
+                    /* Gets object repeat values */
+                    orxObject_GetRepeat(pstObject, &fRepeatX, &fRepeatY);
 
-                  /* Gets object repeat values */
-                  orxObject_GetRepeat(pstObject, &fRepeatX, &fRepeatY);
-
-                  /* Updates if invalid */
-                  if(fRepeatX == orxFLOAT_0)
-                  {
-                    fRepeatX = orxMATH_KF_EPSILON;
-                  }
-                  if(fRepeatY == orxFLOAT_0)
-                  {
-                    fRepeatY = orxMATH_KF_EPSILON;
-                  }
+                    /* Updates if invalid */
+                    if(fRepeatX == orxFLOAT_0)
+                    {
+                      fRepeatX = orxMATH_KF_EPSILON;
+                    }
+                    if(fRepeatY == orxFLOAT_0)
+                    {
+                      fRepeatY = orxMATH_KF_EPSILON;
+                    }
 
-                  /* Sets transformation values */
-                  stTransform.fSrcX     = orxFLOAT_0;
-                  stTransform.fSrcY     = orxFLOAT_0;
-                  stTransform.fDstX     = vRenderPos.fX;
-                  stTransform.fDstY     = vRenderPos.fY;
-                  stTransform.fRepeatX  = fRepeatX;
-                  stTransform.fRepeatY  = fRepeatY;
-                  stTransform.fScaleX   = vObjectScale.fX * fObjectScaleX;
-                  stTransform.fScaleY   = vObjectScale.fY * fObjectScaleY;
-                  stTransform.fRotation = fObjectRotation - fRenderRotation;
-
-                  /* Renders it */
-                  if(orxRender_Home_RenderObject(pstObject, &stTransform, pstRenderNode->eSmoothing, pstRenderNode->eBlendMode) == orxSTATUS_FAILURE)
-                  {
-                    /* Prints error message */
-                    orxDEBUG_PRINT(orxDEBUG_LEVEL_RENDER, "[orxOBJECT %p / %s] couldn't be rendered.", pstObject, orxObject_GetName(pstObject));
+                    /* Sets transformation values */
+                    stTransform.fSrcX     = orxFLOAT_0;
+                    stTransform.fSrcY     = orxFLOAT_0;
+                    stTransform.fDstX     = vRenderPos.fX;
+                    stTransform.fDstY     = vRenderPos.fY;
+                    stTransform.fRepeatX  = fRepeatX;
+                    stTransform.fRepeatY  = fRepeatY;
+                    stTransform.fScaleX   = vObjectScale.fX * fObjectScaleX;
+                    stTransform.fScaleY   = vObjectScale.fY * fObjectScaleY;
+                    stTransform.fRotation = fObjectRotation - fRenderRotation;
+
+                    /* Renders it */
+                    if(orxRender_Home_RenderObject(pstObject, &stTransform, pstRenderNode->eSmoothing, pstRenderNode->eBlendMode) == orxSTATUS_FAILURE)
+                    {
+                      /* Prints error message */
+                      orxDEBUG_PRINT(orxDEBUG_LEVEL_RENDER, "[orxOBJECT %p / %s] couldn't be rendered.", pstObject, orxObject_GetName(pstObject));
+                    }
                   }
                 }
-
-                /* Cleans rendering bank */
-                orxBank_Clear(sstRender.pstRenderBank);
-
-                /* Cleans rendering list */
-                orxMemory_Zero(&(sstRender.stRenderList), sizeof(orxLINKLIST));
               }
             }
             else
@@ -2140,11 +3433,48 @@ static orxINLINE void orxRender_Home_RenderViewport(const orxVIEWPORT *_pstViewp
             }
           }
         }
-        else
+        else if(bRender != orxFALSE)
         {
           /* Logs message */
           orxDEBUG_PRINT(orxDEBUG_LEVEL_RENDER, "Viewport does not intersect with texture.");
         }
+
+        /* Uses cache? */
+        if(pstTargetBitmap != orxNULL)
+        {
+          orxDISPLAY_TRANSFORM stTransform;
+
+          /* Has been refreshed? */
+          if(bRender != orxFALSE)
+          {
+            /* Validates it */
+            orxViewport_ValidateCache(_pstViewport, u32CacheKey, fCacheTime);
+
+            /* Restores target bitmap */
+            orxDisplay_SetDestinationBitmaps(&pstTargetBitmap, 1);
+          }
+
+          /* Restores target clipping */
+          orxDisplay_SetBitmapClipping(pstTargetBitmap, orxF2U(stCacheBox.vTL.fX), orxF2U(stCacheBox.vTL.fY), orxF2U(stCacheBox.vBR.fX), orxF2U(stCacheBox.vBR.fY));
+
+          /* Inits blit transform */
+          stTransform.fSrcX     = orxFLOAT_0;
+          stTransform.fSrcY     = orxFLOAT_0;
+          stTransform.fDstX     = stCacheBox.vTL.fX;
+          stTransform.fDstY     = stCacheBox.vTL.fY;
+          stTransform.fRepeatX  = orxFLOAT_1;
+          stTransform.fRepeatY  = orxFLOAT_1;
+          stTransform.fScaleX   = orxFLOAT_1;
+          stTransform.fScaleY   = orxFLOAT_1;
+          stTransform.fRotation = orxFLOAT_0;
+
+          /* Blits cache onto target */
+          if(orxDisplay_TransformBitmap(pstCacheBitmap, &stTransform, orxDISPLAY_SMOOTHING_OFF, orxDISPLAY_BLEND_MODE_ALPHA) == orxSTATUS_FAILURE)
+          {
+            /* Logs message */
+            orxDEBUG_PRINT(orxDEBUG_LEVEL_RENDER, "Viewport [%s]: Couldn't blit cache.", orxViewport_GetName(_pstViewport));
+          }
+        }
       }
 
       /* Sends stop event */
@@ -2192,6 +3522,9 @@ static void orxFASTCALL orxRender_Home_RenderAll(const orxCLOCK_INFO *_pstClockI
     /* Profiles */
     orxPROFILER_PUSH_MARKER("orxRender_RenderAll");
 
+    /* Clears render nodes from previous frame */
+    orxRender_Home_ClearRenderNodes();
+
     /* For all viewports */
     for(pstViewport = orxVIEWPORT(orxStructure_GetFirst(orxSTRUCTURE_ID_VIEWPORT));
         pstViewport != orxNULL;
@@ -2490,6 +3823,54 @@ static orxSTATUS orxFASTCALL orxRender_Home_EventHandler(const orxEVENT *_pstEve
       break;
     }
 
+    case orxEVENT_TYPE_OBJECT:
+    {
+      /* Depending on event */
+      switch(_pstEvent->eID)
+      {
+        case orxOBJECT_EVENT_CREATE:
+        case orxOBJECT_EVENT_DELETE:
+        case orxOBJECT_EVENT_ENABLE:
+        case orxOBJECT_EVENT_DISABLE:
+        case orxOBJECT_EVENT_STATIC_UPDATE:
+        {
+          orxOBJECT              *pstObject;
+          orxRENDER_STATIC_GROUP *pstGroup;
+
+          /* Gets object */
+          pstObject = orxOBJECT(_pstEvent->hSender);
+
+          /* Invalidates caches of viewports rendering its group */
+          orxRender_Home_InvalidateViewportCaches(orxObject_GetGroupID(pstObject));
+
+          /* Invalidates stored render nodes, they'll be re-created by the next viewport */
+          sstRender.pstRenderCamera = orxNULL;
+
+          /* Gets its static group, creating it when gaining a static member */
+          pstGroup = orxRender_Home_GetStaticGroup(orxObject_GetGroupID(pstObject), orxObject_IsStatic(pstObject));
+
+          /* Found and concerned? */
+          if((pstGroup != orxNULL)
+          && ((orxFLAG_TEST(pstGroup->u32Flags, orxRENDER_KU32_STATIC_GROUP_FLAG_ALL))
+           || (orxObject_IsStatic(pstObject) != orxFALSE)
+           || (orxObject_IsBaked(pstObject) != orxFALSE)))
+          {
+            /* Marks it as dirty */
+            orxFLAG_SET(pstGroup->u32Flags, orxRENDER_KU32_STATIC_GROUP_FLAG_DIRTY, orxRENDER_KU32_STATIC_GROUP_FLAG_NONE);
+          }
+
+          break;
+        }
+
+        default:
+        {
+          break;
+        }
+      }
+
+      break;
+    }
+
     case orxEVENT_TYPE_SYSTEM:
     {
       /* Close event? */
@@ -2820,8 +4201,18 @@ orxSTATUS orxFASTCALL orxRender_Home_Init()
     /* Creates rendering bank */
     sstRender.pstRenderBank = orxBank_Create(orxRENDER_KU32_ORDER_BANK_SIZE, sizeof(orxRENDER_NODE), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
 
+    /* Creates static group & chunk banks */
+    sstRender.pstStaticGroupBank = orxBank_Create(orxRENDER_KU32_STATIC_GROUP_BANK_SIZE, sizeof(orxRENDER_STATIC_GROUP), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+    sstRender.pstStaticChunkBank = orxBank_Create(orxRENDER_KU32_STATIC_CHUNK_BANK_SIZE, sizeof(orxRENDER_STATIC_CHUNK), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+
+    /* Creates static group table */
+    sstRender.pstStaticGroupTable = orxHashTable_Create(orxRENDER_KU32_STATIC_GROUP_TABLE_SIZE, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+
     /* Valid? */
-    if(sstRender.pstRenderBank != orxNULL)
+    if((sstRender.pstRenderBank != orxNULL)
+    && (sstRender.pstStaticGroupBank != orxNULL)
+    && (sstRender.pstStaticChunkBank != orxNULL)
+    && (sstRender.pstStaticGroupTable != orxNULL))
     {
       orxFLOAT fMinFrequency = orxFLOAT_0;
 
@@ -2839,6 +4230,48 @@ orxSTATUS orxFASTCALL orxRender_Home_Init()
         orxClock_SetModifier(sstRender.pstClock, orxCLOCK_MOD_TYPE_MAXED, (fMinFrequency > orxFLOAT_0) ? (orxFLOAT_1 / fMinFrequency) : orxRENDER_KF_TICK_SIZE);
       }
 
+      /* Gets static chunk size */
+      sstRender.fStaticChunkSize = (orxConfig_HasValue(orxRENDER_KZ_CONFIG_STATIC_CHUNK_SIZE) != orxFALSE) ? orxConfig_GetFloat(orxRENDER_KZ_CONFIG_STATIC_CHUNK_SIZE) : orxRENDER_KF_STATIC_CHUNK_SIZE;
+
+      /* Invalid? */
+      if(sstRender.fStaticChunkSize <= orxFLOAT_0)
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_RENDER, "Invalid static chunk size <%g>, using default value <%g> instead.", sstRender.fStaticChunkSize, orxRENDER_KF_STATIC_CHUNK_SIZE);
+
+        /* Uses default value */
+        sstRender.fStaticChunkSize = orxRENDER_KF_STATIC_CHUNK_SIZE;
+      }
+
+      /* Has profiler budget? */
+      if(orxConfig_HasValue(orxRENDER_KZ_CONFIG_PROFILER_BUDGET) != orxFALSE)
+      {
+        /* Sets it */
+        orxProfiler_SetFrameBudget((orxDOUBLE)orxMAX(orxConfig_GetFloat(orxRENDER_KZ_CONFIG_PROFILER_BUDGET), orxFLOAT_0), (orxConfig_HasValue(orxRENDER_KZ_CONFIG_PROFILER_BUDGET_HISTORY) != orxFALSE) ? orxConfig_GetU32(orxRENDER_KZ_CONFIG_PROFILER_BUDGET_HISTORY) : orxPROFILER_KU32_BUDGET_DEFAULT_HISTORY);
+      }
+
+      /* Has static groups? */
+      if(orxConfig_HasValue(orxRENDER_KZ_CONFIG_STATIC_GROUP_LIST) != orxFALSE)
+      {
+        orxS32 i, s32Count;
+
+        /* For all static groups */
+        for(i = 0, s32Count = orxConfig_GetListCount(orxRENDER_KZ_CONFIG_STATIC_GROUP_LIST); i < s32Count; i++)
+        {
+          orxRENDER_STATIC_GROUP *pstGroup;
+
+          /* Gets its static group */
+          pstGroup = orxRender_Home_GetStaticGroup(orxString_GetID(orxConfig_GetListString(orxRENDER_KZ_CONFIG_STATIC_GROUP_LIST, i)), orxTRUE);
+
+          /* Valid? */
+          if(pstGroup != orxNULL)
+          {
+            /* Tags it as fully static */
+            orxFLAG_SET(pstGroup->u32Flags, orxRENDER_KU32_STATIC_GROUP_FLAG_ALL, orxRENDER_KU32_STATIC_GROUP_FLAG_NONE);
+          }
+        }
+      }
+
       /* Pops config section */
       orxConfig_PopSection();
 
@@ -2895,6 +4328,7 @@ orxSTATUS orxFASTCALL orxRender_Home_Init()
             orxEvent_AddHandler(orxEVENT_TYPE_DISPLAY, orxRender_Home_EventHandler);
             orxEvent_AddHandler(orxEVENT_TYPE_SYSTEM, orxRender_Home_EventHandler);
             orxEvent_AddHandler(orxEVENT_TYPE_INPUT, orxRender_Home_EventHandler);
+            orxEvent_AddHandler(orxEVENT_TYPE_OBJECT, orxRender_Home_EventHandler);
 
             /* Gets screen size */
             orxDisplay_GetScreenSize(&fScreenWidth, &fScreenHeight);
@@ -2925,14 +4359,24 @@ orxSTATUS orxFASTCALL orxRender_Home_Init()
             /* Deletes frame */
             orxFrame_Delete(sstRender.pstFrame);
 
-            /* Deletes bank */
+            /* Deletes static group table */
+            orxHashTable_Delete(sstRender.pstStaticGroupTable);
+
+            /* Deletes banks */
             orxBank_Delete(sstRender.pstRenderBank);
+            orxBank_Delete(sstRender.pstStaticGroupBank);
+            orxBank_Delete(sstRender.pstStaticChunkBank);
           }
         }
         else
         {
-          /* Deletes bank */
+          /* Deletes static group table */
+          orxHashTable_Delete(sstRender.pstStaticGroupTable);
+
+          /* Deletes banks */
           orxBank_Delete(sstRender.pstRenderBank);
+          orxBank_Delete(sstRender.pstStaticGroupBank);
+          orxBank_Delete(sstRender.pstStaticChunkBank);
 
           /* Updates result */
           eResult = orxSTATUS_FAILURE;
@@ -2940,8 +4384,13 @@ orxSTATUS orxFASTCALL orxRender_Home_Init()
       }
       else
       {
-        /* Deletes bank */
+        /* Deletes static group table */
+        orxHashTable_Delete(sstRender.pstStaticGroupTable);
+
+        /* Deletes banks */
         orxBank_Delete(sstRender.pstRenderBank);
+        orxBank_Delete(sstRender.pstStaticGroupBank);
+        orxBank_Delete(sstRender.pstStaticChunkBank);
 
         /* Updates result */
         eResult = orxSTATUS_FAILURE;
@@ -2949,6 +4398,26 @@ orxSTATUS orxFASTCALL orxRender_Home_Init()
     }
     else
     {
+      /* Deletes static group table */
+      if(sstRender.pstStaticGroupTable != orxNULL)
+      {
+        orxHashTable_Delete(sstRender.pstStaticGroupTable);
+      }
+
+      /* Deletes banks */
+      if(sstRender.pstRenderBank != orxNULL)
+      {
+        orxBank_Delete(sstRender.pstRenderBank);
+      }
+      if(sstRender.pstStaticGroupBank != orxNULL)
+      {
+        orxBank_Delete(sstRender.pstStaticGroupBank);
+      }
+      if(sstRender.pstStaticChunkBank != orxNULL)
+      {
+        orxBank_Delete(sstRender.pstStaticChunkBank);
+      }
+
       /* Updates result */
       eResult = orxSTATUS_FAILURE;
     }
@@ -2970,6 +4439,8 @@ orxSTATUS orxFASTCALL orxRender_Home_Init()
  */
 void orxFASTCALL orxRender_Home_Exit()
 {
+  orxRENDER_STATIC_GROUP *pstGroup;
+
   /* Initialized? */
   if(sstRender.u32Flags & orxRENDER_KU32_STATIC_FLAG_READY)
   {
@@ -2977,6 +4448,7 @@ void orxFASTCALL orxRender_Home_Exit()
     orxEvent_RemoveHandler(orxEVENT_TYPE_DISPLAY, orxRender_Home_EventHandler);
     orxEvent_RemoveHandler(orxEVENT_TYPE_SYSTEM, orxRender_Home_EventHandler);
     orxEvent_RemoveHandler(orxEVENT_TYPE_INPUT, orxRender_Home_EventHandler);
+    orxEvent_RemoveHandler(orxEVENT_TYPE_OBJECT, orxRender_Home_EventHandler);
 
     /* Removes blinking timer */
     orxClock_RemoveGlobalTimer(orxRender_Home_BlinkTimer, orxRENDER_KF_CONSOLE_BLINK_DELAY, orxNULL);
@@ -2994,6 +4466,31 @@ void orxFASTCALL orxRender_Home_Exit()
     /* Deletes rendering bank */
     orxBank_Delete(sstRender.pstRenderBank);
 
+    /* For all static groups */
+    for(pstGroup = (orxRENDER_STATIC_GROUP *)orxBank_GetNext(sstRender.pstStaticGroupBank, orxNULL);
+        pstGroup != orxNULL;
+        pstGroup = (orxRENDER_STATIC_GROUP *)orxBank_GetNext(sstRender.pstStaticGroupBank, pstGroup))
+    {
+      /* Clears it */
+      orxRender_Home_ClearStaticGroup(pstGroup);
+    }
+
+    /* Deletes static group table */
+    orxHashTable_Delete(sstRender.pstStaticGroupTable);
+
+    /* Deletes static banks */
+    orxBank_Delete(sstRender.pstStaticGroupBank);
+    orxBank_Delete(sstRender.pstStaticChunkBank);
+
+    /* Has vertex list? */
+    if(sstRender.astVertexList != orxNULL)
+    {
+      /* Frees it */
+      orxMemory_Free(sstRender.astVertexList);
+      sstRender.astVertexList     = orxNULL;
+      sstRender.u32VertexListSize = 0;
+    }
+
     /* Updates flags */
     sstRender.u32Flags &= ~(orxRENDER_KU32_STATIC_FLAG_READY | orxRENDER_KU32_STATIC_FLAG_REGISTERED);
   }
@@ -122,6 +122,7 @@
 
 #define orxANIMSET_KU32_LINK_TABLE_FLAG_READY         0x01000000  /**< Link table flag ready */
 #define orxANIMSET_KU32_LINK_TABLE_FLAG_DIRTY         0x02000000  /**< Link table flag dirty */
+#define orxANIMSET_KU32_LINK_TABLE_FLAG_SHARED        0x04000000  /**< Link table flag shared: arrays belong to a snapshot and are copied upon first write */
 
 #define orxANIMSET_KU32_LINK_TABLE_MASK_FLAGS         0xFFFF0000  /**< Link table mask flags */
 
@@ -204,6 +205,8 @@ struct __orxANIMSET_LINK_TABLE_t
   orxU16                  u16LinkCount;               /**< Link count : 10 */
   orxU16                  u16TableSize;               /**< Table size : 12 */
   orxU32                  u32Flags;                   /**< Flags : 16 */
+  orxANIMSET_LINK_TABLE  *pstSnapshot;                /**< Snapshot owning the shared arrays : 20 */
+  orxU32                  u32ShareCount;              /**< Share count (snapshots only) : 24 */
 };
 
 /** AnimSet structure
@@ -303,6 +306,97 @@ static orxINLINE orxU32 orxAnimSet_GetLinkTableLink(orxANIMSET_LINK_TABLE *_pstL
   return _pstLinkTable->au32LinkArray[_u32Index];
 }
 
+/** Releases a link table snapshot, freeing it along with its arrays when not shared anymore
+ * @param[in]   _pstSnapshot                  Concerned snapshot
+ */
+static void orxFASTCALL orxAnimSet_ReleaseLinkTableSnapshot(orxANIMSET_LINK_TABLE *_pstSnapshot)
+{
+  /* Checks */
+  orxASSERT(_pstSnapshot != orxNULL);
+  orxASSERT(_pstSnapshot->u32ShareCount != 0);
+
+  /* Updates share count */
+  _pstSnapshot->u32ShareCount--;
+
+  /* Not shared anymore? */
+  if(_pstSnapshot->u32ShareCount == 0)
+  {
+    /* Frees it */
+    orxMemory_Free(_pstSnapshot->au32LinkArray);
+    orxMemory_Free(_pstSnapshot->au8LoopArray);
+    orxMemory_Free(_pstSnapshot);
+  }
+
+  return;
+}
+
+/** Makes a link table writable, copying its arrays if they're shared through a snapshot
+ * @param[in]   _pstLinkTable                 Concerned LinkTable
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxSTATUS orxFASTCALL orxAnimSet_MakeLinkTableWritable(orxANIMSET_LINK_TABLE *_pstLinkTable)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT(_pstLinkTable != orxNULL);
+
+  /* Shared? */
+  if(orxAnimSet_TestLinkTableFlag(_pstLinkTable, orxANIMSET_KU32_LINK_TABLE_FLAG_SHARED) != orxFALSE)
+  {
+    orxU32 *au32LinkArray;
+    orxU8  *au8LoopArray;
+    orxU32  u32ArraySize;
+
+    /* Gets array size */
+    u32ArraySize = (orxU32)(_pstLinkTable->u16TableSize) * (orxU32)(_pstLinkTable->u16TableSize);
+
+    /* Allocates arrays */
+    au32LinkArray = (orxU32 *)orxMemory_Allocate(u32ArraySize * sizeof(orxU32), orxMEMORY_TYPE_MAIN);
+    au8LoopArray  = (orxU8 *)orxMemory_Allocate(u32ArraySize * sizeof(orxU8), orxMEMORY_TYPE_MAIN);
+
+    /* Success? */
+    if((au32LinkArray != orxNULL) && (au8LoopArray != orxNULL))
+    {
+      /* Copies shared arrays */
+      orxMemory_Copy(au32LinkArray, _pstLinkTable->au32LinkArray, u32ArraySize * sizeof(orxU32));
+      orxMemory_Copy(au8LoopArray, _pstLinkTable->au8LoopArray, u32ArraySize * sizeof(orxU8));
+
+      /* Stores them */
+      _pstLinkTable->au32LinkArray  = au32LinkArray;
+      _pstLinkTable->au8LoopArray   = au8LoopArray;
+
+      /* Releases snapshot */
+      orxAnimSet_ReleaseLinkTableSnapshot(_pstLinkTable->pstSnapshot);
+      _pstLinkTable->pstSnapshot    = orxNULL;
+
+      /* Updates flags */
+      orxAnimSet_SetLinkTableFlag(_pstLinkTable, orxANIMSET_KU32_LINK_TABLE_FLAG_NONE, orxANIMSET_KU32_LINK_TABLE_FLAG_SHARED);
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_ANIM, "Failed to allocate arrays when copying shared link table.");
+
+      /* Frees arrays */
+      if(au32LinkArray != orxNULL)
+      {
+        orxMemory_Free(au32LinkArray);
+      }
+      if(au8LoopArray != orxNULL)
+      {
+        orxMemory_Free(au8LoopArray);
+      }
+
+      /* Updates result */
+      eResult = orxSTATUS_FAILURE;
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
 /** Sets a link value in a link table
  * @param[in]   _pstLinkTable                 Concerned LinkTable
  * @param[in]   _u32Index                     Link index
@@ -317,8 +411,17 @@ static orxINLINE orxSTATUS orxAnimSet_SetLinkTableLink(orxANIMSET_LINK_TABLE *_p
   orxASSERT(_pstLinkTable != orxNULL);
   orxASSERT(_u32Index < (orxU32)(_pstLinkTable->u16TableSize) * (orxU32)(_pstLinkTable->u16TableSize));
 
-  /* Sets link */
-  _pstLinkTable->au32LinkArray[_u32Index] = _u32LinkValue;
+  /* Can write? */
+  if(orxAnimSet_MakeLinkTableWritable(_pstLinkTable) != orxSTATUS_FAILURE)
+  {
+    /* Sets link */
+    _pstLinkTable->au32LinkArray[_u32Index] = _u32LinkValue;
+  }
+  else
+  {
+    /* Updates result */
+    eResult = orxSTATUS_FAILURE;
+  }
 
   /* Done! */
   return eResult;
@@ -342,6 +445,13 @@ static orxINLINE orxSTATUS orxAnimSet_SetLinkTableLinkProperty(orxANIMSET_LINK_T
   /* Has link? */
   if(_pstLinkTable->au32LinkArray[_u32LinkIndex] & orxANIMSET_KU32_LINK_FLAG_LINK)
   {
+    /* Can't write? */
+    if(orxAnimSet_MakeLinkTableWritable(_pstLinkTable) == orxSTATUS_FAILURE)
+    {
+      /* Done! */
+      return orxSTATUS_FAILURE;
+    }
+
     /* Depends on property */
     switch(_u32Property & orxANIMSET_KU32_LINK_MASK_FLAGS)
     {
@@ -894,6 +1004,12 @@ static void orxFASTCALL orxAnimSet_CleanLinkTable(orxANIMSET_LINK_TABLE *_pstLin
   /* Checks anim index */
   orxASSERT(_u32AnimIndex < u32Size);
 
+  /* Can't write? */
+  if(orxAnimSet_MakeLinkTableWritable(_pstLinkTable) == orxSTATUS_FAILURE)
+  {
+    return;
+  }
+
   /* Gets base index */
   u32AnimBaseIndex = _u32AnimIndex * u32Size;
 
@@ -1003,28 +1119,6 @@ static orxANIMSET_LINK_TABLE *orxFASTCALL orxAnimSet_CreateLinkTable(orxU32 _u32
   return pstLinkTable;
 }
 
-/** Copies an AnimSet LinkTable into another one
- * @param[in]   _pstDstLinkTable              Destination LinkTable
- * @param[in]   _pstSrcLinkTable              Source LinkTable
- */
-static orxINLINE void orxAnimSet_CopyLinkTable(orxANIMSET_LINK_TABLE *_pstDstLinkTable, const orxANIMSET_LINK_TABLE *_pstSrcLinkTable)
-{
-  /* Checks */
-  orxASSERT(_pstSrcLinkTable != orxNULL);
-  orxASSERT(_pstDstLinkTable != orxNULL);
-
-  /* Copies all */
-  _pstDstLinkTable->u32Flags       = _pstSrcLinkTable->u32Flags;
-  _pstDstLinkTable->u16LinkCount   = _pstSrcLinkTable->u16LinkCount;
-  _pstDstLinkTable->u16TableSize   = _pstSrcLinkTable->u16TableSize;
-
-  /* Copies tables */
-  orxMemory_Copy(_pstDstLinkTable->au32LinkArray, _pstSrcLinkTable->au32LinkArray, (orxU32)(_pstSrcLinkTable->u16TableSize) * (orxU32)(_pstSrcLinkTable->u16TableSize) * sizeof(orxU32));
-  orxMemory_Copy(_pstDstLinkTable->au8LoopArray, _pstSrcLinkTable->au8LoopArray, (orxU32)(_pstSrcLinkTable->u16TableSize) * (orxU32)(_pstSrcLinkTable->u16TableSize) * sizeof(orxU8));
-
-  return;
-}
-
 /** Sets an AnimSet storage size
  * @param[in]   _pstAnimSet                   Concerned AnimSet
  * @param[in]   _u32Size                      Desired size
@@ -1254,8 +1348,9 @@ static orxSTATUS orxFASTCALL orxAnimSet_ComputeLinkTable(orxANIMSET_LINK_TABLE *
   /* Is link table dirty? */
   if(orxAnimSet_TestLinkTableFlag(_pstLinkTable, orxANIMSET_KU32_LINK_TABLE_FLAG_DIRTY) != orxFALSE)
   {
-    /* Has ready link structure */
-    if(orxAnimSet_TestLinkTableFlag(_pstLinkTable, orxANIMSET_KU32_LINK_TABLE_FLAG_READY) != orxFALSE)
+    /* Has ready link structure and can write? */
+    if((orxAnimSet_TestLinkTableFlag(_pstLinkTable, orxANIMSET_KU32_LINK_TABLE_FLAG_READY) != orxFALSE)
+    && (orxAnimSet_MakeLinkTableWritable(_pstLinkTable) != orxSTATUS_FAILURE))
     {
       orxLINK_UPDATE_INFO  *pstUpdateInfo;
       orxU32                u32Size, i;
@@ -1313,7 +1408,7 @@ static orxSTATUS orxFASTCALL orxAnimSet_ComputeLinkTable(orxANIMSET_LINK_TABLE *
     else
     {
       /* Logs message */
-      orxDEBUG_PRINT(orxDEBUG_LEVEL_ANIM, "Link table does not have a ready link structure.");
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_ANIM, "Link table does not have a ready link structure or couldn't be made writable.");
 
       /* Failed */
       eResult = orxSTATUS_FAILURE;
@@ -2855,28 +2950,62 @@ void orxFASTCALL orxAnimSet_RemoveReference(orxANIMSET *_pstAnimSet)
  */
 orxANIMSET_LINK_TABLE *orxFASTCALL orxAnimSet_CloneLinkTable(const orxANIMSET *_pstAnimSet)
 {
-  orxANIMSET_LINK_TABLE *pstLinkTable;
+  orxANIMSET_LINK_TABLE *pstSource, *pstSnapshot, *pstLinkTable = orxNULL;
 
   /* Checks */
   orxASSERT(sstAnimSet.u32Flags & orxANIMSET_KU32_STATIC_FLAG_READY);
   orxSTRUCTURE_ASSERT(_pstAnimSet);
 
-  /* Creates a new link table */
-  pstLinkTable = orxAnimSet_CreateLinkTable((orxU32)(_pstAnimSet->pstLinkTable->u16TableSize));
+  /* Gets source link table */
+  pstSource = _pstAnimSet->pstLinkTable;
+
+  /* Computes it so that its arrays can be shared as is */
+  orxAnimSet_ComputeLinkTable(pstSource);
+
+  /* Gets its current snapshot */
+  pstSnapshot = pstSource->pstSnapshot;
+
+  /* None? */
+  if(pstSnapshot == orxNULL)
+  {
+    /* Allocates it */
+    pstSnapshot = (orxANIMSET_LINK_TABLE *)orxMemory_Allocate(sizeof(orxANIMSET_LINK_TABLE), orxMEMORY_TYPE_MAIN);
+
+    /* Success? */
+    if(pstSnapshot != orxNULL)
+    {
+      /* Hands source arrays over to it, the source will copy them upon its next write */
+      orxMemory_Copy(pstSnapshot, pstSource, sizeof(orxANIMSET_LINK_TABLE));
+      pstSnapshot->pstSnapshot    = orxNULL;
+      pstSnapshot->u32ShareCount  = 1;
+      pstSource->pstSnapshot      = pstSnapshot;
+      orxAnimSet_SetLinkTableFlag(pstSource, orxANIMSET_KU32_LINK_TABLE_FLAG_SHARED, orxANIMSET_KU32_LINK_TABLE_FLAG_NONE);
+    }
+  }
+
+  /* Valid snapshot? */
+  if(pstSnapshot != orxNULL)
+  {
+    /* Allocates link table header only */
+    pstLinkTable = (orxANIMSET_LINK_TABLE *)orxMemory_Allocate(sizeof(orxANIMSET_LINK_TABLE), orxMEMORY_TYPE_MAIN);
+  }
 
   /* Was allocated? */
   if(pstLinkTable != orxNULL)
   {
-    /* Copies it */
-    orxAnimSet_CopyLinkTable(pstLinkTable, _pstAnimSet->pstLinkTable);
+    /* Shares snapshot arrays until first write */
+    orxMemory_Copy(pstLinkTable, pstSnapshot, sizeof(orxANIMSET_LINK_TABLE));
+    pstLinkTable->pstSnapshot   = pstSnapshot;
+    pstLinkTable->u32ShareCount = 0;
+    orxAnimSet_SetLinkTableFlag(pstLinkTable, orxANIMSET_KU32_LINK_TABLE_FLAG_SHARED, orxANIMSET_KU32_LINK_TABLE_FLAG_NONE);
+
+    /* Updates share count */
+    pstSnapshot->u32ShareCount++;
   }
   else
   {
     /* Logs message */
     orxDEBUG_PRINT(orxDEBUG_LEVEL_ANIM, "Failed to create link table.");
-
-    /* Can't process */
-    pstLinkTable = orxNULL;
   }
 
   /* Done! */
@@ -2892,9 +3021,20 @@ void orxFASTCALL orxAnimSet_DeleteLinkTable(orxANIMSET_LINK_TABLE *_pstLinkTable
   orxASSERT(sstAnimSet.u32Flags & orxANIMSET_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstLinkTable != orxNULL);
 
+  /* Shares its arrays? */
+  if(orxAnimSet_TestLinkTableFlag(_pstLinkTable, orxANIMSET_KU32_LINK_TABLE_FLAG_SHARED) != orxFALSE)
+  {
+    /* Releases snapshot */
+    orxAnimSet_ReleaseLinkTableSnapshot(_pstLinkTable->pstSnapshot);
+  }
+  else
+  {
+    /* Frees them */
+    orxMemory_Free(_pstLinkTable->au32LinkArray);
+    orxMemory_Free(_pstLinkTable->au8LoopArray);
+  }
+
   /* Frees memory*/
-  orxMemory_Free(_pstLinkTable->au32LinkArray);
-  orxMemory_Free(_pstLinkTable->au8LoopArray);
   orxMemory_Free(_pstLinkTable);
 
   return;
@@ -75,10 +75,12 @@ static orxINLINE void orxModule_RegisterAll()
   orxMODULE_REGISTER(MOUSE, orxMouse);
   orxMODULE_REGISTER(OBJECT, orxObject);
   orxMODULE_REGISTER(PARAM, orxParam);
+  orxMODULE_REGISTER(PARTICLESYSTEM, orxParticleSystem);
   orxMODULE_REGISTER(PHYSICS, orxPhysics);
   orxMODULE_REGISTER(PLUGIN, orxPlugin);
   orxMODULE_REGISTER(PROFILER, orxProfiler);
   orxMODULE_REGISTER(RENDER, orxRender);
+  orxMODULE_REGISTER(REPLAY, orxReplay);
   orxMODULE_REGISTER(RESOURCE, orxResource);
   orxMODULE_REGISTER(SCREENSHOT, orxScreenshot);
   orxMODULE_REGISTER(SHADER, orxShader);
@@ -93,6 +95,7 @@ static orxINLINE void orxModule_RegisterAll()
   orxMODULE_REGISTER(TEXT, orxText);
   orxMODULE_REGISTER(TEXTURE, orxTexture);
   orxMODULE_REGISTER(THREAD, orxThread);
+  orxMODULE_REGISTER(TILEMAP, orxTileMap);
   orxMODULE_REGISTER(TIMELINE, orxTimeLine);
   orxMODULE_REGISTER(VIEWPORT, orxViewport);
 
@@ -36,6 +36,7 @@
 #include "core/orxCommand.h"
 #include "core/orxConfig.h"
 #include "core/orxEvent.h"
+#include "core/orxReplay.h"
 #include "memory/orxBank.h"
 #include "memory/orxMemory.h"
 #include "math/orxMath.h"
@@ -615,6 +616,9 @@ orxSTATUS orxFASTCALL orxClock_Update()
     /* Computes natural DT */
     fDT       = (orxFLOAT)(dNewTime - sstClock.dTime);
 
+    /* Records it or gets the played back one */
+    fDT       = orxReplay_ProcessDT(fDT);
+
     /* Gets modified DT */
     fDT       = orxClock_ComputeDT(fDT, orxNULL);
 
@@ -734,8 +738,8 @@ orxSTATUS orxFASTCALL orxClock_Update()
     /* Gets real remaining delay */
     fDelay = fDelay + orxCLOCK_KF_DELAY_ADJUSTMENT - orx2F(orxSystem_GetTime() - sstClock.dTime);
 
-    /* Should delay? */
-    if(fDelay > orxFLOAT_0)
+    /* Should delay and not playing back? */
+    if((fDelay > orxFLOAT_0) && (orxReplay_IsPlaying() == orxFALSE))
     {
       /* Waits for next time slice */
       orxSystem_Delay(fDelay);
@@ -2162,6 +2162,171 @@ void orxFASTCALL orxCommand_CommandLogAllStructures(orxU32 _u32ArgNumber, const
   return;
 }
 
+/** Command: EnableProfilerTrace
+ */
+void orxFASTCALL orxCommand_CommandEnableProfilerTrace(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+{
+  /* Enables/disables trace recording */
+  orxProfiler_EnableTrace(((_u32ArgNumber == 0) || (_astArgList[0].bValue != orxFALSE)) ? orxTRUE : orxFALSE);
+
+  /* Updates result */
+  _pstResult->bValue = orxProfiler_IsTraceEnabled();
+
+  /* Done! */
+  return;
+}
+
+/** Command: DumpProfilerTrace
+ */
+void orxFASTCALL orxCommand_CommandDumpProfilerTrace(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+{
+  orxSTATUS eResult;
+
+  /* Dumps trace */
+  eResult = orxProfiler_DumpTrace((_u32ArgNumber > 0) ? _astArgList[0].zValue : orxNULL);
+
+  /* Updates result */
+  _pstResult->bValue = (eResult != orxSTATUS_FAILURE) ? orxTRUE : orxFALSE;
+
+  /* Done! */
+  return;
+}
+
+/** Command: StartProfilerSampling
+ */
+void orxFASTCALL orxCommand_CommandStartProfilerSampling(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+{
+  orxSTATUS eResult;
+
+  /* Starts sampling */
+  eResult = orxProfiler_StartSampling((_u32ArgNumber > 0) ? _astArgList[0].u32Value : 0);
+
+  /* Updates result */
+  _pstResult->bValue = (eResult != orxSTATUS_FAILURE) ? orxTRUE : orxFALSE;
+
+  /* Done! */
+  return;
+}
+
+/** Command: StopProfilerSampling
+ */
+void orxFASTCALL orxCommand_CommandStopProfilerSampling(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+{
+  /* Updates result */
+  _pstResult->bValue = orxProfiler_IsSampling();
+
+  /* Stops sampling */
+  orxProfiler_StopSampling();
+
+  /* Done! */
+  return;
+}
+
+/** Command: DumpProfilerSamples
+ */
+void orxFASTCALL orxCommand_CommandDumpProfilerSamples(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+{
+  orxSTATUS eResult;
+
+  /* Dumps samples */
+  eResult = orxProfiler_DumpSamples((_u32ArgNumber > 0) ? _astArgList[0].zValue : orxNULL);
+
+  /* Updates result */
+  _pstResult->bValue = (eResult != orxSTATUS_FAILURE) ? orxTRUE : orxFALSE;
+
+  /* Done! */
+  return;
+}
+
+/** Command: SetProfilerBudget
+ */
+void orxFASTCALL orxCommand_CommandSetProfilerBudget(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+{
+  /* Sets frame budget */
+  orxProfiler_SetFrameBudget((orxDOUBLE)orxMAX(_astArgList[0].fValue, orxFLOAT_0), (_u32ArgNumber > 1) ? _astArgList[1].u32Value : orxPROFILER_KU32_BUDGET_DEFAULT_HISTORY);
+
+  /* Updates result */
+  _pstResult->fValue = _astArgList[0].fValue;
+
+  /* Done! */
+  return;
+}
+
+/** Command: LogProfilerStats
+ */
+void orxFASTCALL orxCommand_CommandLogProfilerStats(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+{
+  /* Logs frame stats */
+  orxProfiler_LogFrameStats();
+
+  /* Resets them? */
+  if((_u32ArgNumber > 0) && (_astArgList[0].bValue != orxFALSE))
+  {
+    /* Resets them */
+    orxProfiler_ResetFrameStats();
+  }
+
+  /* Updates result */
+  _pstResult->fValue = (orxFLOAT)(orxProfiler_GetFramePercentile(orx2F(99.0f)) * orx2D(1000.0));
+
+  /* Done! */
+  return;
+}
+
+/** Command: StartProfilerCostReport
+ */
+void orxFASTCALL orxCommand_CommandStartProfilerCostReport(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+{
+  /* Updates result */
+  _pstResult->bValue = (orxProfiler_StartCostReport() != orxSTATUS_FAILURE) ? orxTRUE : orxFALSE;
+
+  /* Done! */
+  return;
+}
+
+/** Command: StopProfilerCostReport
+ */
+void orxFASTCALL orxCommand_CommandStopProfilerCostReport(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+{
+  /* Updates result */
+  _pstResult->bValue = (orxProfiler_StopCostReport((_u32ArgNumber > 0) ? _astArgList[0].zValue : orxNULL) != orxSTATUS_FAILURE) ? orxTRUE : orxFALSE;
+
+  /* Done! */
+  return;
+}
+
+/** Command: EnableEventProfiling
+ */
+void orxFASTCALL orxCommand_CommandEnableEventProfiling(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+{
+  /* Updates result */
+  _pstResult->bValue = (orxEvent_EnableProfiling((_u32ArgNumber > 0) ? _astArgList[0].bValue : orxTRUE) != orxSTATUS_FAILURE) ? orxTRUE : orxFALSE;
+
+  /* Done! */
+  return;
+}
+
+/** Command: LogEventStats
+ */
+void orxFASTCALL orxCommand_CommandLogEventStats(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+{
+  /* Updates result */
+  _pstResult->u32Value = orxEvent_GetHandlerStatsCount();
+
+  /* Logs handler stats */
+  orxEvent_LogHandlerStats((_u32ArgNumber > 0) ? _astArgList[0].u32Value : 0);
+
+  /* Resets them? */
+  if((_u32ArgNumber > 1) && (_astArgList[1].bValue != orxFALSE))
+  {
+    /* Resets them */
+    orxEvent_ResetHandlerStats();
+  }
+
+  /* Done! */
+  return;
+}
+
 /** Registers all the command commands
  */
 static orxINLINE void orxCommand_RegisterCommands()
@@ -2241,6 +2406,30 @@ static orxINLINE void orxCommand_RegisterCommands()
   /* Command: LogAllStructures */
   orxCOMMAND_REGISTER_CORE_COMMAND(Command, LogAllStructures, "Success?", orxCOMMAND_VAR_TYPE_BOOL, 0, 0);
 
+  /* Command: EnableProfilerTrace */
+  orxCOMMAND_REGISTER_CORE_COMMAND(Command, EnableProfilerTrace, "Enabled?", orxCOMMAND_VAR_TYPE_BOOL, 0, 1, {"Enable = true", orxCOMMAND_VAR_TYPE_BOOL});
+  /* Command: DumpProfilerTrace */
+  orxCOMMAND_REGISTER_CORE_COMMAND(Command, DumpProfilerTrace, "Success?", orxCOMMAND_VAR_TYPE_BOOL, 0, 1, {"File = orxtrace.json", orxCOMMAND_VAR_TYPE_STRING});
+
+  /* Command: StartProfilerSampling */
+  orxCOMMAND_REGISTER_CORE_COMMAND(Command, StartProfilerSampling, "Success?", orxCOMMAND_VAR_TYPE_BOOL, 0, 1, {"Frequency = 1000", orxCOMMAND_VAR_TYPE_U32});
+  /* Command: StopProfilerSampling */
+  orxCOMMAND_REGISTER_CORE_COMMAND(Command, StopProfilerSampling, "Stopped?", orxCOMMAND_VAR_TYPE_BOOL, 0, 0);
+  /* Command: DumpProfilerSamples */
+  orxCOMMAND_REGISTER_CORE_COMMAND(Command, DumpProfilerSamples, "Success?", orxCOMMAND_VAR_TYPE_BOOL, 0, 1, {"File = orxsamples.txt", orxCOMMAND_VAR_TYPE_STRING});
+  /* Command: SetProfilerBudget */
+  orxCOMMAND_REGISTER_CORE_COMMAND(Command, SetProfilerBudget, "Budget", orxCOMMAND_VAR_TYPE_FLOAT, 1, 1, {"Budget", orxCOMMAND_VAR_TYPE_FLOAT}, {"History = 10", orxCOMMAND_VAR_TYPE_U32});
+  /* Command: LogProfilerStats */
+  orxCOMMAND_REGISTER_CORE_COMMAND(Command, LogProfilerStats, "P99 (ms)", orxCOMMAND_VAR_TYPE_FLOAT, 0, 1, {"Reset = false", orxCOMMAND_VAR_TYPE_BOOL});
+  /* Command: StartProfilerCostReport */
+  orxCOMMAND_REGISTER_CORE_COMMAND(Command, StartProfilerCostReport, "Success?", orxCOMMAND_VAR_TYPE_BOOL, 0, 0);
+  /* Command: StopProfilerCostReport */
+  orxCOMMAND_REGISTER_CORE_COMMAND(Command, StopProfilerCostReport, "Success?", orxCOMMAND_VAR_TYPE_BOOL, 0, 1, {"File = orxcosts.txt", orxCOMMAND_VAR_TYPE_STRING});
+  /* Command: EnableEventProfiling */
+  orxCOMMAND_REGISTER_CORE_COMMAND(Command, EnableEventProfiling, "Success?", orxCOMMAND_VAR_TYPE_BOOL, 0, 1, {"Enable = true", orxCOMMAND_VAR_TYPE_BOOL});
+  /* Command: LogEventStats */
+  orxCOMMAND_REGISTER_CORE_COMMAND(Command, LogEventStats, "Count", orxCOMMAND_VAR_TYPE_U32, 0, 2, {"Max = 0 (all)", orxCOMMAND_VAR_TYPE_U32}, {"Reset = false", orxCOMMAND_VAR_TYPE_BOOL});
+
   /* Alias: Help */
   orxCommand_AddAlias("Help", "Command.Help", orxNULL);
   orxCommand_AddAlias("?", "Command.Help", orxNULL);
@@ -2529,6 +2718,30 @@ static orxINLINE void orxCommand_UnregisterCommands()
 
   /* Command: LogAllStructures */
   orxCOMMAND_UNREGISTER_CORE_COMMAND(Command, LogAllStructures);
+
+  /* Command: EnableProfilerTrace */
+  orxCOMMAND_UNREGISTER_CORE_COMMAND(Command, EnableProfilerTrace);
+  /* Command: DumpProfilerTrace */
+  orxCOMMAND_UNREGISTER_CORE_COMMAND(Command, DumpProfilerTrace);
+
+  /* Command: StartProfilerSampling */
+  orxCOMMAND_UNREGISTER_CORE_COMMAND(Command, StartProfilerSampling);
+  /* Command: StopProfilerSampling */
+  orxCOMMAND_UNREGISTER_CORE_COMMAND(Command, StopProfilerSampling);
+  /* Command: DumpProfilerSamples */
+  orxCOMMAND_UNREGISTER_CORE_COMMAND(Command, DumpProfilerSamples);
+  /* Command: SetProfilerBudget */
+  orxCOMMAND_UNREGISTER_CORE_COMMAND(Command, SetProfilerBudget);
+  /* Command: LogProfilerStats */
+  orxCOMMAND_UNREGISTER_CORE_COMMAND(Command, LogProfilerStats);
+  /* Command: StartProfilerCostReport */
+  orxCOMMAND_UNREGISTER_CORE_COMMAND(Command, StartProfilerCostReport);
+  /* Command: StopProfilerCostReport */
+  orxCOMMAND_UNREGISTER_CORE_COMMAND(Command, StopProfilerCostReport);
+  /* Command: EnableEventProfiling */
+  orxCOMMAND_UNREGISTER_CORE_COMMAND(Command, EnableEventProfiling);
+  /* Command: LogEventStats */
+  orxCOMMAND_UNREGISTER_CORE_COMMAND(Command, LogEventStats);
 }
 
 /***************************************************************************
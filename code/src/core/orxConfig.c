@@ -36,6 +36,7 @@
 #include "core/orxCommand.h"
 #include "core/orxEvent.h"
 #include "core/orxResource.h"
+#include "core/orxSystem.h"
 #include "debug/orxDebug.h"
 #include "debug/orxProfiler.h"
 #include "memory/orxBank.h"
@@ -1224,14 +1225,29 @@ static orxINLINE orxCONFIG_VALUE *orxConfig_GetValue(const orxSTRING _zKey)
   if((_zKey != orxSTRING_EMPTY) && (_zKey != orxNULL))
   {
     orxCONFIG_SECTION  *pstDummy = orxNULL;
+    orxDOUBLE           dCostTime = orxDOUBLE_0;
     orxU32              u32ID;
 
     /* Gets its ID */
     u32ID = orxString_ToCRC(_zKey);
 
+    /* Recording costs? */
+    if(orxProfiler_IsRecordingCosts() != orxFALSE)
+    {
+      /* Gets start time */
+      dCostTime = orxSystem_GetTime();
+    }
+
     /* Gets value */
     pstResult = orxConfig_GetValueFromKey(u32ID, sstConfig.pstCurrentSection, &pstDummy);
 
+    /* Was resolved through inheritance while recording costs? */
+    if((dCostTime != orxDOUBLE_0) && (pstDummy != sstConfig.pstCurrentSection))
+    {
+      /* Adds its cost to the section */
+      orxProfiler_AddCost(orxPROFILER_COST_CONFIG_INHERITANCE, sstConfig.pstCurrentSection->zName, orxSystem_GetTime() - dCostTime);
+    }
+
 #ifdef __orxDEBUG__
 
     /* Not found? */
@@ -3666,7 +3682,7 @@ orxSTATUS orxFASTCALL orxConfig_Init()
     sstConfig.pstSectionBank  = orxBank_Create(orxCONFIG_KU32_SECTION_BANK_SIZE, sizeof(orxCONFIG_SECTION), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_CONFIG);
     sstConfig.pstEntryBank    = orxBank_Create(orxCONFIG_KU32_ENTRY_BANK_SIZE, sizeof(orxCONFIG_ENTRY), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_CONFIG);
 
-    sstConfig.pstSectionTable = orxHashTable_Create(orxCONFIG_KU32_SECTION_BANK_SIZE, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_CONFIG);
+    sstConfig.pstSectionTable = orxHashTable_Create(orxCONFIG_KU32_SECTION_BANK_SIZE, orxHASHTABLE_KU32_FLAG_OPEN_ADDRESSING, orxMEMORY_TYPE_CONFIG);
 
     /* Valid? */
     if((sstConfig.pstStackBank != orxNULL) && (sstConfig.pstHistoryBank != orxNULL) && (sstConfig.pstSectionBank != orxNULL) && (sstConfig.pstEntryBank != orxNULL) && (sstConfig.pstSectionTable != orxNULL))
@@ -4017,6 +4033,9 @@ orxSTATUS orxFASTCALL orxConfig_Load(const orxSTRING _zFileName)
   /* Updates load count */
   sstConfig.u32LoadCount++;
 
+  /* Records cost */
+  orxProfiler_PushCost(orxPROFILER_COST_CONFIG_FILE, _zFileName);
+
   /* Stores previously loaded file */
   u32PreviousLoadFileID = sstConfig.u32LoadFileID;
 
@@ -4151,6 +4170,9 @@ orxSTATUS orxFASTCALL orxConfig_Load(const orxSTRING _zFileName)
   /* Restores previously loading file */
   sstConfig.u32LoadFileID = u32PreviousLoadFileID;
 
+  /* Ends cost record */
+  orxProfiler_PopCost();
+
   /* Updates load count */
   sstConfig.u32LoadCount--;
 
@@ -33,12 +33,26 @@
 #include "orxInclude.h"
 
 #include "core/orxEvent.h"
+#include "core/orxSystem.h"
 #include "core/orxThread.h"
 #include "debug/orxDebug.h"
 #include "debug/orxProfiler.h"
 #include "memory/orxBank.h"
 #include "utils/orxHashTable.h"
 #include "utils/orxLinkList.h"
+#include "utils/orxString.h"
+
+#ifdef __orxPROFILER__
+
+  #include <stdlib.h>
+
+  #ifdef __orxLINUX__
+
+    #include <dlfcn.h>
+
+  #endif /* __orxLINUX__ */
+
+#endif /* __orxPROFILER__ */
 
 
 /** Module flags
@@ -46,6 +60,8 @@
 #define orxEVENT_KU32_STATIC_FLAG_NONE    0x00000000  /**< No flags */
 
 #define orxEVENT_KU32_STATIC_FLAG_READY   0x00000001  /**< Ready flag */
+#define orxEVENT_KU32_STATIC_FLAG_PROFILING 0x00000002  /**< Profiling flag */
+#define orxEVENT_KU32_STATIC_FLAG_SORTED  0x00000004  /**< Sorted stats flag */
 
 #define orxEVENT_KU32_STATIC_MASK_ALL     0xFFFFFFFF  /**< All mask */
 
@@ -56,6 +72,9 @@
 #define orxEVENT_KU32_HANDLER_BANK_SIZE   32
 #define orxEVENT_KU32_STORAGE_BANK_SIZE   32
 
+#define orxEVENT_KU32_STATS_ENTRY_NUMBER  1024        /**< Handler stats table size, power of 2 */
+#define orxEVENT_KU32_STATS_NAME_LENGTH   64
+
 
 /***************************************************************************
  * Structure declaration                                                   *
@@ -80,6 +99,20 @@ typedef struct __orxEVENT_HANDLER_STORAGE_t
 
 } orxEVENT_HANDLER_STORAGE;
 
+#ifdef __orxPROFILER__
+
+/** Handler stats entry
+ */
+typedef struct __orxEVENT_STATS_ENTRY_t
+{
+  orxEVENT_HANDLER_STATS    stStats;
+  orxS32                    s32MarkerID;
+  orxCHAR                   acName[orxEVENT_KU32_STATS_NAME_LENGTH];
+
+} orxEVENT_STATS_ENTRY;
+
+#endif /* __orxPROFILER__ */
+
 /** Static structure
  */
 typedef struct __orxEVENT_STATIC_t
@@ -90,6 +123,15 @@ typedef struct __orxEVENT_STATIC_t
   orxBANK                  *pstHandlerStorageBank;    /**< Handler storage bank */
   orxEVENT_HANDLER_STORAGE *astCoreHandlerStorageList[orxEVENT_TYPE_CORE_NUMBER]; /**< Core handler storage list */
 
+#ifdef __orxPROFILER__
+
+  orxEVENT_STATS_ENTRY     *astStatsEntryList;        /**< Handler stats table */
+  orxEVENT_STATS_ENTRY    **apstSortedStatsList;      /**< Sorted handler stats list */
+  orxU32                    u32StatsEntryCount;       /**< Handler stats entry count */
+  orxU32                    u32StatsLostCount;        /**< Handler stats lost count (table full) */
+
+#endif /* __orxPROFILER__ */
+
 } orxEVENT_STATIC;
 
 
@@ -104,6 +146,207 @@ static orxEVENT_STATIC sstEvent;
  * Private functions                                                       *
  ***************************************************************************/
 
+#ifdef __orxPROFILER__
+
+static orxEVENT_STATS_ENTRY *orxFASTCALL orxEvent_GetStatsEntry(orxEVENT_TYPE _eType, orxENUM _eID, orxEVENT_HANDLER _pfnHandler)
+{
+  orxEVENT_STATS_ENTRY *pstResult = orxNULL;
+  orxU32                u32Index, i;
+
+  /* Gets start index */
+  u32Index = (((orxU32)((size_t)_pfnHandler >> 2) * 2654435761u) ^ ((orxU32)_eType << 16) ^ (orxU32)_eID) & (orxEVENT_KU32_STATS_ENTRY_NUMBER - 1);
+
+  /* For all entries, starting from index */
+  for(i = 0; i < orxEVENT_KU32_STATS_ENTRY_NUMBER; i++, u32Index = (u32Index + 1) & (orxEVENT_KU32_STATS_ENTRY_NUMBER - 1))
+  {
+    orxEVENT_STATS_ENTRY *pstEntry;
+
+    /* Gets it */
+    pstEntry = &(sstEvent.astStatsEntryList[u32Index]);
+
+    /* Free? */
+    if(pstEntry->stStats.pfnHandler == orxNULL)
+    {
+      /* Not too full? */
+      if(sstEvent.u32StatsEntryCount < (orxEVENT_KU32_STATS_ENTRY_NUMBER * 3) / 4)
+      {
+        orxCHAR acMarkerName[orxEVENT_KU32_STATS_NAME_LENGTH + 32];
+
+#ifdef __orxLINUX__
+
+        Dl_info stInfo;
+
+        /* Finds its symbol */
+        if((dladdr((void *)_pfnHandler, &stInfo) != 0) && (stInfo.dli_sname != NULL))
+        {
+          /* Stores it */
+          orxString_NPrint(pstEntry->acName, orxEVENT_KU32_STATS_NAME_LENGTH - 1, "%s", stInfo.dli_sname);
+        }
+        else
+
+#endif /* __orxLINUX__ */
+
+        {
+          /* Stores address */
+          orxString_NPrint(pstEntry->acName, orxEVENT_KU32_STATS_NAME_LENGTH - 1, "%p", (void *)_pfnHandler);
+        }
+
+        /* Inits it */
+        pstEntry->stStats.pfnHandler  = _pfnHandler;
+        pstEntry->stStats.zName       = pstEntry->acName;
+        pstEntry->stStats.eType       = _eType;
+        pstEntry->stStats.eID         = _eID;
+
+        /* Gets its profiler marker */
+        orxString_NPrint(acMarkerName, sizeof(acMarkerName) - 1, "Event %u:%u %s", (orxU32)_eType, (orxU32)_eID, pstEntry->acName);
+        pstEntry->s32MarkerID = orxProfiler_GetIDFromName(acMarkerName);
+
+        /* Updates count */
+        sstEvent.u32StatsEntryCount++;
+
+        /* Updates result */
+        pstResult = pstEntry;
+      }
+      else
+      {
+        /* Updates lost count */
+        sstEvent.u32StatsLostCount++;
+      }
+
+      break;
+    }
+    /* Found? */
+    else if((pstEntry->stStats.pfnHandler == _pfnHandler)
+         && (pstEntry->stStats.eType == _eType)
+         && (pstEntry->stStats.eID == _eID))
+    {
+      /* Updates result */
+      pstResult = pstEntry;
+
+      break;
+    }
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+static orxSTATUS orxFASTCALL orxEvent_SendProfiled(orxEVENT *_pstEvent, orxEVENT_HANDLER_STORAGE *_pstStorage)
+{
+  orxEVENT_HANDLER_INFO  *pstInfo;
+  orxSTATUS               eResult = orxSTATUS_SUCCESS;
+
+  /* For all handlers */
+  for(pstInfo = (orxEVENT_HANDLER_INFO *)orxLinkList_GetFirst(&(_pstStorage->stList));
+      pstInfo != orxNULL;
+      pstInfo = (orxEVENT_HANDLER_INFO *)orxLinkList_GetNext(&(pstInfo->stNode)))
+  {
+    orxEVENT_STATS_ENTRY *pstEntry;
+    orxDOUBLE             dTime;
+    orxSTATUS             eHandlerResult;
+
+    /* Stores context */
+    _pstEvent->pContext = pstInfo->pContext;
+
+    /* Gets stats entry */
+    pstEntry = orxEvent_GetStatsEntry(_pstEvent->eType, _pstEvent->eID, pstInfo->pfnHandler);
+
+    /* Has marker? */
+    if((pstEntry != orxNULL) && (pstEntry->s32MarkerID != orxPROFILER_KS32_MARKER_ID_NONE))
+    {
+      /* Pushes it */
+      orxProfiler_PushMarker(pstEntry->s32MarkerID);
+    }
+
+    /* Calls it */
+    dTime           = orxSystem_GetTime();
+    eHandlerResult  = (pstInfo->pfnHandler)(_pstEvent);
+    dTime           = orxSystem_GetTime() - dTime;
+
+    /* Valid? */
+    if(pstEntry != orxNULL)
+    {
+      /* Has marker? */
+      if(pstEntry->s32MarkerID != orxPROFILER_KS32_MARKER_ID_NONE)
+      {
+        /* Pops it */
+        orxProfiler_PopMarker();
+      }
+
+      /* Updates stats */
+      pstEntry->stStats.dTotalTime += dTime;
+      pstEntry->stStats.u32CallCount++;
+      if(dTime > pstEntry->stStats.dMaxTime)
+      {
+        pstEntry->stStats.dMaxTime = dTime;
+      }
+
+      /* Updates status */
+      orxFLAG_SET(sstEvent.u32Flags, orxEVENT_KU32_STATIC_FLAG_NONE, orxEVENT_KU32_STATIC_FLAG_SORTED);
+    }
+
+    /* Failed? */
+    if(eHandlerResult == orxSTATUS_FAILURE)
+    {
+      /* Updates result */
+      eResult = orxSTATUS_FAILURE;
+
+      break;
+    }
+  }
+
+  /* Clears context */
+  _pstEvent->pContext = orxNULL;
+
+  /* Done! */
+  return eResult;
+}
+
+static int orxEvent_CompareStatsEntries(const void *_pElement1, const void *_pElement2)
+{
+  const orxEVENT_STATS_ENTRY *pstEntry1, *pstEntry2;
+
+  /* Gets entries */
+  pstEntry1 = *(const orxEVENT_STATS_ENTRY **)_pElement1;
+  pstEntry2 = *(const orxEVENT_STATS_ENTRY **)_pElement2;
+
+  /* Done! */
+  return (pstEntry1->stStats.dTotalTime != pstEntry2->stStats.dTotalTime)
+         ? ((pstEntry1->stStats.dTotalTime < pstEntry2->stStats.dTotalTime) ? 1 : -1)
+         : 0;
+}
+
+static void orxFASTCALL orxEvent_SortStatsEntries()
+{
+  /* Not sorted? */
+  if(!orxFLAG_TEST(sstEvent.u32Flags, orxEVENT_KU32_STATIC_FLAG_SORTED))
+  {
+    orxU32 i, u32Count;
+
+    /* For all entries */
+    for(i = 0, u32Count = 0; i < orxEVENT_KU32_STATS_ENTRY_NUMBER; i++)
+    {
+      /* Used? */
+      if(sstEvent.astStatsEntryList[i].stStats.pfnHandler != orxNULL)
+      {
+        /* Stores it */
+        sstEvent.apstSortedStatsList[u32Count++] = &(sstEvent.astStatsEntryList[i]);
+      }
+    }
+
+    /* Sorts them */
+    qsort(sstEvent.apstSortedStatsList, (size_t)u32Count, sizeof(orxEVENT_STATS_ENTRY *), &orxEvent_CompareStatsEntries);
+
+    /* Updates status */
+    orxFLAG_SET(sstEvent.u32Flags, orxEVENT_KU32_STATIC_FLAG_SORTED, orxEVENT_KU32_STATIC_FLAG_NONE);
+  }
+
+  /* Done! */
+  return;
+}
+
+#endif /* __orxPROFILER__ */
+
 
 /***************************************************************************
  * Public functions                                                        *
@@ -117,6 +360,7 @@ void orxFASTCALL orxEvent_Setup()
   orxModule_AddDependency(orxMODULE_ID_EVENT, orxMODULE_ID_MEMORY);
   orxModule_AddDependency(orxMODULE_ID_EVENT, orxMODULE_ID_BANK);
   orxModule_AddDependency(orxMODULE_ID_EVENT, orxMODULE_ID_PROFILER);
+  orxModule_AddDependency(orxMODULE_ID_EVENT, orxMODULE_ID_SYSTEM);
   orxModule_AddDependency(orxMODULE_ID_EVENT, orxMODULE_ID_THREAD);
 
   /* Done! */
@@ -201,6 +445,20 @@ void orxFASTCALL orxEvent_Exit()
     /* Deletes bank */
     orxBank_Delete(sstEvent.pstHandlerStorageBank);
 
+#ifdef __orxPROFILER__
+
+    /* Has handler stats? */
+    if(sstEvent.astStatsEntryList != orxNULL)
+    {
+      /* Frees them */
+      orxMemory_Free(sstEvent.astStatsEntryList);
+      orxMemory_Free(sstEvent.apstSortedStatsList);
+      sstEvent.astStatsEntryList    = orxNULL;
+      sstEvent.apstSortedStatsList  = orxNULL;
+    }
+
+#endif /* __orxPROFILER__ */
+
     /* Updates flags */
     orxFLAG_SET(sstEvent.u32Flags, orxEVENT_KU32_STATIC_FLAG_NONE, orxEVENT_KU32_STATIC_MASK_ALL);
   }
@@ -426,6 +684,19 @@ orxSTATUS orxFASTCALL orxEvent_Send(orxEVENT *_pstEvent)
     {
       orxEVENT_HANDLER_INFO *pstInfo;
 
+#ifdef __orxPROFILER__
+
+      /* Profiling on main thread? */
+      if((orxFLAG_TEST(sstEvent.u32Flags, orxEVENT_KU32_STATIC_FLAG_PROFILING))
+      && (orxThread_GetCurrent() == orxTHREAD_KU32_MAIN_THREAD_ID))
+      {
+        /* Sends it with handler profiling */
+        eResult = orxEvent_SendProfiled(_pstEvent, pstStorage);
+      }
+      else
+
+#endif /* __orxPROFILER__ */
+
       /* For all handlers */
       for(pstInfo = (orxEVENT_HANDLER_INFO *)orxLinkList_GetFirst(&(pstStorage->stList));
           pstInfo != orxNULL;
@@ -501,3 +772,224 @@ orxBOOL orxFASTCALL orxEvent_IsSending()
   /* Done! */
   return bResult;
 }
+
+/** Enables/disables handler profiling (main thread only, requires a build with __orxPROFILER__): each handler call is then timed, counted per event type, event ID & handler, and pushed as its own profiler marker
+ * @param[in] _bEnable              Enable / disable
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxEvent_EnableProfiling(orxBOOL _bEnable)
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstEvent.u32Flags, orxEVENT_KU32_STATIC_FLAG_READY));
+
+#ifdef __orxPROFILER__
+
+  /* Enable? */
+  if(_bEnable != orxFALSE)
+  {
+    /* No table yet? */
+    if(sstEvent.astStatsEntryList == orxNULL)
+    {
+      /* Allocates tables */
+      sstEvent.astStatsEntryList    = (orxEVENT_STATS_ENTRY *)orxMemory_Allocate(orxEVENT_KU32_STATS_ENTRY_NUMBER * sizeof(orxEVENT_STATS_ENTRY), orxMEMORY_TYPE_DEBUG);
+      sstEvent.apstSortedStatsList  = (orxEVENT_STATS_ENTRY **)orxMemory_Allocate(orxEVENT_KU32_STATS_ENTRY_NUMBER * sizeof(orxEVENT_STATS_ENTRY *), orxMEMORY_TYPE_DEBUG);
+
+      /* Valid? */
+      if((sstEvent.astStatsEntryList != orxNULL) && (sstEvent.apstSortedStatsList != orxNULL))
+      {
+        /* Clears stats */
+        orxMemory_Zero(sstEvent.astStatsEntryList, orxEVENT_KU32_STATS_ENTRY_NUMBER * sizeof(orxEVENT_STATS_ENTRY));
+        sstEvent.u32StatsEntryCount = 0;
+        sstEvent.u32StatsLostCount  = 0;
+      }
+      else
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Can't allocate event handler stats table.");
+
+        /* Frees tables */
+        if(sstEvent.astStatsEntryList != orxNULL)
+        {
+          orxMemory_Free(sstEvent.astStatsEntryList);
+          sstEvent.astStatsEntryList = orxNULL;
+        }
+        if(sstEvent.apstSortedStatsList != orxNULL)
+        {
+          orxMemory_Free(sstEvent.apstSortedStatsList);
+          sstEvent.apstSortedStatsList = orxNULL;
+        }
+      }
+    }
+
+    /* Valid? */
+    if(sstEvent.astStatsEntryList != orxNULL)
+    {
+      /* Updates status */
+      orxFLAG_SET(sstEvent.u32Flags, orxEVENT_KU32_STATIC_FLAG_PROFILING, orxEVENT_KU32_STATIC_FLAG_SORTED);
+
+      /* Updates result */
+      eResult = orxSTATUS_SUCCESS;
+    }
+  }
+  else
+  {
+    /* Updates status */
+    orxFLAG_SET(sstEvent.u32Flags, orxEVENT_KU32_STATIC_FLAG_NONE, orxEVENT_KU32_STATIC_FLAG_PROFILING);
+
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
+
+#else /* __orxPROFILER__ */
+
+  /* Enable? */
+  if(_bEnable != orxFALSE)
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Event handler profiling requires a build with __orxPROFILER__.");
+  }
+  else
+  {
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
+
+#endif /* __orxPROFILER__ */
+
+  /* Done! */
+  return eResult;
+}
+
+/** Is handler profiling enabled?
+ * @return orxTRUE / orxFALSE
+ */
+orxBOOL orxFASTCALL orxEvent_IsProfilingEnabled()
+{
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstEvent.u32Flags, orxEVENT_KU32_STATIC_FLAG_READY));
+
+  /* Done! */
+  return orxFLAG_TEST(sstEvent.u32Flags, orxEVENT_KU32_STATIC_FLAG_PROFILING) ? orxTRUE : orxFALSE;
+}
+
+/** Gets handler stats count
+ * @return Number of recorded (event type, event ID, handler) entries
+ */
+orxU32 orxFASTCALL orxEvent_GetHandlerStatsCount()
+{
+  orxU32 u32Result = 0;
+
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstEvent.u32Flags, orxEVENT_KU32_STATIC_FLAG_READY));
+
+#ifdef __orxPROFILER__
+
+  /* Updates result */
+  u32Result = sstEvent.u32StatsEntryCount;
+
+#endif /* __orxPROFILER__ */
+
+  /* Done! */
+  return u32Result;
+}
+
+/** Gets handler stats, sorted by decreasing total time
+ * @param[in] _u32Index             Index of the entry, in [0, orxEvent_GetHandlerStatsCount()[
+ * @return orxEVENT_HANDLER_STATS / orxNULL, only valid until next handler call or reset
+ */
+const orxEVENT_HANDLER_STATS *orxFASTCALL orxEvent_GetHandlerStats(orxU32 _u32Index)
+{
+  const orxEVENT_HANDLER_STATS *pstResult = orxNULL;
+
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstEvent.u32Flags, orxEVENT_KU32_STATIC_FLAG_READY));
+
+#ifdef __orxPROFILER__
+
+  /* Valid? */
+  if(_u32Index < sstEvent.u32StatsEntryCount)
+  {
+    /* Sorts entries */
+    orxEvent_SortStatsEntries();
+
+    /* Updates result */
+    pstResult = &(sstEvent.apstSortedStatsList[_u32Index]->stStats);
+  }
+
+#endif /* __orxPROFILER__ */
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Resets all handler stats
+ */
+void orxFASTCALL orxEvent_ResetHandlerStats()
+{
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstEvent.u32Flags, orxEVENT_KU32_STATIC_FLAG_READY));
+
+#ifdef __orxPROFILER__
+
+  /* Has table? */
+  if(sstEvent.astStatsEntryList != orxNULL)
+  {
+    /* Clears stats */
+    orxMemory_Zero(sstEvent.astStatsEntryList, orxEVENT_KU32_STATS_ENTRY_NUMBER * sizeof(orxEVENT_STATS_ENTRY));
+    sstEvent.u32StatsEntryCount = 0;
+    sstEvent.u32StatsLostCount  = 0;
+
+    /* Updates status */
+    orxFLAG_SET(sstEvent.u32Flags, orxEVENT_KU32_STATIC_FLAG_NONE, orxEVENT_KU32_STATIC_FLAG_SORTED);
+  }
+
+#endif /* __orxPROFILER__ */
+
+  /* Done! */
+  return;
+}
+
+/** Logs handler stats, sorted by decreasing total time
+ * @param[in] _u32Count             Max number of entries to log, 0 for all
+ */
+void orxFASTCALL orxEvent_LogHandlerStats(orxU32 _u32Count)
+{
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstEvent.u32Flags, orxEVENT_KU32_STATIC_FLAG_READY));
+
+#ifdef __orxPROFILER__
+
+  /* Has table? */
+  if(sstEvent.astStatsEntryList != orxNULL)
+  {
+    orxU32 i, u32Count;
+
+    /* Sorts entries */
+    orxEvent_SortStatsEntries();
+
+    /* Gets count */
+    u32Count = ((_u32Count == 0) || (_u32Count > sstEvent.u32StatsEntryCount)) ? sstEvent.u32StatsEntryCount : _u32Count;
+
+    /* Logs header */
+    orxLOG("[EVENT] %u handler(s) profiled (%u lost), showing %u", sstEvent.u32StatsEntryCount, sstEvent.u32StatsLostCount, u32Count);
+
+    /* For all entries */
+    for(i = 0; i < u32Count; i++)
+    {
+      const orxEVENT_HANDLER_STATS *pstStats;
+
+      /* Gets it */
+      pstStats = &(sstEvent.apstSortedStatsList[i]->stStats);
+
+      /* Logs it */
+      orxLOG("[EVENT] Type %u, ID %u, %s: %u call(s), total %.3fms, avg %.3fms, max %.3fms", (orxU32)pstStats->eType, (orxU32)pstStats->eID, pstStats->zName, pstStats->u32CallCount, pstStats->dTotalTime * orx2D(1000.0), (pstStats->u32CallCount != 0) ? pstStats->dTotalTime * orx2D(1000.0) / (orxDOUBLE)pstStats->u32CallCount : orxDOUBLE_0, pstStats->dMaxTime * orx2D(1000.0));
+    }
+  }
+
+#endif /* __orxPROFILER__ */
+
+  /* Done! */
+  return;
+}
@@ -0,0 +1,714 @@
+/* Orx - Portable Game Engine
+ *
+ * Copyright (c) 2008-2018 Orx-Project
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ *    1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ *
+ *    2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ *
+ *    3. This notice may not be removed or altered from any source
+ *    distribution.
+ */
+
+/**
+ * @file orxReplay.c
+ * @date 19/10/2026
+ * @author iarwain@orx-project.org
+ *
+ */
+
+
+#include "core/orxReplay.h"
+
+#include "debug/orxDebug.h"
+#include "core/orxCommand.h"
+#include "core/orxConfig.h"
+#include "core/orxEvent.h"
+#include "core/orxSystem.h"
+#include "io/orxFile.h"
+#include "memory/orxMemory.h"
+#include "utils/orxString.h"
+
+
+/** Module flags
+ */
+#define orxREPLAY_KU32_STATIC_FLAG_NONE         0x00000000  /**< No flags */
+
+#define orxREPLAY_KU32_STATIC_FLAG_READY        0x00000001  /**< Ready flag */
+#define orxREPLAY_KU32_STATIC_FLAG_RECORD       0x00000002  /**< Record flag */
+#define orxREPLAY_KU32_STATIC_FLAG_PLAY         0x00000004  /**< Play flag */
+#define orxREPLAY_KU32_STATIC_FLAG_NEXT_FRAME   0x00000008  /**< Next frame flag */
+#define orxREPLAY_KU32_STATIC_FLAG_QUIT_ON_END  0x00000010  /**< Quit on end flag */
+
+#define orxREPLAY_KU32_STATIC_MASK_ACTIVE       (orxREPLAY_KU32_STATIC_FLAG_RECORD | orxREPLAY_KU32_STATIC_FLAG_PLAY) /**< Active mask */
+
+#define orxREPLAY_KU32_STATIC_MASK_ALL          0xFFFFFFFF  /**< All mask */
+
+
+/** Misc defines
+ */
+#define orxREPLAY_KZ_CONFIG_SECTION             "Replay"
+#define orxREPLAY_KZ_CONFIG_RECORD              "Record"
+#define orxREPLAY_KZ_CONFIG_PLAY                "Play"
+#define orxREPLAY_KZ_CONFIG_QUIT_ON_END         "QuitOnEnd"
+
+#define orxREPLAY_KU32_MAGIC                    0x5278726F  /**< Magic number ('orxR') */
+#define orxREPLAY_KU32_VERSION                  1           /**< File format version */
+
+#define orxREPLAY_KU8_TAG_FRAME                 'F'         /**< Frame record (5 bytes): tag, DT */
+#define orxREPLAY_KU8_TAG_INPUT                 'I'         /**< Input record (8 bytes): tag, type, ID (16 bits, little endian), value */
+
+#define orxREPLAY_KU32_FRAME_RECORD_SIZE        (1 + sizeof(orxFLOAT))
+#define orxREPLAY_KU32_INPUT_RECORD_SIZE        (1 + 1 + 2 + sizeof(orxFLOAT))
+
+#define orxREPLAY_KU32_BUFFER_SIZE              256         /**< File name buffer size */
+
+#define orxREPLAY_KU32_VALUE_OFFSET_MOUSE_BUTTON      (orxKEYBOARD_KEY_NUMBER)
+#define orxREPLAY_KU32_VALUE_OFFSET_MOUSE_AXIS        (orxREPLAY_KU32_VALUE_OFFSET_MOUSE_BUTTON + orxMOUSE_BUTTON_NUMBER)
+#define orxREPLAY_KU32_VALUE_OFFSET_JOYSTICK_BUTTON   (orxREPLAY_KU32_VALUE_OFFSET_MOUSE_AXIS + orxMOUSE_AXIS_NUMBER)
+#define orxREPLAY_KU32_VALUE_OFFSET_JOYSTICK_AXIS     (orxREPLAY_KU32_VALUE_OFFSET_JOYSTICK_BUTTON + orxJOYSTICK_BUTTON_NUMBER)
+#define orxREPLAY_KU32_VALUE_NUMBER                   (orxREPLAY_KU32_VALUE_OFFSET_JOYSTICK_AXIS + orxJOYSTICK_AXIS_NUMBER)
+
+
+/***************************************************************************
+ * Structure declaration                                                   *
+ ***************************************************************************/
+
+/** Static structure
+ */
+typedef struct __orxREPLAY_STATIC_t
+{
+  orxFILE  *pstFile;                                            /**< Current file */
+  orxDOUBLE dStartTime;                                         /**< Start time */
+  orxU32    u32FrameCount;                                      /**< Frame count */
+  orxU32    u32RecordCount;                                     /**< Input record count */
+  orxFLOAT  fNextDT;                                            /**< Next played back DT */
+  orxU32    u32Flags;                                           /**< Control flags */
+  orxFLOAT  afValueList[orxREPLAY_KU32_VALUE_NUMBER];           /**< Last recorded / played back input values */
+  orxCHAR   acFileName[orxREPLAY_KU32_BUFFER_SIZE];             /**< Current file name */
+
+} orxREPLAY_STATIC;
+
+
+/***************************************************************************
+ * Static variables                                                        *
+ ***************************************************************************/
+
+/** Static data
+ */
+static orxREPLAY_STATIC sstReplay;
+
+
+/***************************************************************************
+ * Private functions                                                       *
+ ***************************************************************************/
+
+/** Gets an input value index
+ * @param[in]   _eType          Input type
+ * @param[in]   _eID            Input ID
+ * @return      Value index / orxU32_UNDEFINED
+ */
+static orxINLINE orxU32 orxReplay_GetValueIndex(orxINPUT_TYPE _eType, orxENUM _eID)
+{
+  orxU32 u32Result;
+
+  /* Depending on type */
+  switch(_eType)
+  {
+    case orxINPUT_TYPE_KEYBOARD_KEY:
+    {
+      /* Updates result */
+      u32Result = (_eID < orxKEYBOARD_KEY_NUMBER) ? (orxU32)_eID : orxU32_UNDEFINED;
+      break;
+    }
+
+    case orxINPUT_TYPE_MOUSE_BUTTON:
+    {
+      /* Updates result */
+      u32Result = (_eID < orxMOUSE_BUTTON_NUMBER) ? orxREPLAY_KU32_VALUE_OFFSET_MOUSE_BUTTON + (orxU32)_eID : orxU32_UNDEFINED;
+      break;
+    }
+
+    case orxINPUT_TYPE_MOUSE_AXIS:
+    {
+      /* Updates result */
+      u32Result = (_eID < orxMOUSE_AXIS_NUMBER) ? orxREPLAY_KU32_VALUE_OFFSET_MOUSE_AXIS + (orxU32)_eID : orxU32_UNDEFINED;
+      break;
+    }
+
+    case orxINPUT_TYPE_JOYSTICK_BUTTON:
+    {
+      /* Updates result */
+      u32Result = (_eID < orxJOYSTICK_BUTTON_NUMBER) ? orxREPLAY_KU32_VALUE_OFFSET_JOYSTICK_BUTTON + (orxU32)_eID : orxU32_UNDEFINED;
+      break;
+    }
+
+    case orxINPUT_TYPE_JOYSTICK_AXIS:
+    {
+      /* Updates result */
+      u32Result = (_eID < orxJOYSTICK_AXIS_NUMBER) ? orxREPLAY_KU32_VALUE_OFFSET_JOYSTICK_AXIS + (orxU32)_eID : orxU32_UNDEFINED;
+      break;
+    }
+
+    default:
+    {
+      /* Not a device input */
+      u32Result = orxU32_UNDEFINED;
+      break;
+    }
+  }
+
+  /* Done! */
+  return u32Result;
+}
+
+/** Reads records till the next frame one
+ * @return orxTRUE if a next frame was found, orxFALSE otherwise
+ */
+static orxBOOL orxFASTCALL orxReplay_ReadRecords()
+{
+  orxU8   au8Buffer[orxREPLAY_KU32_INPUT_RECORD_SIZE];
+  orxBOOL bResult = orxFALSE;
+
+  /* Checks */
+  orxASSERT(sstReplay.pstFile != orxNULL);
+
+  /* While there are records */
+  while(orxFile_Read(au8Buffer, sizeof(orxU8), 1, sstReplay.pstFile) == 1)
+  {
+    /* Frame? */
+    if(au8Buffer[0] == orxREPLAY_KU8_TAG_FRAME)
+    {
+      /* Gets its DT */
+      if(orxFile_Read(&(sstReplay.fNextDT), sizeof(orxFLOAT), 1, sstReplay.pstFile) == 1)
+      {
+        /* Updates result */
+        bResult = orxTRUE;
+      }
+
+      break;
+    }
+    /* Input? */
+    else if((au8Buffer[0] == orxREPLAY_KU8_TAG_INPUT)
+         && (orxFile_Read(au8Buffer + 1, orxREPLAY_KU32_INPUT_RECORD_SIZE - 1, 1, sstReplay.pstFile) == 1))
+    {
+      orxU32 u32Index;
+
+      /* Gets value index */
+      u32Index = orxReplay_GetValueIndex((orxINPUT_TYPE)au8Buffer[1], (orxENUM)(au8Buffer[2] | (au8Buffer[3] << 8)));
+
+      /* Valid? */
+      if(u32Index != orxU32_UNDEFINED)
+      {
+        /* Stores its value */
+        orxMemory_Copy(&(sstReplay.afValueList[u32Index]), au8Buffer + 4, sizeof(orxFLOAT));
+      }
+
+      /* Updates record count */
+      sstReplay.u32RecordCount++;
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "[%s]: Invalid or truncated record after frame %u, ending playback.", sstReplay.acFileName, sstReplay.u32FrameCount);
+
+      break;
+    }
+  }
+
+  /* Done! */
+  return bResult;
+}
+
+/** Opens a replay file
+ * @param[in]   _zFileName      File name
+ * @param[in]   _bRecord        Record or play?
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxSTATUS orxFASTCALL orxReplay_Open(const orxSTRING _zFileName, orxBOOL _bRecord)
+{
+  orxU32    au32Header[2];
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT(sstReplay.u32Flags & orxREPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Stops current session */
+  orxReplay_Stop();
+
+  /* Gets file name */
+  orxString_NPrint(sstReplay.acFileName, sizeof(sstReplay.acFileName) - 1, "%s", ((_zFileName != orxNULL) && (*_zFileName != orxCHAR_NULL)) ? _zFileName : orxREPLAY_KZ_DEFAULT_FILE);
+
+  /* Opens it */
+  sstReplay.pstFile = orxFile_Open(sstReplay.acFileName, ((_bRecord != orxFALSE) ? orxFILE_KU32_FLAG_OPEN_WRITE : orxFILE_KU32_FLAG_OPEN_READ) | orxFILE_KU32_FLAG_OPEN_BINARY);
+
+  /* Success? */
+  if(sstReplay.pstFile != orxNULL)
+  {
+    /* Clears values */
+    orxMemory_Zero(sstReplay.afValueList, sizeof(sstReplay.afValueList));
+    sstReplay.u32FrameCount   = 0;
+    sstReplay.u32RecordCount  = 0;
+
+    /* Record? */
+    if(_bRecord != orxFALSE)
+    {
+      /* Writes header */
+      au32Header[0] = orxREPLAY_KU32_MAGIC;
+      au32Header[1] = orxREPLAY_KU32_VERSION;
+      if(orxFile_Write(au32Header, sizeof(au32Header), 1, sstReplay.pstFile) == 1)
+      {
+        /* Updates status */
+        orxFLAG_SET(sstReplay.u32Flags, orxREPLAY_KU32_STATIC_FLAG_RECORD, orxREPLAY_KU32_STATIC_FLAG_NONE);
+
+        /* Updates result */
+        eResult = orxSTATUS_SUCCESS;
+      }
+    }
+    else
+    {
+      /* Checks header */
+      if((orxFile_Read(au32Header, sizeof(au32Header), 1, sstReplay.pstFile) == 1)
+      && (au32Header[0] == orxREPLAY_KU32_MAGIC)
+      && (au32Header[1] == orxREPLAY_KU32_VERSION))
+      {
+        /* Updates status */
+        orxFLAG_SET(sstReplay.u32Flags, orxREPLAY_KU32_STATIC_FLAG_PLAY, orxREPLAY_KU32_STATIC_FLAG_NONE);
+
+        /* Reads first frame */
+        if(orxReplay_ReadRecords() != orxFALSE)
+        {
+          /* Updates status */
+          orxFLAG_SET(sstReplay.u32Flags, orxREPLAY_KU32_STATIC_FLAG_NEXT_FRAME, orxREPLAY_KU32_STATIC_FLAG_NONE);
+        }
+
+        /* Updates result */
+        eResult = orxSTATUS_SUCCESS;
+      }
+      else
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "[%s]: Not a valid replay file (version %u expected).", sstReplay.acFileName, orxREPLAY_KU32_VERSION);
+      }
+    }
+
+    /* Success? */
+    if(eResult != orxSTATUS_FAILURE)
+    {
+      /* Stores start time */
+      sstReplay.dStartTime = orxSystem_GetTime();
+
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "%s [%s].", (_bRecord != orxFALSE) ? "Recording to" : "Playing back", sstReplay.acFileName);
+    }
+    else
+    {
+      /* Closes file */
+      orxFile_Close(sstReplay.pstFile);
+      sstReplay.pstFile = orxNULL;
+    }
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "[%s]: Can't open replay file for %s.", sstReplay.acFileName, (_bRecord != orxFALSE) ? "writing" : "reading");
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Command: Record
+ */
+void orxFASTCALL orxReplay_CommandRecord(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+{
+  /* Updates result */
+  _pstResult->bValue = (orxReplay_Record((_u32ArgNumber > 0) ? _astArgList[0].zValue : orxNULL) != orxSTATUS_FAILURE) ? orxTRUE : orxFALSE;
+
+  /* Done! */
+  return;
+}
+
+/** Command: Play
+ */
+void orxFASTCALL orxReplay_CommandPlay(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+{
+  /* Updates result */
+  _pstResult->bValue = (orxReplay_Play((_u32ArgNumber > 0) ? _astArgList[0].zValue : orxNULL) != orxSTATUS_FAILURE) ? orxTRUE : orxFALSE;
+
+  /* Done! */
+  return;
+}
+
+/** Command: Stop
+ */
+void orxFASTCALL orxReplay_CommandStop(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+{
+  /* Updates result */
+  _pstResult->bValue = (orxReplay_Stop() != orxSTATUS_FAILURE) ? orxTRUE : orxFALSE;
+
+  /* Done! */
+  return;
+}
+
+/** Registers all the replay commands
+ */
+static orxINLINE void orxReplay_RegisterCommands()
+{
+  /* Command: Record */
+  orxCOMMAND_REGISTER_CORE_COMMAND(Replay, Record, "Success?", orxCOMMAND_VAR_TYPE_BOOL, 0, 1, {"File = " orxREPLAY_KZ_DEFAULT_FILE, orxCOMMAND_VAR_TYPE_STRING});
+  /* Command: Play */
+  orxCOMMAND_REGISTER_CORE_COMMAND(Replay, Play, "Success?", orxCOMMAND_VAR_TYPE_BOOL, 0, 1, {"File = " orxREPLAY_KZ_DEFAULT_FILE, orxCOMMAND_VAR_TYPE_STRING});
+  /* Command: Stop */
+  orxCOMMAND_REGISTER_CORE_COMMAND(Replay, Stop, "Stopped?", orxCOMMAND_VAR_TYPE_BOOL, 0, 0);
+}
+
+/** Unregisters all the replay commands
+ */
+static orxINLINE void orxReplay_UnregisterCommands()
+{
+  /* Command: Record */
+  orxCOMMAND_UNREGISTER_CORE_COMMAND(Replay, Record);
+  /* Command: Play */
+  orxCOMMAND_UNREGISTER_CORE_COMMAND(Replay, Play);
+  /* Command: Stop */
+  orxCOMMAND_UNREGISTER_CORE_COMMAND(Replay, Stop);
+}
+
+
+/***************************************************************************
+ * Public functions                                                        *
+ ***************************************************************************/
+
+/** Replay module setup
+ */
+void orxFASTCALL orxReplay_Setup()
+{
+  /* Adds module dependencies */
+  orxModule_AddDependency(orxMODULE_ID_REPLAY, orxMODULE_ID_MEMORY);
+  orxModule_AddDependency(orxMODULE_ID_REPLAY, orxMODULE_ID_STRING);
+  orxModule_AddDependency(orxMODULE_ID_REPLAY, orxMODULE_ID_SYSTEM);
+  orxModule_AddDependency(orxMODULE_ID_REPLAY, orxMODULE_ID_CONFIG);
+  orxModule_AddDependency(orxMODULE_ID_REPLAY, orxMODULE_ID_COMMAND);
+  orxModule_AddDependency(orxMODULE_ID_REPLAY, orxMODULE_ID_EVENT);
+  orxModule_AddDependency(orxMODULE_ID_REPLAY, orxMODULE_ID_FILE);
+
+  return;
+}
+
+/** Inits the replay module
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxReplay_Init()
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Not already Initialized? */
+  if(!(sstReplay.u32Flags & orxREPLAY_KU32_STATIC_FLAG_READY))
+  {
+    /* Cleans control structure */
+    orxMemory_Zero(&sstReplay, sizeof(orxREPLAY_STATIC));
+
+    /* Registers commands */
+    orxReplay_RegisterCommands();
+
+    /* Inits flags */
+    sstReplay.u32Flags = orxREPLAY_KU32_STATIC_FLAG_READY | orxREPLAY_KU32_STATIC_FLAG_QUIT_ON_END;
+
+    /* Pushes section */
+    if((orxConfig_HasSection(orxREPLAY_KZ_CONFIG_SECTION) != orxFALSE)
+    && (orxConfig_PushSection(orxREPLAY_KZ_CONFIG_SECTION) != orxSTATUS_FAILURE))
+    {
+      /* Should not quit on end? */
+      if((orxConfig_HasValue(orxREPLAY_KZ_CONFIG_QUIT_ON_END) != orxFALSE)
+      && (orxConfig_GetBool(orxREPLAY_KZ_CONFIG_QUIT_ON_END) == orxFALSE))
+      {
+        /* Updates flags */
+        orxFLAG_SET(sstReplay.u32Flags, orxREPLAY_KU32_STATIC_FLAG_NONE, orxREPLAY_KU32_STATIC_FLAG_QUIT_ON_END);
+      }
+
+      /* Play? */
+      if(orxConfig_HasValue(orxREPLAY_KZ_CONFIG_PLAY) != orxFALSE)
+      {
+        /* Starts playback */
+        orxReplay_Play(orxConfig_GetString(orxREPLAY_KZ_CONFIG_PLAY));
+      }
+      /* Record? */
+      else if(orxConfig_HasValue(orxREPLAY_KZ_CONFIG_RECORD) != orxFALSE)
+      {
+        /* Starts recording */
+        orxReplay_Record(orxConfig_GetString(orxREPLAY_KZ_CONFIG_RECORD));
+      }
+
+      /* Pops section */
+      orxConfig_PopSection();
+    }
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Tried to initialize Replay module when it was already initialized.");
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Exits from the replay module
+ */
+void orxFASTCALL orxReplay_Exit()
+{
+  /* Initialized? */
+  if(sstReplay.u32Flags & orxREPLAY_KU32_STATIC_FLAG_READY)
+  {
+    /* Stops current session */
+    orxReplay_Stop();
+
+    /* Unregisters commands */
+    orxReplay_UnregisterCommands();
+
+    /* Updates flags */
+    sstReplay.u32Flags &= ~orxREPLAY_KU32_STATIC_FLAG_READY;
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Tried to exit from Replay module when it wasn't initialized.");
+  }
+
+  return;
+}
+
+/** Starts recording to a file, stops any current recording/playback
+ * @param[in]   _zFileName      File name, orxNULL for default one
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxReplay_Record(const orxSTRING _zFileName)
+{
+  orxSTATUS eResult;
+
+  /* Checks */
+  orxASSERT(sstReplay.u32Flags & orxREPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Opens file for writing */
+  eResult = orxReplay_Open(_zFileName, orxTRUE);
+
+  /* Done! */
+  return eResult;
+}
+
+/** Starts playing back a file, stops any current recording/playback
+ * @param[in]   _zFileName      File name, orxNULL for default one
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxReplay_Play(const orxSTRING _zFileName)
+{
+  orxSTATUS eResult;
+
+  /* Checks */
+  orxASSERT(sstReplay.u32Flags & orxREPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Opens file for reading */
+  eResult = orxReplay_Open(_zFileName, orxFALSE);
+
+  /* Done! */
+  return eResult;
+}
+
+/** Stops current recording/playback
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxReplay_Stop()
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT(sstReplay.u32Flags & orxREPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Active? */
+  if(sstReplay.pstFile != orxNULL)
+  {
+    orxDOUBLE dDuration;
+
+    /* Gets duration */
+    dDuration = orxSystem_GetTime() - sstReplay.dStartTime;
+
+    /* Closes file */
+    orxFile_Close(sstReplay.pstFile);
+    sstReplay.pstFile = orxNULL;
+
+    /* Logs summary */
+    orxLOG("[%s]: %s %u frames (%u input changes) in %.3fs, %.3fms per frame.", sstReplay.acFileName, orxFLAG_TEST(sstReplay.u32Flags, orxREPLAY_KU32_STATIC_FLAG_RECORD) ? "Recorded" : "Played back", sstReplay.u32FrameCount, sstReplay.u32RecordCount, dDuration, (sstReplay.u32FrameCount != 0) ? (orxDOUBLE)1000.0 * dDuration / (orxDOUBLE)sstReplay.u32FrameCount : (orxDOUBLE)0.0);
+
+    /* Updates status */
+    orxFLAG_SET(sstReplay.u32Flags, orxREPLAY_KU32_STATIC_FLAG_NONE, orxREPLAY_KU32_STATIC_MASK_ACTIVE | orxREPLAY_KU32_STATIC_FLAG_NEXT_FRAME);
+
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Is recording?
+ * @return orxTRUE / orxFALSE
+ */
+orxBOOL orxFASTCALL orxReplay_IsRecording()
+{
+  /* Done! */
+  return orxFLAG_TEST(sstReplay.u32Flags, orxREPLAY_KU32_STATIC_FLAG_RECORD) ? orxTRUE : orxFALSE;
+}
+
+/** Is playing back?
+ * @return orxTRUE / orxFALSE
+ */
+orxBOOL orxFASTCALL orxReplay_IsPlaying()
+{
+  /* Done! */
+  return orxFLAG_TEST(sstReplay.u32Flags, orxREPLAY_KU32_STATIC_FLAG_PLAY) ? orxTRUE : orxFALSE;
+}
+
+/** Processes a new frame's DT: records it or replaces it with the played back one (called by the clock module)
+ * @param[in]   _fDT            Natural DT
+ * @return      DT to use for this frame
+ */
+orxFLOAT orxFASTCALL orxReplay_ProcessDT(orxFLOAT _fDT)
+{
+  orxFLOAT fResult = _fDT;
+
+  /* Recording? */
+  if(orxFLAG_TEST(sstReplay.u32Flags, orxREPLAY_KU32_STATIC_FLAG_RECORD))
+  {
+    orxU8 au8Buffer[orxREPLAY_KU32_FRAME_RECORD_SIZE];
+
+    /* Writes frame record */
+    au8Buffer[0] = orxREPLAY_KU8_TAG_FRAME;
+    orxMemory_Copy(au8Buffer + 1, &_fDT, sizeof(orxFLOAT));
+    if(orxFile_Write(au8Buffer, sizeof(au8Buffer), 1, sstReplay.pstFile) == 1)
+    {
+      /* Updates frame count */
+      sstReplay.u32FrameCount++;
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "[%s]: Couldn't write frame %u, stopping recording.", sstReplay.acFileName, sstReplay.u32FrameCount);
+
+      /* Stops */
+      orxReplay_Stop();
+    }
+  }
+  /* Playing back? */
+  else if(orxFLAG_TEST(sstReplay.u32Flags, orxREPLAY_KU32_STATIC_FLAG_PLAY))
+  {
+    /* Has frame? */
+    if(orxFLAG_TEST(sstReplay.u32Flags, orxREPLAY_KU32_STATIC_FLAG_NEXT_FRAME))
+    {
+      /* Updates result */
+      fResult = sstReplay.fNextDT;
+
+      /* Updates frame count */
+      sstReplay.u32FrameCount++;
+
+      /* Reads this frame's inputs */
+      if(orxReplay_ReadRecords() == orxFALSE)
+      {
+        /* Updates status */
+        orxFLAG_SET(sstReplay.u32Flags, orxREPLAY_KU32_STATIC_FLAG_NONE, orxREPLAY_KU32_STATIC_FLAG_NEXT_FRAME);
+      }
+    }
+    else
+    {
+      /* Stops */
+      orxReplay_Stop();
+
+      /* Should quit? */
+      if(orxFLAG_TEST(sstReplay.u32Flags, orxREPLAY_KU32_STATIC_FLAG_QUIT_ON_END))
+      {
+        /* Sends close event */
+        orxEvent_SendShort(orxEVENT_TYPE_SYSTEM, orxSYSTEM_EVENT_CLOSE);
+      }
+    }
+  }
+
+  /* Done! */
+  return fResult;
+}
+
+/** Records an input device value, if it changed since last frame (called by the input module)
+ * @param[in]   _eType          Input type
+ * @param[in]   _eID            Input ID
+ * @param[in]   _fValue         Current device value
+ */
+void orxFASTCALL orxReplay_RecordInputValue(orxINPUT_TYPE _eType, orxENUM _eID, orxFLOAT _fValue)
+{
+  /* Recording? */
+  if(orxFLAG_TEST(sstReplay.u32Flags, orxREPLAY_KU32_STATIC_FLAG_RECORD))
+  {
+    orxU32 u32Index;
+
+    /* Gets value index */
+    u32Index = orxReplay_GetValueIndex(_eType, _eID);
+
+    /* Valid and changed? */
+    if((u32Index != orxU32_UNDEFINED)
+    && (sstReplay.afValueList[u32Index] != _fValue))
+    {
+      orxU8 au8Buffer[orxREPLAY_KU32_INPUT_RECORD_SIZE];
+
+      /* Stores it */
+      sstReplay.afValueList[u32Index] = _fValue;
+
+      /* Writes input record */
+      au8Buffer[0] = orxREPLAY_KU8_TAG_INPUT;
+      au8Buffer[1] = (orxU8)_eType;
+      au8Buffer[2] = (orxU8)(_eID & 0xFF);
+      au8Buffer[3] = (orxU8)((_eID >> 8) & 0xFF);
+      orxMemory_Copy(au8Buffer + 4, &_fValue, sizeof(orxFLOAT));
+      orxFile_Write(au8Buffer, sizeof(au8Buffer), 1, sstReplay.pstFile);
+
+      /* Updates record count */
+      sstReplay.u32RecordCount++;
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Gets a played back input device value (called by the input module)
+ * @param[in]   _eType          Input type
+ * @param[in]   _eID            Input ID
+ * @return      Played back value
+ */
+orxFLOAT orxFASTCALL orxReplay_GetInputValue(orxINPUT_TYPE _eType, orxENUM _eID)
+{
+  orxU32    u32Index;
+  orxFLOAT  fResult = orxFLOAT_0;
+
+  /* Gets value index */
+  u32Index = orxReplay_GetValueIndex(_eType, _eID);
+
+  /* Valid? */
+  if(u32Index != orxU32_UNDEFINED)
+  {
+    /* Updates result */
+    fResult = sstReplay.afValueList[u32Index];
+  }
+
+  /* Done! */
+  return fResult;
+}
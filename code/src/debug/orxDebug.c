@@ -32,9 +32,22 @@
 
 #include "debug/orxDebug.h"
 #include "core/orxConsole.h"
+#include "memory/orxMemory.h"
 
 #include <stdlib.h>
 
+#ifdef __orxWINDOWS__
+
+  #include <process.h>
+
+#else /* __orxWINDOWS__ */
+
+  #include <pthread.h>
+  #include <sched.h>
+  #include <sys/time.h>
+
+#endif /* __orxWINDOWS__ */
+
 #if defined(__orxANDROID__) || defined(__orxANDROID_NATIVE__)
 
   #include <jni.h>
@@ -62,6 +75,7 @@
 
 #define orxDEBUG_KU32_STATIC_FLAG_READY         0x10000000
 #define orxDEBUG_KU32_STATIC_FLAG_ANSI          0x20000000
+#define orxDEBUG_KU32_STATIC_FLAG_ASYNC         0x40000000
 
 #define orxDEBUG_KU32_STATIC_MASK_ALL           0xFFFFFFFF
 
@@ -75,14 +89,81 @@
 
 #endif /* __orxDEBUG__ */
 
+#define orxDEBUG_KU32_ENTRY_NUMBER              1024    /**< Ring buffer size, needs to be a power of two */
+#define orxDEBUG_KU32_ENTRY_MASK                (orxDEBUG_KU32_ENTRY_NUMBER - 1)
+#define orxDEBUG_KU32_FLUSH_DELAY               100     /**< Maximum delay, in milliseconds, before flushing files */
+
+
 /***************************************************************************
  * Structure declaration                                                   *
  ***************************************************************************/
 
+/** Ring buffer entry
+ */
+typedef struct __orxDEBUG_ENTRY_t
+{
+  volatile orxU32 u32Sequence;                  /**< Sequence: position + 1 when ready to be written, position + size when free */
+  orxDEBUG_LEVEL  eLevel;                       /**< Debug level */
+  orxU32          u32DebugFlags;                /**< Debug flags active when logged */
+  orxCHAR         acBuffer[orxDEBUG_KS32_BUFFER_OUTPUT_SIZE]; /**< Formatted line */
+
+} orxDEBUG_ENTRY;
+
 /** Static structure
  */
 typedef struct __orxDEBUG_STATIC_t
 {
+  /* Ring buffer */
+  orxDEBUG_ENTRY *astEntryList;
+
+  /* Write position (producers) */
+  volatile orxU32 u32InIndex;
+
+  /* Read position (writer thread) */
+  volatile orxU32 u32OutIndex;
+
+  /* Flushed position (writer thread) */
+  volatile orxU32 u32FlushIndex;
+
+  /* Is writer thread waiting? */
+  volatile orxU32 u32Waiting;
+
+  /* Should writer thread stop? */
+  volatile orxU32 u32Stop;
+
+  /* Is a flush requested? */
+  volatile orxU32 u32FlushRequest;
+
+#ifdef __orxWINDOWS__
+
+  /* Writer thread */
+  HANDLE hThread;
+
+  /* Writer condition lock */
+  CRITICAL_SECTION stLock;
+
+  /* Writer condition */
+  CONDITION_VARIABLE stCondition;
+
+  /* Output streams lock */
+  CRITICAL_SECTION stStreamLock;
+
+#else /* __orxWINDOWS__ */
+
+  /* Writer thread */
+  pthread_t hThread;
+
+  /* Writer condition lock */
+  pthread_mutex_t stLock;
+
+  /* Writer condition */
+  pthread_cond_t stCondition;
+
+  /* Output streams lock */
+  pthread_mutex_t stStreamLock;
+
+#endif /* __orxWINDOWS__ */
+
   /* Debug file name */
   orxSTRING zDebugFile;
 
@@ -297,6 +378,500 @@ static orxINLINE orxBOOL orxDebug_HasANSICodes(orxSTRING _zBuffer)
   return bResult;
 }
 
+/** Gets a monotonic-enough millisecond counter, used for flush scheduling
+ * @return      Milliseconds
+ */
+static orxINLINE orxU32 orxDebug_GetMilliseconds()
+{
+  orxU32 u32Result;
+
+#ifdef __orxWINDOWS__
+
+  /* Gets tick count */
+  u32Result = (orxU32)GetTickCount();
+
+#else /* __orxWINDOWS__ */
+
+  struct timeval stTime;
+
+  /* Gets current time */
+  gettimeofday(&stTime, NULL);
+  u32Result = (orxU32)stTime.tv_sec * 1000 + (orxU32)(stTime.tv_usec / 1000);
+
+#endif /* __orxWINDOWS__ */
+
+  /* Done! */
+  return u32Result;
+}
+
+/** Yields to other threads
+ */
+static orxINLINE void orxDebug_Yield()
+{
+#ifdef __orxWINDOWS__
+
+  Sleep(0);
+
+#else /* __orxWINDOWS__ */
+
+  sched_yield();
+
+#endif /* __orxWINDOWS__ */
+}
+
+/** Locks the output streams (writer thread only holds it while writing a batch, never while waiting)
+ */
+static orxINLINE void orxDebug_Lock()
+{
+#ifdef __orxWINDOWS__
+
+  EnterCriticalSection(&(sstDebug.stStreamLock));
+
+#else /* __orxWINDOWS__ */
+
+  pthread_mutex_lock(&(sstDebug.stStreamLock));
+
+#endif /* __orxWINDOWS__ */
+}
+
+/** Unlocks the output streams
+ */
+static orxINLINE void orxDebug_Unlock()
+{
+#ifdef __orxWINDOWS__
+
+  LeaveCriticalSection(&(sstDebug.stStreamLock));
+
+#else /* __orxWINDOWS__ */
+
+  pthread_mutex_unlock(&(sstDebug.stStreamLock));
+
+#endif /* __orxWINDOWS__ */
+}
+
+/** Wakes the writer thread up (only contends with the writer thread while it's about to wait)
+ */
+static orxINLINE void orxDebug_Signal()
+{
+#ifdef __orxWINDOWS__
+
+  /* Signals writer thread */
+  EnterCriticalSection(&(sstDebug.stLock));
+  WakeConditionVariable(&(sstDebug.stCondition));
+  LeaveCriticalSection(&(sstDebug.stLock));
+
+#else /* __orxWINDOWS__ */
+
+  /* Signals writer thread */
+  pthread_mutex_lock(&(sstDebug.stLock));
+  pthread_cond_signal(&(sstDebug.stCondition));
+  pthread_mutex_unlock(&(sstDebug.stLock));
+
+#endif /* __orxWINDOWS__ */
+}
+
+/** Waits for the writer thread to be signaled, unless an entry is already ready at the read position or a stop has been requested
+ * @param[in]   _u32OutIndex                  Current read position
+ * @param[in]   _u32Delay                     Maximum delay, in milliseconds
+ */
+static orxINLINE void orxDebug_Wait(orxU32 _u32OutIndex, orxU32 _u32Delay)
+{
+#ifdef __orxWINDOWS__
+
+  /* Locks condition */
+  EnterCriticalSection(&(sstDebug.stLock));
+
+  /* Still nothing to write? */
+  if((sstDebug.astEntryList[_u32OutIndex & orxDEBUG_KU32_ENTRY_MASK].u32Sequence != _u32OutIndex + 1) && (sstDebug.u32Stop == 0))
+  {
+    /* Waits for a signal */
+    SleepConditionVariableCS(&(sstDebug.stCondition), &(sstDebug.stLock), (DWORD)_u32Delay);
+  }
+
+  /* Unlocks condition */
+  LeaveCriticalSection(&(sstDebug.stLock));
+
+#else /* __orxWINDOWS__ */
+
+  /* Locks condition */
+  pthread_mutex_lock(&(sstDebug.stLock));
+
+  /* Still nothing to write? */
+  if((sstDebug.astEntryList[_u32OutIndex & orxDEBUG_KU32_ENTRY_MASK].u32Sequence != _u32OutIndex + 1) && (sstDebug.u32Stop == 0))
+  {
+    struct timeval  stTime;
+    struct timespec stTimeOut;
+
+    /* Gets absolute time out */
+    gettimeofday(&stTime, NULL);
+    stTimeOut.tv_sec  = stTime.tv_sec + (time_t)(_u32Delay / 1000);
+    stTimeOut.tv_nsec = (long)stTime.tv_usec * 1000 + (long)(_u32Delay % 1000) * 1000000;
+    if(stTimeOut.tv_nsec >= 1000000000)
+    {
+      stTimeOut.tv_sec++;
+      stTimeOut.tv_nsec -= 1000000000;
+    }
+
+    /* Waits for a signal */
+    pthread_cond_timedwait(&(sstDebug.stCondition), &(sstDebug.stLock), &stTimeOut);
+  }
+
+  /* Unlocks condition */
+  pthread_mutex_unlock(&(sstDebug.stLock));
+
+#endif /* __orxWINDOWS__ */
+}
+
+/** Flushes output streams
+ * @param[in]   _bFiles                       Flush files as well as terminal?
+ */
+static orxINLINE void orxDebug_Flush(orxBOOL _bFiles)
+{
+  /* Flushes terminal */
+  fflush(stdout);
+  fflush(stderr);
+
+  /* Files? */
+  if(_bFiles != orxFALSE)
+  {
+    /* Flushes them */
+    if(sstDebug.pstLogFile != orxNULL)
+    {
+      fflush(sstDebug.pstLogFile);
+    }
+    if(sstDebug.pstDebugFile != orxNULL)
+    {
+      fflush(sstDebug.pstDebugFile);
+    }
+  }
+}
+
+/** Writes a formatted line to the terminal & files (doesn't flush them)
+ * @param[in]   _eLevel                       Debug level associated with this output
+ * @param[in]   _u32DebugFlags                Debug flags active when the line was logged
+ * @param[in]   _zBuffer                      Formatted line, ANSI codes will be cleared in place
+ */
+static void orxFASTCALL orxDebug_Write(orxDEBUG_LEVEL _eLevel, orxU32 _u32DebugFlags, orxSTRING _zBuffer)
+{
+  /* Doesn't have ANSI support? */
+  if(!orxFLAG_TEST(sstDebug.u32Flags, orxDEBUG_KU32_STATIC_FLAG_ANSI))
+  {
+    /* Clears ANSI codes */
+    orxDebug_ClearANSICodes(_zBuffer);
+  }
+
+  /* Terminal display? */
+  if(_u32DebugFlags & orxDEBUG_KU32_STATIC_FLAG_TERMINAL)
+  {
+#if defined(__orxANDROID__) || defined(__orxANDROID_NATIVE__)
+
+#define  LOG_TAG    "orxDebug"
+#define  LOGI(...)  __android_log_write(ANDROID_LOG_INFO,LOG_TAG,__VA_ARGS__)
+#define  LOGD(...)  __android_log_write(ANDROID_LOG_DEBUG,LOG_TAG,__VA_ARGS__)
+
+    if(_eLevel == orxDEBUG_LEVEL_LOG)
+    {
+      LOGI(_zBuffer);
+    }
+    else
+    {
+      LOGD(_zBuffer);
+    }
+
+#else /* __orxANDROID__ || __orxANDROID_NATIVE__ */
+
+    FILE *pstFile;
+
+    if(_eLevel == orxDEBUG_LEVEL_LOG)
+    {
+      pstFile = stdout;
+    }
+    else
+    {
+      pstFile = stderr;
+    }
+
+    fprintf(pstFile, "%s", _zBuffer);
+
+#endif /* __orxANDROID__ || __orxANDROID_NATIVE__ */
+
+  }
+
+  /* Has ANSI support? */
+  if(orxFLAG_TEST(sstDebug.u32Flags, orxDEBUG_KU32_STATIC_FLAG_ANSI))
+  {
+    /* Clears ANSI codes */
+    orxDebug_ClearANSICodes(_zBuffer);
+  }
+
+#ifdef __orxWINDOWS__
+
+  /* Terminal display? */
+  if(_u32DebugFlags & orxDEBUG_KU32_STATIC_FLAG_TERMINAL)
+  {
+    OutputDebugString(_zBuffer);
+  }
+
+#endif /* __orxWINDOWS__ */
+
+  /* File print? */
+  if(_u32DebugFlags & orxDEBUG_KU32_STATIC_FLAG_FILE)
+  {
+    FILE *pstFile;
+
+    if(_eLevel == orxDEBUG_LEVEL_LOG)
+    {
+
+#if !defined(__orxANDROID__) && !defined(__orxANDROID_ANDROID__)
+
+      /* Needs to open the file? */
+      if(sstDebug.pstLogFile == orxNULL)
+      {
+        /* Opens it */
+        sstDebug.pstLogFile = fopen(sstDebug.zLogFile, "ab+");
+      }
+
+#endif /* !__orxANDROID__ && !__orxANDROID_NATIVE__ */
+
+      pstFile = sstDebug.pstLogFile;
+    }
+    else
+    {
+
+#if !defined(__orxANDROID__) && !defined(__orxANDROID_ANDROID__)
+
+      /* Needs to open the file? */
+      if(sstDebug.pstDebugFile == orxNULL)
+      {
+        /* Opens it */
+        sstDebug.pstDebugFile = fopen(sstDebug.zDebugFile, "ab+");
+      }
+
+#endif /* !__orxANDROID__ && !__orxANDROID_NATIVE__ */
+
+      pstFile = sstDebug.pstDebugFile;
+    }
+
+    /* Valid? */
+    if(pstFile != orxNULL)
+    {
+      fprintf(pstFile, "%s", _zBuffer);
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Queues a formatted line for the writer thread (lock-free, multiple producers)
+ * @param[in]   _eLevel                       Debug level associated with this output
+ * @param[in]   _u32DebugFlags                Debug flags active when the line was logged
+ * @param[in]   _zBuffer                      Formatted line
+ */
+static void orxFASTCALL orxDebug_Enqueue(orxDEBUG_LEVEL _eLevel, orxU32 _u32DebugFlags, const orxSTRING _zBuffer)
+{
+  orxDEBUG_ENTRY *pstEntry;
+  orxU32          u32Index;
+
+  /* Gets current write position */
+  u32Index = sstDebug.u32InIndex;
+
+  /* Until an entry has been reserved */
+  for(;;)
+  {
+    orxS32 s32Delta;
+
+    /* Gets entry */
+    pstEntry = &(sstDebug.astEntryList[u32Index & orxDEBUG_KU32_ENTRY_MASK]);
+
+    /* Gets its delta with the write position */
+    s32Delta = (orxS32)(pstEntry->u32Sequence - u32Index);
+
+    /* Free? */
+    if(s32Delta == 0)
+    {
+      orxU32 u32Previous;
+
+      /* Tries to reserve it */
+      u32Previous = orxMEMORY_ATOMIC_CAS32(&(sstDebug.u32InIndex), u32Index, u32Index + 1);
+
+      /* Success? */
+      if(u32Previous == u32Index)
+      {
+        break;
+      }
+
+      /* Retries from the new position */
+      u32Index = u32Previous;
+    }
+    else
+    {
+      /* Full? */
+      if(s32Delta < 0)
+      {
+        /* Wakes writer thread up and leaves it some time */
+        orxDebug_Signal();
+        orxDebug_Yield();
+      }
+
+      /* Retries from the current position */
+      u32Index = sstDebug.u32InIndex;
+    }
+  }
+
+  /* Stores line */
+  pstEntry->eLevel        = _eLevel;
+  pstEntry->u32DebugFlags = _u32DebugFlags;
+  strncpy(pstEntry->acBuffer, _zBuffer, orxDEBUG_KS32_BUFFER_OUTPUT_SIZE - 1);
+  pstEntry->acBuffer[orxDEBUG_KS32_BUFFER_OUTPUT_SIZE - 1] = orxCHAR_NULL;
+
+  /* Publishes it */
+  orxMEMORY_BARRIER();
+  pstEntry->u32Sequence = u32Index + 1;
+  orxMEMORY_BARRIER();
+
+  /* Assert? */
+  if(_eLevel == orxDEBUG_LEVEL_ASSERT)
+  {
+    /* Wakes writer thread up */
+    orxDebug_Signal();
+
+    /* Waits until it has been flushed, as a break is likely to follow */
+    while((orxS32)(sstDebug.u32FlushIndex - (u32Index + 1)) < 0)
+    {
+      orxDebug_Yield();
+    }
+  }
+  /* Is writer thread waiting? */
+  else if(sstDebug.u32Waiting != 0)
+  {
+    /* Wakes it up */
+    orxDebug_Signal();
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Writer thread: drains the ring buffer in batches, flushes terminal after each batch and files on a timer or on assert
+ */
+#ifdef __orxWINDOWS__
+static unsigned int WINAPI orxDebug_Run(void *_pContext)
+#else /* __orxWINDOWS__ */
+static void *orxDebug_Run(void *_pContext)
+#endif /* __orxWINDOWS__ */
+{
+  orxU32  u32OutIndex, u32FlushTime;
+  orxBOOL bDirty = orxFALSE;
+
+  /* Inits */
+  u32OutIndex   = sstDebug.u32OutIndex;
+  u32FlushTime  = orxDebug_GetMilliseconds();
+
+  /* While not stopped or not empty */
+  while((sstDebug.u32Stop == 0) || (u32OutIndex != sstDebug.u32InIndex))
+  {
+    orxDEBUG_ENTRY *pstEntry;
+    orxU32          u32Time, u32BatchEnd;
+    orxBOOL         bWritten = orxFALSE, bFlush = orxFALSE;
+
+    /* Locks output streams */
+    orxDebug_Lock();
+
+    /* For all ready entries, at most a ring's worth so that file changes can get in between batches */
+    for(pstEntry = &(sstDebug.astEntryList[u32OutIndex & orxDEBUG_KU32_ENTRY_MASK]), u32BatchEnd = u32OutIndex + orxDEBUG_KU32_ENTRY_NUMBER;
+        (pstEntry->u32Sequence == u32OutIndex + 1) && (u32OutIndex != u32BatchEnd);
+        pstEntry = &(sstDebug.astEntryList[u32OutIndex & orxDEBUG_KU32_ENTRY_MASK]))
+    {
+      orxMEMORY_BARRIER();
+
+      /* Writes it */
+      orxDebug_Write(pstEntry->eLevel, pstEntry->u32DebugFlags, pstEntry->acBuffer);
+
+      /* Assert? */
+      if(pstEntry->eLevel == orxDEBUG_LEVEL_ASSERT)
+      {
+        /* Needs flush */
+        bFlush = orxTRUE;
+      }
+
+      /* Frees it */
+      orxMEMORY_BARRIER();
+      pstEntry->u32Sequence = u32OutIndex + orxDEBUG_KU32_ENTRY_NUMBER;
+
+      /* Updates read position */
+      sstDebug.u32OutIndex = ++u32OutIndex;
+
+      /* Updates status */
+      bWritten = orxTRUE;
+    }
+
+    /* Flush requested? */
+    if(sstDebug.u32FlushRequest != 0)
+    {
+      /* Updates status */
+      sstDebug.u32FlushRequest  = 0;
+      bFlush                    = orxTRUE;
+    }
+
+    /* Gets current time */
+    u32Time = orxDebug_GetMilliseconds();
+
+    /* Wrote anything? */
+    if(bWritten != orxFALSE)
+    {
+      /* Updates status */
+      bDirty = orxTRUE;
+    }
+
+    /* Should flush files? */
+    if((bDirty != orxFALSE)
+    && ((bFlush != orxFALSE)
+     || (sstDebug.u32Stop != 0)
+     || (u32Time - u32FlushTime >= orxDEBUG_KU32_FLUSH_DELAY)))
+    {
+      /* Flushes everything */
+      orxDebug_Flush(orxTRUE);
+
+      /* Updates status */
+      sstDebug.u32FlushIndex  = u32OutIndex;
+      u32FlushTime            = u32Time;
+      bDirty                  = orxFALSE;
+    }
+    else if(bWritten != orxFALSE)
+    {
+      /* Flushes terminal */
+      orxDebug_Flush(orxFALSE);
+    }
+
+    /* Unlocks output streams */
+    orxDebug_Unlock();
+
+    /* Nothing new? */
+    if(bWritten == orxFALSE)
+    {
+      /* Declares itself as waiting */
+      sstDebug.u32Waiting = 1;
+      orxMEMORY_BARRIER();
+
+      /* Waits for a signal or for the next flush */
+      orxDebug_Wait(u32OutIndex, (bDirty != orxFALSE) ? orxDEBUG_KU32_FLUSH_DELAY - orxMIN(u32Time - u32FlushTime, orxDEBUG_KU32_FLUSH_DELAY - 1) : 10 * orxDEBUG_KU32_FLUSH_DELAY);
+
+      /* Updates status */
+      sstDebug.u32Waiting = 0;
+    }
+  }
+
+  /* Final flush */
+  orxDebug_Lock();
+  orxDebug_Flush(orxTRUE);
+  sstDebug.u32FlushIndex = u32OutIndex;
+  orxDebug_Unlock();
+
+  /* Done! */
+  return 0;
+}
+
 
 /***************************************************************************
  * Public functions                                                        *
@@ -369,6 +944,74 @@ orxSTATUS orxFASTCALL _orxDebug_Init()
 
 #endif /* __orxWINDOWS__ */
 
+    /* Allocates ring buffer */
+    sstDebug.astEntryList = (orxDEBUG_ENTRY *)malloc(orxDEBUG_KU32_ENTRY_NUMBER * sizeof(orxDEBUG_ENTRY));
+
+    /* Success? */
+    if(sstDebug.astEntryList != orxNULL)
+    {
+      orxBOOL bStarted;
+
+      /* Inits all entries as free */
+      for(i = 0; i < orxDEBUG_KU32_ENTRY_NUMBER; i++)
+      {
+        sstDebug.astEntryList[i].u32Sequence = i;
+      }
+
+#ifdef __orxWINDOWS__
+
+      /* Inits locks & condition */
+      InitializeCriticalSection(&(sstDebug.stLock));
+      InitializeConditionVariable(&(sstDebug.stCondition));
+      InitializeCriticalSection(&(sstDebug.stStreamLock));
+
+      /* Starts writer thread */
+      sstDebug.hThread = (HANDLE)_beginthreadex(NULL, 0, orxDebug_Run, orxNULL, 0, NULL);
+      bStarted = (sstDebug.hThread != NULL) ? orxTRUE : orxFALSE;
+
+      /* Failure? */
+      if(bStarted == orxFALSE)
+      {
+        /* Deletes locks */
+        DeleteCriticalSection(&(sstDebug.stLock));
+        DeleteCriticalSection(&(sstDebug.stStreamLock));
+      }
+
+#else /* __orxWINDOWS__ */
+
+      /* Inits locks & condition */
+      pthread_mutex_init(&(sstDebug.stLock), NULL);
+      pthread_cond_init(&(sstDebug.stCondition), NULL);
+      pthread_mutex_init(&(sstDebug.stStreamLock), NULL);
+
+      /* Starts writer thread */
+      bStarted = (pthread_create(&(sstDebug.hThread), NULL, orxDebug_Run, orxNULL) == 0) ? orxTRUE : orxFALSE;
+
+      /* Failure? */
+      if(bStarted == orxFALSE)
+      {
+        /* Deletes locks & condition */
+        pthread_cond_destroy(&(sstDebug.stCondition));
+        pthread_mutex_destroy(&(sstDebug.stLock));
+        pthread_mutex_destroy(&(sstDebug.stStreamLock));
+      }
+
+#endif /* __orxWINDOWS__ */
+
+      /* Success? */
+      if(bStarted != orxFALSE)
+      {
+        /* Updates flags */
+        sstDebug.u32Flags |= orxDEBUG_KU32_STATIC_FLAG_ASYNC;
+      }
+      else
+      {
+        /* Deletes ring buffer, output will remain synchronous */
+        free(sstDebug.astEntryList);
+        sstDebug.astEntryList = orxNULL;
+      }
+    }
+
     /* Success */
     eResult = orxSTATUS_SUCCESS;
   }
@@ -383,6 +1026,44 @@ void orxFASTCALL _orxDebug_Exit()
   /* Initialized? */
   if(sstDebug.u32Flags & orxDEBUG_KU32_STATIC_FLAG_READY)
   {
+    /* Asynchronous output? */
+    if(sstDebug.u32Flags & orxDEBUG_KU32_STATIC_FLAG_ASYNC)
+    {
+      /* Goes back to synchronous output */
+      sstDebug.u32Flags &= ~orxDEBUG_KU32_STATIC_FLAG_ASYNC;
+      orxMEMORY_BARRIER();
+
+      /* Stops writer thread, once all pending lines have been written */
+      sstDebug.u32Stop = 1;
+      orxDebug_Signal();
+
+#ifdef __orxWINDOWS__
+
+      /* Waits for it */
+      WaitForSingleObject(sstDebug.hThread, INFINITE);
+      CloseHandle(sstDebug.hThread);
+
+      /* Deletes locks */
+      DeleteCriticalSection(&(sstDebug.stLock));
+      DeleteCriticalSection(&(sstDebug.stStreamLock));
+
+#else /* __orxWINDOWS__ */
+
+      /* Waits for it */
+      pthread_join(sstDebug.hThread, NULL);
+
+      /* Deletes locks & condition */
+      pthread_cond_destroy(&(sstDebug.stCondition));
+      pthread_mutex_destroy(&(sstDebug.stLock));
+      pthread_mutex_destroy(&(sstDebug.stStreamLock));
+
+#endif /* __orxWINDOWS__ */
+
+      /* Deletes ring buffer */
+      free(sstDebug.astEntryList);
+      sstDebug.astEntryList = orxNULL;
+    }
+
 #if !defined(__orxANDROID__) && !defined(__orxANDROID_NATIVE__)
 
     /* Closes files */
@@ -456,6 +1137,41 @@ void orxFASTCALL _orxDebug_Break()
   return;
 }
 
+/** Waits for all the pending output to be written and flushed */
+void orxFASTCALL _orxDebug_Flush()
+{
+  /* Checks */
+  orxASSERT(sstDebug.u32Flags & orxDEBUG_KU32_STATIC_FLAG_READY);
+
+  /* Asynchronous output? */
+  if(sstDebug.u32Flags & orxDEBUG_KU32_STATIC_FLAG_ASYNC)
+  {
+    orxU32 u32Index;
+
+    /* Gets last reserved position */
+    u32Index = sstDebug.u32InIndex;
+
+    /* Until everything up to it has been flushed */
+    while((orxS32)(sstDebug.u32FlushIndex - u32Index) < 0)
+    {
+      /* Requests a flush */
+      sstDebug.u32FlushRequest = 1;
+      orxDebug_Signal();
+
+      /* Yields */
+      orxDebug_Yield();
+    }
+  }
+  else
+  {
+    /* Flushes everything */
+    orxDebug_Flush(orxTRUE);
+  }
+
+  /* Done! */
+  return;
+}
+
 /** Sets current debug flags
  * @param[in]   _u32Add                       Flags to add
  * @param[in]   _u32Remove                    Flags to remove
@@ -599,112 +1315,26 @@ void orxCDECL _orxDebug_Log(orxDEBUG_LEVEL _eLevel, const orxSTRING _zFunction,
 
     pcBuffer[orxDEBUG_KS32_BUFFER_OUTPUT_SIZE  - (pcBuffer - zBuffer) - 1] = '\0';
 
-    /* Doesn't have ANSI support? */
-    if(!orxFLAG_TEST(sstDebug.u32Flags, orxDEBUG_KU32_STATIC_FLAG_ANSI))
+    /* Asynchronous output? */
+    if(orxFLAG_TEST(sstDebug.u32Flags, orxDEBUG_KU32_STATIC_FLAG_ASYNC))
     {
-      /* Clears ANSI codes */
-      orxDebug_ClearANSICodes(zBuffer);
-    }
-
-    /* Terminal display? */
-    if(sstDebug.u32DebugFlags & orxDEBUG_KU32_STATIC_FLAG_TERMINAL)
-    {
-#if defined(__orxANDROID__) || defined(__orxANDROID_NATIVE__)
-
-#define  LOG_TAG    "orxDebug"
-#define  LOGI(...)  __android_log_write(ANDROID_LOG_INFO,LOG_TAG,__VA_ARGS__)
-#define  LOGD(...)  __android_log_write(ANDROID_LOG_DEBUG,LOG_TAG,__VA_ARGS__)
-
-      if(_eLevel == orxDEBUG_LEVEL_LOG)
-      {
-        LOGI(zBuffer);
-      }
-      else
-      {
-        LOGD(zBuffer);
-      }
+      /* Queues it for the writer thread */
+      orxDebug_Enqueue(_eLevel, sstDebug.u32DebugFlags, zBuffer);
 
-#else /* __orxANDROID__ || __orxANDROID_NATIVE__ */
-
-      FILE *pstFile;
-
-      if(_eLevel == orxDEBUG_LEVEL_LOG)
-      {
-        pstFile = stdout;
-      }
-      else
+      /* Console display? */
+      if(sstDebug.u32DebugFlags & orxDEBUG_KU32_STATIC_FLAG_CONSOLE)
       {
-        pstFile = stderr;
+        /* Clears ANSI codes */
+        orxDebug_ClearANSICodes(zBuffer);
       }
-
-      fprintf(pstFile, "%s", zBuffer);
-      fflush(pstFile);
-
-#endif /* __orxANDROID__ || __orxANDROID_NATIVE__ */
-
     }
-
-    /* Has ANSI support? */
-    if(orxFLAG_TEST(sstDebug.u32Flags, orxDEBUG_KU32_STATIC_FLAG_ANSI))
+    else
     {
-      /* Clears ANSI codes */
-      orxDebug_ClearANSICodes(zBuffer);
-    }
+      /* Writes it */
+      orxDebug_Write(_eLevel, sstDebug.u32DebugFlags, zBuffer);
 
-#ifdef __orxWINDOWS__
-
-    /* Terminal display? */
-    if(sstDebug.u32DebugFlags & orxDEBUG_KU32_STATIC_FLAG_TERMINAL)
-    {
-      OutputDebugString(zBuffer);
-    }
-
-#endif /* __orxWINDOWS__ */
-
-    /* File print? */
-    if(sstDebug.u32DebugFlags & orxDEBUG_KU32_STATIC_FLAG_FILE)
-    {
-      FILE *pstFile;
-
-      if(_eLevel == orxDEBUG_LEVEL_LOG)
-      {
-
-#if !defined(__orxANDROID__) && !defined(__orxANDROID_ANDROID__)
-
-        /* Needs to open the file? */
-        if(sstDebug.pstLogFile == orxNULL)
-        {
-          /* Opens it */
-          sstDebug.pstLogFile = fopen(sstDebug.zLogFile, "ab+");
-        }
-
-#endif /* !__orxANDROID__ && !__orxANDROID_NATIVE__ */
-
-        pstFile = sstDebug.pstLogFile;
-      }
-      else
-      {
-
-#if !defined(__orxANDROID__) && !defined(__orxANDROID_ANDROID__)
-
-        /* Needs to open the file? */
-        if(sstDebug.pstDebugFile == orxNULL)
-        {
-          /* Opens it */
-          sstDebug.pstDebugFile = fopen(sstDebug.zDebugFile, "ab+");
-        }
-
-#endif /* !__orxANDROID__ && !__orxANDROID_NATIVE__ */
-
-        pstFile = sstDebug.pstDebugFile;
-      }
-
-      /* Valid? */
-      if(pstFile != orxNULL)
-      {
-        fprintf(pstFile, "%s", zBuffer);
-        fflush(pstFile);
-      }
+      /* Flushes output */
+      orxDebug_Flush(orxTRUE);
     }
 
     /* Console display? */
@@ -806,6 +1436,16 @@ void orxFASTCALL _orxDebug_SetDebugFile(const orxSTRING _zFileName)
   /* Checks */
   orxASSERT(sstDebug.u32Flags & orxDEBUG_KU32_STATIC_FLAG_READY);
 
+  /* Asynchronous output? */
+  if(sstDebug.u32Flags & orxDEBUG_KU32_STATIC_FLAG_ASYNC)
+  {
+    /* Writes pending lines to the previous file */
+    _orxDebug_Flush();
+
+    /* Locks writer thread out */
+    orxDebug_Lock();
+  }
+
   /* Was open? */
   if(sstDebug.pstDebugFile != orxNULL)
   {
@@ -840,6 +1480,13 @@ void orxFASTCALL _orxDebug_SetDebugFile(const orxSTRING _zFileName)
     /* Uses default file */
     sstDebug.zDebugFile = (orxSTRING)orxDEBUG_KZ_DEFAULT_DEBUG_FILE;
   }
+
+  /* Asynchronous output? */
+  if(sstDebug.u32Flags & orxDEBUG_KU32_STATIC_FLAG_ASYNC)
+  {
+    /* Unlocks writer thread */
+    orxDebug_Unlock();
+  }
 }
 
 /** Sets log file name
@@ -850,6 +1497,16 @@ void orxFASTCALL _orxDebug_SetLogFile(const orxSTRING _zFileName)
   /* Checks */
   orxASSERT(sstDebug.u32Flags & orxDEBUG_KU32_STATIC_FLAG_READY);
 
+  /* Asynchronous output? */
+  if(sstDebug.u32Flags & orxDEBUG_KU32_STATIC_FLAG_ASYNC)
+  {
+    /* Writes pending lines to the previous file */
+    _orxDebug_Flush();
+
+    /* Locks writer thread out */
+    orxDebug_Lock();
+  }
+
   /* Was open? */
   if(sstDebug.pstLogFile != orxNULL)
   {
@@ -884,6 +1541,13 @@ void orxFASTCALL _orxDebug_SetLogFile(const orxSTRING _zFileName)
     /* Uses default file */
     sstDebug.zLogFile = (orxSTRING)orxDEBUG_KZ_DEFAULT_LOG_FILE;
   }
+
+  /* Asynchronous output? */
+  if(sstDebug.u32Flags & orxDEBUG_KU32_STATIC_FLAG_ASYNC)
+  {
+    /* Unlocks writer thread */
+    orxDebug_Unlock();
+  }
 }
 
 #ifdef __orxMSVC__
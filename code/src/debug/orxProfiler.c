@@ -37,6 +37,19 @@
 #include "core/orxThread.h"
 #include "utils/orxString.h"
 
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifdef __orxLINUX__
+
+  #include <dlfcn.h>
+  #include <errno.h>
+  #include <execinfo.h>
+  #include <signal.h>
+  #include <sys/time.h>
+
+#endif /* __orxLINUX__ */
+
 
 #ifdef __orxMSVC__
   #pragma warning(disable : 4244)
@@ -48,8 +61,12 @@
 #define orxPROFILER_KU32_STATIC_FLAG_NONE         0x00000000
 
 #define orxPROFILER_KU32_STATIC_FLAG_READY        0x00000001
+#define orxPROFILER_KU32_STATIC_FLAG_SPIKE_FILE   0x00000002
+#define orxPROFILER_KU32_STATIC_FLAG_COST         0x00000004
 #define orxPROFILER_KU32_STATIC_FLAG_ENABLE_OPS   0x10000000
 #define orxPROFILER_KU32_STATIC_FLAG_PAUSED       0x20000000
+#define orxPROFILER_KU32_STATIC_FLAG_TRACE        0x40000000
+#define orxPROFILER_KU32_STATIC_FLAG_SAMPLING     0x80000000
 
 #define orxPROFILER_KU32_STATIC_MASK_ALL          0xFFFFFFFF
 
@@ -68,10 +85,31 @@
 /** Misc defines
  */
 #define orxPROFILER_KU32_MAX_MARKER_NUMBER        (orxPROFILER_KU32_MASK_MARKER_ID + 1)
-#define orxPROFILER_KU32_SHIFT_MARKER_ID          7
-#define orxPROFILER_KU32_MASK_MARKER_ID           0x7F
+#define orxPROFILER_KU32_SHIFT_MARKER_ID          12
+#define orxPROFILER_KU32_MASK_MARKER_ID           0xFFF
 #define orxPROFILER_KS32_MARKER_ID_ROOT           -2
 #define orxPROFILER_KU32_MARKER_DATA_NUMBER       orxTHREAD_KU32_MAX_THREAD_NUMBER
+#define orxPROFILER_KU32_HISTORY_ENTRY_MIN_SIZE   64          /**< Minimum number of entries allocated for a history frame */
+
+#define orxPROFILER_KU32_TRACE_EVENT_NUMBER       65536       /**< Trace ring buffer size, per thread, has to be a power of two */
+#define orxPROFILER_KU32_TRACE_FLAG_PUSH          0x80000000  /**< Trace event is a push (pop otherwise) */
+#define orxPROFILER_KZ_TRACE_FILE                 "orxtrace.json"
+
+#define orxPROFILER_KU32_SAMPLE_STACK_NUMBER      4096        /**< Number of distinct sampled call stacks, has to be a power of two */
+#define orxPROFILER_KU32_SAMPLE_STACK_DEPTH       48          /**< Maximum sampled call stack depth */
+#define orxPROFILER_KU32_SAMPLE_SKIP_DEPTH        2           /**< Signal handler & signal trampoline frames */
+#define orxPROFILER_KU32_SAMPLE_MAX_PROBE         64          /**< Maximum number of probes when looking for a call stack slot */
+#define orxPROFILER_KU32_SAMPLE_DEFAULT_FREQUENCY 1000        /**< Default sampling frequency, in Hz */
+#define orxPROFILER_KZ_SAMPLE_FILE                "orxsamples.txt"
+
+#define orxPROFILER_KU32_BUCKET_OCTAVE_SIZE       8           /**< Number of histogram buckets per power of two */
+#define orxPROFILER_KU32_BUCKET_OCTAVE_NUMBER     24          /**< Number of powers of two covered by the histograms, starting at 1us */
+#define orxPROFILER_KU32_BUCKET_NUMBER            (orxPROFILER_KU32_BUCKET_OCTAVE_SIZE * orxPROFILER_KU32_BUCKET_OCTAVE_NUMBER + 1)
+#define orxPROFILER_KZ_SPIKE_FILE                 "orxspikes.txt"
+
+#define orxPROFILER_KU32_COST_ENTRY_NUMBER        8192        /**< Cost report table size, has to be a power of two */
+#define orxPROFILER_KU32_COST_DEPTH               64          /**< Max cost record nesting */
+#define orxPROFILER_KZ_COST_FILE                  "orxcosts.txt"
 
 
 /***************************************************************************
@@ -87,9 +125,21 @@ typedef struct __orxPROFILER_HISTORY_ENTRY_t
   orxDOUBLE               dMaxCumulatedTime;
   orxU32                  u32PushCount;
   orxU32                  u32Depth;
+  orxS32                  s32MarkerID;
 
 } orxPROFILER_HISTORY_ENTRY;
 
+/** Internal history frame structure: only holds entries for the markers used during that frame
+ */
+typedef struct __orxPROFILER_HISTORY_FRAME_t
+{
+  orxPROFILER_HISTORY_ENTRY *astEntryList;
+  orxDOUBLE               dTimeStamp;
+  orxU32                  u32EntryCount;
+  orxU32                  u32EntrySize;
+
+} orxPROFILER_HISTORY_FRAME;
+
 /** Internal marker structure
  */
 typedef struct __orxPROFILER_MARKER_t
@@ -104,17 +154,75 @@ typedef struct __orxPROFILER_MARKER_t
 typedef struct __orxPROFILER_MARKER_INFO_t
 {
   orxDOUBLE               dTimeStamp;
+  orxDOUBLE               dMaxCumulatedTime;
   orxS32                  s32ParentID;
   orxU32                  u32Flags;
+  orxU32                  u32EntryIndex;              /**< Index of its entry in the current frame, only valid if that entry refers back to this marker */
+  orxU32                  u32QueryEntryIndex;         /**< Index of its entry in the query frame, same validity rule */
 
 } orxPROFILER_MARKER_INFO;
 
+/** Internal trace event structure
+ */
+typedef struct __orxPROFILER_TRACE_EVENT_t
+{
+  orxDOUBLE               dTimeStamp;
+  orxU32                  u32Info;                    /**< Marker ID | orxPROFILER_KU32_TRACE_FLAG_PUSH */
+
+} orxPROFILER_TRACE_EVENT;
+
+/** Internal sampled call stack structure
+ */
+typedef struct __orxPROFILER_SAMPLE_STACK_t
+{
+  volatile orxU32         u32Key;                     /**< Call stack hash, 0 when unused */
+  volatile orxU32         u32Count;
+  volatile orxU32         u32Ready;
+  orxU32                  u32ThreadID;
+  orxU32                  u32Depth;
+  void                   *apFrameList[orxPROFILER_KU32_SAMPLE_STACK_DEPTH];
+
+} orxPROFILER_SAMPLE_STACK;
+
+/** Internal cost entry structure
+ */
+typedef struct __orxPROFILER_COST_ENTRY_t
+{
+  orxSTRING               zName;
+  orxDOUBLE               dTotalTime;
+  orxDOUBLE               dSelfTime;
+  orxDOUBLE               dMaxTime;
+  orxU32                  u32NameID;
+  orxU32                  u32Count;
+  orxPROFILER_COST        eCost;
+
+} orxPROFILER_COST_ENTRY;
+
+/** Internal cost record structure (pushed & not yet popped)
+ */
+typedef struct __orxPROFILER_COST_RECORD_t
+{
+  orxPROFILER_COST_ENTRY *pstEntry;
+  orxDOUBLE               dStartTime;
+  orxDOUBLE               dChildTime;
+
+} orxPROFILER_COST_RECORD;
+
+/** Internal time histogram structure (log-scaled buckets, used for percentiles)
+ */
+typedef struct __orxPROFILER_HISTOGRAM_t
+{
+  orxDOUBLE               dMaxTime;
+  orxU32                  u32Count;
+  orxU32                  au32BucketList[orxPROFILER_KU32_BUCKET_NUMBER];
+
+} orxPROFILER_HISTOGRAM;
+
 /** Internal marker data structure
  */
 typedef struct __orxPROFILER_MARKER_DATA_t
 {
-  orxPROFILER_HISTORY_ENTRY aastHistory[orxPROFILER_KU32_HISTORY_LENGTH][orxPROFILER_KU32_MAX_MARKER_NUMBER];
-  orxDOUBLE               adTimeStampHistory[orxPROFILER_KU32_HISTORY_LENGTH];
+  orxPROFILER_HISTORY_FRAME astHistory[orxPROFILER_KU32_HISTORY_LENGTH];
   orxPROFILER_MARKER_INFO astMarkerInfoList[orxPROFILER_KU32_MAX_MARKER_NUMBER];
   orxS32                  s32MarkerCount;
   orxS32                  s32CurrentMarker;
@@ -123,6 +231,9 @@ typedef struct __orxPROFILER_MARKER_DATA_t
   orxU32                  u32HistoryIndex;
   orxU32                  u32HistoryQueryIndex;
   orxBOOL                 bReset;
+  orxBOOL                 bResetMaxima;
+  orxPROFILER_TRACE_EVENT *astTraceEventList;
+  orxU32                  u32TraceEventCount;
 
 } orxPROFILER_MARKER_DATA;
 
@@ -141,6 +252,32 @@ typedef struct __orxPROFILER_STATIC_t
 
   orxPROFILER_MARKER_DATA *apstMarkerDataList[orxPROFILER_KU32_MARKER_DATA_NUMBER];
 
+  orxPROFILER_SAMPLE_STACK *astSampleStackList;
+  volatile orxU32         u32SampleCount;
+  volatile orxU32         u32LostSampleCount;
+
+  orxPROFILER_HISTOGRAM   stFrameHistogram;
+  orxPROFILER_HISTOGRAM  *apstHistogramList[orxPROFILER_KU32_MAX_MARKER_NUMBER];
+  orxDOUBLE               dBudget;
+  orxU32                  u32BudgetHistory;
+  orxU32                  u32FrameCount;
+  orxU32                  u32SpikeCount;
+  orxU32                  u32LastSpikeFrame;
+
+  orxPROFILER_COST_ENTRY *astCostEntryList;
+  orxDOUBLE               dCostStartTime;
+  orxU32                  u32CostEntryCount;
+  orxU32                  u32CostDepth;
+  orxU32                  u32CostSkipCount;
+  orxU32                  u32CostLostCount;
+  orxPROFILER_COST_RECORD astCostRecordList[orxPROFILER_KU32_COST_DEPTH];
+
+#ifdef __orxLINUX__
+
+  struct sigaction        stPreviousSampleAction;
+
+#endif /* __orxLINUX__ */
+
 } orxPROFILER_STATIC;
 
 
@@ -180,7 +317,7 @@ static orxINLINE orxPROFILER_MARKER_DATA *orxProfiler_GetMarkerData(orxU32 _u32I
 
     /* Inits it */
     orxMemory_Zero(pstResult, sizeof(orxPROFILER_MARKER_DATA));
-    pstResult->adTimeStampHistory[pstResult->u32HistoryIndex] = orxSystem_GetTime();
+    pstResult->astHistory[pstResult->u32HistoryIndex].dTimeStamp = orxSystem_GetTime();
     pstResult->s32CurrentMarker = orxPROFILER_KS32_MARKER_ID_ROOT;
 
     /* Inits all marker info */
@@ -189,6 +326,8 @@ static orxINLINE orxPROFILER_MARKER_DATA *orxProfiler_GetMarkerData(orxU32 _u32I
       pstResult->astMarkerInfoList[i].dTimeStamp  = orxDOUBLE_0;
       pstResult->astMarkerInfoList[i].s32ParentID = orxPROFILER_KS32_MARKER_ID_NONE;
       pstResult->astMarkerInfoList[i].u32Flags    = orxPROFILER_KU32_FLAG_UNIQUE;
+      pstResult->astMarkerInfoList[i].u32EntryIndex = orxU32_UNDEFINED;
+      pstResult->astMarkerInfoList[i].u32QueryEntryIndex = orxU32_UNDEFINED;
     }
 
     /* Stores it */
@@ -223,524 +362,1966 @@ static orxINLINE orxPROFILER_MARKER_DATA *orxProfiler_GetCurrentMarkerData()
   return pstResult;
 }
 
-static orxINLINE void orxProfiler_ResetData(orxPROFILER_MARKER_DATA *_pstData)
+static orxINLINE void orxProfiler_RecordTraceEvent(orxPROFILER_MARKER_DATA *_pstData, orxS32 _s32MarkerID, orxDOUBLE _dTimeStamp, orxBOOL _bPush)
 {
-  orxS32 i;
-  orxU32 u32NextIndex;
-
-  /* Gets next index */
-  u32NextIndex = (_pstData->u32HistoryIndex + 1) % orxPROFILER_KU32_HISTORY_LENGTH;
+  /* No trace buffer yet? */
+  if(_pstData->astTraceEventList == orxNULL)
+  {
+    /* Allocates it (only accessed by its owner thread until dumped) */
+    _pstData->astTraceEventList = (orxPROFILER_TRACE_EVENT *)orxMemory_Allocate(orxPROFILER_KU32_TRACE_EVENT_NUMBER * sizeof(orxPROFILER_TRACE_EVENT), orxMEMORY_TYPE_DEBUG);
+  }
 
-  /* For all markers */
-  for(i = 0; i < sstProfiler.s32MarkerCount; i++)
+  /* Valid? */
+  if(_pstData->astTraceEventList != orxNULL)
   {
-    orxPROFILER_HISTORY_ENTRY *pstEntry;
+    orxPROFILER_TRACE_EVENT *pstEvent;
 
-    /* Gets its info */
-    pstEntry = &(_pstData->aastHistory[u32NextIndex][i]);
+    /* Gets next event, overwriting the oldest one when full */
+    pstEvent = &(_pstData->astTraceEventList[_pstData->u32TraceEventCount & (orxPROFILER_KU32_TRACE_EVENT_NUMBER - 1)]);
 
-    /* Inits it */
-    pstEntry->dFirstTimeStamp   = orxDOUBLE_0;
-    pstEntry->dCumulatedTime    = orxDOUBLE_0;
-    pstEntry->dMaxCumulatedTime = _pstData->aastHistory[_pstData->u32HistoryIndex][i].dMaxCumulatedTime;
-    pstEntry->u32PushCount      = 0;
-    pstEntry->u32Depth          = 0;
+    /* Stores it */
+    pstEvent->dTimeStamp  = _dTimeStamp;
+    pstEvent->u32Info     = (orxU32)_s32MarkerID | ((_bPush != orxFALSE) ? orxPROFILER_KU32_TRACE_FLAG_PUSH : 0);
 
-    /* Resets marker */
-    _pstData->astMarkerInfoList[i].dTimeStamp = orxDOUBLE_0;
-    orxFLAG_SET(_pstData->astMarkerInfoList[i].u32Flags, orxPROFILER_KU32_FLAG_NONE, orxPROFILER_KU32_FLAG_PUSHED|orxPROFILER_KU32_FLAG_INIT);
+    /* Updates count */
+    orxMEMORY_BARRIER();
+    _pstData->u32TraceEventCount++;
   }
 
-  /* Updates new time stamps */
-  _pstData->adTimeStampHistory[u32NextIndex] = orxSystem_GetTime();
-
-  /* Updates history index */
-  orxMEMORY_BARRIER();
-  _pstData->u32HistoryIndex = u32NextIndex;
-
-  /* Updates its status */
-  orxMEMORY_BARRIER();
-  _pstData->bReset = orxFALSE;
-
   /* Done! */
   return;
 }
 
-/***************************************************************************
- * Public functions                                                        *
- ***************************************************************************/
-
-/** Setups Profiler module */
-void orxFASTCALL orxProfiler_Setup()
+static void orxFASTCALL orxProfiler_WriteTraceString(FILE *_pstFile, const orxSTRING _zString)
 {
-  /* Adds module dependencies */
-  orxModule_AddDependency(orxMODULE_ID_PROFILER, orxMODULE_ID_MEMORY);
-  orxModule_AddDependency(orxMODULE_ID_PROFILER, orxMODULE_ID_SYSTEM);
-  orxModule_AddDependency(orxMODULE_ID_PROFILER, orxMODULE_ID_THREAD);
+  const orxCHAR *pc;
+
+  /* Opens string */
+  fputc('"', _pstFile);
+
+  /* For all characters */
+  for(pc = _zString; *pc != orxCHAR_NULL; pc++)
+  {
+    /* Needs escaping? */
+    if((*pc == '"') || (*pc == '\\'))
+    {
+      fputc('\\', _pstFile);
+      fputc(*pc, _pstFile);
+    }
+    /* Printable? */
+    else if((orxU8)*pc >= 0x20)
+    {
+      fputc(*pc, _pstFile);
+    }
+  }
+
+  /* Closes string */
+  fputc('"', _pstFile);
 
   /* Done! */
   return;
 }
 
-/** Inits the Profiler module
- * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
- */
-orxSTATUS orxFASTCALL orxProfiler_Init()
+static orxINLINE orxPROFILER_HISTORY_ENTRY *orxProfiler_GetHistoryEntry(orxPROFILER_MARKER_DATA *_pstData, orxS32 _s32ID)
 {
-  orxSTATUS eResult = orxSTATUS_FAILURE;
+  orxPROFILER_HISTORY_FRAME  *pstFrame;
+  orxPROFILER_MARKER_INFO    *pstMarkerInfo;
+  orxPROFILER_HISTORY_ENTRY  *pstResult;
 
-  /* Checks */
-  orxASSERT(orxMath_IsPowerOfTwo(orxPROFILER_KU32_MAX_MARKER_NUMBER) != orxFALSE);
+  /* Gets current frame & marker info */
+  pstFrame      = &(_pstData->astHistory[_pstData->u32HistoryIndex]);
+  pstMarkerInfo = &(_pstData->astMarkerInfoList[_s32ID]);
 
-  /* Not already Initialized? */
-  if(!(sstProfiler.u32Flags & orxPROFILER_KU32_STATIC_FLAG_READY))
+  /* Already has an entry in this frame? */
+  if((pstMarkerInfo->u32EntryIndex < pstFrame->u32EntryCount)
+  && (pstFrame->astEntryList[pstMarkerInfo->u32EntryIndex].s32MarkerID == _s32ID))
   {
-    /* Cleans control structure */
-    orxMemory_Zero(&sstProfiler, sizeof(orxPROFILER_STATIC));
-
-    /* Creates semaphore */
-    sstProfiler.pstSemaphore = orxThread_CreateSemaphore(1);
-
-    /* Success? */
-    if(sstProfiler.pstSemaphore != orxNULL)
+    /* Updates result */
+    pstResult = &(pstFrame->astEntryList[pstMarkerInfo->u32EntryIndex]);
+  }
+  else
+  {
+    /* Is frame full? */
+    if(pstFrame->u32EntryCount == pstFrame->u32EntrySize)
     {
-      /* Creates data for main thread */
-      orxProfiler_GetMarkerData(orxTHREAD_KU32_MAIN_THREAD_ID, orxFALSE);
+      /* First allocation? */
+      if(pstFrame->u32EntrySize == 0)
+      {
+        /* Allocates entries */
+        pstFrame->u32EntrySize = orxPROFILER_KU32_HISTORY_ENTRY_MIN_SIZE;
+        pstFrame->astEntryList = (orxPROFILER_HISTORY_ENTRY *)orxMemory_Allocate(pstFrame->u32EntrySize * sizeof(orxPROFILER_HISTORY_ENTRY), orxMEMORY_TYPE_DEBUG);
+      }
+      else
+      {
+        /* Doubles entries */
+        pstFrame->u32EntrySize <<= 1;
+        pstFrame->astEntryList = (orxPROFILER_HISTORY_ENTRY *)orxMemory_Reallocate(pstFrame->astEntryList, pstFrame->u32EntrySize * sizeof(orxPROFILER_HISTORY_ENTRY));
+      }
 
-      /* Gets water stamp */
-      sstProfiler.s32WaterStamp = ((orxS32)(orxMath_Mod((orxFLOAT)orxSystem_GetSystemTime() * 1e3, (orxFLOAT)(1L << (32 - orxPROFILER_KU32_SHIFT_MARKER_ID))))) << orxPROFILER_KU32_SHIFT_MARKER_ID;
+      /* Checks */
+      orxASSERT(pstFrame->astEntryList != orxNULL);
+    }
 
-      /* Updates flags */
-      sstProfiler.u32Flags = orxPROFILER_KU32_STATIC_FLAG_READY | orxPROFILER_KU32_STATIC_FLAG_ENABLE_OPS;
+    /* Stores its index */
+    pstMarkerInfo->u32EntryIndex = pstFrame->u32EntryCount++;
 
-      /* Selects query frame */
-      orxProfiler_SelectQueryFrame(0, orxTHREAD_KU32_MAIN_THREAD_ID);
+    /* Gets it */
+    pstResult = &(pstFrame->astEntryList[pstMarkerInfo->u32EntryIndex]);
 
-      /* Updates result */
-      eResult = orxSTATUS_SUCCESS;
-    }
-    else
-    {
-      /* Logs message */
-      orxDEBUG_PRINT(orxDEBUG_LEVEL_PROFILER, "Couldn't create semaphore.");
-    }
+    /* Inits it */
+    pstResult->dFirstTimeStamp    = orxDOUBLE_0;
+    pstResult->dCumulatedTime     = orxDOUBLE_0;
+    pstResult->dMaxCumulatedTime  = pstMarkerInfo->dMaxCumulatedTime;
+    pstResult->u32PushCount       = 0;
+    pstResult->u32Depth           = 0;
+    pstResult->s32MarkerID        = _s32ID;
   }
-  else
-  {
-    /* Logs message */
-    orxDEBUG_PRINT(orxDEBUG_LEVEL_PROFILER, "Tried to initialize profiler module when it was already initialized.");
 
-    /* Already initialized */
-    eResult = orxSTATUS_SUCCESS;
+  /* Done! */
+  return pstResult;
+}
+
+static orxINLINE const orxPROFILER_HISTORY_ENTRY *orxProfiler_GetQueryEntry(const orxPROFILER_MARKER_DATA *_pstData, orxS32 _s32ID)
+{
+  const orxPROFILER_HISTORY_FRAME  *pstFrame;
+  orxU32                            u32Index;
+  const orxPROFILER_HISTORY_ENTRY  *pstResult = orxNULL;
+
+  /* Gets query frame & entry index */
+  pstFrame = &(_pstData->astHistory[_pstData->u32HistoryQueryIndex]);
+  u32Index = _pstData->astMarkerInfoList[_s32ID].u32QueryEntryIndex;
+
+  /* Was marker used during that frame? */
+  if((u32Index < pstFrame->u32EntryCount)
+  && (pstFrame->astEntryList[u32Index].s32MarkerID == _s32ID))
+  {
+    /* Updates result */
+    pstResult = &(pstFrame->astEntryList[u32Index]);
   }
 
   /* Done! */
-  return eResult;
+  return pstResult;
 }
 
-/** Exits from the Profiler module */
-void orxFASTCALL orxProfiler_Exit()
+#ifdef __orxLINUX__
+
+static void orxProfiler_HandleSample(int _iSignal)
 {
-  /* Initialized? */
-  if(sstProfiler.u32Flags & orxPROFILER_KU32_STATIC_FLAG_READY)
+  void *apFrameList[orxPROFILER_KU32_SAMPLE_STACK_DEPTH + orxPROFILER_KU32_SAMPLE_SKIP_DEPTH];
+  int   iDepth, iErrno;
+
+  /* Backups errno */
+  iErrno = errno;
+
+  /* Captures call stack (backtrace() has been primed outside of the handler so that it doesn't allocate) */
+  iDepth = backtrace(apFrameList, orxPROFILER_KU32_SAMPLE_STACK_DEPTH + orxPROFILER_KU32_SAMPLE_SKIP_DEPTH);
+
+  /* Valid? */
+  if(iDepth > (int)orxPROFILER_KU32_SAMPLE_SKIP_DEPTH)
   {
-    orxU32 i;
+    void  **apStack;
+    orxU32  u32Depth, u32ThreadID, u32Key, i;
 
-    /* For all marker data */
-    for(i = 0; i < orxPROFILER_KU32_MARKER_DATA_NUMBER; i++)
+    /* Skips handler frames */
+    apStack   = &apFrameList[orxPROFILER_KU32_SAMPLE_SKIP_DEPTH];
+    u32Depth  = (orxU32)iDepth - orxPROFILER_KU32_SAMPLE_SKIP_DEPTH;
+
+    /* Gets current thread */
+    u32ThreadID = orxThread_GetCurrent();
+
+    /* Hashes thread & call stack (FNV-1a) */
+    for(i = 0, u32Key = 2166136261u ^ u32ThreadID; i < u32Depth; i++)
     {
-      orxPROFILER_MARKER_DATA *pstData;
+      u32Key = (u32Key ^ (orxU32)((size_t)apStack[i] >> 2)) * 16777619u;
+    }
+    u32Key |= 1;
 
-      /* Gets it */
-      pstData = sstProfiler.apstMarkerDataList[i];
+    /* For all probes */
+    for(i = 0; i < orxPROFILER_KU32_SAMPLE_MAX_PROBE; i++)
+    {
+      orxPROFILER_SAMPLE_STACK *pstStack;
 
-      /* Valid? */
-      if(pstData != orxNULL)
+      /* Gets slot */
+      pstStack = &(sstProfiler.astSampleStackList[(u32Key + i) & (orxPROFILER_KU32_SAMPLE_STACK_NUMBER - 1)]);
+
+      /* Free? */
+      if(pstStack->u32Key == 0)
       {
-        /* Deletes data */
-        orxMemory_Free(pstData);
-        sstProfiler.apstMarkerDataList[i] = orxNULL;
+        /* Claims it */
+        if(orxMEMORY_ATOMIC_CAS32(&(pstStack->u32Key), 0, u32Key) == 0)
+        {
+          /* Stores call stack */
+          orxMemory_Copy(pstStack->apFrameList, apStack, u32Depth * sizeof(void *));
+          pstStack->u32Depth    = u32Depth;
+          pstStack->u32ThreadID = u32ThreadID;
+          orxMEMORY_BARRIER();
+          pstStack->u32Ready    = orxTRUE;
+        }
+      }
+
+      /* Same call stack? */
+      if(pstStack->u32Key == u32Key)
+      {
+        /* Updates its count */
+        orxMEMORY_ATOMIC_ADD32(&(pstStack->u32Count), 1);
+        break;
       }
     }
 
-    /* For all existing markers */
-    for(i = 0; i < (orxU32)sstProfiler.s32MarkerCount; i++)
+    /* Not stored? */
+    if(i == orxPROFILER_KU32_SAMPLE_MAX_PROBE)
     {
-      /* Deletes its name */
-      orxString_Delete(sstProfiler.astMarkerList[i].zName);
+      /* Updates lost count */
+      orxMEMORY_ATOMIC_ADD32(&(sstProfiler.u32LostSampleCount), 1);
     }
 
-    /* Deletes semaphore */
-    orxThread_DeleteSemaphore(sstProfiler.pstSemaphore);
-
-    /* Updates flags */
-    sstProfiler.u32Flags &= ~orxPROFILER_KU32_STATIC_FLAG_READY;
-  }
-  else
-  {
-    /* Logs message */
-    orxDEBUG_PRINT(orxDEBUG_LEVEL_PROFILER, "Tried to exit profiler module when it wasn't initialized.");
+    /* Updates sample count */
+    orxMEMORY_ATOMIC_ADD32(&(sstProfiler.u32SampleCount), 1);
   }
 
+  /* Restores errno */
+  errno = iErrno;
+
+  /* Done! */
   return;
 }
 
-/** Gets a marker ID given a name
- * @param[in] _zName            Name of the marker
- * @return Marker's ID / orxPROFILER_KS32_MARKER_ID_NONE
- */
-orxS32 orxFASTCALL orxProfiler_GetIDFromName(const orxSTRING _zName)
+static void orxFASTCALL orxProfiler_WriteSampleFrame(FILE *_pstFile, void *_pFrame)
 {
-  orxS32 s32MarkerID;
-  orxU32 u32NameID;
-
-  /* Checks */
-  orxASSERT(sstProfiler.u32Flags & orxPROFILER_KU32_STATIC_FLAG_READY);
-  orxASSERT(_zName != orxNULL);
-
-  /* Waits for semaphore */
-  orxThread_WaitSemaphore(sstProfiler.pstSemaphore);
-
-  /* Gets name ID */
-  u32NameID = orxString_ToCRC(_zName);
+  Dl_info stInfo;
 
-  /* For all markers */
-  for(s32MarkerID = 0; s32MarkerID < sstProfiler.s32MarkerCount; s32MarkerID++)
+  /* Finds its symbol */
+  if((dladdr(_pFrame, &stInfo) != 0) && (stInfo.dli_sname != NULL))
   {
-    /* Matches? */
-    if(u32NameID == sstProfiler.astMarkerList[s32MarkerID].u32NameID)
-    {
-      /* Stops */
-      break;
-    }
+    /* Writes it */
+    fputs(stInfo.dli_sname, _pstFile);
   }
-
-  /* Not found? */
-  if(s32MarkerID >= sstProfiler.s32MarkerCount)
+  /* Finds its module? */
+  else if((dladdr(_pFrame, &stInfo) != 0) && (stInfo.dli_fname != NULL))
   {
-    /* Has free marker IDs? */
-    if(sstProfiler.s32MarkerCount < orxPROFILER_KU32_MAX_MARKER_NUMBER)
-    {
-      /* Updates marker count */
-      sstProfiler.s32MarkerCount++;
-
-      /* Inits it */
-      sstProfiler.astMarkerList[s32MarkerID].zName     = orxString_Duplicate(_zName);
-      sstProfiler.astMarkerList[s32MarkerID].u32NameID = u32NameID;
+    const orxCHAR *pc, *zModule;
 
-      /* Stamps result */
-      s32MarkerID |= sstProfiler.s32WaterStamp;
-    }
-    else
+    /* Gets module base name */
+    for(pc = zModule = stInfo.dli_fname; *pc != orxCHAR_NULL; pc++)
     {
-      /* Logs message */
-      orxDEBUG_PRINT(orxDEBUG_LEVEL_PROFILER, "Can't get a marker ID for <%s> as the limit of %d markers has been reached!", _zName, orxPROFILER_KU32_MAX_MARKER_NUMBER);
-
-      /* Updates marker ID */
-      s32MarkerID = orxPROFILER_KS32_MARKER_ID_NONE;
+      if(*pc == '/')
+      {
+        zModule = pc + 1;
+      }
     }
+
+    /* Writes module & offset, to be resolved with addr2line */
+    fprintf(_pstFile, "%s+0x%lx", zModule, (unsigned long)((orxU8 *)_pFrame - (orxU8 *)stInfo.dli_fbase));
   }
   else
   {
-    /* Stamps result */
-    s32MarkerID |= sstProfiler.s32WaterStamp;
+    /* Writes raw address */
+    fprintf(_pstFile, "%p", _pFrame);
   }
 
-  /* Signals semaphore */
-  orxThread_SignalSemaphore(sstProfiler.pstSemaphore);
-
   /* Done! */
-  return s32MarkerID;
+  return;
 }
 
-/** Is the given marker valid? (Useful when storing markers in static variables and still allow normal hot restart)
- * @param[in] _s32MarkerID      ID of the marker to test
- * @return orxTRUE / orxFALSE
- */
-orxBOOL orxFASTCALL orxProfiler_IsMarkerIDValid(orxS32 _s32MarkerID)
+#endif /* __orxLINUX__ */
+
+static orxINLINE void orxProfiler_ResetData(orxPROFILER_MARKER_DATA *_pstData)
 {
-  orxBOOL bResult;
+  orxPROFILER_HISTORY_FRAME  *pstFrame;
+  orxU32                      u32NextIndex, i;
 
+  /* Gets current frame & next index */
+  pstFrame      = &(_pstData->astHistory[_pstData->u32HistoryIndex]);
+  u32NextIndex  = (_pstData->u32HistoryIndex + 1) % orxPROFILER_KU32_HISTORY_LENGTH;
+
+  /* For all markers used during the current frame */
+  for(i = 0; i < pstFrame->u32EntryCount; i++)
+  {
+    orxPROFILER_MARKER_INFO *pstMarkerInfo;
+
+    /* Gets its info */
+    pstMarkerInfo = &(_pstData->astMarkerInfoList[pstFrame->astEntryList[i].s32MarkerID]);
+
+    /* Resets marker */
+    pstMarkerInfo->dTimeStamp = orxDOUBLE_0;
+    orxFLAG_SET(pstMarkerInfo->u32Flags, orxPROFILER_KU32_FLAG_NONE, orxPROFILER_KU32_FLAG_PUSHED|orxPROFILER_KU32_FLAG_INIT);
+  }
+
+  /* Should reset maxima? */
+  if(_pstData->bResetMaxima != orxFALSE)
+  {
+    /* For all markers */
+    for(i = 0; i < (orxU32)sstProfiler.s32MarkerCount; i++)
+    {
+      /* Resets its maximum */
+      _pstData->astMarkerInfoList[i].dMaxCumulatedTime = orxDOUBLE_0;
+    }
+  }
+
+  /* Clears next frame */
+  _pstData->astHistory[u32NextIndex].u32EntryCount = 0;
+
+  /* Updates new time stamps */
+  _pstData->astHistory[u32NextIndex].dTimeStamp = orxSystem_GetTime();
+
+  /* Updates maxima status */
+  _pstData->bResetMaxima = orxFALSE;
+
+  /* Updates history index */
+  orxMEMORY_BARRIER();
+  _pstData->u32HistoryIndex = u32NextIndex;
+
+  /* Updates its status */
+  orxMEMORY_BARRIER();
+  _pstData->bReset = orxFALSE;
+
+  /* Done! */
+  return;
+}
+
+static orxINLINE orxU32 orxProfiler_GetBucketIndex(orxDOUBLE _dTime)
+{
+  orxDOUBLE dMicroSeconds;
+  orxU32    u32Result;
+
+  /* Gets time in microseconds */
+  dMicroSeconds = _dTime * orx2D(1e6);
+
+  /* Less than 1us? */
+  if(dMicroSeconds < orx2D(1.0))
+  {
+    /* Updates result */
+    u32Result = 0;
+  }
+  else
+  {
+    orxDOUBLE dMantissa;
+    int       iExponent;
+
+    /* Splits it: dMicroSeconds = dMantissa * 2^iExponent, with dMantissa in [0.5, 1) */
+    dMantissa = frexp(dMicroSeconds, &iExponent);
+
+    /* Updates result */
+    u32Result = 1 + (orxU32)(iExponent - 1) * orxPROFILER_KU32_BUCKET_OCTAVE_SIZE + (orxU32)((dMantissa * orx2D(2.0) - orx2D(1.0)) * orx2D(orxPROFILER_KU32_BUCKET_OCTAVE_SIZE));
+    u32Result = orxMIN(u32Result, orxPROFILER_KU32_BUCKET_NUMBER - 1);
+  }
+
+  /* Done! */
+  return u32Result;
+}
+
+static orxINLINE void orxProfiler_AddHistogramTime(orxPROFILER_HISTOGRAM *_pstHistogram, orxDOUBLE _dTime)
+{
+  /* Updates it */
+  _pstHistogram->au32BucketList[orxProfiler_GetBucketIndex(_dTime)]++;
+  _pstHistogram->u32Count++;
+  if(_dTime > _pstHistogram->dMaxTime)
+  {
+    _pstHistogram->dMaxTime = _dTime;
+  }
+
+  /* Done! */
+  return;
+}
+
+static orxDOUBLE orxFASTCALL orxProfiler_GetHistogramPercentile(const orxPROFILER_HISTOGRAM *_pstHistogram, orxFLOAT _fPercentile)
+{
+  orxDOUBLE dResult = orxDOUBLE_0;
+
+  /* Not empty? */
+  if(_pstHistogram->u32Count != 0)
+  {
+    orxU32 u32Rank, u32Count, i;
+
+    /* Gets rank of the percentile */
+    u32Rank = (orxU32)orxMath_Ceil(orxCLAMP(_fPercentile, orxFLOAT_0, orx2F(100.0f)) * orx2F(0.01f) * orxU2F(_pstHistogram->u32Count));
+    u32Rank = orxMAX(u32Rank, 1);
+
+    /* Finds its bucket */
+    for(i = 0, u32Count = _pstHistogram->au32BucketList[0]; (u32Count < u32Rank) && (i < orxPROFILER_KU32_BUCKET_NUMBER - 1); u32Count += _pstHistogram->au32BucketList[++i])
+      ;
+
+    /* Gets its upper bound (in seconds) */
+    dResult = (i == 0)
+            ? orx2D(1e-6)
+            : ldexp(orx2D(1.0) + (orxDOUBLE)((i - 1) % orxPROFILER_KU32_BUCKET_OCTAVE_SIZE + 1) / orx2D(orxPROFILER_KU32_BUCKET_OCTAVE_SIZE), (int)((i - 1) / orxPROFILER_KU32_BUCKET_OCTAVE_SIZE)) * orx2D(1e-6);
+
+    /* Can't be above the maximum */
+    dResult = orxMIN(dResult, _pstHistogram->dMaxTime);
+  }
+
+  /* Done! */
+  return dResult;
+}
+
+static void orxFASTCALL orxProfiler_WriteSpike(const orxPROFILER_MARKER_DATA *_pstData, orxDOUBLE _dTime, orxDOUBLE _dFrameTime)
+{
+  FILE *pstFile;
+
+  /* Opens file (truncated for the first spike) */
+  pstFile = fopen(orxPROFILER_KZ_SPIKE_FILE, orxFLAG_TEST(sstProfiler.u32Flags, orxPROFILER_KU32_STATIC_FLAG_SPIKE_FILE) ? "a" : "w");
+
+  /* Success? */
+  if(pstFile != NULL)
+  {
+    orxU32 i;
+
+    /* Writes header */
+    fprintf(pstFile, "Spike #%u, frame %u: %.3fms (budget: %.3fms)\n", sstProfiler.u32SpikeCount, sstProfiler.u32FrameCount, _dFrameTime * orx2D(1000.0), sstProfiler.dBudget * orx2D(1000.0));
+
+    /* For the spike frame and the previous ones */
+    for(i = 0; i <= sstProfiler.u32BudgetHistory; i++)
+    {
+      const orxPROFILER_HISTORY_FRAME  *pstFrame;
+      orxU32                            u32Index, j;
+
+      /* Gets frame index */
+      u32Index = (_pstData->u32HistoryIndex + orxPROFILER_KU32_HISTORY_LENGTH - i) % orxPROFILER_KU32_HISTORY_LENGTH;
+
+      /* Gets it */
+      pstFrame = &(_pstData->astHistory[u32Index]);
+
+      /* Never used? */
+      if(pstFrame->dTimeStamp == orxDOUBLE_0)
+      {
+        break;
+      }
+
+      /* Writes its duration */
+      fprintf(pstFile, "  Frame -%u: %.3fms\n", i, (((i == 0) ? _dTime : _pstData->astHistory[(u32Index + 1) % orxPROFILER_KU32_HISTORY_LENGTH].dTimeStamp) - pstFrame->dTimeStamp) * orx2D(1000.0));
+
+      /* For all its markers, in first push order */
+      for(j = 0; j < pstFrame->u32EntryCount; j++)
+      {
+        const orxPROFILER_HISTORY_ENTRY *pstEntry;
+
+        /* Gets it */
+        pstEntry = &(pstFrame->astEntryList[j]);
+
+        /* Writes it */
+        fprintf(pstFile, "    %*s%s: %.3fms, %u push(es)%s\n", 2 * (orxS32)((pstEntry->u32Depth > 0) ? pstEntry->u32Depth - 1 : 0), "", sstProfiler.astMarkerList[pstEntry->s32MarkerID].zName, pstEntry->dCumulatedTime * orx2D(1000.0), pstEntry->u32PushCount, (pstEntry->u32Depth == 0) ? " [not unique]" : "");
+      }
+    }
+
+    /* Ends spike */
+    fputc('\n', pstFile);
+
+    /* Closes file */
+    fclose(pstFile);
+
+    /* Updates status */
+    orxFLAG_SET(sstProfiler.u32Flags, orxPROFILER_KU32_STATIC_FLAG_SPIKE_FILE, orxPROFILER_KU32_STATIC_FLAG_NONE);
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_PROFILER, "Can't open <%s> to write spike.", orxPROFILER_KZ_SPIKE_FILE);
+  }
+
+  /* Done! */
+  return;
+}
+
+static orxINLINE void orxProfiler_UpdateFrameStats(orxPROFILER_MARKER_DATA *_pstData)
+{
+  const orxPROFILER_HISTORY_FRAME  *pstFrame;
+  orxDOUBLE                         dTime, dFrameTime;
+  orxU32                            i;
+
+  /* Gets current frame */
+  pstFrame = &(_pstData->astHistory[_pstData->u32HistoryIndex]);
+
+  /* Gets its duration */
+  dTime       = orxSystem_GetTime();
+  dFrameTime  = dTime - pstFrame->dTimeStamp;
+
+  /* Updates frame count & histogram */
+  sstProfiler.u32FrameCount++;
+  orxProfiler_AddHistogramTime(&(sstProfiler.stFrameHistogram), dFrameTime);
+
+  /* For all markers used during that frame */
+  for(i = 0; i < pstFrame->u32EntryCount; i++)
+  {
+    const orxPROFILER_HISTORY_ENTRY *pstEntry;
+
+    /* Gets it */
+    pstEntry = &(pstFrame->astEntryList[i]);
+
+    /* Top level? */
+    if(pstEntry->u32Depth == 1)
+    {
+      orxPROFILER_HISTOGRAM *pstHistogram;
+
+      /* Gets its histogram */
+      pstHistogram = sstProfiler.apstHistogramList[pstEntry->s32MarkerID];
+
+      /* Not yet created? */
+      if(pstHistogram == orxNULL)
+      {
+        /* Allocates it */
+        pstHistogram = (orxPROFILER_HISTOGRAM *)orxMemory_Allocate(sizeof(orxPROFILER_HISTOGRAM), orxMEMORY_TYPE_DEBUG);
+
+        /* Checks */
+        orxASSERT(pstHistogram != orxNULL);
+
+        /* Inits & stores it */
+        orxMemory_Zero(pstHistogram, sizeof(orxPROFILER_HISTOGRAM));
+        sstProfiler.apstHistogramList[pstEntry->s32MarkerID] = pstHistogram;
+      }
+
+      /* Updates it */
+      orxProfiler_AddHistogramTime(pstHistogram, pstEntry->dCumulatedTime);
+    }
+  }
+
+  /* Over budget? */
+  if((sstProfiler.dBudget > orxDOUBLE_0) && (dFrameTime > sstProfiler.dBudget))
+  {
+    /* Updates spike count */
+    sstProfiler.u32SpikeCount++;
+
+    /* Not overlapping with the last written spike? */
+    if((sstProfiler.u32LastSpikeFrame == 0) || (sstProfiler.u32FrameCount - sstProfiler.u32LastSpikeFrame > sstProfiler.u32BudgetHistory))
+    {
+      /* Writes it */
+      orxProfiler_WriteSpike(_pstData, dTime, dFrameTime);
+
+      /* Stores its frame */
+      sstProfiler.u32LastSpikeFrame = sstProfiler.u32FrameCount;
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+static orxPROFILER_COST_ENTRY *orxFASTCALL orxProfiler_GetCostEntry(orxPROFILER_COST _eCost, const orxSTRING _zName)
+{
+  orxPROFILER_COST_ENTRY *pstResult = orxNULL;
+  orxU32                  u32NameID, u32Index;
+
+  /* Gets name ID */
+  u32NameID = orxString_ToCRC(_zName);
+
+  /* For all probed entries */
+  for(u32Index = (u32NameID + (orxU32)_eCost) & (orxPROFILER_KU32_COST_ENTRY_NUMBER - 1);
+      sstProfiler.astCostEntryList[u32Index].zName != orxNULL;
+      u32Index = (u32Index + 1) & (orxPROFILER_KU32_COST_ENTRY_NUMBER - 1))
+  {
+    /* Matches? */
+    if((sstProfiler.astCostEntryList[u32Index].u32NameID == u32NameID) && (sstProfiler.astCostEntryList[u32Index].eCost == _eCost))
+    {
+      /* Updates result */
+      pstResult = &(sstProfiler.astCostEntryList[u32Index]);
+
+      break;
+    }
+  }
+
+  /* Not found? */
+  if(pstResult == orxNULL)
+  {
+    /* Table not too full? */
+    if(sstProfiler.u32CostEntryCount < (orxPROFILER_KU32_COST_ENTRY_NUMBER - (orxPROFILER_KU32_COST_ENTRY_NUMBER >> 2)))
+    {
+      /* Inits new entry */
+      pstResult             = &(sstProfiler.astCostEntryList[u32Index]);
+      pstResult->zName      = orxString_Duplicate(_zName);
+      pstResult->u32NameID  = u32NameID;
+      pstResult->eCost      = _eCost;
+
+      /* Updates count */
+      sstProfiler.u32CostEntryCount++;
+    }
+    else
+    {
+      /* Updates lost count */
+      sstProfiler.u32CostLostCount++;
+    }
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+static orxINLINE void orxProfiler_UpdateCostEntry(orxPROFILER_COST_ENTRY *_pstEntry, orxDOUBLE _dTime, orxDOUBLE _dChildTime)
+{
+  /* Valid? */
+  if(_pstEntry != orxNULL)
+  {
+    /* Updates it */
+    _pstEntry->dTotalTime  += _dTime;
+    _pstEntry->dSelfTime   += _dTime - _dChildTime;
+    _pstEntry->u32Count++;
+    if(_dTime > _pstEntry->dMaxTime)
+    {
+      _pstEntry->dMaxTime = _dTime;
+    }
+  }
+
+  /* Has enclosing record? */
+  if(sstProfiler.u32CostDepth != 0)
+  {
+    /* Updates its child time */
+    sstProfiler.astCostRecordList[sstProfiler.u32CostDepth - 1].dChildTime += _dTime;
+  }
+
+  /* Done! */
+  return;
+}
+
+static void orxFASTCALL orxProfiler_ClearCostEntries()
+{
+  orxU32 i;
+
+  /* For all entries */
+  for(i = 0; i < orxPROFILER_KU32_COST_ENTRY_NUMBER; i++)
+  {
+    /* Used? */
+    if(sstProfiler.astCostEntryList[i].zName != orxNULL)
+    {
+      /* Deletes its name */
+      orxString_Delete(sstProfiler.astCostEntryList[i].zName);
+    }
+  }
+
+  /* Clears them */
+  orxMemory_Zero(sstProfiler.astCostEntryList, orxPROFILER_KU32_COST_ENTRY_NUMBER * sizeof(orxPROFILER_COST_ENTRY));
+
+  /* Clears counters */
+  sstProfiler.u32CostEntryCount = 0;
+  sstProfiler.u32CostDepth      = 0;
+  sstProfiler.u32CostSkipCount  = 0;
+  sstProfiler.u32CostLostCount  = 0;
+
+  /* Done! */
+  return;
+}
+
+static int orxProfiler_CompareCostEntries(const void *_pElement1, const void *_pElement2)
+{
+  const orxPROFILER_COST_ENTRY *pstEntry1, *pstEntry2;
+  int                           iResult;
+
+  /* Gets entries */
+  pstEntry1 = *(const orxPROFILER_COST_ENTRY **)_pElement1;
+  pstEntry2 = *(const orxPROFILER_COST_ENTRY **)_pElement2;
+
+  /* Updates result: by type first, then by decreasing total time */
+  iResult = (pstEntry1->eCost != pstEntry2->eCost)
+            ? ((pstEntry1->eCost < pstEntry2->eCost) ? -1 : 1)
+            : (pstEntry1->dTotalTime != pstEntry2->dTotalTime)
+              ? ((pstEntry1->dTotalTime < pstEntry2->dTotalTime) ? 1 : -1)
+              : 0;
+
+  /* Done! */
+  return iResult;
+}
+
+/***************************************************************************
+ * Public functions                                                        *
+ ***************************************************************************/
+
+/** Setups Profiler module */
+void orxFASTCALL orxProfiler_Setup()
+{
+  /* Adds module dependencies */
+  orxModule_AddDependency(orxMODULE_ID_PROFILER, orxMODULE_ID_MEMORY);
+  orxModule_AddDependency(orxMODULE_ID_PROFILER, orxMODULE_ID_SYSTEM);
+  orxModule_AddDependency(orxMODULE_ID_PROFILER, orxMODULE_ID_THREAD);
+
+  /* Done! */
+  return;
+}
+
+/** Inits the Profiler module
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxProfiler_Init()
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT(orxMath_IsPowerOfTwo(orxPROFILER_KU32_MAX_MARKER_NUMBER) != orxFALSE);
+
+  /* Not already Initialized? */
+  if(!(sstProfiler.u32Flags & orxPROFILER_KU32_STATIC_FLAG_READY))
+  {
+    /* Cleans control structure */
+    orxMemory_Zero(&sstProfiler, sizeof(orxPROFILER_STATIC));
+
+    /* Creates semaphore */
+    sstProfiler.pstSemaphore = orxThread_CreateSemaphore(1);
+
+    /* Success? */
+    if(sstProfiler.pstSemaphore != orxNULL)
+    {
+      /* Creates data for main thread */
+      orxProfiler_GetMarkerData(orxTHREAD_KU32_MAIN_THREAD_ID, orxFALSE);
+
+      /* Inits spike history size */
+      sstProfiler.u32BudgetHistory = orxPROFILER_KU32_BUDGET_DEFAULT_HISTORY;
+
+      /* Gets water stamp */
+      sstProfiler.s32WaterStamp = ((orxS32)(orxMath_Mod((orxFLOAT)orxSystem_GetSystemTime() * 1e3, (orxFLOAT)(1L << (32 - orxPROFILER_KU32_SHIFT_MARKER_ID))))) << orxPROFILER_KU32_SHIFT_MARKER_ID;
+
+      /* Updates flags */
+      sstProfiler.u32Flags = orxPROFILER_KU32_STATIC_FLAG_READY | orxPROFILER_KU32_STATIC_FLAG_ENABLE_OPS;
+
+      /* Selects query frame */
+      orxProfiler_SelectQueryFrame(0, orxTHREAD_KU32_MAIN_THREAD_ID);
+
+      /* Updates result */
+      eResult = orxSTATUS_SUCCESS;
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_PROFILER, "Couldn't create semaphore.");
+    }
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_PROFILER, "Tried to initialize profiler module when it was already initialized.");
+
+    /* Already initialized */
+    eResult = orxSTATUS_SUCCESS;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Exits from the Profiler module */
+void orxFASTCALL orxProfiler_Exit()
+{
+  /* Initialized? */
+  if(sstProfiler.u32Flags & orxPROFILER_KU32_STATIC_FLAG_READY)
+  {
+    orxU32 i;
+
+    /* Sampling? */
+    if(orxFLAG_TEST(sstProfiler.u32Flags, orxPROFILER_KU32_STATIC_FLAG_SAMPLING))
+    {
+      /* Stops it */
+      orxProfiler_StopSampling();
+
+      /* Dumps samples */
+      orxProfiler_DumpSamples(orxNULL);
+    }
+
+    /* Has sampled call stacks? */
+    if(sstProfiler.astSampleStackList != orxNULL)
+    {
+      /* Deletes them */
+      orxMemory_Free(sstProfiler.astSampleStackList);
+      sstProfiler.astSampleStackList = orxNULL;
+    }
+
+    /* Has cost report table? */
+    if(sstProfiler.astCostEntryList != orxNULL)
+    {
+      /* Recording? */
+      if(orxFLAG_TEST(sstProfiler.u32Flags, orxPROFILER_KU32_STATIC_FLAG_COST))
+      {
+        /* Writes report */
+        orxProfiler_StopCostReport(orxNULL);
+      }
+
+      /* Deletes it */
+      orxMemory_Free(sstProfiler.astCostEntryList);
+      sstProfiler.astCostEntryList = orxNULL;
+    }
+
+    /* For all marker histograms */
+    for(i = 0; i < orxPROFILER_KU32_MAX_MARKER_NUMBER; i++)
+    {
+      /* Valid? */
+      if(sstProfiler.apstHistogramList[i] != orxNULL)
+      {
+        /* Deletes it */
+        orxMemory_Free(sstProfiler.apstHistogramList[i]);
+      }
+    }
+
+    /* For all marker data */
+    for(i = 0; i < orxPROFILER_KU32_MARKER_DATA_NUMBER; i++)
+    {
+      orxPROFILER_MARKER_DATA *pstData;
+
+      /* Gets it */
+      pstData = sstProfiler.apstMarkerDataList[i];
+
+      /* Valid? */
+      if(pstData != orxNULL)
+      {
+        orxU32 j;
+
+        /* For all history frames */
+        for(j = 0; j < orxPROFILER_KU32_HISTORY_LENGTH; j++)
+        {
+          /* Has entries? */
+          if(pstData->astHistory[j].astEntryList != orxNULL)
+          {
+            /* Deletes them */
+            orxMemory_Free(pstData->astHistory[j].astEntryList);
+          }
+        }
+
+        /* Has trace events? */
+        if(pstData->astTraceEventList != orxNULL)
+        {
+          /* Deletes them */
+          orxMemory_Free(pstData->astTraceEventList);
+        }
+
+        /* Deletes data */
+        orxMemory_Free(pstData);
+        sstProfiler.apstMarkerDataList[i] = orxNULL;
+      }
+    }
+
+    /* For all existing markers */
+    for(i = 0; i < (orxU32)sstProfiler.s32MarkerCount; i++)
+    {
+      /* Deletes its name */
+      orxString_Delete(sstProfiler.astMarkerList[i].zName);
+    }
+
+    /* Deletes semaphore */
+    orxThread_DeleteSemaphore(sstProfiler.pstSemaphore);
+
+    /* Updates flags */
+    sstProfiler.u32Flags &= ~orxPROFILER_KU32_STATIC_FLAG_READY;
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_PROFILER, "Tried to exit profiler module when it wasn't initialized.");
+  }
+
+  return;
+}
+
+/** Gets a marker ID given a name
+ * @param[in] _zName            Name of the marker
+ * @return Marker's ID / orxPROFILER_KS32_MARKER_ID_NONE
+ */
+orxS32 orxFASTCALL orxProfiler_GetIDFromName(const orxSTRING _zName)
+{
+  orxS32 s32MarkerID;
+  orxU32 u32NameID;
+
+  /* Checks */
+  orxASSERT(sstProfiler.u32Flags & orxPROFILER_KU32_STATIC_FLAG_READY);
+  orxASSERT(_zName != orxNULL);
+
+  /* Waits for semaphore */
+  orxThread_WaitSemaphore(sstProfiler.pstSemaphore);
+
+  /* Gets name ID */
+  u32NameID = orxString_ToCRC(_zName);
+
+  /* For all markers */
+  for(s32MarkerID = 0; s32MarkerID < sstProfiler.s32MarkerCount; s32MarkerID++)
+  {
+    /* Matches? */
+    if(u32NameID == sstProfiler.astMarkerList[s32MarkerID].u32NameID)
+    {
+      /* Stops */
+      break;
+    }
+  }
+
+  /* Not found? */
+  if(s32MarkerID >= sstProfiler.s32MarkerCount)
+  {
+    /* Has free marker IDs? */
+    if(sstProfiler.s32MarkerCount < orxPROFILER_KU32_MAX_MARKER_NUMBER)
+    {
+      /* Updates marker count */
+      sstProfiler.s32MarkerCount++;
+
+      /* Inits it */
+      sstProfiler.astMarkerList[s32MarkerID].zName     = orxString_Duplicate(_zName);
+      sstProfiler.astMarkerList[s32MarkerID].u32NameID = u32NameID;
+
+      /* Stamps result */
+      s32MarkerID |= sstProfiler.s32WaterStamp;
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_PROFILER, "Can't get a marker ID for <%s> as the limit of %d markers has been reached!", _zName, orxPROFILER_KU32_MAX_MARKER_NUMBER);
+
+      /* Updates marker ID */
+      s32MarkerID = orxPROFILER_KS32_MARKER_ID_NONE;
+    }
+  }
+  else
+  {
+    /* Stamps result */
+    s32MarkerID |= sstProfiler.s32WaterStamp;
+  }
+
+  /* Signals semaphore */
+  orxThread_SignalSemaphore(sstProfiler.pstSemaphore);
+
+  /* Done! */
+  return s32MarkerID;
+}
+
+/** Is the given marker valid? (Useful when storing markers in static variables and still allow normal hot restart)
+ * @param[in] _s32MarkerID      ID of the marker to test
+ * @return orxTRUE / orxFALSE
+ */
+orxBOOL orxFASTCALL orxProfiler_IsMarkerIDValid(orxS32 _s32MarkerID)
+{
+  orxBOOL bResult;
+
+  /* Checks */
+  orxASSERT(sstProfiler.u32Flags & orxPROFILER_KU32_STATIC_FLAG_READY);
+
+  /* Updates result */
+  bResult = ((_s32MarkerID & ~orxPROFILER_KU32_MASK_MARKER_ID) == sstProfiler.s32WaterStamp) ? orxTRUE : orxFALSE;
+
+  /* Done! */
+  return bResult;
+}
+
+/** Pushes a marker (on a stack) and starts a timer for it
+ * @param[in] _s32MarkerID      ID of the marker to push
+ */
+void orxFASTCALL orxProfiler_PushMarker(orxS32 _s32MarkerID)
+{
+  /* Checks */
+  orxASSERT(sstProfiler.u32Flags & orxPROFILER_KU32_STATIC_FLAG_READY);
+  orxASSERT(orxProfiler_IsMarkerIDValid(_s32MarkerID) != orxFALSE);
+
+  /* Not paused and are operations enabled on main thread? */
+  if((orxFLAG_GET(sstProfiler.u32Flags, orxPROFILER_KU32_STATIC_FLAG_PAUSED | orxPROFILER_KU32_STATIC_FLAG_ENABLE_OPS) == orxPROFILER_KU32_STATIC_FLAG_ENABLE_OPS)
+  || (orxThread_GetCurrent() != orxTHREAD_KU32_MAIN_THREAD_ID))
+  {
+    orxPROFILER_MARKER_DATA  *pstData;
+    orxS32                    s32ID;
+    orxBOOL                   bSkip = orxFALSE;
+
+    /* Gets current marker data */
+    pstData = orxProfiler_GetCurrentMarkerData();
+
+    /* Should reset and no marker pushed? */
+    if((pstData->bReset != orxFALSE) && (pstData->s32CurrentMarker == orxPROFILER_KS32_MARKER_ID_ROOT))
+    {
+      /* Resets it */
+      orxProfiler_ResetData(pstData);
+    }
+
+    /* Gets ID */
+    s32ID = _s32MarkerID & orxPROFILER_KU32_MASK_MARKER_ID;
+
+    /* Valid marker ID? */
+    if((s32ID >= 0) && (s32ID < sstProfiler.s32MarkerCount))
+    {
+      orxPROFILER_MARKER_INFO    *pstMarkerInfo;
+      orxPROFILER_HISTORY_ENTRY  *pstEntry;
+
+      /* Gets marker & current info */
+      pstMarkerInfo = &(pstData->astMarkerInfoList[s32ID]);
+      pstEntry      = orxProfiler_GetHistoryEntry(pstData, s32ID);
+
+      /* Not already pushed? */
+      if(!orxFLAG_TEST(pstMarkerInfo->u32Flags, orxPROFILER_KU32_FLAG_PUSHED))
+      {
+        orxDOUBLE dTimeStamp;
+        orxBOOL   bFirstTime;
+
+        /* Updates first time status */
+        bFirstTime = orxFLAG_TEST(pstMarkerInfo->u32Flags, orxPROFILER_KU32_FLAG_INIT) ? orxFALSE : orxTRUE;
+
+        /* Wasn't defined on this thread? */
+        if(!orxFLAG_TEST(pstMarkerInfo->u32Flags, orxPROFILER_KU32_FLAG_DEFINED))
+        {
+          /* Updates thread marker count */
+          pstData->s32MarkerCount++;
+        }
+
+        /* Is unique and already by someone else pushed? */
+        if(orxFLAG_TEST(pstMarkerInfo->u32Flags, orxPROFILER_KU32_FLAG_UNIQUE) && (pstEntry->u32PushCount != 0) && (pstMarkerInfo->s32ParentID != pstData->s32CurrentMarker))
+        {
+          orxPROFILER_HISTORY_FRAME *pstFrame;
+          orxU32                    i;
+
+          /* Updates flags */
+          orxFLAG_SET(pstMarkerInfo->u32Flags, orxPROFILER_KU32_FLAG_PUSHED|orxPROFILER_KU32_FLAG_INIT|orxPROFILER_KU32_FLAG_DEFINED, orxPROFILER_KU32_FLAG_UNIQUE);
+
+          /* Gets current frame */
+          pstFrame = &(pstData->astHistory[pstData->u32HistoryIndex]);
+
+          /* For all markers used during this frame */
+          for(i = 0; i < pstFrame->u32EntryCount; i++)
+          {
+            /* Is child of current marker? */
+            if(pstData->astMarkerInfoList[pstFrame->astEntryList[i].s32MarkerID].s32ParentID == s32ID)
+            {
+              /* Updates its depth */
+              pstFrame->astEntryList[i].u32Depth--;
+            }
+          }
+        }
+        else
+        {
+          /* Updates flags */
+          orxFLAG_SET(pstMarkerInfo->u32Flags, orxPROFILER_KU32_FLAG_PUSHED|orxPROFILER_KU32_FLAG_INIT|orxPROFILER_KU32_FLAG_DEFINED, orxPROFILER_KU32_FLAG_NONE);
+        }
+
+        /* Is unique? */
+        if(orxFLAG_TEST(pstMarkerInfo->u32Flags, orxPROFILER_KU32_FLAG_UNIQUE))
+        {
+          /* Stores its push depth */
+          pstEntry->u32Depth = ++pstData->u32CurrentMarkerDepth;
+        }
+        else
+        {
+          /* Clears push depth */
+          pstEntry->u32Depth = 0;
+        }
+
+        /* Updates its push count */
+        pstEntry->u32PushCount++;
+
+        /* Updates parent marker */
+        pstMarkerInfo->s32ParentID = pstData->s32CurrentMarker;
+
+        /* Updates current marker */
+        pstData->s32CurrentMarker = s32ID;
+
+        /* Gets time stamp */
+        dTimeStamp = orxSystem_GetTime();
+
+        /* First time? */
+        if(bFirstTime != orxFALSE)
+        {
+          /* Stores initial time */
+          pstEntry->dFirstTimeStamp = dTimeStamp;
+        }
+
+        /* Stores time stamp */
+        pstMarkerInfo->dTimeStamp = dTimeStamp;
+
+        /* Tracing? */
+        if(orxFLAG_TEST(sstProfiler.u32Flags, orxPROFILER_KU32_STATIC_FLAG_TRACE))
+        {
+          /* Records push */
+          orxProfiler_RecordTraceEvent(pstData, s32ID, dTimeStamp, orxTRUE);
+        }
+      }
+      else
+      {
+        /* Updates its push count */
+        pstEntry->u32PushCount++;
+
+        /* Skips marker */
+        bSkip = orxTRUE;
+      }
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_PROFILER, "Can't push marker: invalid ID [%d].", _s32MarkerID);
+
+      /* Skips marker */
+      bSkip = orxTRUE;
+    }
+
+    /* Updates marker pops to skip */
+    pstData->u32MarkerPopToSkip = (pstData->u32MarkerPopToSkip << 1) | ((bSkip != orxFALSE) ? 1 : 0);
+  }
+}
+
+/** Pops a marker (from the stack) and updates its cumulated time (using the last marker push time)
+ */
+void orxFASTCALL orxProfiler_PopMarker()
+{
+  /* Checks */
+  orxASSERT(sstProfiler.u32Flags & orxPROFILER_KU32_STATIC_FLAG_READY);
+
+  /* Not paused and are operations enabled on main thread? */
+  if((orxFLAG_GET(sstProfiler.u32Flags, orxPROFILER_KU32_STATIC_FLAG_PAUSED | orxPROFILER_KU32_STATIC_FLAG_ENABLE_OPS) == orxPROFILER_KU32_STATIC_FLAG_ENABLE_OPS)
+  || (orxThread_GetCurrent() != orxTHREAD_KU32_MAIN_THREAD_ID))
+  {
+    orxPROFILER_MARKER_DATA *pstData;
+
+    /* Gets current marker data */
+    pstData = orxProfiler_GetCurrentMarkerData();
+
+    /* Not skipping pop? */
+    if((pstData->u32MarkerPopToSkip & 1) == 0)
+    {
+      /* Has pushed marker? */
+      if(pstData->s32CurrentMarker >= 0)
+      {
+        orxPROFILER_MARKER_INFO    *pstMarkerInfo;
+        orxPROFILER_HISTORY_ENTRY  *pstEntry;
+        orxDOUBLE                   dTimeStamp;
+
+        /* Gets marker & current info */
+        pstMarkerInfo = &(pstData->astMarkerInfoList[pstData->s32CurrentMarker]);
+        pstEntry      = orxProfiler_GetHistoryEntry(pstData, pstData->s32CurrentMarker);
+
+        /* Gets time stamp */
+        dTimeStamp = orxSystem_GetTime();
+
+        /* Tracing? */
+        if(orxFLAG_TEST(sstProfiler.u32Flags, orxPROFILER_KU32_STATIC_FLAG_TRACE))
+        {
+          /* Records pop */
+          orxProfiler_RecordTraceEvent(pstData, pstData->s32CurrentMarker, dTimeStamp, orxFALSE);
+        }
+
+        /* Updates cumulated time */
+        pstEntry->dCumulatedTime += dTimeStamp - pstMarkerInfo->dTimeStamp;
+
+        /* Updates max cumulated time */
+        if(pstEntry->dCumulatedTime > pstEntry->dMaxCumulatedTime)
+        {
+          pstEntry->dMaxCumulatedTime     = pstEntry->dCumulatedTime;
+          pstMarkerInfo->dMaxCumulatedTime  = pstEntry->dCumulatedTime;
+        }
+
+        /* Pops previous marker */
+        pstData->s32CurrentMarker = pstMarkerInfo->s32ParentID;
+
+        /* Is unique? */
+        if(orxFLAG_TEST(pstMarkerInfo->u32Flags, orxPROFILER_KU32_FLAG_UNIQUE))
+        {
+          /* Updates push depth */
+          pstData->u32CurrentMarkerDepth--;
+        }
+
+        /* Updates flags */
+        orxFLAG_SET(pstMarkerInfo->u32Flags, orxPROFILER_KU32_FLAG_NONE, orxPROFILER_KU32_FLAG_PUSHED);
+      }
+      else
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_PROFILER, "Can't pop marker: marker stack is empty.");
+      }
+    }
+
+    /* Updates marker pops to skip */
+    pstData->u32MarkerPopToSkip = pstData->u32MarkerPopToSkip >> 1;
+  }
+}
+
+/** Enables marker push/pop operations
+ * @param[in] _bEnable          Enable
+ */
+void orxFASTCALL orxProfiler_EnableMarkerOperations(orxBOOL _bEnable)
+{
+  /* Checks */
+  orxASSERT(sstProfiler.u32Flags & orxPROFILER_KU32_STATIC_FLAG_READY);
+
+  /* Enable? */
+  if(_bEnable != orxFALSE)
+  {
+    /* Updates flags */
+    orxFLAG_SET(sstProfiler.u32Flags, orxPROFILER_KU32_STATIC_FLAG_ENABLE_OPS, orxPROFILER_KU32_STATIC_FLAG_NONE);
+  }
+  else
+  {
+    /* Updates flags */
+    orxFLAG_SET(sstProfiler.u32Flags, orxPROFILER_KU32_STATIC_FLAG_NONE, orxPROFILER_KU32_STATIC_FLAG_ENABLE_OPS);
+  }
+}
+
+/** Are marker push/pop operations enabled?
+ * @return orxTRUE / orxFALSE
+ */
+orxBOOL orxFASTCALL orxProfiler_AreMarkerOperationsEnabled()
+{
+  /* Checks */
+  orxASSERT(sstProfiler.u32Flags & orxPROFILER_KU32_STATIC_FLAG_READY);
+
+  /* Done! */
+  return orxFLAG_TEST(sstProfiler.u32Flags, orxPROFILER_KU32_STATIC_FLAG_ENABLE_OPS) ? orxTRUE : orxFALSE;
+}
+
+/** Pauses/unpauses the profiler
+ * @param[in] _bPause           Pause
+ */
+void orxFASTCALL orxProfiler_Pause(orxBOOL _bPause)
+{
+  /* Checks */
+  orxASSERT(sstProfiler.u32Flags & orxPROFILER_KU32_STATIC_FLAG_READY);
+
+  /* Pause? */
+  if(_bPause != orxFALSE)
+  {
+    /* Updates flags */
+    orxFLAG_SET(sstProfiler.u32Flags, orxPROFILER_KU32_STATIC_FLAG_PAUSED, orxPROFILER_KU32_STATIC_FLAG_NONE);
+  }
+  else
+  {
+    /* Updates flags */
+    orxFLAG_SET(sstProfiler.u32Flags, orxPROFILER_KU32_STATIC_FLAG_NONE, orxPROFILER_KU32_STATIC_FLAG_PAUSED);
+  }
+}
+
+/** Is profiler paused?
+ * @return orxTRUE / orxFALSE
+ */
+orxBOOL orxFASTCALL orxProfiler_IsPaused()
+{
   /* Checks */
   orxASSERT(sstProfiler.u32Flags & orxPROFILER_KU32_STATIC_FLAG_READY);
 
-  /* Updates result */
-  bResult = ((_s32MarkerID & ~orxPROFILER_KU32_MASK_MARKER_ID) == sstProfiler.s32WaterStamp) ? orxTRUE : orxFALSE;
+  /* Done! */
+  return orxFLAG_TEST(sstProfiler.u32Flags, orxPROFILER_KU32_STATIC_FLAG_PAUSED) ? orxTRUE : orxFALSE;
+}
+
+/** Enables/disables trace recording: when enabled, every marker push/pop is recorded with its time stamp in a per-thread ring buffer
+ * @param[in] _bEnable          Enable
+ */
+void orxFASTCALL orxProfiler_EnableTrace(orxBOOL _bEnable)
+{
+  /* Checks */
+  orxASSERT(sstProfiler.u32Flags & orxPROFILER_KU32_STATIC_FLAG_READY);
+
+  /* Enable? */
+  if(_bEnable != orxFALSE)
+  {
+    /* Updates flags */
+    orxFLAG_SET(sstProfiler.u32Flags, orxPROFILER_KU32_STATIC_FLAG_TRACE, orxPROFILER_KU32_STATIC_FLAG_NONE);
+  }
+  else
+  {
+    /* Updates flags */
+    orxFLAG_SET(sstProfiler.u32Flags, orxPROFILER_KU32_STATIC_FLAG_NONE, orxPROFILER_KU32_STATIC_FLAG_TRACE);
+  }
+}
+
+/** Is trace recording enabled?
+ * @return orxTRUE / orxFALSE
+ */
+orxBOOL orxFASTCALL orxProfiler_IsTraceEnabled()
+{
+  /* Checks */
+  orxASSERT(sstProfiler.u32Flags & orxPROFILER_KU32_STATIC_FLAG_READY);
 
   /* Done! */
-  return bResult;
+  return orxFLAG_TEST(sstProfiler.u32Flags, orxPROFILER_KU32_STATIC_FLAG_TRACE) ? orxTRUE : orxFALSE;
 }
 
-/** Pushes a marker (on a stack) and starts a timer for it
- * @param[in] _s32MarkerID      ID of the marker to push
+/** Dumps all the recorded trace events, for all threads, to a Chrome trace event (JSON) file, viewable with chrome://tracing
+ * @param[in] _zFileName        Name of the file, orxNULL for orxtrace.json
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
  */
-void orxFASTCALL orxProfiler_PushMarker(orxS32 _s32MarkerID)
+orxSTATUS orxFASTCALL orxProfiler_DumpTrace(const orxSTRING _zFileName)
 {
+  FILE     *pstFile;
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
   /* Checks */
   orxASSERT(sstProfiler.u32Flags & orxPROFILER_KU32_STATIC_FLAG_READY);
-  orxASSERT(orxProfiler_IsMarkerIDValid(_s32MarkerID) != orxFALSE);
 
-  /* Not paused and are operations enabled on main thread? */
-  if((orxFLAG_GET(sstProfiler.u32Flags, orxPROFILER_KU32_STATIC_FLAG_PAUSED | orxPROFILER_KU32_STATIC_FLAG_ENABLE_OPS) == orxPROFILER_KU32_STATIC_FLAG_ENABLE_OPS)
-  || (orxThread_GetCurrent() != orxTHREAD_KU32_MAIN_THREAD_ID))
+  /* Opens file */
+  pstFile = fopen((_zFileName != orxNULL) ? _zFileName : orxPROFILER_KZ_TRACE_FILE, "w");
+
+  /* Success? */
+  if(pstFile != NULL)
   {
-    orxPROFILER_MARKER_DATA  *pstData;
-    orxS32                    s32ID;
-    orxBOOL                   bSkip = orxFALSE;
+    const orxCHAR  *zSeparator = "";
+    orxU32          u32ThreadID;
 
-    /* Gets current marker data */
-    pstData = orxProfiler_GetCurrentMarkerData();
+    /* Writes header */
+    fputs("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[", pstFile);
 
-    /* Should reset and no marker pushed? */
-    if((pstData->bReset != orxFALSE) && (pstData->s32CurrentMarker == orxPROFILER_KS32_MARKER_ID_ROOT))
+    /* For all marker data */
+    for(u32ThreadID = 0; u32ThreadID < orxPROFILER_KU32_MARKER_DATA_NUMBER; u32ThreadID++)
     {
-      /* Resets it */
-      orxProfiler_ResetData(pstData);
+      orxPROFILER_MARKER_DATA *pstData;
+
+      /* Gets it */
+      pstData = sstProfiler.apstMarkerDataList[u32ThreadID];
+
+      /* Has trace events? */
+      if((pstData != orxNULL) && (pstData->astTraceEventList != orxNULL))
+      {
+        const orxSTRING zThreadName;
+        orxU32          u32Count, u32Depth, i;
+
+        /* Gets event count */
+        u32Count = pstData->u32TraceEventCount;
+        orxMEMORY_BARRIER();
+
+        /* Gets thread name */
+        zThreadName = orxThread_GetName(u32ThreadID);
+
+        /* Writes thread name */
+        fprintf(pstFile, "%s\n{\"ph\":\"M\",\"pid\":0,\"tid\":%u,\"name\":\"thread_name\",\"args\":{\"name\":", zSeparator, u32ThreadID);
+        orxProfiler_WriteTraceString(pstFile, ((zThreadName != orxNULL) && (*zThreadName != orxCHAR_NULL)) ? zThreadName : (u32ThreadID == orxTHREAD_KU32_MAIN_THREAD_ID) ? "Main" : "Unknown");
+        fputs("}}", pstFile);
+        zSeparator = ",";
+
+        /* For all recorded events still in the ring buffer */
+        for(i = (u32Count > orxPROFILER_KU32_TRACE_EVENT_NUMBER) ? u32Count - orxPROFILER_KU32_TRACE_EVENT_NUMBER : 0, u32Depth = 0; i != u32Count; i++)
+        {
+          const orxPROFILER_TRACE_EVENT *pstEvent;
+          orxS32                          s32MarkerID;
+
+          /* Gets it */
+          pstEvent    = &(pstData->astTraceEventList[i & (orxPROFILER_KU32_TRACE_EVENT_NUMBER - 1)]);
+          s32MarkerID = (orxS32)(pstEvent->u32Info & orxPROFILER_KU32_MASK_MARKER_ID);
+
+          /* Push? */
+          if(pstEvent->u32Info & orxPROFILER_KU32_TRACE_FLAG_PUSH)
+          {
+            /* Writes begin event */
+            fprintf(pstFile, ",\n{\"ph\":\"B\",\"pid\":0,\"tid\":%u,\"ts\":%.3f,\"name\":", u32ThreadID, pstEvent->dTimeStamp * 1e6);
+            orxProfiler_WriteTraceString(pstFile, sstProfiler.astMarkerList[s32MarkerID].zName);
+            fputc('}', pstFile);
+
+            /* Updates depth */
+            u32Depth++;
+          }
+          /* Has matching push? (the oldest ones might have been overwritten) */
+          else if(u32Depth != 0)
+          {
+            /* Writes end event */
+            fprintf(pstFile, ",\n{\"ph\":\"E\",\"pid\":0,\"tid\":%u,\"ts\":%.3f}", u32ThreadID, pstEvent->dTimeStamp * 1e6);
+
+            /* Updates depth */
+            u32Depth--;
+          }
+        }
+      }
     }
 
-    /* Gets ID */
-    s32ID = _s32MarkerID & orxPROFILER_KU32_MASK_MARKER_ID;
+    /* Writes footer */
+    fputs("\n]}\n", pstFile);
 
-    /* Valid marker ID? */
-    if((s32ID >= 0) && (s32ID < sstProfiler.s32MarkerCount))
+    /* Closes file */
+    fclose(pstFile);
+
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_PROFILER, "Can't open <%s> to dump trace events.", (_zFileName != orxNULL) ? _zFileName : orxPROFILER_KZ_TRACE_FILE);
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Starts the sampling profiler (Linux only): call stacks of all threads are sampled on SIGPROF and folded, regardless of markers; previous samples are discarded
+ * @param[in] _u32Frequency     Sampling frequency, in Hz, 0 for default (1000Hz)
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxProfiler_StartSampling(orxU32 _u32Frequency)
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT(sstProfiler.u32Flags & orxPROFILER_KU32_STATIC_FLAG_READY);
+
+#ifdef __orxLINUX__
+
+  /* Not already sampling? */
+  if(!orxFLAG_TEST(sstProfiler.u32Flags, orxPROFILER_KU32_STATIC_FLAG_SAMPLING))
+  {
+    /* No call stack storage yet? */
+    if(sstProfiler.astSampleStackList == orxNULL)
     {
-      orxPROFILER_MARKER_INFO    *pstMarkerInfo;
-      orxPROFILER_HISTORY_ENTRY  *pstEntry;
+      /* Allocates it */
+      sstProfiler.astSampleStackList = (orxPROFILER_SAMPLE_STACK *)orxMemory_Allocate(orxPROFILER_KU32_SAMPLE_STACK_NUMBER * sizeof(orxPROFILER_SAMPLE_STACK), orxMEMORY_TYPE_DEBUG);
+    }
 
-      /* Gets marker & current info */
-      pstMarkerInfo = &(pstData->astMarkerInfoList[s32ID]);
-      pstEntry      = &(pstData->aastHistory[pstData->u32HistoryIndex][s32ID]);
+    /* Valid? */
+    if(sstProfiler.astSampleStackList != orxNULL)
+    {
+      struct sigaction  stAction;
+      struct itimerval  stTimer;
+      void             *pFrame;
 
-      /* Not already pushed? */
-      if(!orxFLAG_TEST(pstMarkerInfo->u32Flags, orxPROFILER_KU32_FLAG_PUSHED))
+      /* Clears previous samples */
+      orxMemory_Zero(sstProfiler.astSampleStackList, orxPROFILER_KU32_SAMPLE_STACK_NUMBER * sizeof(orxPROFILER_SAMPLE_STACK));
+      sstProfiler.u32SampleCount      = 0;
+      sstProfiler.u32LostSampleCount  = 0;
+
+      /* Primes backtrace (its first call loads the unwinder, which isn't signal safe) */
+      backtrace(&pFrame, 1);
+
+      /* Installs handler */
+      orxMemory_Zero(&stAction, sizeof(struct sigaction));
+      stAction.sa_handler = &orxProfiler_HandleSample;
+      stAction.sa_flags   = SA_RESTART;
+      sigemptyset(&(stAction.sa_mask));
+      sigaction(SIGPROF, &stAction, &(sstProfiler.stPreviousSampleAction));
+
+      /* Updates flags */
+      orxFLAG_SET(sstProfiler.u32Flags, orxPROFILER_KU32_STATIC_FLAG_SAMPLING, orxPROFILER_KU32_STATIC_FLAG_NONE);
+
+      /* Starts timer (process CPU time, samples land on whichever thread is running) */
+      stTimer.it_interval.tv_sec  = 0;
+      stTimer.it_interval.tv_usec = 1000000 / (((_u32Frequency != 0) ? orxMIN(_u32Frequency, 1000000) : orxPROFILER_KU32_SAMPLE_DEFAULT_FREQUENCY));
+      stTimer.it_value            = stTimer.it_interval;
+      setitimer(ITIMER_PROF, &stTimer, NULL);
+
+      /* Updates result */
+      eResult = orxSTATUS_SUCCESS;
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_PROFILER, "Can't start sampling: couldn't allocate call stack storage.");
+    }
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_PROFILER, "Can't start sampling: already sampling.");
+  }
+
+#else /* __orxLINUX__ */
+
+  /* Logs message */
+  orxDEBUG_PRINT(orxDEBUG_LEVEL_PROFILER, "Can't start sampling: only supported on Linux.");
+
+#endif /* __orxLINUX__ */
+
+  /* Done! */
+  return eResult;
+}
+
+/** Stops the sampling profiler, samples are kept until the next start
+ */
+void orxFASTCALL orxProfiler_StopSampling()
+{
+  /* Checks */
+  orxASSERT(sstProfiler.u32Flags & orxPROFILER_KU32_STATIC_FLAG_READY);
+
+#ifdef __orxLINUX__
+
+  /* Sampling? */
+  if(orxFLAG_TEST(sstProfiler.u32Flags, orxPROFILER_KU32_STATIC_FLAG_SAMPLING))
+  {
+    struct itimerval stTimer;
+
+    /* Stops timer */
+    orxMemory_Zero(&stTimer, sizeof(struct itimerval));
+    setitimer(ITIMER_PROF, &stTimer, NULL);
+
+    /* Restores previous handler */
+    sigaction(SIGPROF, &(sstProfiler.stPreviousSampleAction), NULL);
+
+    /* Updates flags */
+    orxFLAG_SET(sstProfiler.u32Flags, orxPROFILER_KU32_STATIC_FLAG_NONE, orxPROFILER_KU32_STATIC_FLAG_SAMPLING);
+  }
+
+#endif /* __orxLINUX__ */
+
+  /* Done! */
+  return;
+}
+
+/** Is the sampling profiler running?
+ * @return orxTRUE / orxFALSE
+ */
+orxBOOL orxFASTCALL orxProfiler_IsSampling()
+{
+  /* Checks */
+  orxASSERT(sstProfiler.u32Flags & orxPROFILER_KU32_STATIC_FLAG_READY);
+
+  /* Done! */
+  return orxFLAG_TEST(sstProfiler.u32Flags, orxPROFILER_KU32_STATIC_FLAG_SAMPLING) ? orxTRUE : orxFALSE;
+}
+
+/** Dumps all the sampled call stacks in the folded format used by flame graph tools (one "Thread;Outermost;...;Innermost Count" line per call stack)
+ * @param[in] _zFileName        Name of the file, orxNULL for orxsamples.txt
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxProfiler_DumpSamples(const orxSTRING _zFileName)
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT(sstProfiler.u32Flags & orxPROFILER_KU32_STATIC_FLAG_READY);
+
+#ifdef __orxLINUX__
+
+  /* Has samples? */
+  if(sstProfiler.astSampleStackList != orxNULL)
+  {
+    FILE *pstFile;
+
+    /* Opens file */
+    pstFile = fopen((_zFileName != orxNULL) ? _zFileName : orxPROFILER_KZ_SAMPLE_FILE, "w");
+
+    /* Success? */
+    if(pstFile != NULL)
+    {
+      orxU32 i;
+
+      /* For all call stack slots */
+      for(i = 0; i < orxPROFILER_KU32_SAMPLE_STACK_NUMBER; i++)
       {
-        orxDOUBLE dTimeStamp;
-        orxBOOL   bFirstTime;
+        const orxPROFILER_SAMPLE_STACK *pstStack;
 
-        /* Updates first time status */
-        bFirstTime = orxFLAG_TEST(pstMarkerInfo->u32Flags, orxPROFILER_KU32_FLAG_INIT) ? orxFALSE : orxTRUE;
+        /* Gets it */
+        pstStack = &(sstProfiler.astSampleStackList[i]);
 
-        /* Wasn't defined on this thread? */
-        if(!orxFLAG_TEST(pstMarkerInfo->u32Flags, orxPROFILER_KU32_FLAG_DEFINED))
+        /* Ready? */
+        if(pstStack->u32Ready != orxFALSE)
         {
-          /* Updates thread marker count */
-          pstData->s32MarkerCount++;
+          const orxSTRING zThreadName;
+          orxS32          j;
+
+          /* Gets thread name */
+          zThreadName = (pstStack->u32ThreadID < orxTHREAD_KU32_MAX_THREAD_NUMBER) ? orxThread_GetName(pstStack->u32ThreadID) : orxNULL;
+
+          /* Writes it */
+          fputs(((zThreadName != orxNULL) && (*zThreadName != orxCHAR_NULL)) ? zThreadName : (pstStack->u32ThreadID == orxTHREAD_KU32_MAIN_THREAD_ID) ? "Main" : "Unknown", pstFile);
+
+          /* For all frames, outermost first */
+          for(j = (orxS32)pstStack->u32Depth - 1; j >= 0; j--)
+          {
+            /* Writes it (return addresses are moved back into their call instruction) */
+            fputc(';', pstFile);
+            orxProfiler_WriteSampleFrame(pstFile, (j > 0) ? (void *)((orxU8 *)pstStack->apFrameList[j] - 1) : pstStack->apFrameList[j]);
+          }
+
+          /* Writes count */
+          fprintf(pstFile, " %u\n", pstStack->u32Count);
         }
+      }
+
+      /* Closes file */
+      fclose(pstFile);
+
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_PROFILER, "Dumped %u samples to <%s> (%u lost).", sstProfiler.u32SampleCount, (_zFileName != orxNULL) ? _zFileName : orxPROFILER_KZ_SAMPLE_FILE, sstProfiler.u32LostSampleCount);
+
+      /* Updates result */
+      eResult = orxSTATUS_SUCCESS;
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_PROFILER, "Can't open <%s> to dump samples.", (_zFileName != orxNULL) ? _zFileName : orxPROFILER_KZ_SAMPLE_FILE);
+    }
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_PROFILER, "Can't dump samples: sampling has never been started.");
+  }
+
+#else /* __orxLINUX__ */
+
+  /* Logs message */
+  orxDEBUG_PRINT(orxDEBUG_LEVEL_PROFILER, "Can't dump samples: sampling is only supported on Linux.");
+
+#endif /* __orxLINUX__ */
+
+  /* Done! */
+  return eResult;
+}
+
+/** Sets the frame budget: main thread frames lasting longer are counted as spikes and written, with their previous frames, to orxspikes.txt
+ * @param[in] _dBudget                Frame budget, in seconds, 0 to disable spike capture
+ * @param[in] _u32HistoryFrameNumber  Number of previous frames to write along with a spike (capped by the profiler's history length)
+ */
+void orxFASTCALL orxProfiler_SetFrameBudget(orxDOUBLE _dBudget, orxU32 _u32HistoryFrameNumber)
+{
+  /* Checks */
+  orxASSERT(sstProfiler.u32Flags & orxPROFILER_KU32_STATIC_FLAG_READY);
+  orxASSERT(_dBudget >= orxDOUBLE_0);
+
+  /* Stores values */
+  sstProfiler.dBudget           = _dBudget;
+  sstProfiler.u32BudgetHistory  = orxMIN(_u32HistoryFrameNumber, orxPROFILER_KU32_HISTORY_LENGTH - 1);
+
+  /* Done! */
+  return;
+}
+
+/** Gets the frame budget
+ * @return Frame budget, in seconds, 0 if disabled
+ */
+orxDOUBLE orxFASTCALL orxProfiler_GetFrameBudget()
+{
+  /* Checks */
+  orxASSERT(sstProfiler.u32Flags & orxPROFILER_KU32_STATIC_FLAG_READY);
+
+  /* Done! */
+  return sstProfiler.dBudget;
+}
+
+/** Gets a percentile of the main thread's frame time since the last stats reset
+ * @param[in] _fPercentile            Percentile, [0-100]
+ * @return Frame time, in seconds (approximated to 1/8th of an octave)
+ */
+orxDOUBLE orxFASTCALL orxProfiler_GetFramePercentile(orxFLOAT _fPercentile)
+{
+  /* Checks */
+  orxASSERT(sstProfiler.u32Flags & orxPROFILER_KU32_STATIC_FLAG_READY);
+
+  /* Done! */
+  return orxProfiler_GetHistogramPercentile(&(sstProfiler.stFrameHistogram), _fPercentile);
+}
+
+/** Gets a percentile of a top level marker's time per frame on the main thread, since the last stats reset
+ * @param[in] _s32MarkerID            Concerned marker ID
+ * @param[in] _fPercentile            Percentile, [0-100]
+ * @return Marker's time per frame, in seconds (approximated to 1/8th of an octave), 0 if never used as a top level marker
+ */
+orxDOUBLE orxFASTCALL orxProfiler_GetMarkerPercentile(orxS32 _s32MarkerID, orxFLOAT _fPercentile)
+{
+  const orxPROFILER_HISTOGRAM  *pstHistogram;
+  orxDOUBLE                     dResult;
+
+  /* Checks */
+  orxASSERT(sstProfiler.u32Flags & orxPROFILER_KU32_STATIC_FLAG_READY);
+  orxASSERT(orxProfiler_IsMarkerIDValid(_s32MarkerID) != orxFALSE);
+
+  /* Gets its histogram */
+  pstHistogram = sstProfiler.apstHistogramList[_s32MarkerID & orxPROFILER_KU32_MASK_MARKER_ID];
+
+  /* Updates result */
+  dResult = (pstHistogram != orxNULL) ? orxProfiler_GetHistogramPercentile(pstHistogram, _fPercentile) : orxDOUBLE_0;
+
+  /* Done! */
+  return dResult;
+}
+
+/** Logs the frame stats: frame count, spike count and p50/p95/p99/max of the frame time and of all the top level markers
+ */
+void orxFASTCALL orxProfiler_LogFrameStats()
+{
+  const orxPROFILER_HISTOGRAM  *pstHistogram;
+  orxS32                        i;
+
+  /* Checks */
+  orxASSERT(sstProfiler.u32Flags & orxPROFILER_KU32_STATIC_FLAG_READY);
 
-        /* Is unique and already by someone else pushed? */
-        if(orxFLAG_TEST(pstMarkerInfo->u32Flags, orxPROFILER_KU32_FLAG_UNIQUE) && (pstEntry->u32PushCount != 0) && (pstMarkerInfo->s32ParentID != pstData->s32CurrentMarker))
-        {
-          orxS32 i;
+  /* Logs summary */
+  pstHistogram = &(sstProfiler.stFrameHistogram);
+  orxLOG("[PROFILER] %u frame(s), %u spike(s) over a budget of %.3fms", sstProfiler.u32FrameCount, sstProfiler.u32SpikeCount, sstProfiler.dBudget * orx2D(1000.0));
+  orxLOG("[PROFILER] Frame: p50 %.3fms, p95 %.3fms, p99 %.3fms, max %.3fms", orxProfiler_GetHistogramPercentile(pstHistogram, orx2F(50.0f)) * orx2D(1000.0), orxProfiler_GetHistogramPercentile(pstHistogram, orx2F(95.0f)) * orx2D(1000.0), orxProfiler_GetHistogramPercentile(pstHistogram, orx2F(99.0f)) * orx2D(1000.0), pstHistogram->dMaxTime * orx2D(1000.0));
 
-          /* Updates flags */
-          orxFLAG_SET(pstMarkerInfo->u32Flags, orxPROFILER_KU32_FLAG_PUSHED|orxPROFILER_KU32_FLAG_INIT|orxPROFILER_KU32_FLAG_DEFINED, orxPROFILER_KU32_FLAG_UNIQUE);
+  /* For all markers */
+  for(i = 0; i < sstProfiler.s32MarkerCount; i++)
+  {
+    /* Gets its histogram */
+    pstHistogram = sstProfiler.apstHistogramList[i];
 
-          /* For all markers */
-          for(i = 0; i < sstProfiler.s32MarkerCount; i++)
-          {
-            orxPROFILER_MARKER_INFO *pstTestMarkerInfo;
+    /* Valid and used? */
+    if((pstHistogram != orxNULL) && (pstHistogram->u32Count != 0))
+    {
+      /* Logs it */
+      orxLOG("[PROFILER] %s (%u frame(s)): p50 %.3fms, p95 %.3fms, p99 %.3fms, max %.3fms", sstProfiler.astMarkerList[i].zName, pstHistogram->u32Count, orxProfiler_GetHistogramPercentile(pstHistogram, orx2F(50.0f)) * orx2D(1000.0), orxProfiler_GetHistogramPercentile(pstHistogram, orx2F(95.0f)) * orx2D(1000.0), orxProfiler_GetHistogramPercentile(pstHistogram, orx2F(99.0f)) * orx2D(1000.0), pstHistogram->dMaxTime * orx2D(1000.0));
+    }
+  }
 
-            /* Gets it */
-            pstTestMarkerInfo = &(pstData->astMarkerInfoList[i]);
+  /* Done! */
+  return;
+}
 
-            /* Is child of current marker? */
-            if(pstTestMarkerInfo->s32ParentID == s32ID)
-            {
-              /* Updates its depth */
-              pstData->aastHistory[pstData->u32HistoryIndex][i].u32Depth--;
-            }
-          }
-        }
-        else
-        {
-          /* Updates flags */
-          orxFLAG_SET(pstMarkerInfo->u32Flags, orxPROFILER_KU32_FLAG_PUSHED|orxPROFILER_KU32_FLAG_INIT|orxPROFILER_KU32_FLAG_DEFINED, orxPROFILER_KU32_FLAG_NONE);
-        }
+/** Resets the frame stats
+ */
+void orxFASTCALL orxProfiler_ResetFrameStats()
+{
+  orxU32 i;
 
-        /* Is unique? */
-        if(orxFLAG_TEST(pstMarkerInfo->u32Flags, orxPROFILER_KU32_FLAG_UNIQUE))
-        {
-          /* Stores its push depth */
-          pstEntry->u32Depth = ++pstData->u32CurrentMarkerDepth;
-        }
-        else
-        {
-          /* Clears push depth */
-          pstEntry->u32Depth = 0;
-        }
+  /* Checks */
+  orxASSERT(sstProfiler.u32Flags & orxPROFILER_KU32_STATIC_FLAG_READY);
 
-        /* Updates its push count */
-        pstEntry->u32PushCount++;
+  /* Clears frame stats */
+  orxMemory_Zero(&(sstProfiler.stFrameHistogram), sizeof(orxPROFILER_HISTOGRAM));
+  sstProfiler.u32FrameCount     = 0;
+  sstProfiler.u32SpikeCount     = 0;
+  sstProfiler.u32LastSpikeFrame = 0;
 
-        /* Updates parent marker */
-        pstMarkerInfo->s32ParentID = pstData->s32CurrentMarker;
+  /* For all marker histograms */
+  for(i = 0; i < orxPROFILER_KU32_MAX_MARKER_NUMBER; i++)
+  {
+    /* Valid? */
+    if(sstProfiler.apstHistogramList[i] != orxNULL)
+    {
+      /* Clears it */
+      orxMemory_Zero(sstProfiler.apstHistogramList[i], sizeof(orxPROFILER_HISTOGRAM));
+    }
+  }
 
-        /* Updates current marker */
-        pstData->s32CurrentMarker = s32ID;
+  /* Done! */
+  return;
+}
 
-        /* Gets time stamp */
-        dTimeStamp = orxSystem_GetTime();
+/** Starts recording a cost report (main thread only): time spent per config file, per section inheritance resolve, per created object section and per resource; previous records are discarded
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxProfiler_StartCostReport()
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
 
-        /* First time? */
-        if(bFirstTime != orxFALSE)
-        {
-          /* Stores initial time */
-          pstEntry->dFirstTimeStamp = dTimeStamp;
-        }
+  /* Checks */
+  orxASSERT(sstProfiler.u32Flags & orxPROFILER_KU32_STATIC_FLAG_READY);
 
-        /* Stores time stamp */
-        pstMarkerInfo->dTimeStamp = dTimeStamp;
-      }
-      else
-      {
-        /* Updates its push count */
-        pstEntry->u32PushCount++;
+  /* No table yet? */
+  if(sstProfiler.astCostEntryList == orxNULL)
+  {
+    /* Allocates it */
+    sstProfiler.astCostEntryList = (orxPROFILER_COST_ENTRY *)orxMemory_Allocate(orxPROFILER_KU32_COST_ENTRY_NUMBER * sizeof(orxPROFILER_COST_ENTRY), orxMEMORY_TYPE_DEBUG);
 
-        /* Skips marker */
-        bSkip = orxTRUE;
-      }
-    }
-    else
+    /* Valid? */
+    if(sstProfiler.astCostEntryList != orxNULL)
     {
-      /* Logs message */
-      orxDEBUG_PRINT(orxDEBUG_LEVEL_PROFILER, "Can't push marker: invalid ID [%d].", _s32MarkerID);
-
-      /* Skips marker */
-      bSkip = orxTRUE;
+      /* Clears it */
+      orxMemory_Zero(sstProfiler.astCostEntryList, orxPROFILER_KU32_COST_ENTRY_NUMBER * sizeof(orxPROFILER_COST_ENTRY));
     }
+  }
+  else
+  {
+    /* Clears previous records */
+    orxProfiler_ClearCostEntries();
+  }
 
-    /* Updates marker pops to skip */
-    pstData->u32MarkerPopToSkip = (pstData->u32MarkerPopToSkip << 1) | ((bSkip != orxFALSE) ? 1 : 0);
+  /* Valid? */
+  if(sstProfiler.astCostEntryList != orxNULL)
+  {
+    /* Stores start time */
+    sstProfiler.dCostStartTime = orxSystem_GetTime();
+
+    /* Updates status */
+    orxFLAG_SET(sstProfiler.u32Flags, orxPROFILER_KU32_STATIC_FLAG_COST, orxPROFILER_KU32_STATIC_FLAG_NONE);
+
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_PROFILER, "Can't allocate cost report table.");
   }
+
+  /* Done! */
+  return eResult;
 }
 
-/** Pops a marker (from the stack) and updates its cumulated time (using the last marker push time)
+/** Stops recording the cost report and writes it, sorted by total time within each category
+ * @param[in] _zFileName        Name of the file, orxNULL for orxcosts.txt
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
  */
-void orxFASTCALL orxProfiler_PopMarker()
+orxSTATUS orxFASTCALL orxProfiler_StopCostReport(const orxSTRING _zFileName)
 {
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
   /* Checks */
   orxASSERT(sstProfiler.u32Flags & orxPROFILER_KU32_STATIC_FLAG_READY);
 
-  /* Not paused and are operations enabled on main thread? */
-  if((orxFLAG_GET(sstProfiler.u32Flags, orxPROFILER_KU32_STATIC_FLAG_PAUSED | orxPROFILER_KU32_STATIC_FLAG_ENABLE_OPS) == orxPROFILER_KU32_STATIC_FLAG_ENABLE_OPS)
-  || (orxThread_GetCurrent() != orxTHREAD_KU32_MAIN_THREAD_ID))
+  /* Recording? */
+  if(orxFLAG_TEST(sstProfiler.u32Flags, orxPROFILER_KU32_STATIC_FLAG_COST))
   {
-    orxPROFILER_MARKER_DATA *pstData;
+    orxPROFILER_COST_ENTRY **apstSortedEntryList;
+    orxDOUBLE                dDuration;
 
-    /* Gets current marker data */
-    pstData = orxProfiler_GetCurrentMarkerData();
+    /* Updates status */
+    orxFLAG_SET(sstProfiler.u32Flags, orxPROFILER_KU32_STATIC_FLAG_NONE, orxPROFILER_KU32_STATIC_FLAG_COST);
 
-    /* Not skipping pop? */
-    if((pstData->u32MarkerPopToSkip & 1) == 0)
+    /* Gets recording duration */
+    dDuration = orxSystem_GetTime() - sstProfiler.dCostStartTime;
+
+    /* Allocates sorted entry list */
+    apstSortedEntryList = (orxPROFILER_COST_ENTRY **)orxMemory_Allocate((sstProfiler.u32CostEntryCount + 1) * sizeof(orxPROFILER_COST_ENTRY *), orxMEMORY_TYPE_DEBUG);
+
+    /* Valid? */
+    if(apstSortedEntryList != orxNULL)
     {
-      /* Has pushed marker? */
-      if(pstData->s32CurrentMarker >= 0)
-      {
-        orxPROFILER_MARKER_INFO    *pstMarkerInfo;
-        orxPROFILER_HISTORY_ENTRY  *pstEntry;
+      FILE *pstFile;
 
-        /* Gets marker & current info */
-        pstMarkerInfo = &(pstData->astMarkerInfoList[pstData->s32CurrentMarker]);
-        pstEntry      = &(pstData->aastHistory[pstData->u32HistoryIndex][pstData->s32CurrentMarker]);
+      /* Opens file */
+      pstFile = fopen((_zFileName != orxNULL) ? _zFileName : orxPROFILER_KZ_COST_FILE, "w");
 
-        /* Updates cumulated time */
-        pstEntry->dCumulatedTime += orxSystem_GetTime() - pstMarkerInfo->dTimeStamp;
+      /* Success? */
+      if(pstFile != NULL)
+      {
+        static const orxSTRING  azCostNameList[orxPROFILER_COST_NUMBER] = {"Config files", "Config inheritance (per section)", "Objects (incl. children & body)", "Resources"};
+        orxPROFILER_COST        eCost = orxPROFILER_COST_NONE;
+        orxU32                  u32Count, i;
 
-        /* Updates max cumulated time */
-        if(pstEntry->dCumulatedTime > pstEntry->dMaxCumulatedTime)
+        /* For all entries */
+        for(i = 0, u32Count = 0; i < orxPROFILER_KU32_COST_ENTRY_NUMBER; i++)
         {
-          pstEntry->dMaxCumulatedTime = pstEntry->dCumulatedTime;
+          /* Used? */
+          if(sstProfiler.astCostEntryList[i].zName != orxNULL)
+          {
+            /* Stores it */
+            apstSortedEntryList[u32Count++] = &(sstProfiler.astCostEntryList[i]);
+          }
         }
 
-        /* Pops previous marker */
-        pstData->s32CurrentMarker = pstMarkerInfo->s32ParentID;
+        /* Sorts them */
+        qsort(apstSortedEntryList, (size_t)u32Count, sizeof(orxPROFILER_COST_ENTRY *), &orxProfiler_CompareCostEntries);
 
-        /* Is unique? */
-        if(orxFLAG_TEST(pstMarkerInfo->u32Flags, orxPROFILER_KU32_FLAG_UNIQUE))
+        /* Writes header */
+        fprintf(pstFile, "; orx cost report: %.3fms recorded, %u entries (%u lost)\n", dDuration * orx2D(1000.0), u32Count, sstProfiler.u32CostLostCount);
+
+        /* For all sorted entries */
+        for(i = 0; i < u32Count; i++)
         {
-          /* Updates push depth */
-          pstData->u32CurrentMarkerDepth--;
+          const orxPROFILER_COST_ENTRY *pstEntry;
+
+          /* Gets it */
+          pstEntry = apstSortedEntryList[i];
+
+          /* New category? */
+          if(pstEntry->eCost != eCost)
+          {
+            /* Writes its header */
+            eCost = pstEntry->eCost;
+            fprintf(pstFile, ";\n; %s\n; %12s %12s %8s %12s  %s\n", azCostNameList[eCost], "Total (ms)", "Self (ms)", "Count", "Max (ms)", "Name");
+          }
+
+          /* Writes it */
+          fprintf(pstFile, "  %12.3f %12.3f %8u %12.3f  %s\n", pstEntry->dTotalTime * orx2D(1000.0), pstEntry->dSelfTime * orx2D(1000.0), pstEntry->u32Count, pstEntry->dMaxTime * orx2D(1000.0), pstEntry->zName);
         }
 
-        /* Updates flags */
-        orxFLAG_SET(pstMarkerInfo->u32Flags, orxPROFILER_KU32_FLAG_NONE, orxPROFILER_KU32_FLAG_PUSHED);
+        /* Closes file */
+        fclose(pstFile);
+
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_PROFILER, "Wrote cost report for %u entries to <%s>.", u32Count, (_zFileName != orxNULL) ? _zFileName : orxPROFILER_KZ_COST_FILE);
+
+        /* Updates result */
+        eResult = orxSTATUS_SUCCESS;
       }
       else
       {
         /* Logs message */
-        orxDEBUG_PRINT(orxDEBUG_LEVEL_PROFILER, "Can't pop marker: marker stack is empty.");
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_PROFILER, "Can't open <%s> to write cost report.", (_zFileName != orxNULL) ? _zFileName : orxPROFILER_KZ_COST_FILE);
       }
+
+      /* Frees sorted entry list */
+      orxMemory_Free(apstSortedEntryList);
     }
 
-    /* Updates marker pops to skip */
-    pstData->u32MarkerPopToSkip = pstData->u32MarkerPopToSkip >> 1;
+    /* Clears records */
+    orxProfiler_ClearCostEntries();
   }
+
+  /* Done! */
+  return eResult;
 }
 
-/** Enables marker push/pop operations
- * @param[in] _bEnable          Enable
+/** Is recording a cost report?
+ * @return orxTRUE / orxFALSE
  */
-void orxFASTCALL orxProfiler_EnableMarkerOperations(orxBOOL _bEnable)
+orxBOOL orxFASTCALL orxProfiler_IsRecordingCosts()
 {
   /* Checks */
   orxASSERT(sstProfiler.u32Flags & orxPROFILER_KU32_STATIC_FLAG_READY);
 
-  /* Enable? */
-  if(_bEnable != orxFALSE)
-  {
-    /* Updates flags */
-    orxFLAG_SET(sstProfiler.u32Flags, orxPROFILER_KU32_STATIC_FLAG_ENABLE_OPS, orxPROFILER_KU32_STATIC_FLAG_NONE);
-  }
-  else
-  {
-    /* Updates flags */
-    orxFLAG_SET(sstProfiler.u32Flags, orxPROFILER_KU32_STATIC_FLAG_NONE, orxPROFILER_KU32_STATIC_FLAG_ENABLE_OPS);
-  }
+  /* Done! */
+  return orxFLAG_TEST(sstProfiler.u32Flags, orxPROFILER_KU32_STATIC_FLAG_COST) ? orxTRUE : orxFALSE;
 }
 
-/** Are marker push/pop operations enabled?
- * @return orxTRUE / orxFALSE
+/** Pushes a cost record, does nothing if no cost report is being recorded
+ * @param[in] _eCost            Cost type
+ * @param[in] _zName            Name of the concerned file/section/resource
  */
-orxBOOL orxFASTCALL orxProfiler_AreMarkerOperationsEnabled()
+void orxFASTCALL orxProfiler_PushCost(orxPROFILER_COST _eCost, const orxSTRING _zName)
 {
   /* Checks */
   orxASSERT(sstProfiler.u32Flags & orxPROFILER_KU32_STATIC_FLAG_READY);
+  orxASSERT(_eCost < orxPROFILER_COST_NUMBER);
+
+  /* Recording on main thread? */
+  if((orxFLAG_TEST(sstProfiler.u32Flags, orxPROFILER_KU32_STATIC_FLAG_COST))
+  && (orxThread_GetCurrent() == orxTHREAD_KU32_MAIN_THREAD_ID))
+  {
+    /* Has room? */
+    if(sstProfiler.u32CostDepth < orxPROFILER_KU32_COST_DEPTH)
+    {
+      orxPROFILER_COST_RECORD *pstRecord;
+
+      /* Gets new record */
+      pstRecord = &(sstProfiler.astCostRecordList[sstProfiler.u32CostDepth++]);
+
+      /* Inits it */
+      pstRecord->pstEntry   = orxProfiler_GetCostEntry(_eCost, (_zName != orxNULL) ? _zName : orxSTRING_EMPTY);
+      pstRecord->dChildTime = orxDOUBLE_0;
+      pstRecord->dStartTime = orxSystem_GetTime();
+    }
+    else
+    {
+      /* Updates skip count */
+      sstProfiler.u32CostSkipCount++;
+    }
+  }
 
   /* Done! */
-  return orxFLAG_TEST(sstProfiler.u32Flags, orxPROFILER_KU32_STATIC_FLAG_ENABLE_OPS) ? orxTRUE : orxFALSE;
+  return;
 }
 
-/** Pauses/unpauses the profiler
- * @param[in] _bPause           Pause
+/** Pops the last pushed cost record, its time is removed from the self time of the enclosing record
  */
-void orxFASTCALL orxProfiler_Pause(orxBOOL _bPause)
+void orxFASTCALL orxProfiler_PopCost()
 {
   /* Checks */
   orxASSERT(sstProfiler.u32Flags & orxPROFILER_KU32_STATIC_FLAG_READY);
 
-  /* Pause? */
-  if(_bPause != orxFALSE)
-  {
-    /* Updates flags */
-    orxFLAG_SET(sstProfiler.u32Flags, orxPROFILER_KU32_STATIC_FLAG_PAUSED, orxPROFILER_KU32_STATIC_FLAG_NONE);
-  }
-  else
+  /* Recording on main thread? */
+  if((orxFLAG_TEST(sstProfiler.u32Flags, orxPROFILER_KU32_STATIC_FLAG_COST))
+  && (orxThread_GetCurrent() == orxTHREAD_KU32_MAIN_THREAD_ID))
   {
-    /* Updates flags */
-    orxFLAG_SET(sstProfiler.u32Flags, orxPROFILER_KU32_STATIC_FLAG_NONE, orxPROFILER_KU32_STATIC_FLAG_PAUSED);
+    /* Skipped push? */
+    if(sstProfiler.u32CostSkipCount != 0)
+    {
+      /* Updates skip count */
+      sstProfiler.u32CostSkipCount--;
+    }
+    /* Has record (not pushed before recording started otherwise)? */
+    else if(sstProfiler.u32CostDepth != 0)
+    {
+      const orxPROFILER_COST_RECORD *pstRecord;
+
+      /* Pops it */
+      pstRecord = &(sstProfiler.astCostRecordList[--sstProfiler.u32CostDepth]);
+
+      /* Updates its entry */
+      orxProfiler_UpdateCostEntry(pstRecord->pstEntry, orxSystem_GetTime() - pstRecord->dStartTime, pstRecord->dChildTime);
+    }
   }
+
+  /* Done! */
+  return;
 }
 
-/** Is profiler paused?
- * @return orxTRUE / orxFALSE
+/** Adds a time to a cost record, without nesting, does nothing if no cost report is being recorded
+ * @param[in] _eCost            Cost type
+ * @param[in] _zName            Name of the concerned file/section/resource
+ * @param[in] _dTime            Time to add, in seconds
  */
-orxBOOL orxFASTCALL orxProfiler_IsPaused()
+void orxFASTCALL orxProfiler_AddCost(orxPROFILER_COST _eCost, const orxSTRING _zName, orxDOUBLE _dTime)
 {
   /* Checks */
   orxASSERT(sstProfiler.u32Flags & orxPROFILER_KU32_STATIC_FLAG_READY);
+  orxASSERT(_eCost < orxPROFILER_COST_NUMBER);
+
+  /* Recording on main thread? */
+  if((orxFLAG_TEST(sstProfiler.u32Flags, orxPROFILER_KU32_STATIC_FLAG_COST))
+  && (orxThread_GetCurrent() == orxTHREAD_KU32_MAIN_THREAD_ID))
+  {
+    /* Updates its entry */
+    orxProfiler_UpdateCostEntry(orxProfiler_GetCostEntry(_eCost, (_zName != orxNULL) ? _zName : orxSTRING_EMPTY), _dTime, orxDOUBLE_0);
+  }
 
   /* Done! */
-  return orxFLAG_TEST(sstProfiler.u32Flags, orxPROFILER_KU32_STATIC_FLAG_PAUSED) ? orxTRUE : orxFALSE;
+  return;
 }
 
 /** Resets all markers (usually called at the end of the frame)
@@ -750,7 +2331,8 @@ void orxFASTCALL orxProfiler_ResetAllMarkers()
   /* Not paused? */
   if(!orxFLAG_TEST(sstProfiler.u32Flags, orxPROFILER_KU32_STATIC_FLAG_PAUSED))
   {
-    orxU32 i;
+    orxPROFILER_MARKER_DATA  *pstData;
+    orxU32                    i;
 
     /* Checks */
     orxASSERT(sstProfiler.u32Flags & orxPROFILER_KU32_STATIC_FLAG_READY);
@@ -759,8 +2341,6 @@ void orxFASTCALL orxProfiler_ResetAllMarkers()
     /* For all marker data */
     for(i = 0; i < orxPROFILER_KU32_MARKER_DATA_NUMBER; i++)
     {
-      orxPROFILER_MARKER_DATA *pstData;
-
       /* Gets it */
       pstData = sstProfiler.apstMarkerDataList[i];
 
@@ -772,8 +2352,14 @@ void orxFASTCALL orxProfiler_ResetAllMarkers()
       }
     }
 
+    /* Gets main data */
+    pstData = orxProfiler_GetMarkerData(orxTHREAD_KU32_MAIN_THREAD_ID, orxFALSE);
+
+    /* Updates frame stats */
+    orxProfiler_UpdateFrameStats(pstData);
+
     /* Resets main data */
-    orxProfiler_ResetData(orxProfiler_GetMarkerData(orxTHREAD_KU32_MAIN_THREAD_ID, orxFALSE));
+    orxProfiler_ResetData(pstData);
   }
 
   /* Done! */
@@ -803,19 +2389,8 @@ void orxFASTCALL orxProfiler_ResetAllMaxima()
       /* Valid? */
       if(pstData != orxNULL)
       {
-        orxS32 j;
-        orxU32 u32Index;
-
-        /* Gets its current index */
-        u32Index = pstData->u32HistoryIndex;
-
-        /* For all markers */
-        for(j = 0; j < sstProfiler.s32MarkerCount; j++)
-        {
-          /* Resets its maximum */
-          pstData->aastHistory[u32Index][j].dMaxCumulatedTime = pstData->aastHistory[u32Index][j].dCumulatedTime;
-        }
-
+        /* Marks its maxima for reset (done by its own thread, with the next frame) */
+        pstData->bResetMaxima = orxTRUE;
       }
     }
 
@@ -842,7 +2417,7 @@ orxDOUBLE orxFASTCALL orxProfiler_GetResetTime()
   pstData = orxProfiler_GetMarkerData(orxTHREAD_KU32_MAIN_THREAD_ID, orxFALSE);
 
   /* Updates result */
-  dResult = pstData->adTimeStampHistory[(pstData->u32HistoryQueryIndex + 1) % orxPROFILER_KU32_HISTORY_LENGTH] - pstData->adTimeStampHistory[pstData->u32HistoryQueryIndex];
+  dResult = pstData->astHistory[(pstData->u32HistoryQueryIndex + 1) % orxPROFILER_KU32_HISTORY_LENGTH].dTimeStamp - pstData->astHistory[pstData->u32HistoryQueryIndex].dTimeStamp;
 
   /* Longer than previous? */
   if(dResult > sstProfiler.dMaxResetTime)
@@ -953,7 +2528,7 @@ orxS32 orxFASTCALL orxProfiler_GetNextMarkerID(orxS32 _s32MarkerID)
   return s32Result;
 }
 
-/** Gets the ID of the next marker, sorted by their push time
+/** Gets the ID of the next marker, sorted by their push time, only markers used during the query frame are considered
  * @param[in] _s32MarkerID      ID of the current pushed marker, orxPROFILER_KS32_MARKER_ID_NONE to get the first one
  * @return Next registered marker's ID / orxPROFILER_KS32_MARKER_ID_NONE if the current marker was the last one
  */
@@ -972,17 +2547,24 @@ orxS32 orxFASTCALL orxProfiler_GetNextSortedMarkerID(orxS32 _s32MarkerID)
   /* Valid? */
   if(pstData != orxNULL)
   {
-    orxDOUBLE dPreviousTime, dBestTime;
-    orxS32    i, s32ID;
+    const orxPROFILER_HISTORY_FRAME  *pstFrame;
+    orxDOUBLE                         dPreviousTime, dBestTime;
+    orxS32                            s32ID, s32BestID;
+    orxU32                            i;
 
     /* Valid ID? */
     if(_s32MarkerID != orxPROFILER_KS32_MARKER_ID_NONE)
     {
+      const orxPROFILER_HISTORY_ENTRY *pstEntry;
+
       /* Gets ID */
       s32ID = _s32MarkerID & orxPROFILER_KU32_MASK_MARKER_ID;
 
+      /* Gets its entry */
+      pstEntry = (s32ID < sstProfiler.s32MarkerCount) ? orxProfiler_GetQueryEntry(pstData, s32ID) : orxNULL;
+
       /* Get previous marker's time stamp */
-      dPreviousTime = ((s32ID < sstProfiler.s32MarkerCount) && (orxFLAG_TEST(pstData->astMarkerInfoList[s32ID].u32Flags, orxPROFILER_KU32_FLAG_DEFINED))) ? pstData->aastHistory[pstData->u32HistoryQueryIndex][s32ID].dFirstTimeStamp : orxDOUBLE_0;
+      dPreviousTime = (pstEntry != orxNULL) ? pstEntry->dFirstTimeStamp : orxDOUBLE_0;
     }
     else
     {
@@ -993,27 +2575,31 @@ orxS32 orxFASTCALL orxProfiler_GetNextSortedMarkerID(orxS32 _s32MarkerID)
       dPreviousTime = orxDOUBLE_0;
     }
 
-    /* For all markers */
-    for(i = 0, dBestTime = orxSystem_GetTime(); i < sstProfiler.s32MarkerCount; i++)
+    /* Gets query frame */
+    pstFrame = &(pstData->astHistory[pstData->u32HistoryQueryIndex]);
+
+    /* For all markers used during that frame */
+    for(i = 0, dBestTime = orxSystem_GetTime(), s32BestID = sstProfiler.s32MarkerCount; i < pstFrame->u32EntryCount; i++)
     {
-      // Defined?
-      if(orxFLAG_TEST(pstData->astMarkerInfoList[i].u32Flags, orxPROFILER_KU32_FLAG_DEFINED))
+      orxDOUBLE dTime;
+      orxS32    s32EntryID;
+
+      /* Gets its ID & time */
+      s32EntryID  = pstFrame->astEntryList[i].s32MarkerID;
+      dTime       = pstFrame->astEntryList[i].dFirstTimeStamp;
+
+      /* Is better candidate? */
+      if((((dTime == dPreviousTime)
+        && (s32EntryID > s32ID))
+       || (dTime > dPreviousTime))
+      && ((dTime < dBestTime)
+       || ((dTime == dBestTime)
+        && (s32EntryID < s32BestID))))
       {
-        orxDOUBLE dTime;
-
-        /* Gets its time */
-        dTime = pstData->aastHistory[pstData->u32HistoryQueryIndex][i].dFirstTimeStamp;
-
-        /* Is better candidate? */
-        if((((dTime == dPreviousTime)
-          && (i > s32ID))
-         || (dTime > dPreviousTime))
-        && (dTime < dBestTime))
-        {
-          /* Updates result */
-          s32Result = i | sstProfiler.s32WaterStamp;
-          dBestTime = dTime;
-        }
+        /* Updates result */
+        s32Result = s32EntryID | sstProfiler.s32WaterStamp;
+        s32BestID = s32EntryID;
+        dBestTime = dTime;
       }
     }
   }
@@ -1044,9 +2630,22 @@ orxSTATUS orxFASTCALL orxProfiler_SelectQueryFrame(orxU32 _u32QueryFrame, orxU32
     /* Is frame valid? */
     if(_u32QueryFrame < orxPROFILER_KU32_HISTORY_LENGTH - 1)
     {
+      const orxPROFILER_HISTORY_FRAME  *pstFrame;
+      orxU32                            i;
+
       /* Computes index */
       pstData->u32HistoryQueryIndex = ((pstData->u32HistoryIndex + orxPROFILER_KU32_HISTORY_LENGTH - 1) - _u32QueryFrame) % orxPROFILER_KU32_HISTORY_LENGTH;
 
+      /* Gets query frame */
+      pstFrame = &(pstData->astHistory[pstData->u32HistoryQueryIndex]);
+
+      /* For all markers used during that frame */
+      for(i = 0; i < pstFrame->u32EntryCount; i++)
+      {
+        /* Stores its entry index */
+        pstData->astMarkerInfoList[pstFrame->astEntryList[i].s32MarkerID].u32QueryEntryIndex = i;
+      }
+
       /* Updates result */
       eResult = orxSTATUS_SUCCESS;
     }
@@ -1086,8 +2685,13 @@ orxDOUBLE orxFASTCALL orxProfiler_GetMarkerTime(orxS32 _s32MarkerID)
     /* Valid marker ID? */
     if((s32ID >= 0) && (s32ID < sstProfiler.s32MarkerCount) && (orxFLAG_TEST(pstData->astMarkerInfoList[s32ID].u32Flags, orxPROFILER_KU32_FLAG_DEFINED)))
     {
+      const orxPROFILER_HISTORY_ENTRY *pstEntry;
+
+      /* Gets its entry in the query frame */
+      pstEntry = orxProfiler_GetQueryEntry(pstData, s32ID);
+
       /* Updates result */
-      dResult = pstData->aastHistory[pstData->u32HistoryQueryIndex][s32ID].dCumulatedTime;
+      dResult = (pstEntry != orxNULL) ? pstEntry->dCumulatedTime : orxDOUBLE_0;
     }
     else
     {
@@ -1135,8 +2739,13 @@ orxDOUBLE orxFASTCALL orxProfiler_GetMarkerMaxTime(orxS32 _s32MarkerID)
     /* Valid marker ID? */
     if((s32ID >= 0) && (s32ID < sstProfiler.s32MarkerCount) && (orxFLAG_TEST(pstData->astMarkerInfoList[s32ID].u32Flags, orxPROFILER_KU32_FLAG_DEFINED)))
     {
+      const orxPROFILER_HISTORY_ENTRY *pstEntry;
+
+      /* Gets its entry in the query frame */
+      pstEntry = orxProfiler_GetQueryEntry(pstData, s32ID);
+
       /* Updates result */
-      dResult = pstData->aastHistory[pstData->u32HistoryQueryIndex][s32ID].dMaxCumulatedTime;
+      dResult = (pstEntry != orxNULL) ? pstEntry->dMaxCumulatedTime : pstData->astMarkerInfoList[s32ID].dMaxCumulatedTime;
     }
     else
     {
@@ -1219,8 +2828,13 @@ orxU32 orxFASTCALL orxProfiler_GetMarkerPushCount(orxS32 _s32MarkerID)
     /* Valid marker ID? */
     if((s32ID >= 0) && (s32ID < sstProfiler.s32MarkerCount) && (orxFLAG_TEST(pstData->astMarkerInfoList[s32ID].u32Flags, orxPROFILER_KU32_FLAG_DEFINED)))
     {
+      const orxPROFILER_HISTORY_ENTRY *pstEntry;
+
+      /* Gets its entry in the query frame */
+      pstEntry = orxProfiler_GetQueryEntry(pstData, s32ID);
+
       /* Updates result */
-      u32Result = pstData->aastHistory[pstData->u32HistoryQueryIndex][s32ID].u32PushCount;
+      u32Result = (pstEntry != orxNULL) ? pstEntry->u32PushCount : 0;
     }
     else
     {
@@ -1320,8 +2934,13 @@ orxDOUBLE orxFASTCALL orxProfiler_GetUniqueMarkerStartTime(orxS32 _s32MarkerID)
       /* Is unique? */
       if(orxFLAG_TEST(pstData->astMarkerInfoList[s32ID].u32Flags, orxPROFILER_KU32_FLAG_UNIQUE))
       {
+        const orxPROFILER_HISTORY_ENTRY *pstEntry;
+
+        /* Gets its entry in the query frame */
+        pstEntry = orxProfiler_GetQueryEntry(pstData, s32ID);
+
         /* Updates result */
-        dResult = pstData->aastHistory[pstData->u32HistoryQueryIndex][s32ID].dFirstTimeStamp;
+        dResult = (pstEntry != orxNULL) ? pstEntry->dFirstTimeStamp : orxDOUBLE_0;
       }
       else
       {
@@ -1381,8 +3000,13 @@ orxU32 orxFASTCALL orxProfiler_GetUniqueMarkerDepth(orxS32 _s32MarkerID)
       /* Is unique? */
       if(orxFLAG_TEST(pstData->astMarkerInfoList[s32ID].u32Flags, orxPROFILER_KU32_FLAG_UNIQUE))
       {
+        const orxPROFILER_HISTORY_ENTRY *pstEntry;
+
+        /* Gets its entry in the query frame */
+        pstEntry = orxProfiler_GetQueryEntry(pstData, s32ID);
+
         /* Updates result */
-        u32Result = pstData->aastHistory[pstData->u32HistoryQueryIndex][s32ID].u32Depth;
+        u32Result = (pstEntry != orxNULL) ? pstEntry->u32Depth : 0;
       }
       else
       {
@@ -156,6 +156,7 @@ orxPLUGIN_DEFINE_CORE_FUNCTION(orxDisplay_DrawPolygon, orxSTATUS, const orxVECTO
 orxPLUGIN_DEFINE_CORE_FUNCTION(orxDisplay_DrawCircle, orxSTATUS, const orxVECTOR *, orxFLOAT, orxRGBA, orxBOOL);
 orxPLUGIN_DEFINE_CORE_FUNCTION(orxDisplay_DrawOBox, orxSTATUS, const orxOBOX *, orxRGBA, orxBOOL);
 orxPLUGIN_DEFINE_CORE_FUNCTION(orxDisplay_DrawMesh, orxSTATUS, const orxBITMAP *, orxDISPLAY_SMOOTHING, orxDISPLAY_BLEND_MODE, orxU32, const orxDISPLAY_VERTEX *);
+orxPLUGIN_DEFINE_CORE_FUNCTION(orxDisplay_DrawQuads, orxSTATUS, const orxBITMAP *, orxDISPLAY_SMOOTHING, orxDISPLAY_BLEND_MODE, orxU32, const orxDISPLAY_VERTEX *);
 
 orxPLUGIN_DEFINE_CORE_FUNCTION(orxDisplay_HasShaderSupport, orxBOOL);
 orxPLUGIN_DEFINE_CORE_FUNCTION(orxDisplay_CreateShader, orxHANDLE, const orxSTRING *, orxU32, const orxLINKLIST *, orxBOOL);
@@ -178,6 +179,8 @@ orxPLUGIN_DEFINE_CORE_FUNCTION(orxDisplay_GetVideoMode, orxDISPLAY_VIDEO_MODE *,
 orxPLUGIN_DEFINE_CORE_FUNCTION(orxDisplay_SetVideoMode, orxSTATUS, const orxDISPLAY_VIDEO_MODE *);
 orxPLUGIN_DEFINE_CORE_FUNCTION(orxDisplay_IsVideoModeAvailable, orxBOOL, const orxDISPLAY_VIDEO_MODE *);
 
+orxPLUGIN_DEFINE_CORE_FUNCTION(orxDisplay_GetFrameStats, orxDISPLAY_STATS *, orxDISPLAY_STATS *);
+
 
 /* *** Core function info array *** */
 
@@ -223,6 +226,7 @@ orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(DISPLAY, DRAW_POLYGON, orxDisplay_DrawPolygon)
 orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(DISPLAY, DRAW_CIRCLE, orxDisplay_DrawCircle)
 orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(DISPLAY, DRAW_OBOX, orxDisplay_DrawOBox)
 orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(DISPLAY, DRAW_MESH, orxDisplay_DrawMesh)
+orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(DISPLAY, DRAW_QUADS, orxDisplay_DrawQuads)
 
 orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(DISPLAY, HAS_SHADER_SUPPORT, orxDisplay_HasShaderSupport)
 orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(DISPLAY, CREATE_SHADER, orxDisplay_CreateShader)
@@ -245,6 +249,8 @@ orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(DISPLAY, GET_VIDEO_MODE, orxDisplay_GetVideoMo
 orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(DISPLAY, SET_VIDEO_MODE, orxDisplay_SetVideoMode)
 orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(DISPLAY, IS_VIDEO_MODE_AVAILABLE, orxDisplay_IsVideoModeAvailable)
 
+orxPLUGIN_ADD_CORE_FUNCTION_ARRAY(DISPLAY, GET_FRAME_STATS, orxDisplay_GetFrameStats)
+
 orxPLUGIN_END_CORE_FUNCTION_ARRAY(DISPLAY)
 
 
@@ -300,6 +306,11 @@ orxSTATUS orxFASTCALL orxDisplay_DrawMesh(const orxBITMAP *_pstBitmap, orxDISPLA
   return orxPLUGIN_CORE_FUNCTION_POINTER_NAME(orxDisplay_DrawMesh)(_pstBitmap, _eSmoothing, _eBlendMode, _u32VertexCount, _astVertexList);
 }
 
+orxSTATUS orxFASTCALL orxDisplay_DrawQuads(const orxBITMAP *_pstBitmap, orxDISPLAY_SMOOTHING _eSmoothing, orxDISPLAY_BLEND_MODE _eBlendMode, orxU32 _u32QuadCount, const orxDISPLAY_VERTEX *_astVertexList)
+{
+  return orxPLUGIN_CORE_FUNCTION_POINTER_NAME(orxDisplay_DrawQuads)(_pstBitmap, _eSmoothing, _eBlendMode, _u32QuadCount, _astVertexList);
+}
+
 orxBITMAP *orxFASTCALL orxDisplay_CreateBitmap(orxU32 _u32Width, orxU32 _u32Height)
 {
   return orxPLUGIN_CORE_FUNCTION_POINTER_NAME(orxDisplay_CreateBitmap)(_u32Width, _u32Height);
@@ -484,3 +495,8 @@ orxBOOL orxFASTCALL orxDisplay_IsVideoModeAvailable(const orxDISPLAY_VIDEO_MODE
 {
   return orxPLUGIN_CORE_FUNCTION_POINTER_NAME(orxDisplay_IsVideoModeAvailable)(_pstVideoMode);
 }
+
+orxDISPLAY_STATS *orxFASTCALL orxDisplay_GetFrameStats(orxDISPLAY_STATS *_pstStats)
+{
+  return orxPLUGIN_CORE_FUNCTION_POINTER_NAME(orxDisplay_GetFrameStats)(_pstStats);
+}
@@ -39,6 +39,7 @@
 #include "core/orxLocale.h"
 #include "display/orxText.h"
 #include "display/orxTexture.h"
+#include "display/orxTileMap.h"
 
 
 /** Module flags
@@ -165,10 +166,16 @@ static orxINLINE orxSTATUS orxGraphic_SetDataInternal(orxGRAPHIC *_pstGraphic, o
         /* Deletes it */
         orxText_Delete(orxTEXT(_pstGraphic->pstData));
       }
+      /* Tile map data? */
+      else if(orxStructure_TestFlags(_pstGraphic, orxGRAPHIC_KU32_FLAG_TILEMAP))
+      {
+        /* Deletes it */
+        orxTileMap_Delete(orxTILEMAP(_pstGraphic->pstData));
+      }
       else
       {
         /* Logs message */
-        orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Non-2d (texture/text) graphics not supported yet.");
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Non-2d (texture/text/tile map) graphics not supported yet.");
 
         /* Updates result */
         eResult = orxSTATUS_FAILURE;
@@ -202,10 +209,16 @@ static orxINLINE orxSTATUS orxGraphic_SetDataInternal(orxGRAPHIC *_pstGraphic, o
       /* Updates flags */
       orxStructure_SetFlags(_pstGraphic, orxGRAPHIC_KU32_FLAG_TEXT, orxGRAPHIC_KU32_MASK_TYPE);
     }
+    /* Is data a tile map? */
+    else if(orxTILEMAP(_pstData) != orxNULL)
+    {
+      /* Updates flags */
+      orxStructure_SetFlags(_pstGraphic, orxGRAPHIC_KU32_FLAG_TILEMAP, orxGRAPHIC_KU32_MASK_TYPE);
+    }
     else
     {
       /* Logs message */
-      orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Data given is not a texture nor a text.");
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Data given is not a texture, a text nor a tile map.");
 
       /* Updates flags */
       orxStructure_SetFlags(_pstGraphic, orxGRAPHIC_KU32_FLAG_NONE, orxGRAPHIC_KU32_MASK_TYPE);
@@ -363,6 +376,7 @@ void orxFASTCALL orxGraphic_Setup()
   orxModule_AddDependency(orxMODULE_ID_GRAPHIC, orxMODULE_ID_CONFIG);
   orxModule_AddDependency(orxMODULE_ID_GRAPHIC, orxMODULE_ID_EVENT);
   orxModule_AddDependency(orxMODULE_ID_GRAPHIC, orxMODULE_ID_TEXT);
+  orxModule_AddDependency(orxMODULE_ID_GRAPHIC, orxMODULE_ID_TILEMAP);
   orxModule_AddDependency(orxMODULE_ID_GRAPHIC, orxMODULE_ID_TEXTURE);
   orxModule_AddOptionalDependency(orxMODULE_ID_GRAPHIC, orxMODULE_ID_LOCALE);
 
@@ -619,6 +633,41 @@ orxGRAPHIC *orxFASTCALL orxGraphic_CreateFromConfig(const orxSTRING _zConfigID)
         }
       }
 
+      /* Still no data? */
+      if(pstResult->pstData == orxNULL)
+      {
+        /* Gets tile map name */
+        zName = orxConfig_GetString(orxGRAPHIC_KZ_CONFIG_TILEMAP_NAME);
+
+        /* Valid? */
+        if((zName != orxNULL) && (zName != orxSTRING_EMPTY))
+        {
+          orxTILEMAP *pstTileMap;
+
+          /* Creates tile map */
+          pstTileMap = orxTileMap_CreateFromConfig(zName);
+
+          /* Valid? */
+          if(pstTileMap != orxNULL)
+          {
+            /* Links it */
+            if(orxGraphic_SetDataInternal(pstResult, (orxSTRUCTURE *)pstTileMap, orxTRUE) != orxSTATUS_FAILURE)
+            {
+              /* Updates size */
+              orxGraphic_UpdateSize(pstResult);
+            }
+            else
+            {
+              /* Logs message */
+              orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Couldn't link tile map (%s) data to graphic (%s).", zName, _zConfigID);
+
+              /* Deletes structures */
+              orxTileMap_Delete(pstTileMap);
+            }
+          }
+        }
+      }
+
       /* Has data? */
       if(pstResult->pstData != orxNULL)
       {
@@ -1247,8 +1296,8 @@ orxVECTOR *orxFASTCALL orxGraphic_GetSize(const orxGRAPHIC *_pstGraphic, orxVECT
   orxSTRUCTURE_ASSERT(_pstGraphic);
   orxASSERT(_pvSize != orxNULL);
 
-  /* Valid 2D or text data? */
-  if(orxStructure_TestFlags(_pstGraphic, orxGRAPHIC_KU32_FLAG_2D | orxGRAPHIC_KU32_FLAG_TEXT) != orxFALSE)
+  /* Valid 2D, text or tile map data? */
+  if(orxStructure_TestFlags(_pstGraphic, orxGRAPHIC_KU32_FLAG_2D | orxGRAPHIC_KU32_FLAG_TEXT | orxGRAPHIC_KU32_FLAG_TILEMAP) != orxFALSE)
   {
     /* Gets its size */
     orxVector_Set(_pvSize, _pstGraphic->fWidth, _pstGraphic->fHeight, orxFLOAT_0);
@@ -1497,6 +1546,12 @@ orxSTATUS orxFASTCALL orxGraphic_UpdateSize(orxGRAPHIC *_pstGraphic)
     /* Inits full coordinates */
     orxText_GetSize(orxTEXT(_pstGraphic->pstData), &(_pstGraphic->fWidth), &(_pstGraphic->fHeight));
   }
+  /* Is data a tile map? */
+  else if(orxTILEMAP(_pstGraphic->pstData) != orxNULL)
+  {
+    /* Inits full coordinates */
+    orxTileMap_GetSize(orxTILEMAP(_pstGraphic->pstData), &(_pstGraphic->fWidth), &(_pstGraphic->fHeight));
+  }
   else
   {
     /* Failure */
@@ -822,6 +822,9 @@ orxTEXTURE *orxFASTCALL orxTexture_CreateFromFile(const orxSTRING _zFileName, or
     /* Profiles */
     orxPROFILER_PUSH_MARKER("orxTexture_CreateFromFile");
 
+    /* Records cost */
+    orxProfiler_PushCost(orxPROFILER_COST_RESOURCE, _zFileName);
+
     /* Creates an empty texture */
     pstResult = orxTexture_CreateInternal();
 
@@ -880,6 +883,9 @@ orxTEXTURE *orxFASTCALL orxTexture_CreateFromFile(const orxSTRING _zFileName, or
       orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Invalid texture created.");
     }
 
+    /* Ends cost record */
+    orxProfiler_PopCost();
+
     /* Profiles */
     orxPROFILER_POP_MARKER();
   }
@@ -0,0 +1,791 @@
+/* Orx - Portable Game Engine
+ *
+ * Copyright (c) 2008-2018 Orx-Project
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ *    1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ *
+ *    2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ *
+ *    3. This notice may not be removed or altered from any source
+ *    distribution.
+ */
+
+/**
+ * @file orxTileMap.c
+ * @date 18/10/2026
+ * @author iarwain@orx-project.org
+ *
+ */
+
+
+#include "display/orxTileMap.h"
+
+#include "debug/orxDebug.h"
+#include "memory/orxMemory.h"
+#include "core/orxConfig.h"
+#include "object/orxStructure.h"
+#include "utils/orxString.h"
+
+
+/** Module flags
+ */
+#define orxTILEMAP_KU32_STATIC_FLAG_NONE      0x00000000  /**< No flags */
+
+#define orxTILEMAP_KU32_STATIC_FLAG_READY     0x00000001  /**< Ready flag */
+
+#define orxTILEMAP_KU32_STATIC_MASK_ALL       0xFFFFFFFF  /**< All mask */
+
+/** orxTILEMAP flags / masks
+ */
+#define orxTILEMAP_KU32_FLAG_NONE             0x00000000  /**< No flags */
+
+#define orxTILEMAP_KU32_FLAG_INTERNAL         0x10000000  /**< Internal structure handling flag */
+
+#define orxTILEMAP_KU32_MASK_ALL              0xFFFFFFFF  /**< All mask */
+
+
+/** Misc defines
+ */
+#define orxTILEMAP_KZ_CONFIG_TEXTURE_NAME     "Texture"
+#define orxTILEMAP_KZ_CONFIG_TEXTURE_ORIGIN   "TextureOrigin"
+#define orxTILEMAP_KZ_CONFIG_TEXTURE_SIZE     "TextureSize"
+#define orxTILEMAP_KZ_CONFIG_KEEP_IN_CACHE    "KeepInCache"
+#define orxTILEMAP_KZ_CONFIG_TILE_SIZE        "TileSize"
+#define orxTILEMAP_KZ_CONFIG_SIZE             "Size"
+#define orxTILEMAP_KZ_CONFIG_MAP              "Map"
+
+#define orxTILEMAP_KU32_BANK_SIZE             16          /**< Bank size */
+
+
+/***************************************************************************
+ * Structure declaration                                                   *
+ ***************************************************************************/
+
+/** Tile map structure
+ */
+struct __orxTILEMAP_t
+{
+  orxSTRUCTURE      stStructure;                /**< Public structure, first structure member : 40 / 64 */
+  orxU16           *au16TileList;               /**< Tile list (row major) : 44 / 72 */
+  orxTEXTURE       *pstTexture;                 /**< Tileset texture : 48 / 80 */
+  orxVECTOR         vTileSize;                  /**< Tile size : 60 / 92 */
+  orxVECTOR         vTilesetOrigin;             /**< Tileset origin : 72 / 104 */
+  orxU32            u32Width;                   /**< Width, in tiles : 76 / 108 */
+  orxU32            u32Height;                  /**< Height, in tiles : 80 / 112 */
+  orxU32            u32TilesetColumns;          /**< Tileset column count : 84 / 116 */
+  orxU32            u32TilesetCount;            /**< Tileset tile count : 88 / 120 */
+  const orxSTRING   zReference;                 /**< Config reference : 92 / 128 */
+};
+
+/** Static structure
+ */
+typedef struct __orxTILEMAP_STATIC_t
+{
+  orxU32            u32Flags;                   /**< Control flags */
+
+} orxTILEMAP_STATIC;
+
+
+/***************************************************************************
+ * Module global variable                                                  *
+ ***************************************************************************/
+
+static orxTILEMAP_STATIC sstTileMap;
+
+
+/***************************************************************************
+ * Private functions                                                       *
+ ***************************************************************************/
+
+/** Processes config data
+ * @param[in]   _pstTileMap   Concerned tile map
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxSTATUS orxFASTCALL orxTileMap_ProcessConfigData(orxTILEMAP *_pstTileMap)
+{
+  const orxSTRING zName;
+  orxSTATUS       eResult = orxSTATUS_FAILURE;
+
+  /* Gets texture name */
+  zName = orxConfig_GetString(orxTILEMAP_KZ_CONFIG_TEXTURE_NAME);
+
+  /* Valid? */
+  if((zName != orxNULL) && (*zName != orxCHAR_NULL))
+  {
+    orxTEXTURE *pstTexture;
+
+    /* Creates texture */
+    pstTexture = orxTexture_CreateFromFile(zName, orxConfig_GetBool(orxTILEMAP_KZ_CONFIG_KEEP_IN_CACHE));
+
+    /* Valid? */
+    if(pstTexture != orxNULL)
+    {
+      orxVECTOR vOrigin, vSize;
+
+      /* Links it */
+      if(orxTileMap_SetTexture(_pstTileMap,
+                               pstTexture,
+                               orxConfig_GetVector(orxTILEMAP_KZ_CONFIG_TEXTURE_ORIGIN, &vOrigin),
+                               orxConfig_GetVector(orxTILEMAP_KZ_CONFIG_TEXTURE_SIZE, &vSize)) != orxSTATUS_FAILURE)
+      {
+        orxS32 i, s32Count;
+
+        /* Sets its owner */
+        orxStructure_SetOwner(pstTexture, _pstTileMap);
+
+        /* Updates flags */
+        orxStructure_SetFlags(_pstTileMap, orxTILEMAP_KU32_FLAG_INTERNAL, orxTILEMAP_KU32_FLAG_NONE);
+
+        /* For all rows */
+        for(i = 0, s32Count = orxMIN(orxConfig_GetListCount(orxTILEMAP_KZ_CONFIG_MAP), (orxS32)_pstTileMap->u32Height); i < s32Count; i++)
+        {
+          const orxSTRING zRow;
+          orxU32          u32X;
+
+          /* Gets it */
+          zRow = orxConfig_GetListString(orxTILEMAP_KZ_CONFIG_MAP, i);
+
+          /* For all its tiles */
+          for(u32X = 0, zRow = orxString_SkipWhiteSpaces(zRow);
+              (u32X < _pstTileMap->u32Width) && (*zRow != orxCHAR_NULL);
+              u32X++, zRow = orxString_SkipWhiteSpaces(zRow))
+          {
+            orxU32 u32Tile;
+
+            /* Gets tile */
+            if((orxString_ToU32(zRow, &u32Tile, &zRow) == orxSTATUS_FAILURE)
+            || (orxTileMap_SetTile(_pstTileMap, u32X, (orxU32)i, u32Tile) == orxSTATUS_FAILURE))
+            {
+              /* Logs message */
+              orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "[%s]: Invalid tile <%s> found at (%u, %d), skipping remaining tiles of this row.", _pstTileMap->zReference, zRow, u32X, i);
+
+              break;
+            }
+          }
+        }
+
+        /* Updates result */
+        eResult = orxSTATUS_SUCCESS;
+      }
+      else
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Couldn't link texture (%s) to tile map (%s).", zName, _pstTileMap->zReference);
+
+        /* Deletes texture */
+        orxTexture_Delete(pstTexture);
+      }
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Couldn't create texture (%s) for tile map (%s).", zName, _pstTileMap->zReference);
+    }
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "No texture defined for tile map (%s).", _pstTileMap->zReference);
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Deletes all tile maps
+ */
+static orxINLINE void orxTileMap_DeleteAll()
+{
+  orxTILEMAP *pstTileMap;
+
+  /* Gets first tile map */
+  pstTileMap = orxTILEMAP(orxStructure_GetFirst(orxSTRUCTURE_ID_TILEMAP));
+
+  /* Non empty? */
+  while(pstTileMap != orxNULL)
+  {
+    /* Deletes it */
+    orxTileMap_Delete(pstTileMap);
+
+    /* Gets first tile map */
+    pstTileMap = orxTILEMAP(orxStructure_GetFirst(orxSTRUCTURE_ID_TILEMAP));
+  }
+
+  return;
+}
+
+
+/***************************************************************************
+ * Public functions                                                        *
+ ***************************************************************************/
+
+/** Setups the tile map module
+ */
+void orxFASTCALL orxTileMap_Setup()
+{
+  /* Adds module dependencies */
+  orxModule_AddDependency(orxMODULE_ID_TILEMAP, orxMODULE_ID_MEMORY);
+  orxModule_AddDependency(orxMODULE_ID_TILEMAP, orxMODULE_ID_CONFIG);
+  orxModule_AddDependency(orxMODULE_ID_TILEMAP, orxMODULE_ID_STRUCTURE);
+  orxModule_AddDependency(orxMODULE_ID_TILEMAP, orxMODULE_ID_TEXTURE);
+
+  return;
+}
+
+/** Inits the tile map module
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxTileMap_Init()
+{
+  orxSTATUS eResult;
+
+  /* Not already Initialized? */
+  if(!(sstTileMap.u32Flags & orxTILEMAP_KU32_STATIC_FLAG_READY))
+  {
+    /* Cleans static controller */
+    orxMemory_Zero(&sstTileMap, sizeof(orxTILEMAP_STATIC));
+
+    /* Registers structure type */
+    eResult = orxSTRUCTURE_REGISTER(TILEMAP, orxSTRUCTURE_STORAGE_TYPE_LINKLIST, orxMEMORY_TYPE_MAIN, orxTILEMAP_KU32_BANK_SIZE, orxNULL);
+
+    /* Success? */
+    if(eResult != orxSTATUS_FAILURE)
+    {
+      /* Updates flags */
+      sstTileMap.u32Flags = orxTILEMAP_KU32_STATIC_FLAG_READY;
+    }
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Tried to initialize tile map module when it was already initialized.");
+
+    /* Already initialized */
+    eResult = orxSTATUS_SUCCESS;
+  }
+
+  /* Not initialized? */
+  if(eResult == orxSTATUS_FAILURE)
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Initializing tile map module failed.");
+
+    /* Updates Flags */
+    sstTileMap.u32Flags &= ~orxTILEMAP_KU32_STATIC_FLAG_READY;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Exits from the tile map module
+ */
+void orxFASTCALL orxTileMap_Exit()
+{
+  /* Initialized? */
+  if(sstTileMap.u32Flags & orxTILEMAP_KU32_STATIC_FLAG_READY)
+  {
+    /* Deletes tile map list */
+    orxTileMap_DeleteAll();
+
+    /* Unregisters structure type */
+    orxStructure_Unregister(orxSTRUCTURE_ID_TILEMAP);
+
+    /* Updates flags */
+    sstTileMap.u32Flags &= ~orxTILEMAP_KU32_STATIC_FLAG_READY;
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Tried to exit tile map module when it wasn't initialized.");
+  }
+
+  return;
+}
+
+/** Creates an empty tile map
+ * @param[in]   _u32Width     Width, in tiles
+ * @param[in]   _u32Height    Height, in tiles
+ * @param[in]   _pvTileSize   Size of a tile, in pixels
+ * @return      orxTILEMAP / orxNULL
+ */
+orxTILEMAP *orxFASTCALL orxTileMap_Create(orxU32 _u32Width, orxU32 _u32Height, const orxVECTOR *_pvTileSize)
+{
+  orxTILEMAP *pstResult = orxNULL;
+
+  /* Checks */
+  orxASSERT(sstTileMap.u32Flags & orxTILEMAP_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pvTileSize != orxNULL);
+
+  /* Valid (tile list size fitting in 32 bits)? */
+  if((_u32Width > 0)
+  && (_u32Height > 0)
+  && (_u32Width <= (orxU32)(orxU32_UNDEFINED / sizeof(orxU16)) / _u32Height)
+  && (_pvTileSize->fX > orxFLOAT_0)
+  && (_pvTileSize->fY > orxFLOAT_0))
+  {
+    /* Creates tile map */
+    pstResult = orxTILEMAP(orxStructure_Create(orxSTRUCTURE_ID_TILEMAP));
+
+    /* Created? */
+    if(pstResult != orxNULL)
+    {
+      /* Allocates its tiles */
+      pstResult->au16TileList = (orxU16 *)orxMemory_Allocate(_u32Width * _u32Height * sizeof(orxU16), orxMEMORY_TYPE_MAIN);
+
+      /* Success? */
+      if(pstResult->au16TileList != orxNULL)
+      {
+        /* Inits it */
+        orxMemory_Zero(pstResult->au16TileList, _u32Width * _u32Height * sizeof(orxU16));
+        orxVector_Copy(&(pstResult->vTileSize), _pvTileSize);
+        pstResult->u32Width   = _u32Width;
+        pstResult->u32Height  = _u32Height;
+
+        /* Inits flags */
+        orxStructure_SetFlags(pstResult, orxTILEMAP_KU32_FLAG_NONE, orxTILEMAP_KU32_MASK_ALL);
+
+        /* Increases count */
+        orxStructure_IncreaseCount(pstResult);
+      }
+      else
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Failed to allocate %ux%u tiles for tile map.", _u32Width, _u32Height);
+
+        /* Deletes structure */
+        orxStructure_Delete(pstResult);
+
+        /* Updates result */
+        pstResult = orxNULL;
+      }
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Failed to create structure for tile map.");
+    }
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Invalid tile map size %ux%u or tile size (%g, %g).", _u32Width, _u32Height, _pvTileSize->fX, _pvTileSize->fY);
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Creates a tile map from config
+ * @param[in]   _zConfigID    Config ID
+ * @return      orxTILEMAP / orxNULL
+ */
+orxTILEMAP *orxFASTCALL orxTileMap_CreateFromConfig(const orxSTRING _zConfigID)
+{
+  orxTILEMAP *pstResult;
+
+  /* Checks */
+  orxASSERT(sstTileMap.u32Flags & orxTILEMAP_KU32_STATIC_FLAG_READY);
+  orxASSERT((_zConfigID != orxNULL) && (_zConfigID != orxSTRING_EMPTY));
+
+  /* Pushes section */
+  if((orxConfig_HasSection(_zConfigID) != orxFALSE)
+  && (orxConfig_PushSection(_zConfigID) != orxSTATUS_FAILURE))
+  {
+    orxVECTOR vSize, vTileSize;
+
+    /* Gets map & tile sizes */
+    if((orxConfig_GetVector(orxTILEMAP_KZ_CONFIG_SIZE, &vSize) != orxNULL)
+    && (orxConfig_GetVector(orxTILEMAP_KZ_CONFIG_TILE_SIZE, &vTileSize) != orxNULL)
+    && (vSize.fX >= orxFLOAT_1)
+    && (vSize.fY >= orxFLOAT_1))
+    {
+      /* Creates tile map */
+      pstResult = orxTileMap_Create(orxF2U(vSize.fX), orxF2U(vSize.fY), &vTileSize);
+
+      /* Valid? */
+      if(pstResult != orxNULL)
+      {
+        /* Stores its reference key */
+        pstResult->zReference = orxConfig_GetCurrentSection();
+
+        /* Processes its config data */
+        if(orxTileMap_ProcessConfigData(pstResult) == orxSTATUS_FAILURE)
+        {
+          /* Logs message */
+          orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Couldn't process config data for tile map <%s>.", _zConfigID);
+
+          /* Deletes it */
+          orxTileMap_Delete(pstResult);
+
+          /* Updates result */
+          pstResult = orxNULL;
+        }
+      }
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "[%s]: Tile map needs a valid " orxTILEMAP_KZ_CONFIG_SIZE " and " orxTILEMAP_KZ_CONFIG_TILE_SIZE ".", _zConfigID);
+
+      /* Updates result */
+      pstResult = orxNULL;
+    }
+
+    /* Pops previous section */
+    orxConfig_PopSection();
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Couldn't find config section named (%s).", _zConfigID);
+
+    /* Updates result */
+    pstResult = orxNULL;
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Deletes a tile map
+ * @param[in]   _pstTileMap   Concerned tile map
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxTileMap_Delete(orxTILEMAP *_pstTileMap)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT(sstTileMap.u32Flags & orxTILEMAP_KU32_STATIC_FLAG_READY);
+  orxSTRUCTURE_ASSERT(_pstTileMap);
+
+  /* Decreases count */
+  orxStructure_DecreaseCount(_pstTileMap);
+
+  /* Not referenced? */
+  if(orxStructure_GetRefCount(_pstTileMap) == 0)
+  {
+    /* Removes texture */
+    orxTileMap_SetTexture(_pstTileMap, orxNULL, orxNULL, orxNULL);
+
+    /* Frees its tiles */
+    orxMemory_Free(_pstTileMap->au16TileList);
+
+    /* Deletes structure */
+    orxStructure_Delete(_pstTileMap);
+  }
+  else
+  {
+    /* Referenced by others */
+    eResult = orxSTATUS_FAILURE;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Gets tile map name
+ * @param[in]   _pstTileMap   Concerned tile map
+ * @return      Tile map name / orxSTRING_EMPTY
+ */
+const orxSTRING orxFASTCALL orxTileMap_GetName(const orxTILEMAP *_pstTileMap)
+{
+  const orxSTRING zResult;
+
+  /* Checks */
+  orxASSERT(sstTileMap.u32Flags & orxTILEMAP_KU32_STATIC_FLAG_READY);
+  orxSTRUCTURE_ASSERT(_pstTileMap);
+
+  /* Updates result */
+  zResult = (_pstTileMap->zReference != orxNULL) ? _pstTileMap->zReference : orxSTRING_EMPTY;
+
+  /* Done! */
+  return zResult;
+}
+
+/** Sets tile map's tileset texture
+ * @param[in]   _pstTileMap   Concerned tile map
+ * @param[in]   _pstTexture   Tileset texture / orxNULL
+ * @param[in]   _pvOrigin     Origin of the tileset inside the texture, orxNULL for top left corner
+ * @param[in]   _pvSize       Size of the tileset inside the texture, orxNULL for the whole texture
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxTileMap_SetTexture(orxTILEMAP *_pstTileMap, orxTEXTURE *_pstTexture, const orxVECTOR *_pvOrigin, const orxVECTOR *_pvSize)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT(sstTileMap.u32Flags & orxTILEMAP_KU32_STATIC_FLAG_READY);
+  orxSTRUCTURE_ASSERT(_pstTileMap);
+
+  /* Had previous texture? */
+  if(_pstTileMap->pstTexture != orxNULL)
+  {
+    /* Updates structure reference count */
+    orxStructure_DecreaseCount(_pstTileMap->pstTexture);
+
+    /* Internally handled? */
+    if(orxStructure_TestFlags(_pstTileMap, orxTILEMAP_KU32_FLAG_INTERNAL))
+    {
+      /* Removes its owner */
+      orxStructure_SetOwner(_pstTileMap->pstTexture, orxNULL);
+
+      /* Deletes it */
+      orxTexture_Delete(_pstTileMap->pstTexture);
+
+      /* Updates flags */
+      orxStructure_SetFlags(_pstTileMap, orxTILEMAP_KU32_FLAG_NONE, orxTILEMAP_KU32_FLAG_INTERNAL);
+    }
+
+    /* Cleans reference */
+    _pstTileMap->pstTexture = orxNULL;
+
+    /* Clears tileset */
+    orxVector_Copy(&(_pstTileMap->vTilesetOrigin), &orxVECTOR_0);
+    _pstTileMap->u32TilesetColumns  = 0;
+    _pstTileMap->u32TilesetCount    = 0;
+  }
+
+  /* New texture? */
+  if(_pstTexture != orxNULL)
+  {
+    orxVECTOR vSize;
+
+    /* Gets tileset origin */
+    orxVector_Copy(&(_pstTileMap->vTilesetOrigin), (_pvOrigin != orxNULL) ? _pvOrigin : &orxVECTOR_0);
+
+    /* Gets tileset size */
+    if(_pvSize != orxNULL)
+    {
+      orxVector_Copy(&vSize, _pvSize);
+    }
+    else
+    {
+      orxTexture_GetSize(_pstTexture, &(vSize.fX), &(vSize.fY));
+      vSize.fX -= _pstTileMap->vTilesetOrigin.fX;
+      vSize.fY -= _pstTileMap->vTilesetOrigin.fY;
+    }
+
+    /* Gets tileset layout */
+    _pstTileMap->u32TilesetColumns  = orxF2U(vSize.fX / _pstTileMap->vTileSize.fX);
+    _pstTileMap->u32TilesetCount    = orxMIN(_pstTileMap->u32TilesetColumns * orxF2U(vSize.fY / _pstTileMap->vTileSize.fY), orxTILEMAP_KU32_TILE_MAX);
+
+    /* Valid? */
+    if(_pstTileMap->u32TilesetCount > 0)
+    {
+      /* Stores it */
+      _pstTileMap->pstTexture = _pstTexture;
+
+      /* Updates its reference count */
+      orxStructure_IncreaseCount(_pstTexture);
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "[%s]: Texture <%s> can't contain any tile of size (%g, %g).", orxTileMap_GetName(_pstTileMap), orxTexture_GetName(_pstTexture), _pstTileMap->vTileSize.fX, _pstTileMap->vTileSize.fY);
+
+      /* Clears tileset */
+      orxVector_Copy(&(_pstTileMap->vTilesetOrigin), &orxVECTOR_0);
+      _pstTileMap->u32TilesetColumns = 0;
+
+      /* Updates result */
+      eResult = orxSTATUS_FAILURE;
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Gets tile map's tileset texture
+ * @param[in]   _pstTileMap   Concerned tile map
+ * @return      orxTEXTURE / orxNULL
+ */
+orxTEXTURE *orxFASTCALL orxTileMap_GetTexture(const orxTILEMAP *_pstTileMap)
+{
+  /* Checks */
+  orxASSERT(sstTileMap.u32Flags & orxTILEMAP_KU32_STATIC_FLAG_READY);
+  orxSTRUCTURE_ASSERT(_pstTileMap);
+
+  /* Done! */
+  return _pstTileMap->pstTexture;
+}
+
+/** Gets tile map's size, in tiles
+ * @param[in]   _pstTileMap   Concerned tile map
+ * @param[out]  _pu32Width    Width, in tiles
+ * @param[out]  _pu32Height   Height, in tiles
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxTileMap_GetMapSize(const orxTILEMAP *_pstTileMap, orxU32 *_pu32Width, orxU32 *_pu32Height)
+{
+  /* Checks */
+  orxASSERT(sstTileMap.u32Flags & orxTILEMAP_KU32_STATIC_FLAG_READY);
+  orxSTRUCTURE_ASSERT(_pstTileMap);
+  orxASSERT(_pu32Width != orxNULL);
+  orxASSERT(_pu32Height != orxNULL);
+
+  /* Updates result */
+  *_pu32Width   = _pstTileMap->u32Width;
+  *_pu32Height  = _pstTileMap->u32Height;
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
+/** Gets tile map's tile size, in pixels
+ * @param[in]   _pstTileMap   Concerned tile map
+ * @param[out]  _pvTileSize   Tile size
+ * @return      orxVECTOR / orxNULL
+ */
+orxVECTOR *orxFASTCALL orxTileMap_GetTileSize(const orxTILEMAP *_pstTileMap, orxVECTOR *_pvTileSize)
+{
+  /* Checks */
+  orxASSERT(sstTileMap.u32Flags & orxTILEMAP_KU32_STATIC_FLAG_READY);
+  orxSTRUCTURE_ASSERT(_pstTileMap);
+  orxASSERT(_pvTileSize != orxNULL);
+
+  /* Done! */
+  return orxVector_Copy(_pvTileSize, &(_pstTileMap->vTileSize));
+}
+
+/** Gets tile map's size, in pixels
+ * @param[in]   _pstTileMap   Concerned tile map
+ * @param[out]  _pfWidth      Width, in pixels
+ * @param[out]  _pfHeight     Height, in pixels
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxTileMap_GetSize(const orxTILEMAP *_pstTileMap, orxFLOAT *_pfWidth, orxFLOAT *_pfHeight)
+{
+  /* Checks */
+  orxASSERT(sstTileMap.u32Flags & orxTILEMAP_KU32_STATIC_FLAG_READY);
+  orxSTRUCTURE_ASSERT(_pstTileMap);
+  orxASSERT(_pfWidth != orxNULL);
+  orxASSERT(_pfHeight != orxNULL);
+
+  /* Updates result */
+  *_pfWidth   = orxU2F(_pstTileMap->u32Width) * _pstTileMap->vTileSize.fX;
+  *_pfHeight  = orxU2F(_pstTileMap->u32Height) * _pstTileMap->vTileSize.fY;
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
+/** Sets a tile
+ * @param[in]   _pstTileMap   Concerned tile map
+ * @param[in]   _u32X         X coordinate, in tiles
+ * @param[in]   _u32Y         Y coordinate, in tiles
+ * @param[in]   _u32Tile      Tile index in the tileset (1-based), orxTILEMAP_KU32_TILE_NONE to clear it
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxTileMap_SetTile(orxTILEMAP *_pstTileMap, orxU32 _u32X, orxU32 _u32Y, orxU32 _u32Tile)
+{
+  orxSTATUS eResult;
+
+  /* Checks */
+  orxASSERT(sstTileMap.u32Flags & orxTILEMAP_KU32_STATIC_FLAG_READY);
+  orxSTRUCTURE_ASSERT(_pstTileMap);
+
+  /* Valid? */
+  if((_u32X < _pstTileMap->u32Width)
+  && (_u32Y < _pstTileMap->u32Height)
+  && (_u32Tile <= orxTILEMAP_KU32_TILE_MAX))
+  {
+    /* Stores it */
+    _pstTileMap->au16TileList[_u32Y * _pstTileMap->u32Width + _u32X] = (orxU16)_u32Tile;
+
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
+  else
+  {
+    /* Updates result */
+    eResult = orxSTATUS_FAILURE;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Gets a tile
+ * @param[in]   _pstTileMap   Concerned tile map
+ * @param[in]   _u32X         X coordinate, in tiles
+ * @param[in]   _u32Y         Y coordinate, in tiles
+ * @return      Tile index in the tileset (1-based) / orxTILEMAP_KU32_TILE_NONE
+ */
+orxU32 orxFASTCALL orxTileMap_GetTile(const orxTILEMAP *_pstTileMap, orxU32 _u32X, orxU32 _u32Y)
+{
+  orxU32 u32Result;
+
+  /* Checks */
+  orxASSERT(sstTileMap.u32Flags & orxTILEMAP_KU32_STATIC_FLAG_READY);
+  orxSTRUCTURE_ASSERT(_pstTileMap);
+
+  /* Updates result */
+  u32Result = ((_u32X < _pstTileMap->u32Width) && (_u32Y < _pstTileMap->u32Height)) ? (orxU32)_pstTileMap->au16TileList[_u32Y * _pstTileMap->u32Width + _u32X] : orxTILEMAP_KU32_TILE_NONE;
+
+  /* Done! */
+  return u32Result;
+}
+
+/** Gets tile map's raw tile list (row major, read only), used for fast iteration
+ * @param[in]   _pstTileMap   Concerned tile map
+ * @return      Tile list
+ */
+const orxU16 *orxFASTCALL orxTileMap_GetTileList(const orxTILEMAP *_pstTileMap)
+{
+  /* Checks */
+  orxASSERT(sstTileMap.u32Flags & orxTILEMAP_KU32_STATIC_FLAG_READY);
+  orxSTRUCTURE_ASSERT(_pstTileMap);
+
+  /* Done! */
+  return _pstTileMap->au16TileList;
+}
+
+/** Gets a tile's origin inside the tileset texture
+ * @param[in]   _pstTileMap   Concerned tile map
+ * @param[in]   _u32Tile      Tile index in the tileset (1-based)
+ * @param[out]  _pvOrigin     Tile's top left corner, in texels
+ * @return      orxVECTOR / orxNULL if the tile is empty or out of the tileset
+ */
+orxVECTOR *orxFASTCALL orxTileMap_GetTileOrigin(const orxTILEMAP *_pstTileMap, orxU32 _u32Tile, orxVECTOR *_pvOrigin)
+{
+  orxVECTOR *pvResult;
+
+  /* Checks */
+  orxASSERT(sstTileMap.u32Flags & orxTILEMAP_KU32_STATIC_FLAG_READY);
+  orxSTRUCTURE_ASSERT(_pstTileMap);
+  orxASSERT(_pvOrigin != orxNULL);
+
+  /* Valid? */
+  if((_u32Tile != orxTILEMAP_KU32_TILE_NONE) && (_u32Tile <= _pstTileMap->u32TilesetCount))
+  {
+    /* Updates result */
+    orxVector_Set(_pvOrigin,
+                  _pstTileMap->vTilesetOrigin.fX + orxU2F((_u32Tile - 1) % _pstTileMap->u32TilesetColumns) * _pstTileMap->vTileSize.fX,
+                  _pstTileMap->vTilesetOrigin.fY + orxU2F((_u32Tile - 1) / _pstTileMap->u32TilesetColumns) * _pstTileMap->vTileSize.fY,
+                  orxFLOAT_0);
+    pvResult = _pvOrigin;
+  }
+  else
+  {
+    /* Updates result */
+    pvResult = orxNULL;
+  }
+
+  /* Done! */
+  return pvResult;
+}
@@ -37,6 +37,7 @@
 #include "core/orxCommand.h"
 #include "core/orxConfig.h"
 #include "core/orxEvent.h"
+#include "core/orxReplay.h"
 #include "core/orxResource.h"
 #include "debug/orxDebug.h"
 #include "debug/orxProfiler.h"
@@ -386,84 +387,96 @@ static orxINLINE orxFLOAT orxInput_GetBindingValue(orxINPUT_TYPE _eType, orxENUM
   /* Checks */
   orxASSERT(_eType < orxINPUT_TYPE_NUMBER);
 
-  /* Depending on type */
-  switch(_eType)
+  /* Playing back? */
+  if(orxReplay_IsPlaying() != orxFALSE)
   {
-    case orxINPUT_TYPE_KEYBOARD_KEY:
+    /* Gets played back value */
+    fResult = orxReplay_GetInputValue(_eType, _eID);
+  }
+  else
+  {
+    /* Depending on type */
+    switch(_eType)
     {
-      /* Updates result */
-      fResult = (orxKeyboard_IsKeyPressed((orxKEYBOARD_KEY)_eID) != orxFALSE) ? orxFLOAT_1 : orxFLOAT_0;
+      case orxINPUT_TYPE_KEYBOARD_KEY:
+      {
+        /* Updates result */
+        fResult = (orxKeyboard_IsKeyPressed((orxKEYBOARD_KEY)_eID) != orxFALSE) ? orxFLOAT_1 : orxFLOAT_0;
 
-      break;
-    }
+        break;
+      }
 
-    case orxINPUT_TYPE_MOUSE_BUTTON:
-    {
-      /* Wheel? */
-      switch(_eID)
+      case orxINPUT_TYPE_MOUSE_BUTTON:
       {
-        case orxMOUSE_BUTTON_WHEEL_UP:
+        /* Wheel? */
+        switch(_eID)
         {
-          /* Updates result */
-          fResult = orxMouse_GetWheelDelta();
-          fResult = orxMAX(fResult, orxFLOAT_0);
-          break;
-        }
+          case orxMOUSE_BUTTON_WHEEL_UP:
+          {
+            /* Updates result */
+            fResult = orxMouse_GetWheelDelta();
+            fResult = orxMAX(fResult, orxFLOAT_0);
+            break;
+          }
 
-        case orxMOUSE_BUTTON_WHEEL_DOWN:
-        {
-          /* Updates result */
-          fResult = -orxMouse_GetWheelDelta();
-          fResult = orxMAX(fResult, orxFLOAT_0);
-          break;
-        }
+          case orxMOUSE_BUTTON_WHEEL_DOWN:
+          {
+            /* Updates result */
+            fResult = -orxMouse_GetWheelDelta();
+            fResult = orxMAX(fResult, orxFLOAT_0);
+            break;
+          }
 
-        default:
-        {
-          /* Updates result */
-          fResult = (orxMouse_IsButtonPressed((orxMOUSE_BUTTON)_eID) != orxFALSE) ? orxFLOAT_1 : orxFLOAT_0;
-          break;
+          default:
+          {
+            /* Updates result */
+            fResult = (orxMouse_IsButtonPressed((orxMOUSE_BUTTON)_eID) != orxFALSE) ? orxFLOAT_1 : orxFLOAT_0;
+            break;
+          }
         }
-      }
 
-      break;
-    }
+        break;
+      }
 
-    case orxINPUT_TYPE_MOUSE_AXIS:
-    {
-      /* Updates result */
-      fResult = (_eID == (orxMOUSE_AXIS_X))
-              ? sstInput.vMouseMove.fX
-              : (_eID == (orxMOUSE_AXIS_Y))
-              ?  sstInput.vMouseMove.fY
-              : orxFLOAT_0;
+      case orxINPUT_TYPE_MOUSE_AXIS:
+      {
+        /* Updates result */
+        fResult = (_eID == (orxMOUSE_AXIS_X))
+                ? sstInput.vMouseMove.fX
+                : (_eID == (orxMOUSE_AXIS_Y))
+                ?  sstInput.vMouseMove.fY
+                : orxFLOAT_0;
 
-      break;
-    }
+        break;
+      }
 
-    case orxINPUT_TYPE_JOYSTICK_BUTTON:
-    {
-      /* Updates result */
-      fResult = (orxJoystick_IsButtonPressed((orxJOYSTICK_BUTTON)_eID) != orxFALSE) ? orxFLOAT_1 : orxFLOAT_0;
+      case orxINPUT_TYPE_JOYSTICK_BUTTON:
+      {
+        /* Updates result */
+        fResult = (orxJoystick_IsButtonPressed((orxJOYSTICK_BUTTON)_eID) != orxFALSE) ? orxFLOAT_1 : orxFLOAT_0;
 
-      break;
-    }
+        break;
+      }
 
-    case orxINPUT_TYPE_JOYSTICK_AXIS:
-    {
-      /* Updates result */
-      fResult = orxJoystick_GetAxisValue((orxJOYSTICK_AXIS)_eID);
+      case orxINPUT_TYPE_JOYSTICK_AXIS:
+      {
+        /* Updates result */
+        fResult = orxJoystick_GetAxisValue((orxJOYSTICK_AXIS)_eID);
 
-      break;
-    }
+        break;
+      }
 
-    default:
-    {
-      /* Logs message */
-      orxDEBUG_PRINT(orxDEBUG_LEVEL_INPUT, "Input type <%d> is not recognized!", _eType);
+      default:
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_INPUT, "Input type <%d> is not recognized!", _eType);
 
-      break;
+        break;
+      }
     }
+
+    /* Records it */
+    orxReplay_RecordInputValue(_eType, _eID, fResult);
   }
 
   /* Done! */
@@ -31,6 +31,7 @@
 
 
 #include "memory/orxBank.h"
+#include "core/orxThread.h"
 #include "debug/orxDebug.h"
 #include "debug/orxProfiler.h"
 #include "math/orxMath.h"
@@ -40,6 +41,9 @@
 #define orxBANK_KU32_STATIC_FLAG_NONE         0x00000000  /**< No flags have been set */
 #define orxBANK_KU32_STATIC_FLAG_READY        0x00000001  /**< The module has been initialized */
 
+#define orxBANK_KU32_MAGAZINE_SIZE            32          /**< Number of free cells cached per thread, for thread-safe banks */
+#define orxBANK_KU32_SEGMENT_LIST_SIZE        16          /**< Initial size of the segment directory */
+
 
 /***************************************************************************
  * Structure declaration                                                   *
@@ -51,24 +55,45 @@ typedef struct __orxBANK_SEGMENT_t
 {
   void                       *pSegmentData;     /**< Pointer address on the head of the segment data cells */
   struct __orxBANK_SEGMENT_t *pstNext;          /**< Pointer on the next segment */
+  struct __orxBANK_SEGMENT_t *pstNextPartial;   /**< Pointer on the next segment with free elements */
+  struct __orxBANK_SEGMENT_t *pstPreviousPartial; /**< Pointer on the previous segment with free elements */
+  orxU32                      u32Index;         /**< Index of the segment */
+  orxU32                      u32FreeHint;      /**< Lowest map part that can contain free elements */
   orxU32                      u32NbFree;        /**< Number of free elements in the segment */
-  orxU32                      au32CellAllocationMap[0]; /**< List of bits that represents free and used elements in the segment */
+  orxU32                      au32CellAllocationMap[0]; /**< List of bits that represents free and used elements in the segment, followed by the reserved (cached in a magazine) ones for thread-safe banks */
 
 } orxBANK_SEGMENT;
 #ifdef __orxMSVC__
   #pragma warning(default : 4200)
 #endif /* __orxMSVC__ */
 
+typedef struct __orxBANK_MAGAZINE_t
+{
+  void                       *apCellList[orxBANK_KU32_MAGAZINE_SIZE]; /**< Cached cells, allocated in segments but not handed out */
+  orxU32                      u32Count;         /**< Number of cached cells */
+
+} orxBANK_MAGAZINE;
+
 struct __orxBANK_t
 {
   orxLINKLIST_NODE  stNode;                 /**< Linklist node */
   orxBANK_SEGMENT  *pstFirstSegment;        /**< First segment used in the bank */
+  orxBANK_SEGMENT  *pstPartialSegment;      /**< First segment with free elements */
+  orxBANK_SEGMENT **apstSegmentList;        /**< Segment directory, indexed by segment index */
+  orxU32            u32SegmentCount;        /**< Number of segments */
+  orxU32            u32SegmentListSize;     /**< Size of the segment directory */
+  orxU32            u32SegmentShift;        /**< Cell index to segment index shift, orxU32_UNDEFINED if the number of cells per segment isn't a power of two */
+  orxU32            u32SegmentSize;         /**< Size of a segment allocation, header included */
+  orxU32            u32SegmentAlignment;    /**< Alignment of segment allocations (power of two, no smaller than their size), used to retrieve a segment from any of its cells */
+  orxU32            u32SegmentOffset;       /**< Offset of segments from their aligned base, orxU32_UNDEFINED before the first allocation */
   orxU32            u32Count;               /**< Number of allocated cells */
   orxU32            u32ElemSize;            /**< Size of a cell */
   orxU16            u16NbCellPerSegments;   /**< Number of cells per banks */
   orxU16            u16SizeSegmentBitField; /**< Number of u32 (4 bytes) to represent a segment */
   orxU32            u32Flags;               /**< Flags set for the memory bank */
   orxMEMORY_TYPE    eMemType;               /**< Memory type that will be used by the memory allocation */
+  orxTHREAD_SEMAPHORE *pstSemaphore;        /**< Segment list lock (thread-safe banks only) */
+  orxBANK_MAGAZINE *astMagazineList;        /**< Per-thread magazines (thread-safe banks only) */
 };
 
 typedef struct __orxBANK_STATIC_t
@@ -92,7 +117,7 @@ static orxBANK_STATIC sstBank;
  * @param[in] _pstBank    Concerned bank
  * @return  returns a pointer on the memory segment (orxNULL if an error occurred)
  */
-static orxINLINE orxBANK_SEGMENT *orxBank_CreateSegment(const orxBANK *_pstBank)
+static orxINLINE orxBANK_SEGMENT *orxBank_CreateSegment(orxBANK *_pstBank)
 {
   orxBANK_SEGMENT *pstSegment;  /* Pointer on the segment of memory */
   orxU32 u32BaseSegmentSize;    /* Base size of segment allocation */
@@ -106,11 +131,38 @@ static orxINLINE orxBANK_SEGMENT *orxBank_CreateSegment(const orxBANK *_pstBank)
   /* Correct parameters ? */
   orxASSERT(_pstBank != orxNULL);
 
-  /* Compute the base segment size */
-  u32BaseSegmentSize = sizeof(orxBANK_SEGMENT) + _pstBank->u16SizeSegmentBitField * sizeof(orxU32);
+  /* Compute the base segment size (thread-safe banks also store a reserved map) */
+  u32BaseSegmentSize = sizeof(orxBANK_SEGMENT) + _pstBank->u16SizeSegmentBitField * sizeof(orxU32) * ((_pstBank->u32Flags & orxBANK_KU32_FLAG_THREAD_SAFE) ? 2 : 1);
+
+  /* Allocates a new segment of memory, aligned so that it can be retrieved from any of its cells by masking */
+  pstSegment = (orxBANK_SEGMENT *)orxMemory_AllocateAligned(_pstBank->u32SegmentSize, _pstBank->u32SegmentAlignment, _pstBank->eMemType);
+
+  /* First segment? */
+  while((pstSegment != orxNULL) && (_pstBank->u32SegmentOffset == orxU32_UNDEFINED))
+  {
+    orxU32 u32Offset;
+
+    /* Gets its offset from its aligned base */
+    u32Offset = (orxU32)((size_t)pstSegment & (size_t)(_pstBank->u32SegmentAlignment - 1));
+
+    /* Fits in its alignment window? */
+    if(u32Offset + _pstBank->u32SegmentSize <= _pstBank->u32SegmentAlignment)
+    {
+      /* Stores offset */
+      _pstBank->u32SegmentOffset = u32Offset;
+    }
+    else
+    {
+      /* Retries with a larger window */
+      orxMemory_Free(pstSegment);
+      _pstBank->u32SegmentAlignment <<= 1;
+      pstSegment = (orxBANK_SEGMENT *)orxMemory_AllocateAligned(_pstBank->u32SegmentSize, _pstBank->u32SegmentAlignment, _pstBank->eMemType);
+    }
+  }
+
+  /* Checks */
+  orxASSERT((pstSegment == orxNULL) || ((orxU32)((size_t)pstSegment & (size_t)(_pstBank->u32SegmentAlignment - 1)) == _pstBank->u32SegmentOffset));
 
-  /* Allocates a new segment of memory */
-  pstSegment = (orxBANK_SEGMENT *)orxMemory_Allocate(u32BaseSegmentSize + sstBank.u32CacheLineSize - 1 + (_pstBank->u16NbCellPerSegments * _pstBank->u32ElemSize), _pstBank->eMemType);
   if(pstSegment != orxNULL)
   {
     orxU8 *pAlignedSegmentData;
@@ -121,6 +173,9 @@ static orxINLINE orxBANK_SEGMENT *orxBank_CreateSegment(const orxBANK *_pstBank)
     pstSegment->u32NbFree             = _pstBank->u16NbCellPerSegments;
     pAlignedSegmentData               = ((orxU8 *)pstSegment) + u32BaseSegmentSize;
     pstSegment->pSegmentData          = (void *)orxALIGN(pAlignedSegmentData, sstBank.u32CacheLineSize);
+
+    /* Makes sure segment is fully initialized before being linked, as thread-safe banks retrieve segments from cells without locking */
+    orxMEMORY_BARRIER();
   }
 
   /* Profiles */
@@ -130,15 +185,127 @@ static orxINLINE orxBANK_SEGMENT *orxBank_CreateSegment(const orxBANK *_pstBank)
   return pstSegment;
 }
 
-/** Returns the segment where is stored _pCell
+/** Links a segment to the list of segments with free elements
+ * @param[in] _pstBank    Concerned bank
+ * @param[in] _pstSegment Segment to link
+ */
+static orxINLINE void orxBank_LinkPartialSegment(orxBANK *_pstBank, orxBANK_SEGMENT *_pstSegment)
+{
+  /* Checks */
+  orxASSERT(_pstBank != orxNULL);
+  orxASSERT(_pstSegment != orxNULL);
+
+  /* Links it as first */
+  _pstSegment->pstPreviousPartial = orxNULL;
+  _pstSegment->pstNextPartial     = _pstBank->pstPartialSegment;
+  if(_pstBank->pstPartialSegment != orxNULL)
+  {
+    _pstBank->pstPartialSegment->pstPreviousPartial = _pstSegment;
+  }
+  _pstBank->pstPartialSegment     = _pstSegment;
+
+  /* Done! */
+  return;
+}
+
+/** Unlinks a segment from the list of segments with free elements
+ * @param[in] _pstBank    Concerned bank
+ * @param[in] _pstSegment Segment to unlink
+ */
+static orxINLINE void orxBank_UnlinkPartialSegment(orxBANK *_pstBank, orxBANK_SEGMENT *_pstSegment)
+{
+  /* Checks */
+  orxASSERT(_pstBank != orxNULL);
+  orxASSERT(_pstSegment != orxNULL);
+
+  /* Unlinks it */
+  if(_pstSegment->pstPreviousPartial != orxNULL)
+  {
+    _pstSegment->pstPreviousPartial->pstNextPartial = _pstSegment->pstNextPartial;
+  }
+  else
+  {
+    orxASSERT(_pstBank->pstPartialSegment == _pstSegment);
+    _pstBank->pstPartialSegment = _pstSegment->pstNextPartial;
+  }
+  if(_pstSegment->pstNextPartial != orxNULL)
+  {
+    _pstSegment->pstNextPartial->pstPreviousPartial = _pstSegment->pstPreviousPartial;
+  }
+  _pstSegment->pstNextPartial = _pstSegment->pstPreviousPartial = orxNULL;
+
+  /* Done! */
+  return;
+}
+
+/** Adds a segment at the end of the bank's segment list & directories
+ * @param[in] _pstBank    Concerned bank
+ * @param[in] _pstSegment Segment to add
+ * @return  orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxINLINE orxSTATUS orxBank_AddSegment(orxBANK *_pstBank, orxBANK_SEGMENT *_pstSegment)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT(_pstBank != orxNULL);
+  orxASSERT(_pstSegment != orxNULL);
+
+  /* Directories full? */
+  if(_pstBank->u32SegmentCount == _pstBank->u32SegmentListSize)
+  {
+    orxBANK_SEGMENT **apstSegmentList;
+
+    /* Doubles its size */
+    apstSegmentList = (orxBANK_SEGMENT **)orxMemory_Reallocate(_pstBank->apstSegmentList, (_pstBank->u32SegmentListSize << 1) * sizeof(orxBANK_SEGMENT *));
+
+    /* Success? */
+    if(apstSegmentList != orxNULL)
+    {
+      /* Updates directory */
+      _pstBank->apstSegmentList     = apstSegmentList;
+      _pstBank->u32SegmentListSize <<= 1;
+    }
+    else
+    {
+      /* Updates result */
+      eResult = orxSTATUS_FAILURE;
+    }
+  }
+
+  /* Valid? */
+  if(eResult != orxSTATUS_FAILURE)
+  {
+    /* Links it at the end of the segment list */
+    if(_pstBank->u32SegmentCount != 0)
+    {
+      _pstBank->apstSegmentList[_pstBank->u32SegmentCount - 1]->pstNext = _pstSegment;
+    }
+    else
+    {
+      _pstBank->pstFirstSegment = _pstSegment;
+    }
+
+    /* Stores it */
+    _pstSegment->u32Index = _pstBank->u32SegmentCount;
+    _pstBank->apstSegmentList[_pstBank->u32SegmentCount++] = _pstSegment;
+
+    /* Links it as partial */
+    orxBank_LinkPartialSegment(_pstBank, _pstSegment);
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Returns the segment where is stored _pCell, in constant time, without accessing the segment directory
  * @param[in] _pstBank  Bank that stores segments
  * @param[in] _pCell    Cell stored by the segment to find
- * @return  The segment where is stored _pCell (orxNULL if not found)
+ * @return  The segment where is stored _pCell
  */
 static orxINLINE orxBANK_SEGMENT *orxBank_GetSegment(const orxBANK *_pstBank, const void *_pCell)
 {
-  orxBANK_SEGMENT  *pstSegment, *pstResult = orxNULL;
-  orxU32            u32Size;
+  orxBANK_SEGMENT *pstResult;
 
   /* Module initialized ? */
   orxASSERT((sstBank.u32Flags & orxBANK_KU32_STATIC_FLAG_READY) == orxBANK_KU32_STATIC_FLAG_READY);
@@ -147,24 +314,500 @@ static orxINLINE orxBANK_SEGMENT *orxBank_GetSegment(const orxBANK *_pstBank, co
   orxASSERT(_pstBank != orxNULL);
   orxASSERT(_pCell != orxNULL);
 
-  /* For all segments */
-  for(pstSegment = _pstBank->pstFirstSegment, u32Size = _pstBank->u32ElemSize * (orxU32)_pstBank->u16NbCellPerSegments;
-      pstSegment != orxNULL;
-      pstSegment = pstSegment->pstNext)
+  /* Gets segment from the cell's aligned base */
+  pstResult = (orxBANK_SEGMENT *)((((size_t)_pCell) & ~((size_t)_pstBank->u32SegmentAlignment - 1)) + (size_t)_pstBank->u32SegmentOffset);
+
+  /* Checks */
+  orxASSERT((_pCell >= pstResult->pSegmentData) && ((orxU32)((orxU8 *)_pCell - (orxU8 *)pstResult->pSegmentData) < _pstBank->u32ElemSize * (orxU32)_pstBank->u16NbCellPerSegments));
+
+  /* Done! */
+  return pstResult;
+}
+
+#ifdef __orxMEMORY_DEBUG__
+
+/** Checks a segment's allocation map against its free count
+ * @param[in] _pstBank    Concerned bank
+ * @param[in] _pstSegment Concerned segment
+ */
+static orxINLINE void orxBank_CheckSegment(const orxBANK *_pstBank, const orxBANK_SEGMENT *_pstSegment)
+{
+  orxU32 u32Count = 0, i;
+
+  /* For all map parts */
+  for(i = 0; i < _pstBank->u16SizeSegmentBitField; i++)
+  {
+    /* Updates count */
+    u32Count += orxMath_GetBitCount(_pstSegment->au32CellAllocationMap[i]);
+  }
+
+  /* Checks */
+  orxASSERT(u32Count == (orxU32)(_pstBank->u16NbCellPerSegments - _pstSegment->u32NbFree));
+
+  /* Done! */
+  return;
+}
+
+#endif /* __orxMEMORY_DEBUG__ */
+
+/** Gets a part of the map of live cells (ie. allocated and handed out) of a segment
+ * @param[in] _pstBank    Concerned bank
+ * @param[in] _pstSegment Concerned segment
+ * @param[in] _u32Index   Index of the map part
+ * @return  Map part
+ */
+static orxINLINE orxU32 orxBank_GetLiveMap(const orxBANK *_pstBank, const orxBANK_SEGMENT *_pstSegment, orxU32 _u32Index)
+{
+  orxU32 u32Result;
+
+  /* Updates result */
+  u32Result = _pstSegment->au32CellAllocationMap[_u32Index];
+
+  /* Thread-safe? */
+  if(_pstBank->u32Flags & orxBANK_KU32_FLAG_THREAD_SAFE)
+  {
+    /* Removes cells reserved in magazines */
+    u32Result &= ~(_pstSegment->au32CellAllocationMap[_pstBank->u16SizeSegmentBitField + _u32Index]);
+  }
+
+  /* Done! */
+  return u32Result;
+}
+
+/** Sets / clears the reserved bit of a cell, for thread-safe banks
+ * @param[in] _pstBank    Concerned bank
+ * @param[in] _pCell      Concerned cell
+ * @param[in] _bReserve   Reserve / release
+ * @param[out] _pu32Index If non-null, will contain the index of the cell
+ */
+static orxINLINE void orxBank_ReserveCell(const orxBANK *_pstBank, const void *_pCell, orxBOOL _bReserve, orxU32 *_pu32Index)
+{
+  orxBANK_SEGMENT  *pstSegment;
+  orxU32            u32CellIndex;
+
+  /* Gets its segment */
+  pstSegment = orxBank_GetSegment(_pstBank, _pCell);
+
+  /* Checks */
+  orxASSERT(pstSegment != orxNULL);
+
+  /* Gets cell index */
+  u32CellIndex = (orxU32)((orxU8 *)_pCell - (orxU8 *)pstSegment->pSegmentData) / _pstBank->u32ElemSize;
+
+  /* Reserve? */
+  if(_bReserve != orxFALSE)
+  {
+    /* Sets its bit */
+    orxMEMORY_ATOMIC_OR32(&(pstSegment->au32CellAllocationMap[_pstBank->u16SizeSegmentBitField + (u32CellIndex >> 5)]), (orxU32)(1 << (u32CellIndex & 31)));
+  }
+  else
+  {
+    /* Clears its bit */
+    orxMEMORY_ATOMIC_AND32(&(pstSegment->au32CellAllocationMap[_pstBank->u16SizeSegmentBitField + (u32CellIndex >> 5)]), ~(orxU32)(1 << (u32CellIndex & 31)));
+  }
+
+  /* Asked for index? */
+  if(_pu32Index != orxNULL)
+  {
+    /* Stores it */
+    *_pu32Index = (pstSegment->u32Index * (orxU32)_pstBank->u16NbCellPerSegments) + u32CellIndex;
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Gets the closest allocated cell preceding a given one (partial segments aren't filled in address order, so the cell right before can be free)
+ * Cost is linear in the number of map parts scanned: at most the cell's segment and the first non-empty one before it, plus one step per fully free segment in between
+ * @param[in] _pstBank        Concerned bank
+ * @param[in] _pstSegment     Segment of the reference cell
+ * @param[in] _u32CellIndex   Index of the reference cell inside its segment
+ * @return Closest preceding allocated cell / orxNULL if none
+ */
+static void *orxFASTCALL orxBank_GetPreviousCell(const orxBANK *_pstBank, const orxBANK_SEGMENT *_pstSegment, orxU32 _u32CellIndex)
+{
+  const orxBANK_SEGMENT  *pstSegment;
+  orxU32                  u32MapPartIndex, u32MapPart;
+  void                   *pResult = orxNULL;
+
+  /* Gets cells allocated before the reference one in its map part */
+  pstSegment      = _pstSegment;
+  u32MapPartIndex = _u32CellIndex >> 5;
+  u32MapPart      = pstSegment->au32CellAllocationMap[u32MapPartIndex] & ((1U << (_u32CellIndex & 31)) - 1);
+
+  /* Until an allocated cell is found */
+  while(u32MapPart == 0)
   {
-    /* Is cell in segment? */
-    if((_pCell >= pstSegment->pSegmentData)
-    && (((orxU32)((orxU8 *)_pCell - (orxU8 *)pstSegment->pSegmentData)) < u32Size))
+    /* Not first map part of segment? */
+    if(u32MapPartIndex > 0)
     {
-      /* Updates result */
-      pstResult = pstSegment;
+      /* Gets previous map part */
+      u32MapPart = pstSegment->au32CellAllocationMap[--u32MapPartIndex];
+    }
+    /* Not first segment? */
+    else if(pstSegment->u32Index > 0)
+    {
+      /* Gets previous segment */
+      pstSegment = _pstBank->apstSegmentList[pstSegment->u32Index - 1];
 
+      /* Isn't empty? */
+      if(pstSegment->u32NbFree != (orxU32)_pstBank->u16NbCellPerSegments)
+      {
+        /* Gets its last map part */
+        u32MapPartIndex = (orxU32)_pstBank->u16SizeSegmentBitField - 1;
+        u32MapPart      = pstSegment->au32CellAllocationMap[u32MapPartIndex];
+      }
+    }
+    else
+    {
+      /* None */
       break;
     }
   }
 
+  /* Found? */
+  if(u32MapPart != 0)
+  {
+    /* Keeps only its highest allocated cell */
+    u32MapPart |= u32MapPart >> 1;
+    u32MapPart |= u32MapPart >> 2;
+    u32MapPart |= u32MapPart >> 4;
+    u32MapPart |= u32MapPart >> 8;
+    u32MapPart |= u32MapPart >> 16;
+
+    /* Updates result */
+    pResult = (void *)(((orxU8 *)pstSegment->pSegmentData) + _pstBank->u32ElemSize * ((u32MapPartIndex << 5) + orxMath_GetBitCount(u32MapPart) - 1));
+  }
+
   /* Done! */
-  return pstResult;
+  return pResult;
+}
+
+/** Allocates a new cell from the bank segments (bank count isn't updated)
+ * @param[in] _pstBank        Pointer on the memory bank to use
+ * @param[out] _pu32ItemIndex Will be set with the allocated item index
+ * @param[out] _ppPrevious    If non-null, will contain closest preceding allocated neighbor if found
+ * @return a new cell of memory (orxNULL if no allocation possible)
+ */
+static void *orxFASTCALL orxBank_AllocateCell(orxBANK *_pstBank, orxU32 *_pu32ItemIndex, void **_ppPrevious)
+{
+  orxBANK_SEGMENT  *pstSegment;
+  void             *pResult = orxNULL;
+
+  /* Module initialized ? */
+  orxASSERT((sstBank.u32Flags & orxBANK_KU32_STATIC_FLAG_READY) == orxBANK_KU32_STATIC_FLAG_READY);
+
+  /* Correct parameters ? */
+  orxASSERT(_pstBank != orxNULL);
+  orxASSERT(_pu32ItemIndex != orxNULL);
+
+  /* Gets first segment with empty space */
+  pstSegment = _pstBank->pstPartialSegment;
+
+  /* None found? (If so, try to expand the bank if allowed) */
+  if((pstSegment == orxNULL) && (!(_pstBank->u32Flags & orxBANK_KU32_FLAG_NOT_EXPANDABLE)))
+  {
+    /* Try to allocate a new segment */
+    pstSegment = orxBank_CreateSegment(_pstBank);
+
+    /* Correct segment allocation ? */
+    if(pstSegment != orxNULL)
+    {
+      /* Can't add it? */
+      if(orxBank_AddSegment(_pstBank, pstSegment) == orxSTATUS_FAILURE)
+      {
+        /* Deletes it */
+        orxMemory_Free(pstSegment);
+        pstSegment = orxNULL;
+      }
+    }
+  }
+
+  /* Found a segment with free nodes? (yes : the allocation was correct (if there was), else returns orxNULL) */
+  if(pstSegment != orxNULL)
+  {
+    orxU32 u32BitIndex, u32MapPartIndex, u32CellIndex;
+
+    /* Checks */
+    orxASSERT(pstSegment->u32NbFree > 0);
+
+    /* Finds the first map part with available slots, starting from the segment's hint */
+    for(u32MapPartIndex = pstSegment->u32FreeHint; pstSegment->au32CellAllocationMap[u32MapPartIndex] == 0xFFFFFFFF; u32MapPartIndex++)
+    {
+      /* Checks */
+      orxASSERT(u32MapPartIndex + 1 < (orxU32)_pstBank->u16SizeSegmentBitField);
+    }
+
+    /* Gets free cell's map part index */
+    u32BitIndex   = orxMath_GetTrailingZeroCount(~(pstSegment->au32CellAllocationMap[u32MapPartIndex]));
+    u32CellIndex  = (u32MapPartIndex << 5) + u32BitIndex;
+
+    /* Checks */
+    orxASSERT(u32CellIndex < (orxU32)_pstBank->u16NbCellPerSegments);
+
+    /* Get the pointer on the cell according to index value and cells size */
+    pResult = (void *)(((orxU8 *)pstSegment->pSegmentData) + _pstBank->u32ElemSize * u32CellIndex);
+
+    /* Sets the bit as used */
+    pstSegment->au32CellAllocationMap[u32MapPartIndex] |= 1 << u32BitIndex;
+
+    /* Updates hint */
+    pstSegment->u32FreeHint = u32MapPartIndex;
+
+    /* Decrease the number of free elements */
+    pstSegment->u32NbFree--;
+
+#ifdef __orxMEMORY_DEBUG__
+
+    /* Checks segment */
+    orxBank_CheckSegment(_pstBank, pstSegment);
+
+#endif /* __orxMEMORY_DEBUG__ */
+
+    /* Full? */
+    if(pstSegment->u32NbFree == 0)
+    {
+      /* Unlinks it from partial segments */
+      orxBank_UnlinkPartialSegment(_pstBank, pstSegment);
+    }
+
+    /* Updates item ID */
+    *_pu32ItemIndex = (pstSegment->u32Index * (orxU32)_pstBank->u16NbCellPerSegments) + u32CellIndex;
+
+    /* Asked for previous element? */
+    if(_ppPrevious != orxNULL)
+    {
+      /* Updates previous */
+      *_ppPrevious = orxBank_GetPreviousCell(_pstBank, pstSegment, u32CellIndex);
+    }
+  }
+  else
+  {
+    /* It can be volunteer (orxBANK_KU32_FLAG_NOT_EXPANDABLE) or a memory allocation failure */
+    orxASSERT(((_pstBank->u32Flags & orxBANK_KU32_FLAG_NOT_EXPANDABLE) == orxBANK_KU32_FLAG_NOT_EXPANDABLE) && "Couldn't allocate a new bank segment.");
+  }
+
+  /* Done! */
+  return pResult;
+}
+
+/** Frees a cell back to the bank segments (bank count isn't updated)
+ * @param[in] _pstBank    Bank of memory from where _pCell has been allocated
+ * @param[in] _pCell      Pointer on the cell to free
+ */
+static void orxFASTCALL orxBank_FreeCell(orxBANK *_pstBank, void *_pCell)
+{
+  orxBANK_SEGMENT *pstSegment;  /* Segment associated to the cell */
+  orxU32 u32Index32Bits;        /* Index of 32 the bits data */
+  orxU32 u32IndexBit;           /* Index of the bit in u32Index32Bits */
+  orxU32 u32CellIndex;          /* Difference in pointers address */
+
+  /* Module initialized ? */
+  orxASSERT((sstBank.u32Flags & orxBANK_KU32_STATIC_FLAG_READY) == orxBANK_KU32_STATIC_FLAG_READY);
+
+  /* Correct parameters ? */
+  orxASSERT(_pstBank != orxNULL);
+  orxASSERT(_pCell != orxNULL);
+
+  /* Look for the segment associated to this cell */
+  pstSegment = orxBank_GetSegment(_pstBank, _pCell);
+  orxASSERT(pstSegment != orxNULL);
+
+  /* (The address of _pCell can not be smaller than the address of pstSegment->pSegmentData */
+  orxASSERT(_pCell >= pstSegment->pSegmentData);
+
+  /* Retrieve the cell index in the bitfield computing position with cell address */
+  u32CellIndex    = (orxU32)((orxU8 *)_pCell - (orxU8 *)pstSegment->pSegmentData) / _pstBank->u32ElemSize;
+  u32Index32Bits  = u32CellIndex >> 5;
+  u32IndexBit     = u32CellIndex & 31;
+
+  /* Checks */
+  orxASSERT(pstSegment->au32CellAllocationMap[u32Index32Bits] & (1 << u32IndexBit));
+
+  /* Set cell as Free */
+  pstSegment->au32CellAllocationMap[u32Index32Bits] &= ~(1 << u32IndexBit);
+
+  /* Updates hint */
+  if(u32Index32Bits < pstSegment->u32FreeHint)
+  {
+    pstSegment->u32FreeHint = u32Index32Bits;
+  }
+
+  /* Was full? */
+  if(pstSegment->u32NbFree == 0)
+  {
+    /* Links it back to partial segments */
+    orxBank_LinkPartialSegment(_pstBank, pstSegment);
+  }
+
+  /* Increase the number of free elements */
+  pstSegment->u32NbFree++;
+
+#ifdef __orxMEMORY_DEBUG__
+
+  /* Checks segment */
+  orxBank_CheckSegment(_pstBank, pstSegment);
+
+#endif /* __orxMEMORY_DEBUG__ */
+
+  /* Done! */
+  return;
+}
+
+/** Allocates a new cell from a thread-safe bank, using current thread's magazine when possible
+ * @param[in] _pstBank        Pointer on the memory bank to use
+ * @param[out] _pu32ItemIndex Will be set with the allocated item index
+ * @return a new cell of memory (orxNULL if no allocation possible)
+ */
+static void *orxFASTCALL orxBank_AllocateShared(orxBANK *_pstBank, orxU32 *_pu32ItemIndex)
+{
+  orxU32  u32ThreadID;
+  void   *pResult = orxNULL;
+
+  /* Gets current thread */
+  u32ThreadID = orxThread_GetCurrent();
+
+  /* Known thread? */
+  if(u32ThreadID < orxTHREAD_KU32_MAX_THREAD_NUMBER)
+  {
+    orxBANK_MAGAZINE *pstMagazine;
+
+    /* Gets its magazine */
+    pstMagazine = &(_pstBank->astMagazineList[u32ThreadID]);
+
+    /* Empty? */
+    if(pstMagazine->u32Count == 0)
+    {
+      orxU32 u32Dummy;
+
+      /* Locks segments */
+      orxThread_WaitSemaphore(_pstBank->pstSemaphore);
+
+      /* Refills half of the magazine */
+      while(pstMagazine->u32Count < (orxBANK_KU32_MAGAZINE_SIZE >> 1))
+      {
+        void *pCell;
+
+        /* Allocates a cell */
+        pCell = orxBank_AllocateCell(_pstBank, &u32Dummy, orxNULL);
+
+        /* Failure? */
+        if(pCell == orxNULL)
+        {
+          break;
+        }
+
+        /* Marks it as reserved */
+        orxBank_ReserveCell(_pstBank, pCell, orxTRUE, orxNULL);
+
+        /* Stores it */
+        pstMagazine->apCellList[pstMagazine->u32Count++] = pCell;
+      }
+
+      /* Unlocks segments */
+      orxThread_SignalSemaphore(_pstBank->pstSemaphore);
+    }
+
+    /* Has cached cell? */
+    if(pstMagazine->u32Count != 0)
+    {
+      /* Gets it */
+      pResult = pstMagazine->apCellList[--pstMagazine->u32Count];
+
+      /* Releases it */
+      orxBank_ReserveCell(_pstBank, pResult, orxFALSE, _pu32ItemIndex);
+    }
+  }
+  else
+  {
+    /* Locks segments */
+    orxThread_WaitSemaphore(_pstBank->pstSemaphore);
+
+    /* Allocates a cell */
+    pResult = orxBank_AllocateCell(_pstBank, _pu32ItemIndex, orxNULL);
+
+    /* Unlocks segments */
+    orxThread_SignalSemaphore(_pstBank->pstSemaphore);
+  }
+
+  /* Success? */
+  if(pResult != orxNULL)
+  {
+    /* Updates bank count */
+    orxMEMORY_ATOMIC_ADD32(&(_pstBank->u32Count), 1);
+  }
+
+  /* Done! */
+  return pResult;
+}
+
+/** Frees a cell of a thread-safe bank, using current thread's magazine when possible
+ * @param[in] _pstBank    Bank of memory from where _pCell has been allocated
+ * @param[in] _pCell      Pointer on the cell to free
+ */
+static void orxFASTCALL orxBank_FreeShared(orxBANK *_pstBank, void *_pCell)
+{
+  orxU32 u32ThreadID;
+
+  /* Updates bank count */
+  orxMEMORY_ATOMIC_ADD32(&(_pstBank->u32Count), (orxU32)-1);
+
+  /* Gets current thread */
+  u32ThreadID = orxThread_GetCurrent();
+
+  /* Known thread? */
+  if(u32ThreadID < orxTHREAD_KU32_MAX_THREAD_NUMBER)
+  {
+    orxBANK_MAGAZINE *pstMagazine;
+
+    /* Gets its magazine */
+    pstMagazine = &(_pstBank->astMagazineList[u32ThreadID]);
+
+    /* Full? */
+    if(pstMagazine->u32Count == orxBANK_KU32_MAGAZINE_SIZE)
+    {
+      /* Locks segments */
+      orxThread_WaitSemaphore(_pstBank->pstSemaphore);
+
+      /* Flushes half of the magazine */
+      while(pstMagazine->u32Count > (orxBANK_KU32_MAGAZINE_SIZE >> 1))
+      {
+        void *pCell;
+
+        /* Gets cell */
+        pCell = pstMagazine->apCellList[--pstMagazine->u32Count];
+
+        /* Releases it */
+        orxBank_ReserveCell(_pstBank, pCell, orxFALSE, orxNULL);
+
+        /* Frees it */
+        orxBank_FreeCell(_pstBank, pCell);
+      }
+
+      /* Unlocks segments */
+      orxThread_SignalSemaphore(_pstBank->pstSemaphore);
+    }
+
+    /* Marks cell as reserved */
+    orxBank_ReserveCell(_pstBank, _pCell, orxTRUE, orxNULL);
+
+    /* Stores it */
+    pstMagazine->apCellList[pstMagazine->u32Count++] = _pCell;
+  }
+  else
+  {
+    /* Locks segments */
+    orxThread_WaitSemaphore(_pstBank->pstSemaphore);
+
+    /* Frees cell */
+    orxBank_FreeCell(_pstBank, _pCell);
+
+    /* Unlocks segments */
+    orxThread_SignalSemaphore(_pstBank->pstSemaphore);
+  }
+
+  /* Done! */
+  return;
 }
 
 /***************************************************************************
@@ -178,6 +821,7 @@ void orxFASTCALL orxBank_Setup()
   /* Adds module dependencies */
   orxModule_AddDependency(orxMODULE_ID_BANK, orxMODULE_ID_MEMORY);
   orxModule_AddDependency(orxMODULE_ID_BANK, orxMODULE_ID_PROFILER);
+  orxModule_AddDependency(orxMODULE_ID_BANK, orxMODULE_ID_THREAD);
 
   return;
 }
@@ -267,20 +911,80 @@ orxBANK *orxFASTCALL orxBank_Create(orxU16 _u16NbElem, orxU32 _u32Size, orxU32 _
     pstBank->u16NbCellPerSegments     = _u16NbElem;
     pstBank->eMemType                 = _eMemType;
 
+    pstBank->u32SegmentShift          = (orxMath_IsPowerOfTwo((orxU32)_u16NbElem) != orxFALSE) ? orxMath_GetTrailingZeroCount((orxU32)_u16NbElem) : orxU32_UNDEFINED;
+
     /* Compute the necessary number of 32 bits packs */
     pstBank->u16SizeSegmentBitField   = orxALIGN32(_u16NbElem) >> 5;
 
-    /* Allocate the first segment, and select it as current */
-    pstBank->pstFirstSegment          = orxBank_CreateSegment(pstBank);
+    /* Computes segment size & alignment (thread-safe banks also store a reserved map) */
+    pstBank->u32SegmentSize           = sizeof(orxBANK_SEGMENT) + pstBank->u16SizeSegmentBitField * sizeof(orxU32) * ((_u32Flags & orxBANK_KU32_FLAG_THREAD_SAFE) ? 2 : 1) + sstBank.u32CacheLineSize - 1 + ((orxU32)_u16NbElem * pstBank->u32ElemSize);
+    pstBank->u32SegmentAlignment      = orxMath_GetNextPowerOfTwo(pstBank->u32SegmentSize);
+    pstBank->u32SegmentOffset         = orxU32_UNDEFINED;
+
+    /* Allocates the segment directory */
+    pstBank->apstSegmentList          = (orxBANK_SEGMENT **)orxMemory_Allocate(orxBANK_KU32_SEGMENT_LIST_SIZE * sizeof(orxBANK_SEGMENT *), _eMemType);
+    pstBank->u32SegmentListSize       = orxBANK_KU32_SEGMENT_LIST_SIZE;
+
+    /* Valid? */
+    if(pstBank->apstSegmentList != orxNULL)
+    {
+      orxBANK_SEGMENT *pstSegment;
+
+      /* Allocate the first segment */
+      pstSegment = orxBank_CreateSegment(pstBank);
+
+      /* Valid? */
+      if(pstSegment != orxNULL)
+      {
+        /* Adds it, which selects it as first */
+        orxBank_AddSegment(pstBank, pstSegment);
+      }
+    }
+
+    /* Thread-safe? */
+    if(_u32Flags & orxBANK_KU32_FLAG_THREAD_SAFE)
+    {
+      /* Creates its lock & magazines */
+      pstBank->pstSemaphore           = orxThread_CreateSemaphore(1);
+      pstBank->astMagazineList        = (orxBANK_MAGAZINE *)orxMemory_Allocate(orxTHREAD_KU32_MAX_THREAD_NUMBER * sizeof(orxBANK_MAGAZINE), _eMemType);
+
+      /* Valid? */
+      if(pstBank->astMagazineList != orxNULL)
+      {
+        /* Clears them */
+        orxMemory_Zero(pstBank->astMagazineList, orxTHREAD_KU32_MAX_THREAD_NUMBER * sizeof(orxBANK_MAGAZINE));
+      }
+    }
 
     /* Success? */
-    if(pstBank->pstFirstSegment != orxNULL)
+    if((pstBank->pstFirstSegment != orxNULL)
+    && (!(_u32Flags & orxBANK_KU32_FLAG_THREAD_SAFE)
+     || ((pstBank->pstSemaphore != orxNULL)
+      && (pstBank->astMagazineList != orxNULL))))
     {
       /* Add it to the list */
       orxLinkList_AddEnd(&(sstBank.stBankList), &(pstBank->stNode));
     }
     else
     {
+      /* Cleans everything that got created */
+      if(pstBank->pstFirstSegment != orxNULL)
+      {
+        orxMemory_Free(pstBank->pstFirstSegment);
+      }
+      if(pstBank->apstSegmentList != orxNULL)
+      {
+        orxMemory_Free(pstBank->apstSegmentList);
+      }
+      if(pstBank->pstSemaphore != orxNULL)
+      {
+        orxThread_DeleteSemaphore(pstBank->pstSemaphore);
+      }
+      if(pstBank->astMagazineList != orxNULL)
+      {
+        orxMemory_Free(pstBank->astMagazineList);
+      }
+
       /* Can't allocate segment, cancel bank allocation */
       orxMemory_Free(pstBank);
       pstBank = orxNULL;
@@ -311,6 +1015,17 @@ void orxFASTCALL orxBank_Delete(orxBANK *_pstBank)
       pstSegment != orxNULL;
       pstSegmentToDelete = pstSegment, pstSegment = pstSegment->pstNext, orxMemory_Free(pstSegmentToDelete));
 
+  /* Deletes segment directory */
+  orxMemory_Free(_pstBank->apstSegmentList);
+
+  /* Thread-safe? */
+  if(_pstBank->u32Flags & orxBANK_KU32_FLAG_THREAD_SAFE)
+  {
+    /* Deletes its lock & magazines */
+    orxThread_DeleteSemaphore(_pstBank->pstSemaphore);
+    orxMemory_Free(_pstBank->astMagazineList);
+  }
+
   /* Completly Free Bank */
   orxMemory_Free(_pstBank);
 }
@@ -330,14 +1045,12 @@ void *orxFASTCALL orxBank_Allocate(orxBANK *_pstBank)
 /** Allocates a new cell from the bank and returns its index
  * @param[in] _pstBank        Pointer on the memory bank to use
  * @param[out] _pu32ItemIndex Will be set with the allocated item index
- * @param[out] _ppPrevious    If non-null, will contain previous neighbor if found
+ * @param[out] _ppPrevious    If non-null, will contain previous neighbor if found (always orxNULL for thread-safe banks), found with a backward scan that grows with the number of fully free segments before the new cell: pass orxNULL when not needed
  * @return a new cell of memory (orxNULL if no allocation possible)
  */
 void *orxFASTCALL orxBank_AllocateIndexed(orxBANK *_pstBank, orxU32 *_pu32ItemIndex, void **_ppPrevious)
 {
-  orxU32            u32SegmentIndex;
-  orxBANK_SEGMENT  *pstCurrentSegment, *pstPreviousSegment;
-  void             *pResult = orxNULL;
+  void *pResult;
 
   /* Profiles */
   orxPROFILER_PUSH_MARKER("orxBank_Allocate");
@@ -349,110 +1062,29 @@ void *orxFASTCALL orxBank_AllocateIndexed(orxBANK *_pstBank, orxU32 *_pu32ItemIn
   orxASSERT(_pstBank != orxNULL);
   orxASSERT(_pu32ItemIndex != orxNULL);
 
-  /* Finds the first segment with empty space */
-  for(u32SegmentIndex = 0, pstCurrentSegment = _pstBank->pstFirstSegment, pstPreviousSegment = orxNULL;
-      (pstCurrentSegment->pstNext != orxNULL) && (pstCurrentSegment->u32NbFree == 0);
-      u32SegmentIndex++, pstPreviousSegment = pstCurrentSegment, pstCurrentSegment = pstCurrentSegment->pstNext);
-
-  /* Is there a free space in the current segment ? (If no, try to expand it if allowed) */
-  if((pstCurrentSegment->u32NbFree == 0) && (!(_pstBank->u32Flags & orxBANK_KU32_FLAG_NOT_EXPANDABLE)))
+  /* Thread-safe? */
+  if(_pstBank->u32Flags & orxBANK_KU32_FLAG_THREAD_SAFE)
   {
-    /* No, Try to allocate a new segment */
-    pstCurrentSegment->pstNext = orxBank_CreateSegment(_pstBank);
+    /* Allocates cell */
+    pResult = orxBank_AllocateShared(_pstBank, _pu32ItemIndex);
 
-    /* Correct segment allocation ? */
-    if(pstCurrentSegment->pstNext != orxNULL)
+    /* Asked for previous element? */
+    if(_ppPrevious != orxNULL)
     {
-      /* Set the new allocated segment as the current selected one */
-      pstCurrentSegment = pstCurrentSegment->pstNext;
-      u32SegmentIndex++;
+      /* Neighbors aren't tracked with magazines */
+      *_ppPrevious = orxNULL;
     }
   }
-
-  /* Does the current segment has free nodes ? (yes : the allocation was correct (if there was), else returns orxNULL) */
-  if(pstCurrentSegment->u32NbFree > 0)
+  else
   {
-    orxU32  u32BitIndex, u32MapPartIndex;
-    orxBOOL bFound;
-
-    /* For all map parts */
-    for(u32BitIndex = 0, u32MapPartIndex = 0, bFound = orxFALSE; !bFound && (u32MapPartIndex < (orxU32)_pstBank->u16SizeSegmentBitField); u32MapPartIndex++)
-    {
-      orxU32 u32MapPartValue;
+    /* Allocates cell */
+    pResult = orxBank_AllocateCell(_pstBank, _pu32ItemIndex, _ppPrevious);
 
-      /* Gets the available slots */
-      u32MapPartValue = ~(pstCurrentSegment->au32CellAllocationMap[u32MapPartIndex]);
-
-      /* Any free one? */
-      if(u32MapPartValue != 0)
-      {
-        /* Gets free cell's map part index */
-        u32BitIndex = orxMath_GetTrailingZeroCount(u32MapPartValue);
-
-        /* Found ! */
-        bFound = orxTRUE;
-
-        break;
-      }
-    }
-
-    /* If bFound is false, It means that there are no more free segments that we can allocate.
-     * It can be volunteer (orxBANK_KU32_FLAG_NOT_EXPANDABLE) or a problem in the code => assert
-     */
-    orxASSERT(bFound || ((_pstBank->u32Flags & orxBANK_KU32_FLAG_NOT_EXPANDABLE) == orxBANK_KU32_FLAG_NOT_EXPANDABLE));
-
-    /* Found a free element ? */
-    if(bFound)
+    /* Success? */
+    if(pResult != orxNULL)
     {
-      /* Get the pointer on the cell according to index value and cells size */
-      pResult = (void *)(((orxU8 *)pstCurrentSegment->pSegmentData) + _pstBank->u32ElemSize * ((u32MapPartIndex << 5) + u32BitIndex));
-
-      /* Decrease the number of free elements */
-      pstCurrentSegment->u32NbFree--;
-
       /* Updates bank count */
       _pstBank->u32Count++;
-
-      /* Sets the bit as used */
-      ((orxU32 *)(pstCurrentSegment->au32CellAllocationMap))[u32MapPartIndex] |= 1 << u32BitIndex;
-
-      /* Updates item ID */
-      *_pu32ItemIndex = (u32SegmentIndex * (orxU32)_pstBank->u16NbCellPerSegments) + (u32MapPartIndex << 5) + u32BitIndex;
-
-      /* Asked for previous element? */
-      if(_ppPrevious != orxNULL)
-      {
-        /* Is current allocation first in segment? */
-        if((u32MapPartIndex == 0) && (u32BitIndex == 0))
-        {
-          /* Updates previous */
-          *_ppPrevious = (pstPreviousSegment != orxNULL) ? (void *)(((orxU8 *)pstPreviousSegment->pSegmentData) + _pstBank->u32ElemSize * (_pstBank->u16NbCellPerSegments - 1)) : orxNULL;
-        }
-        else
-        {
-          /* Updates previous */
-          *_ppPrevious = (void *)(((orxU8 *)pResult) - _pstBank->u32ElemSize);
-        }
-      }
-
-#ifdef __orxMEMORY_DEBUG__
-      {
-        orxU32 r = 0, i, j;
-
-        for(i = 0; i < _pstBank->u16SizeSegmentBitField; i++)
-        {
-          for(j = 0; j < 32; j++)
-          {
-            if((1 << j) & pstCurrentSegment->pu32CellAllocationMap[i])
-            {
-              r++;
-            }
-          }
-        }
-
-        orxASSERT(r == (orxU32)(_pstBank->u16NbCellPerSegments - pstCurrentSegment->u32NbFree));
-      }
-#endif /* __orxMEMORY_DEBUG__ */
     }
   }
 
@@ -470,11 +1102,6 @@ void *orxFASTCALL orxBank_AllocateIndexed(orxBANK *_pstBank, orxU32 *_pu32ItemIn
  */
 void orxFASTCALL orxBank_Free(orxBANK *_pstBank, void *_pCell)
 {
-  orxBANK_SEGMENT *pstSegment;  /* Segment associated to the cell */
-  orxU32 u32Index32Bits;        /* Index of 32 the bits data */
-  orxU32 u32IndexBit;           /* Index of the bit in u32Index32Bits */
-  orxU32 u32CellIndex;          /* Difference in pointers address */
-
   /* Profiles */
   orxPROFILER_PUSH_MARKER("orxBank_Free");
 
@@ -485,26 +1112,20 @@ void orxFASTCALL orxBank_Free(orxBANK *_pstBank, void *_pCell)
   orxASSERT(_pstBank != orxNULL);
   orxASSERT(_pCell != orxNULL);
 
-  /* Look for the segment associated to this cell */
-  pstSegment = orxBank_GetSegment(_pstBank, _pCell);
-  orxASSERT(pstSegment != orxNULL);
-
-  /* (The address of _pCell can not be smaller than the address of pstSegment->pSegmentData */
-  orxASSERT(_pCell >= pstSegment->pSegmentData);
-
-  /* Retrieve the cell index in the bitfield computing position with cell address */
-  u32CellIndex    = (orxU32)((orxU8 *)_pCell - (orxU8 *)pstSegment->pSegmentData) / _pstBank->u32ElemSize;
-  u32Index32Bits  = u32CellIndex >> 5;
-  u32IndexBit     = u32CellIndex & 31;
-
-  /* Set cell as Free */
-  pstSegment->au32CellAllocationMap[u32Index32Bits] &= ~(1 << u32IndexBit);
-
-  /* Increase the number of free elements */
-  pstSegment->u32NbFree++;
+  /* Thread-safe? */
+  if(_pstBank->u32Flags & orxBANK_KU32_FLAG_THREAD_SAFE)
+  {
+    /* Frees cell */
+    orxBank_FreeShared(_pstBank, _pCell);
+  }
+  else
+  {
+    /* Frees cell */
+    orxBank_FreeCell(_pstBank, _pCell);
 
-  /* Updates bank count */
-  _pstBank->u32Count--;
+    /* Updates bank count */
+    _pstBank->u32Count--;
+  }
 
   /* Profiles */
   orxPROFILER_POP_MARKER();
@@ -518,7 +1139,7 @@ void orxFASTCALL orxBank_Free(orxBANK *_pstBank, void *_pCell)
  */
 void orxFASTCALL orxBank_Clear(orxBANK *_pstBank)
 {
-  orxBANK_SEGMENT *pstSegment;
+  orxU32 i;
 
   /* Module initialized ? */
   orxASSERT((sstBank.u32Flags & orxBANK_KU32_STATIC_FLAG_READY) == orxBANK_KU32_STATIC_FLAG_READY);
@@ -526,14 +1147,31 @@ void orxFASTCALL orxBank_Clear(orxBANK *_pstBank)
   /* Correct parameters ? */
   orxASSERT(_pstBank != orxNULL);
 
-  /* For all segments */
-  for(pstSegment = _pstBank->pstFirstSegment;
-      pstSegment != orxNULL;
-      pstSegment = pstSegment->pstNext)
+  /* Clears partial segments */
+  _pstBank->pstPartialSegment = orxNULL;
+
+  /* For all segments, in reverse order */
+  for(i = _pstBank->u32SegmentCount; i > 0; i--)
   {
+    orxBANK_SEGMENT *pstSegment;
+
+    /* Gets it */
+    pstSegment = _pstBank->apstSegmentList[i - 1];
+
     /* Clears it */
-    pstSegment->u32NbFree = (orxU32)_pstBank->u16NbCellPerSegments;
-    orxMemory_Zero(pstSegment->au32CellAllocationMap, _pstBank->u16SizeSegmentBitField * sizeof(orxU32));
+    pstSegment->u32NbFree   = (orxU32)_pstBank->u16NbCellPerSegments;
+    pstSegment->u32FreeHint = 0;
+    orxMemory_Zero(pstSegment->au32CellAllocationMap, _pstBank->u16SizeSegmentBitField * sizeof(orxU32) * ((_pstBank->u32Flags & orxBANK_KU32_FLAG_THREAD_SAFE) ? 2 : 1));
+
+    /* Links it as partial */
+    orxBank_LinkPartialSegment(_pstBank, pstSegment);
+  }
+
+  /* Thread-safe? */
+  if(_pstBank->u32Flags & orxBANK_KU32_FLAG_THREAD_SAFE)
+  {
+    /* Empties all magazines */
+    orxMemory_Zero(_pstBank->astMagazineList, orxTHREAD_KU32_MAX_THREAD_NUMBER * sizeof(orxBANK_MAGAZINE));
   }
 
   /* Clears bank count */
@@ -546,13 +1184,14 @@ void orxFASTCALL orxBank_Clear(orxBANK *_pstBank)
 void orxFASTCALL orxBank_Compact(orxBANK *_pstBank)
 {
   orxBANK_SEGMENT *pstSegment, *pstPreviousSegment;
+  orxU32           u32SegmentCount;
 
   /* Checks */
   orxASSERT(sstBank.u32Flags & orxBANK_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBank != orxNULL);
 
   /* For all segments */
-  for(pstPreviousSegment = _pstBank->pstFirstSegment, pstSegment = pstPreviousSegment->pstNext;
+  for(pstPreviousSegment = _pstBank->pstFirstSegment, pstSegment = pstPreviousSegment->pstNext, u32SegmentCount = 1;
       pstSegment != orxNULL;
       pstPreviousSegment = pstSegment, pstSegment = pstSegment->pstNext)
   {
@@ -562,13 +1201,25 @@ void orxFASTCALL orxBank_Compact(orxBANK *_pstBank)
       /* Updates previous segment's next */
       pstPreviousSegment->pstNext = pstSegment->pstNext;
 
+      /* Unlinks it from partial segments */
+      orxBank_UnlinkPartialSegment(_pstBank, pstSegment);
+
       /* Frees it */
       orxMemory_Free(pstSegment);
 
       /* Reverts back to previous */
       pstSegment = pstPreviousSegment;
     }
+    else
+    {
+      /* Keeps it in the directory */
+      pstSegment->u32Index = u32SegmentCount;
+      _pstBank->apstSegmentList[u32SegmentCount++] = pstSegment;
+    }
   }
+
+  /* Updates segment count */
+  _pstBank->u32SegmentCount = u32SegmentCount;
 }
 
 /** Compacts all banks by removing all their unused segments
@@ -646,7 +1297,7 @@ void *orxFASTCALL orxBank_GetNext(const orxBANK *_pstBank, const void *_pCell)
         orxU32 u32MaskedMap;
 
         /* Gets masked map */
-        u32MaskedMap = pstSegment->au32CellAllocationMap[u32ByteIndex] & u32Mask;
+        u32MaskedMap = orxBank_GetLiveMap(_pstBank, pstSegment, u32ByteIndex) & u32Mask;
 
         /* Has remaining elements? */
         if(u32MaskedMap != 0)
@@ -670,26 +1321,15 @@ void *orxFASTCALL orxBank_GetNext(const orxBANK *_pstBank, const void *_pCell)
 orxU32 orxFASTCALL orxBank_GetIndex(const orxBANK *_pstBank, const void *_pCell)
 {
   orxBANK_SEGMENT  *pstSegment;
-  orxU32            u32CellIndex, u32Size, u32SegmentCount, u32Result = orxU32_UNDEFINED;
+  orxU32            u32CellIndex, u32Result = orxU32_UNDEFINED;
 
   /* Checks */
   orxASSERT((sstBank.u32Flags & orxBANK_KU32_STATIC_FLAG_READY) == orxBANK_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBank != orxNULL);
   orxASSERT(_pCell != orxNULL);
 
-  /* For all segments */
-  for(pstSegment = _pstBank->pstFirstSegment, u32Size = _pstBank->u32ElemSize * (orxU32)_pstBank->u16NbCellPerSegments, u32SegmentCount = 0;
-      pstSegment != orxNULL;
-      pstSegment = pstSegment->pstNext, u32SegmentCount++)
-  {
-    /* Is cell in segment? */
-    if((_pCell >= pstSegment->pSegmentData)
-    && (((orxU32)((orxU8 *)_pCell - (orxU8 *)pstSegment->pSegmentData)) < u32Size))
-    {
-      /* Stops */
-      break;
-    }
-  }
+  /* Gets segment */
+  pstSegment = orxBank_GetSegment(_pstBank, _pCell);
 
   /* Checks */
   orxASSERT(pstSegment != orxNULL);
@@ -698,10 +1338,10 @@ orxU32 orxFASTCALL orxBank_GetIndex(const orxBANK *_pstBank, const void *_pCell)
   u32CellIndex = (orxU32)((orxU8 *)_pCell - (orxU8 *)pstSegment->pSegmentData) / _pstBank->u32ElemSize;
 
   /* Valid? */
-  if(pstSegment->au32CellAllocationMap[u32CellIndex >> 5] & (1 << (u32CellIndex & 31)))
+  if(orxBank_GetLiveMap(_pstBank, pstSegment, u32CellIndex >> 5) & (1 << (u32CellIndex & 31)))
   {
     /* Updates result */
-    u32Result = (u32SegmentCount * (orxU32)_pstBank->u16NbCellPerSegments) + u32CellIndex;
+    u32Result = (pstSegment->u32Index * (orxU32)_pstBank->u16NbCellPerSegments) + u32CellIndex;
   }
 
   /* Done! */
@@ -724,20 +1364,35 @@ void *orxFASTCALL orxBank_GetAtIndex(const orxBANK *_pstBank, orxU32 _u32Index)
   /* Non empty? */
   if(_pstBank->u32Count > 0)
   {
-    orxBANK_SEGMENT  *pstSegment;
-    orxU32            u32Index;
+    orxU32 u32SegmentIndex, u32Index;
 
-    /* Skips all segments till we hit the right one */
-    for(u32Index = _u32Index, pstSegment = _pstBank->pstFirstSegment; (u32Index >= (orxU32)_pstBank->u16NbCellPerSegments) && (pstSegment != orxNULL); u32Index -= (orxU32)_pstBank->u16NbCellPerSegments, pstSegment = pstSegment->pstNext);
+    /* Power of two segment size? */
+    if(_pstBank->u32SegmentShift != orxU32_UNDEFINED)
+    {
+      /* Gets segment & cell indices */
+      u32SegmentIndex = _u32Index >> _pstBank->u32SegmentShift;
+      u32Index        = _u32Index & ((orxU32)_pstBank->u16NbCellPerSegments - 1);
+    }
+    else
+    {
+      /* Gets segment & cell indices */
+      u32SegmentIndex = _u32Index / (orxU32)_pstBank->u16NbCellPerSegments;
+      u32Index        = _u32Index - (u32SegmentIndex * (orxU32)_pstBank->u16NbCellPerSegments);
+    }
 
     /* Is segment valid? */
-    if(pstSegment != orxNULL)
+    if(u32SegmentIndex < _pstBank->u32SegmentCount)
     {
+      orxBANK_SEGMENT *pstSegment;
+
+      /* Gets it */
+      pstSegment = _pstBank->apstSegmentList[u32SegmentIndex];
+
       /* Checks */
       orxASSERT((u32Index >> 5) < _pstBank->u16SizeSegmentBitField);
 
       /* Is cell allocated? */
-      if(pstSegment->au32CellAllocationMap[u32Index >> 5] & (1 << (u32Index & 31)))
+      if(orxBank_GetLiveMap(_pstBank, pstSegment, u32Index >> 5) & (1 << (u32Index & 31)))
       {
         /* Updates result */
         pResult = (void *)(((orxU8 *)pstSegment->pSegmentData) + (u32Index * _pstBank->u32ElemSize));
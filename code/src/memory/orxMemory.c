@@ -33,12 +33,22 @@
 #include "memory/orxMemory.h"
 #include "debug/orxDebug.h"
 
+#ifdef __orxMEMORY_PROFILER__
+  #include <stdio.h>
+  #include <stdlib.h>
+#endif /* __orxMEMORY_PROFILER__ */
+
 
 #define USE_DL_PREFIX
 #define USE_BUILTIN_FFS 1
 #define USE_LOCKS 1
 #undef _GNU_SOURCE
 
+#ifdef __orxMEMORY_ARENAS__
+  #define MSPACES 1                                         /**< Arenas are dlmalloc mspaces */
+  #define FOOTERS 1                                         /**< Lets free/realloc retrieve the owning arena of any block */
+#endif /* __orxMEMORY_ARENAS__ */
+
 #if defined(__orxIOS__) && defined(__orxLLVM__)
   #pragma clang diagnostic push
   #pragma clang diagnostic ignored "-Wshorten-64-to-32"
@@ -57,6 +67,32 @@
 
 #define orxMEMORY_KZ_LITERAL_PREFIX             "MEM_"
 
+#if defined(__orxPROFILER__) || defined(__orxMEMORY_PROFILER__)
+  #define orxMEMORY_USE_HEADER                                /**< Memory blocks are prefixed with a tracking header */
+#endif /* __orxPROFILER__ || __orxMEMORY_PROFILER__ */
+
+#ifdef __orxMEMORY_PROFILER__
+
+  #define orxMEMORY_KU32_PROFILER_SITE_NUMBER   4096        /**< Maximum number of tracked allocation sites, has to be a power of two */
+  #define orxMEMORY_KZ_PROFILER_FILE            "orxmemory.txt" /**< Default profiler report file name */
+  #define orxMEMORY_KU64_SITE_HASH_MULTIPLIER   0x9E3779B97F4A7C15ULL /**< Site hash multiplier (Fibonacci hashing) */
+
+  #ifdef __orxMSVC__
+    #include <intrin.h>
+    #pragma intrinsic(_ReturnAddress)
+    #define orxMEMORY_GET_CALLER()              _ReturnAddress()
+    #define orxMEMORY_THREAD_LOCAL              __declspec(thread)
+  #else /* __orxMSVC__ */
+    #define orxMEMORY_GET_CALLER()              __builtin_return_address(0)
+    #define orxMEMORY_THREAD_LOCAL              __thread
+  #endif /* __orxMSVC__ */
+
+#else /* __orxMEMORY_PROFILER__ */
+
+  #define orxMEMORY_GET_CALLER()                orxNULL
+
+#endif /* __orxMEMORY_PROFILER__ */
+
 
 /***************************************************************************
  * Structure declaration                                                   *
@@ -70,6 +106,46 @@ typedef struct __orxMEMORY_TRACKER_t
 
 } orxMEMORY_TRACKER;
 
+#ifdef __orxMEMORY_PROFILER__
+
+/** Allocation site
+ */
+typedef struct __orxMEMORY_SITE_t
+{
+  const void * volatile     pID;                          /**< Caller return address or tag */
+  volatile orxU32           u32Size, u32PeakSize;         /**< Live & peak bytes */
+  volatile orxU32           u32Count;                     /**< Live allocation count */
+  volatile orxU32           u32AllocationCount;           /**< Allocation count */
+  volatile orxU32           u32FreeCount;                 /**< Free count */
+  orxBOOL                   bTag;                         /**< Is ID a tag? */
+
+} orxMEMORY_SITE;
+
+#endif /* __orxMEMORY_PROFILER__ */
+
+#ifdef orxMEMORY_USE_HEADER
+
+/** Memory block header
+ */
+typedef struct __orxMEMORY_HEADER_t
+{
+#ifdef __orxMEMORY_PROFILER__
+
+  orxMEMORY_SITE           *pstSite;                      /**< Allocation site */
+  orxU32                    u32Size;                      /**< Requested size */
+
+#endif /* __orxMEMORY_PROFILER__ */
+
+#ifdef __orxPROFILER__
+
+  orxMEMORY_TYPE            eMemType;                     /**< Memory type */
+
+#endif /* __orxPROFILER__ */
+
+} orxMEMORY_HEADER;
+
+#endif /* orxMEMORY_USE_HEADER */
+
 typedef struct __orxMEMORY_STATIC_t
 {
 #ifdef __orxPROFILER__
@@ -78,6 +154,22 @@ typedef struct __orxMEMORY_STATIC_t
 
 #endif /* __orxPROFILER__ */
 
+#ifdef __orxMEMORY_ARENAS__
+
+  mspace            apTypeArenaList[orxMEMORY_TYPE_NUMBER]; /**< Arena used by each memory type, NULL for the shared heap */
+  mspace            apArenaList[orxMEMORY_TYPE_NUMBER];   /**< Created arenas */
+  orxU32            u32ArenaCount;                        /**< Number of created arenas */
+
+#endif /* __orxMEMORY_ARENAS__ */
+
+#ifdef __orxMEMORY_PROFILER__
+
+  orxMEMORY_SITE    astSiteList[orxMEMORY_KU32_PROFILER_SITE_NUMBER];       /**< Allocation sites */
+  orxMEMORY_SITE   *apstSortedSiteList[orxMEMORY_KU32_PROFILER_SITE_NUMBER];/**< Sorted site list, used for reports */
+  orxMEMORY_SITE    stOverflowSite;                       /**< Site used when the site list is full */
+
+#endif /* __orxMEMORY_PROFILER__ */
+
   orxU32 u32Flags;   /**< Flags set by the memory module */
 
 } orxMEMORY_STATIC;
@@ -89,6 +181,12 @@ typedef struct __orxMEMORY_STATIC_t
 
 static orxMEMORY_STATIC sstMemory;
 
+#ifdef __orxMEMORY_PROFILER__
+
+static orxMEMORY_THREAD_LOCAL const orxCHAR *szMemoryProfilerTag = orxNULL;
+
+#endif /* __orxMEMORY_PROFILER__ */
+
 
 /***************************************************************************
  * Private functions                                                       *
@@ -191,6 +289,247 @@ static orxINLINE orxU32 orxMemory_CacheLineSize()
 
 #endif
 
+#ifdef __orxMEMORY_PROFILER__
+
+/** Gets an allocation site, using the current tag if any or the caller otherwise
+ * @param[in] _pCaller      Caller's return address
+ * @return orxMEMORY_SITE
+ */
+static orxMEMORY_SITE *orxFASTCALL orxMemory_GetSite(const void *_pCaller)
+{
+  const void     *pID;
+  orxBOOL         bTag;
+  orxU32          u32Index, i;
+  orxMEMORY_SITE *pstResult = &(sstMemory.stOverflowSite);
+
+  /* Has tag? */
+  if(szMemoryProfilerTag != orxNULL)
+  {
+    /* Uses it */
+    pID   = szMemoryProfilerTag;
+    bTag  = orxTRUE;
+  }
+  else
+  {
+    /* Uses caller */
+    pID   = _pCaller;
+    bTag  = orxFALSE;
+  }
+
+  /* Checks */
+  orxASSERT(pID != orxNULL);
+
+  /* Gets start index */
+  u32Index = (orxU32)(((orxU64)(size_t)pID * orxMEMORY_KU64_SITE_HASH_MULTIPLIER) >> 32) & (orxMEMORY_KU32_PROFILER_SITE_NUMBER - 1);
+
+  /* For all sites */
+  for(i = 0; i < orxMEMORY_KU32_PROFILER_SITE_NUMBER; i++, u32Index = (u32Index + 1) & (orxMEMORY_KU32_PROFILER_SITE_NUMBER - 1))
+  {
+    orxMEMORY_SITE *pstSite;
+    const void     *pSiteID;
+
+    /* Gets it */
+    pstSite = &(sstMemory.astSiteList[u32Index]);
+    pSiteID = pstSite->pID;
+
+    /* Empty? */
+    if(pSiteID == orxNULL)
+    {
+      /* Claims it */
+      pSiteID = orxMEMORY_ATOMIC_CASPTR(&(pstSite->pID), orxNULL, pID);
+
+      /* Success? */
+      if(pSiteID == orxNULL)
+      {
+        /* Stores its kind */
+        pstSite->bTag = bTag;
+
+        /* Updates result */
+        pstResult = pstSite;
+
+        break;
+      }
+    }
+
+    /* Found? */
+    if(pSiteID == pID)
+    {
+      /* Updates result */
+      pstResult = pstSite;
+
+      break;
+    }
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Profiles an allocation
+ * @param[in] _pstHeader    Header of the allocated block
+ * @param[in] _pCaller      Caller's return address
+ * @param[in] _u32Size      Requested size
+ */
+static void orxFASTCALL orxMemory_ProfileAllocation(orxMEMORY_HEADER *_pstHeader, const void *_pCaller, orxU32 _u32Size)
+{
+  orxMEMORY_SITE *pstSite;
+  orxU32          u32Size, u32PeakSize;
+
+  /* Gets site */
+  pstSite = orxMemory_GetSite(_pCaller);
+
+  /* Tags block */
+  _pstHeader->pstSite = pstSite;
+  _pstHeader->u32Size = _u32Size;
+
+  /* Updates counters */
+  u32Size = orxMEMORY_ATOMIC_ADD32(&(pstSite->u32Size), _u32Size) + _u32Size;
+  orxMEMORY_ATOMIC_ADD32(&(pstSite->u32Count), 1);
+  orxMEMORY_ATOMIC_ADD32(&(pstSite->u32AllocationCount), 1);
+
+  /* Updates peak size */
+  for(u32PeakSize = pstSite->u32PeakSize;
+      (u32Size > u32PeakSize) && (orxMEMORY_ATOMIC_CAS32(&(pstSite->u32PeakSize), u32PeakSize, u32Size) != u32PeakSize);
+      u32PeakSize = pstSite->u32PeakSize);
+
+  /* Done! */
+  return;
+}
+
+/** Profiles a free
+ * @param[in] _pstHeader    Header of the freed block
+ */
+static void orxFASTCALL orxMemory_ProfileFree(const orxMEMORY_HEADER *_pstHeader)
+{
+  orxMEMORY_SITE *pstSite;
+
+  /* Gets site */
+  pstSite = _pstHeader->pstSite;
+
+  /* Updates counters */
+  orxMEMORY_ATOMIC_ADD32(&(pstSite->u32Size), (orxU32)0 - _pstHeader->u32Size);
+  orxMEMORY_ATOMIC_ADD32(&(pstSite->u32Count), (orxU32)-1);
+  orxMEMORY_ATOMIC_ADD32(&(pstSite->u32FreeCount), 1);
+
+  /* Done! */
+  return;
+}
+
+/** Compares two allocation sites: live size, peak size then allocation count, in decreasing order
+ */
+static int orxMemory_CompareSites(const void *_pElement1, const void *_pElement2)
+{
+  const orxMEMORY_SITE *pstSite1, *pstSite2;
+  int                   iResult;
+
+  /* Gets sites */
+  pstSite1 = *(const orxMEMORY_SITE **)_pElement1;
+  pstSite2 = *(const orxMEMORY_SITE **)_pElement2;
+
+  /* Updates result */
+  iResult = (pstSite1->u32Size != pstSite2->u32Size)
+            ? ((pstSite1->u32Size < pstSite2->u32Size) ? 1 : -1)
+            : (pstSite1->u32PeakSize != pstSite2->u32PeakSize)
+              ? ((pstSite1->u32PeakSize < pstSite2->u32PeakSize) ? 1 : -1)
+              : (pstSite1->u32AllocationCount != pstSite2->u32AllocationCount)
+                ? ((pstSite1->u32AllocationCount < pstSite2->u32AllocationCount) ? 1 : -1)
+                : 0;
+
+  /* Done! */
+  return iResult;
+}
+
+#endif /* __orxMEMORY_PROFILER__ */
+
+/** Allocates a block from the arena of the given memory type
+ * @param[in] _uSize      Size of the block
+ * @param[in] _uAlignment Alignment of the block (power of two), 0 for default
+ * @param[in] _eMemType   Memory type
+ * @return Allocated block, NULL if an error has occurred
+ */
+static orxINLINE void *orxMemory_AllocateBlock(size_t _uSize, size_t _uAlignment, orxMEMORY_TYPE _eMemType)
+{
+  void *pResult;
+
+#ifdef __orxMEMORY_ARENAS__
+
+  mspace pArena;
+
+  /* Gets arena */
+  pArena = sstMemory.apTypeArenaList[_eMemType];
+
+  /* Allocates block */
+  pResult = (pArena != NULL)
+            ? ((_uAlignment != 0) ? mspace_memalign(pArena, _uAlignment, _uSize) : mspace_malloc(pArena, _uSize))
+            : ((_uAlignment != 0) ? dlmemalign(_uAlignment, _uSize) : dlmalloc(_uSize));
+
+#else /* __orxMEMORY_ARENAS__ */
+
+  /* Allocates block */
+  pResult = (_uAlignment != 0) ? dlmemalign(_uAlignment, _uSize) : dlmalloc(_uSize);
+
+#endif /* __orxMEMORY_ARENAS__ */
+
+  /* Done! */
+  return pResult;
+}
+
+/** Allocates a portion of memory
+ * @param[in] _u32Size      Size of the memory to allocate
+ * @param[in] _u32Alignment Alignment of the underlying block (power of two), 0 for default
+ * @param[in] _eMemType     Memory zone where data will be allocated
+ * @param[in] _pCaller      Caller's return address, only used by the memory profiler
+ * @return  returns a pointer on the memory allocated, or orxNULL if an error has occurred
+ */
+static orxINLINE void *orxMemory_AllocateInternal(orxU32 _u32Size, orxU32 _u32Alignment, orxMEMORY_TYPE _eMemType, const void *_pCaller)
+{
+  void *pResult;
+
+#ifdef orxMEMORY_USE_HEADER
+
+  /* Allocates memory */
+  pResult = orxMemory_AllocateBlock((size_t)(_u32Size + sizeof(orxMEMORY_HEADER)), (size_t)_u32Alignment, _eMemType);
+
+  /* Success? */
+  if(pResult != NULL)
+  {
+    orxMEMORY_HEADER *pstHeader;
+
+    /* Gets header */
+    pstHeader = (orxMEMORY_HEADER *)pResult;
+
+#ifdef __orxPROFILER__
+
+    /* Tags memory chunk */
+    pstHeader->eMemType = _eMemType;
+
+    /* Updates memory tracker */
+    orxMemory_Track(_eMemType, (orxU32)(dlmalloc_usable_size(pResult) - sizeof(orxMEMORY_HEADER)), orxTRUE);
+
+#endif /* __orxPROFILER__ */
+
+#ifdef __orxMEMORY_PROFILER__
+
+    /* Profiles allocation */
+    orxMemory_ProfileAllocation(pstHeader, _pCaller, _u32Size);
+
+#endif /* __orxMEMORY_PROFILER__ */
+
+    /* Updates result */
+    pResult = (orxU8 *)pResult + sizeof(orxMEMORY_HEADER);
+  }
+
+#else /* orxMEMORY_USE_HEADER */
+
+  /* Allocates memory */
+  pResult = orxMemory_AllocateBlock((size_t)_u32Size, (size_t)_u32Alignment, _eMemType);
+
+#endif /* orxMEMORY_USE_HEADER */
+
+  /* Done! */
+  return pResult;
+}
+
 
 /***************************************************************************
  * Public functions                                                        *
@@ -221,6 +560,14 @@ orxSTATUS orxFASTCALL orxMemory_Init()
     /* Module initialized */
     sstMemory.u32Flags = orxMEMORY_KU32_STATIC_FLAG_READY;
 
+#ifdef __orxMEMORY_ARENAS__
+
+    /* Creates default arenas: config & text data, churned by loading/unloading, and temporary buffers are kept apart from long-lived structures */
+    orxMemory_CreateArena(orxMEMORY_TYPE_MASK(orxMEMORY_TYPE_CONFIG) | orxMEMORY_TYPE_MASK(orxMEMORY_TYPE_TEXT), orxTRUE);
+    orxMemory_CreateArena(orxMEMORY_TYPE_MASK(orxMEMORY_TYPE_TEMP), orxTRUE);
+
+#endif /* __orxMEMORY_ARENAS__ */
+
     /* Success */
     eResult = orxSTATUS_SUCCESS;
   }
@@ -244,6 +591,27 @@ void orxFASTCALL orxMemory_Exit()
   /* Module initialized ? */
   if((sstMemory.u32Flags & orxMEMORY_KU32_STATIC_FLAG_READY) == orxMEMORY_KU32_STATIC_FLAG_READY)
   {
+#ifdef __orxMEMORY_PROFILER__
+
+    /* Dumps profile */
+    orxMemory_DumpProfile(orxNULL);
+
+#endif /* __orxMEMORY_PROFILER__ */
+
+#ifdef __orxMEMORY_ARENAS__
+
+    /* For all arenas */
+    while(sstMemory.u32ArenaCount > 0)
+    {
+      /* Deletes it */
+      destroy_mspace(sstMemory.apArenaList[--sstMemory.u32ArenaCount]);
+    }
+
+    /* Clears type arenas */
+    orxMemory_Zero(sstMemory.apTypeArenaList, sizeof(sstMemory.apTypeArenaList));
+
+#endif /* __orxMEMORY_ARENAS__ */
+
     /* Module uninitialized */
     sstMemory.u32Flags = orxMEMORY_KU32_STATIC_FLAG_NONE;
   }
@@ -264,35 +632,33 @@ void *orxFASTCALL orxMemory_Allocate(orxU32 _u32Size, orxMEMORY_TYPE _eMemType)
   orxASSERT((sstMemory.u32Flags & orxMEMORY_KU32_STATIC_FLAG_READY) == orxMEMORY_KU32_STATIC_FLAG_READY);
   orxASSERT(_eMemType < orxMEMORY_TYPE_NUMBER);
 
-#ifdef __orxPROFILER__
-
   /* Allocates memory */
-  pResult = dlmalloc((size_t)(_u32Size + sizeof(orxMEMORY_TYPE)));
-
-  /* Success? */
-  if(pResult != NULL)
-  {
-    size_t uMemoryChunkSize;
-
-    /* Tags memory chunk */
-    *(orxMEMORY_TYPE *)pResult = _eMemType;
+  pResult = orxMemory_AllocateInternal(_u32Size, 0, _eMemType, orxMEMORY_GET_CALLER());
 
-    /* Gets memory chunk size */
-    uMemoryChunkSize = dlmalloc_usable_size(pResult);
-
-    /* Updates memory tracker */
-    orxMemory_Track(_eMemType, (orxU32)(uMemoryChunkSize - sizeof(orxMEMORY_TYPE)), orxTRUE);
+  /* Done! */
+  return pResult;
+}
 
-    /* Updates result */
-    pResult = (orxU8 *)pResult + sizeof(orxMEMORY_TYPE);
-  }
+/** Allocates a portion of memory whose underlying block starts on the given power-of-two boundary
+ * The returned pointer is located at a constant offset from that boundary (the size of the internal tracking header, if any),
+ * which means that, as long as this offset plus _u32Size doesn't exceed _u32Alignment, the block containing any address of the
+ * returned memory can be found by masking that address with ~(_u32Alignment - 1)
+ * @param[in] _u32Size      Size of the memory to allocate
+ * @param[in] _u32Alignment Alignment of the underlying block, has to be a power of two
+ * @param[in] _eMemType     Memory zone where data will be allocated
+ * @return  returns a pointer on the memory allocated, or orxNULL if an error has occurred; has to be freed with orxMemory_Free
+ */
+void *orxFASTCALL orxMemory_AllocateAligned(orxU32 _u32Size, orxU32 _u32Alignment, orxMEMORY_TYPE _eMemType)
+{
+  void *pResult;
 
-#else /* __orxPROFILER__ */
+  /* Checks */
+  orxASSERT((sstMemory.u32Flags & orxMEMORY_KU32_STATIC_FLAG_READY) == orxMEMORY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_eMemType < orxMEMORY_TYPE_NUMBER);
+  orxASSERT((_u32Alignment != 0) && ((_u32Alignment & (_u32Alignment - 1)) == 0));
 
   /* Allocates memory */
-  pResult = dlmalloc((size_t)_u32Size);
-
-#endif /* __orxPROFILER__ */
+  pResult = orxMemory_AllocateInternal(_u32Size, _u32Alignment, _eMemType, orxMEMORY_GET_CALLER());
 
   /* Done! */
   return pResult;
@@ -316,48 +682,66 @@ void *orxFASTCALL orxMemory_Reallocate(void *_pMem, orxU32 _u32Size)
   if(_pMem == orxNULL)
   {
     /* Allocates it */
-    pResult = orxMemory_Allocate(_u32Size, orxMEMORY_TYPE_TEMP);
+    pResult = orxMemory_AllocateInternal(_u32Size, 0, orxMEMORY_TYPE_TEMP, orxMEMORY_GET_CALLER());
   }
   else
   {
 
-#ifdef __orxPROFILER__
+#ifdef orxMEMORY_USE_HEADER
 
-    orxMEMORY_TYPE eMemType;
-    size_t         uMemoryChunkSize;
+    orxMEMORY_HEADER stHeader;
+#ifdef __orxPROFILER__
+    size_t           uMemoryChunkSize;
+#endif /* __orxPROFILER__ */
 
     /* Updates pointer */
-    _pMem = (orxU8 *)_pMem - sizeof(orxMEMORY_TYPE);
+    _pMem = (orxU8 *)_pMem - sizeof(orxMEMORY_HEADER);
 
-    /* Gets memory type from memory chunk tag */
-    eMemType = *(orxMEMORY_TYPE *)_pMem;
+    /* Backups header */
+    stHeader = *(orxMEMORY_HEADER *)_pMem;
+
+#ifdef __orxPROFILER__
 
     /* Gets memory chunk size */
     uMemoryChunkSize = dlmalloc_usable_size(_pMem);
 
+#endif /* __orxPROFILER__ */
+
     /* Reallocates memory */
-    pResult = dlrealloc(_pMem, (size_t)(_u32Size + sizeof(orxMEMORY_TYPE)));
+    pResult = dlrealloc(_pMem, (size_t)(_u32Size + sizeof(orxMEMORY_HEADER)));
 
     /* Success? */
     if(pResult != NULL)
     {
-      /* Tags memory chunk */
-      *(orxMEMORY_TYPE *)pResult = eMemType;
+      /* Restores header */
+      *(orxMEMORY_HEADER *)pResult = stHeader;
+
+#ifdef __orxPROFILER__
 
       /* Updates memory tracker */
-      orxMemory_Track(eMemType, (orxU32)(uMemoryChunkSize - sizeof(orxMEMORY_TYPE)), orxFALSE);
-      orxMemory_Track(eMemType, (orxU32)(dlmalloc_usable_size(pResult) - sizeof(orxMEMORY_TYPE)), orxTRUE);
+      orxMemory_Track(stHeader.eMemType, (orxU32)(uMemoryChunkSize - sizeof(orxMEMORY_HEADER)), orxFALSE);
+      orxMemory_Track(stHeader.eMemType, (orxU32)(dlmalloc_usable_size(pResult) - sizeof(orxMEMORY_HEADER)), orxTRUE);
+
+#endif /* __orxPROFILER__ */
+
+#ifdef __orxMEMORY_PROFILER__
+
+      /* Profiles reallocation */
+      orxMemory_ProfileFree(&stHeader);
+      orxMemory_ProfileAllocation((orxMEMORY_HEADER *)pResult, orxMEMORY_GET_CALLER(), _u32Size);
+
+#endif /* __orxMEMORY_PROFILER__ */
 
       /* Updates result */
-      pResult = (orxU8 *)pResult + sizeof(orxMEMORY_TYPE);
+      pResult = (orxU8 *)pResult + sizeof(orxMEMORY_HEADER);
     }
 
-#else /* __orxPROFILER__ */
+#else /* orxMEMORY_USE_HEADER */
 
     /* Reallocates memory */
     pResult = dlrealloc(_pMem, (size_t)_u32Size);
 
-#endif /* __orxPROFILER__ */
+#endif /* orxMEMORY_USE_HEADER */
   }
 
   /* Done! */
@@ -372,29 +756,31 @@ void orxFASTCALL orxMemory_Free(void *_pMem)
   /* Checks */
   orxASSERT((sstMemory.u32Flags & orxMEMORY_KU32_STATIC_FLAG_READY) == orxMEMORY_KU32_STATIC_FLAG_READY);
 
-#ifdef __orxPROFILER__
+#ifdef orxMEMORY_USE_HEADER
 
   /* Valid? */
   if(_pMem != NULL)
   {
-    orxMEMORY_TYPE eMemType;
-    size_t         uMemoryChunkSize;
-
     /* Updates pointer */
-    _pMem = (orxU8 *)_pMem - sizeof(orxMEMORY_TYPE);
+    _pMem = (orxU8 *)_pMem - sizeof(orxMEMORY_HEADER);
 
-    /* Gets memory type from memory chunk tag */
-    eMemType = *(orxMEMORY_TYPE *)_pMem;
-
-    /* Gets memory chunk size */
-    uMemoryChunkSize = dlmalloc_usable_size(_pMem);
+#ifdef __orxPROFILER__
 
     /* Updates memory tracker */
-    orxMemory_Track(eMemType, (orxU32)(uMemoryChunkSize - sizeof(orxMEMORY_TYPE)), orxFALSE);
-  }
+    orxMemory_Track(((orxMEMORY_HEADER *)_pMem)->eMemType, (orxU32)(dlmalloc_usable_size(_pMem) - sizeof(orxMEMORY_HEADER)), orxFALSE);
 
 #endif /* __orxPROFILER__ */
 
+#ifdef __orxMEMORY_PROFILER__
+
+    /* Profiles free */
+    orxMemory_ProfileFree((orxMEMORY_HEADER *)_pMem);
+
+#endif /* __orxMEMORY_PROFILER__ */
+  }
+
+#endif /* orxMEMORY_USE_HEADER */
+
   /* System call to free memory */
   dlfree(_pMem);
 
@@ -576,3 +962,242 @@ orxSTATUS orxFASTCALL orxMemory_Track(orxMEMORY_TYPE _eMemType, orxU32 _u32Size,
 }
 
 #endif /* __orxPROFILER__ */
+
+#ifdef __orxMEMORY_PROFILER__
+
+/** Sets the memory profiler tag for the current thread: while set, allocations made by this thread are recorded under this tag instead of their caller
+ * @param[in] _zTag           Tag to set (has to remain valid, literals are recommended), orxNULL to go back to caller recording
+ * @return Previous tag, orxNULL if none
+ */
+const orxSTRING orxFASTCALL orxMemory_SetProfilerTag(const orxSTRING _zTag)
+{
+  const orxSTRING zResult;
+
+  /* Gets previous tag */
+  zResult = szMemoryProfilerTag;
+
+  /* Stores new one */
+  szMemoryProfilerTag = _zTag;
+
+  /* Done! */
+  return zResult;
+}
+
+/** Dumps the memory profiler report to a file, with allocation sites sorted by live size, peak size and allocation count
+ * @param[in] _zFileName      Name of the report file, orxNULL for default
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxMemory_DumpProfile(const orxSTRING _zFileName)
+{
+  FILE     *pstFile;
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT((sstMemory.u32Flags & orxMEMORY_KU32_STATIC_FLAG_READY) == orxMEMORY_KU32_STATIC_FLAG_READY);
+
+  /* Opens file */
+  pstFile = fopen((_zFileName != orxNULL) ? _zFileName : orxMEMORY_KZ_PROFILER_FILE, "w");
+
+  /* Success? */
+  if(pstFile != NULL)
+  {
+    orxU32 u32SiteCount = 0, u32Size = 0, u32PeakSize = 0, u32Count = 0, i;
+
+    /* For all sites */
+    for(i = 0; i < orxMEMORY_KU32_PROFILER_SITE_NUMBER; i++)
+    {
+      /* Used? */
+      if(sstMemory.astSiteList[i].pID != orxNULL)
+      {
+        /* Stores it */
+        sstMemory.apstSortedSiteList[u32SiteCount++] = &(sstMemory.astSiteList[i]);
+      }
+    }
+
+    /* Sorts sites */
+    qsort(sstMemory.apstSortedSiteList, (size_t)u32SiteCount, sizeof(orxMEMORY_SITE *), &orxMemory_CompareSites);
+
+    /* Writes header */
+    fprintf(pstFile, "; orx memory profile: %u sites\n;\n; %12s %12s %10s %12s %12s  %s\n", u32SiteCount, "Live bytes", "Peak bytes", "Live count", "Allocations", "Frees", "Site");
+
+    /* For all sorted sites */
+    for(i = 0; i < u32SiteCount; i++)
+    {
+      const orxMEMORY_SITE *pstSite;
+
+      /* Gets it */
+      pstSite = sstMemory.apstSortedSiteList[i];
+
+      /* Tag? */
+      if(pstSite->bTag != orxFALSE)
+      {
+        /* Writes it */
+        fprintf(pstFile, "  %12u %12u %10u %12u %12u  [%s]\n", pstSite->u32Size, pstSite->u32PeakSize, pstSite->u32Count, pstSite->u32AllocationCount, pstSite->u32FreeCount, (const orxCHAR *)pstSite->pID);
+      }
+      else
+      {
+        /* Writes it */
+        fprintf(pstFile, "  %12u %12u %10u %12u %12u  %p\n", pstSite->u32Size, pstSite->u32PeakSize, pstSite->u32Count, pstSite->u32AllocationCount, pstSite->u32FreeCount, pstSite->pID);
+      }
+
+      /* Updates totals */
+      u32Size     += pstSite->u32Size;
+      u32PeakSize += pstSite->u32PeakSize;
+      u32Count    += pstSite->u32Count;
+    }
+
+    /* Did overflow? */
+    if(sstMemory.stOverflowSite.u32AllocationCount != 0)
+    {
+      /* Writes it */
+      fprintf(pstFile, "  %12u %12u %10u %12u %12u  <overflow>\n", sstMemory.stOverflowSite.u32Size, sstMemory.stOverflowSite.u32PeakSize, sstMemory.stOverflowSite.u32Count, sstMemory.stOverflowSite.u32AllocationCount, sstMemory.stOverflowSite.u32FreeCount);
+
+      /* Updates totals */
+      u32Size     += sstMemory.stOverflowSite.u32Size;
+      u32PeakSize += sstMemory.stOverflowSite.u32PeakSize;
+      u32Count    += sstMemory.stOverflowSite.u32Count;
+    }
+
+    /* Writes totals */
+    fprintf(pstFile, ";\n; %12u %12u %10u  Total (peak is the sum of per-site peaks)\n", u32Size, u32PeakSize, u32Count);
+
+    /* Closes file */
+    fclose(pstFile);
+
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_MEMORY, "Couldn't open memory profiler report file <%s>.", (_zFileName != orxNULL) ? _zFileName : orxMEMORY_KZ_PROFILER_FILE);
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+#endif /* __orxMEMORY_PROFILER__ */
+
+#ifdef __orxMEMORY_ARENAS__
+
+/** Creates a memory arena (separate heap) for a group of memory types
+ * @param[in] _u32TypeMask    Memory types that will allocate from this arena, built with orxMEMORY_TYPE_MASK(), none of them should already have an arena
+ * @param[in] _bThreadSafe    orxTRUE if these types can be allocated/freed from multiple threads, orxFALSE to skip locking
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxMemory_CreateArena(orxU32 _u32TypeMask, orxBOOL _bThreadSafe)
+{
+  orxU32    i;
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT((sstMemory.u32Flags & orxMEMORY_KU32_STATIC_FLAG_READY) == orxMEMORY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_u32TypeMask != 0);
+  orxASSERT(_u32TypeMask < orxMEMORY_TYPE_MASK(orxMEMORY_TYPE_NUMBER));
+
+  /* For all types */
+  for(i = 0; i < orxMEMORY_TYPE_NUMBER; i++)
+  {
+    /* Already has an arena? */
+    if((_u32TypeMask & orxMEMORY_TYPE_MASK(i)) && (sstMemory.apTypeArenaList[i] != NULL))
+    {
+      break;
+    }
+  }
+
+  /* Valid? */
+  if(i == orxMEMORY_TYPE_NUMBER)
+  {
+    mspace pArena;
+
+    /* Checks */
+    orxASSERT(sstMemory.u32ArenaCount < orxMEMORY_TYPE_NUMBER);
+
+    /* Creates arena */
+    pArena = create_mspace(0, (_bThreadSafe != orxFALSE) ? 1 : 0);
+
+    /* Success? */
+    if(pArena != NULL)
+    {
+      /* Stores it */
+      sstMemory.apArenaList[sstMemory.u32ArenaCount++] = pArena;
+
+      /* For all types */
+      for(i = 0; i < orxMEMORY_TYPE_NUMBER; i++)
+      {
+        /* Concerned? */
+        if(_u32TypeMask & orxMEMORY_TYPE_MASK(i))
+        {
+          /* Uses arena */
+          sstMemory.apTypeArenaList[i] = pArena;
+        }
+      }
+
+      /* Updates result */
+      eResult = orxSTATUS_SUCCESS;
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_MEMORY, "Couldn't create memory arena for type mask 0x%X.", _u32TypeMask);
+    }
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_MEMORY, "Can't create memory arena: <%s> already has one.", orxMemory_GetTypeName((orxMEMORY_TYPE)i));
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Gets the footprint (memory obtained from the system) of the arena used by a memory type
+ * @param[in] _eMemType       Concerned memory type
+ * @param[out] _pu32InUseSize Size currently allocated from the arena, can be orxNULL
+ * @return Arena footprint in bytes, shared heap footprint if the type doesn't have its own arena
+ */
+orxU32 orxFASTCALL orxMemory_GetArenaFootprint(orxMEMORY_TYPE _eMemType, orxU32 *_pu32InUseSize)
+{
+  mspace pArena;
+  orxU32 u32Result;
+
+  /* Checks */
+  orxASSERT((sstMemory.u32Flags & orxMEMORY_KU32_STATIC_FLAG_READY) == orxMEMORY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_eMemType < orxMEMORY_TYPE_NUMBER);
+
+  /* Gets arena */
+  pArena = sstMemory.apTypeArenaList[_eMemType];
+
+  /* Own arena? */
+  if(pArena != NULL)
+  {
+    /* Updates result */
+    u32Result = (orxU32)mspace_footprint(pArena);
+
+    /* Asked for in use size? */
+    if(_pu32InUseSize != orxNULL)
+    {
+      /* Updates it */
+      *_pu32InUseSize = (orxU32)mspace_mallinfo(pArena).uordblks;
+    }
+  }
+  else
+  {
+    /* Updates result */
+    u32Result = (orxU32)dlmalloc_footprint();
+
+    /* Asked for in use size? */
+    if(_pu32InUseSize != orxNULL)
+    {
+      /* Updates it */
+      *_pu32InUseSize = (orxU32)dlmallinfo().uordblks;
+    }
+  }
+
+  /* Done! */
+  return u32Result;
+}
+
+#endif /* __orxMEMORY_ARENAS__ */
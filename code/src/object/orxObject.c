@@ -43,6 +43,7 @@
 #include "physics/orxBody.h"
 #include "object/orxFrame.h"
 #include "object/orxFXPointer.h"
+#include "object/orxParticleSystem.h"
 #include "object/orxSpawner.h"
 #include "object/orxTimeLine.h"
 #include "render/orxCamera.h"
@@ -75,6 +76,9 @@
 #define orxOBJECT_KU32_FLAG_IS_JOINT_CHILD      0x08000000  /**< Is joint child flag */
 #define orxOBJECT_KU32_FLAG_DETACH_JOINT_CHILD  0x00100000  /**< Detach joint child flag */
 #define orxOBJECT_KU32_FLAG_DEATH_ROW           0x00200000  /**< Death row flag */
+#define orxOBJECT_KU32_FLAG_STATIC              0x00400000  /**< Static flag */
+#define orxOBJECT_KU32_FLAG_HAS_STATIC_CHILDREN 0x00800000  /**< Has static descendants flag (can be stale: cleared when notifying finds none) */
+#define orxOBJECT_KU32_FLAG_BAKED               0x00080000  /**< Baked (by render plugin) flag */
 
 #define orxOBJECT_KU32_MASK_LINKED_STRUCTURE    0x0000FFFF  /**< Linked structure mask */
 
@@ -103,6 +107,7 @@
 #define orxOBJECT_KZ_CONFIG_BODY                "Body"
 #define orxOBJECT_KZ_CONFIG_CLOCK               "Clock"
 #define orxOBJECT_KZ_CONFIG_SPAWNER             "Spawner"
+#define orxOBJECT_KZ_CONFIG_PARTICLESYSTEM      "ParticleSystem"
 #define orxOBJECT_KZ_CONFIG_PIVOT               "Pivot"
 #define orxOBJECT_KZ_CONFIG_AUTO_SCROLL         "AutoScroll"
 #define orxOBJECT_KZ_CONFIG_FLIP                "Flip"
@@ -137,6 +142,7 @@
 #define orxOBJECT_KZ_CONFIG_GROUP               "Group"
 #define orxOBJECT_KZ_CONFIG_AGE                 "Age"
 #define orxOBJECT_KZ_CONFIG_IGNORE_FROM_PARENT  "IgnoreFromParent"
+#define orxOBJECT_KZ_CONFIG_STATIC              "Static"
 
 #define orxOBJECT_KZ_X                          "x"
 #define orxOBJECT_KZ_Y                          "y"
@@ -282,6 +288,110 @@ void orxFASTCALL orxObject_UpdateBodyScale(orxOBJECT *_pstObject)
   return;
 }
 
+/** Flags all the ancestors of an object as having static descendants
+ */
+static void orxFASTCALL orxObject_SetStaticAncestors(const orxOBJECT *_pstObject)
+{
+  orxFRAME *pstFrame;
+
+  /* Gets its frame */
+  pstFrame = orxOBJECT_GET_STRUCTURE(_pstObject, FRAME);
+
+  /* For all ancestor frames */
+  for(pstFrame = (pstFrame != orxNULL) ? orxFrame_GetParent(pstFrame) : orxNULL;
+      pstFrame != orxNULL;
+      pstFrame = orxFrame_GetParent(pstFrame))
+  {
+    orxOBJECT *pstParent;
+
+    /* Is owned by an object? */
+    if((pstParent = orxOBJECT(orxStructure_GetOwner(pstFrame))) != orxNULL)
+    {
+      /* Already flagged? */
+      if(orxStructure_TestFlags(pstParent, orxOBJECT_KU32_FLAG_HAS_STATIC_CHILDREN))
+      {
+        /* Stops, its ancestors are also flagged */
+        break;
+      }
+
+      /* Updates its flags */
+      orxStructure_SetFlags(pstParent, orxOBJECT_KU32_FLAG_HAS_STATIC_CHILDREN, orxOBJECT_KU32_FLAG_NONE);
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+static orxBOOL orxFASTCALL orxObject_NotifyStaticUpdate(orxOBJECT *_pstObject, orxBOOL _bRecursive);
+
+/** Notifies a static update for all the objects below a frame, going through non-object frames (spawners, ...)
+ * @return orxTRUE if a static object was found, orxFALSE otherwise
+ */
+static orxBOOL orxFASTCALL orxObject_NotifyStaticChildren(const orxFRAME *_pstFrame)
+{
+  orxFRAME *pstChild;
+  orxBOOL   bResult = orxFALSE;
+
+  /* For all child frames */
+  for(pstChild = orxFrame_GetChild(_pstFrame);
+      pstChild != orxNULL;
+      pstChild = orxFrame_GetSibling(pstChild))
+  {
+    orxOBJECT *pstObject;
+
+    /* Notifies its object or its own children */
+    if((((pstObject = orxOBJECT(orxStructure_GetOwner(pstChild))) != orxNULL)
+      ? orxObject_NotifyStaticUpdate(pstObject, orxTRUE)
+      : orxObject_NotifyStaticChildren(pstChild)) != orxFALSE)
+    {
+      /* Updates result */
+      bResult = orxTRUE;
+    }
+  }
+
+  /* Done! */
+  return bResult;
+}
+
+/** Notifies a static object update, only going through children known to have static descendants
+ * @return orxTRUE if the object (or one of its notified descendants) is static, orxFALSE otherwise
+ */
+static orxBOOL orxFASTCALL orxObject_NotifyStaticUpdate(orxOBJECT *_pstObject, orxBOOL _bRecursive)
+{
+  orxBOOL bResult;
+
+  /* Is static? */
+  if((bResult = orxStructure_TestFlags(_pstObject, orxOBJECT_KU32_FLAG_STATIC)) != orxFALSE)
+  {
+    /* Sends event */
+    orxEVENT_SEND(orxEVENT_TYPE_OBJECT, orxOBJECT_EVENT_STATIC_UPDATE, _pstObject, orxNULL, orxNULL);
+  }
+
+  /* Recursive and has static descendants? */
+  if((_bRecursive != orxFALSE)
+  && (orxStructure_TestFlags(_pstObject, orxOBJECT_KU32_FLAG_HAS_STATIC_CHILDREN)))
+  {
+    orxFRAME *pstFrame;
+
+    /* Notifies them */
+    if(((pstFrame = orxOBJECT_GET_STRUCTURE(_pstObject, FRAME)) != orxNULL)
+    && (orxObject_NotifyStaticChildren(pstFrame) != orxFALSE))
+    {
+      /* Updates result */
+      bResult = orxTRUE;
+    }
+    else
+    {
+      /* None left, updates flags */
+      orxStructure_SetFlags(_pstObject, orxOBJECT_KU32_FLAG_NONE, orxOBJECT_KU32_FLAG_HAS_STATIC_CHILDREN);
+    }
+  }
+
+  /* Done! */
+  return bResult;
+}
+
 /** Command: Create
  */
 void orxFASTCALL orxObject_CommandCreate(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
@@ -3150,10 +3260,26 @@ static orxOBJECT *orxFASTCALL orxObject_UpdateInternal(orxOBJECT *_pstObject, co
               /* Updates its rotation */
               orxFrame_SetRotation(pstFrame, orxFRAME_SPACE_LOCAL, orxFrame_GetRotation(pstFrame, orxFRAME_SPACE_LOCAL) + (_pstObject->fAngularVelocity * pstClockInfo->fDT));
             }
+
+            /* Moved? */
+            if((orxVector_IsNull(&(_pstObject->vSpeed)) == orxFALSE)
+            || (_pstObject->fAngularVelocity != orxFLOAT_0))
+            {
+              /* Notifies static update */
+              orxObject_NotifyStaticUpdate(_pstObject, orxTRUE);
+            }
           }
         }
         else
         {
+          /* Is or has static descendants, with a dynamic body (moving its frame directly)? */
+          if((orxStructure_TestFlags(_pstObject, orxOBJECT_KU32_FLAG_STATIC | orxOBJECT_KU32_FLAG_HAS_STATIC_CHILDREN) != orxFALSE)
+          && (orxBody_GetDefFlags((orxBODY *)_pstObject->astStructureList[orxSTRUCTURE_ID_BODY].pstStructure, orxBODY_DEF_KU32_FLAG_DYNAMIC) != orxBODY_DEF_KU32_FLAG_NONE))
+          {
+            /* Notifies static update */
+            orxObject_NotifyStaticUpdate(_pstObject, orxTRUE);
+          }
+
           /* Should detach? */
           if(orxFLAG_TEST(pstStructure->u32Flags, orxOBJECT_KU32_FLAG_DETACH_JOINT_CHILD))
           {
@@ -3202,6 +3328,9 @@ static void orxFASTCALL orxObject_UpdateAll(const orxCLOCK_INFO *_pstClockInfo,
     pstNextObject = orxObject_UpdateInternal(pstObject, _pstClockInfo);
   }
 
+  /* Compacts object storage, now that no iteration is in progress */
+  orxStructure_Compact(orxSTRUCTURE_ID_OBJECT);
+
   /* Profiles */
   orxPROFILER_POP_MARKER();
 
@@ -3236,6 +3365,7 @@ void orxFASTCALL orxObject_Setup()
   orxModule_AddOptionalDependency(orxMODULE_ID_OBJECT, orxMODULE_ID_FXPOINTER);
   orxModule_AddOptionalDependency(orxMODULE_ID_OBJECT, orxMODULE_ID_SHADERPOINTER);
   orxModule_AddOptionalDependency(orxMODULE_ID_OBJECT, orxMODULE_ID_SOUNDPOINTER);
+  orxModule_AddOptionalDependency(orxMODULE_ID_OBJECT, orxMODULE_ID_PARTICLESYSTEM);
   orxModule_AddOptionalDependency(orxMODULE_ID_OBJECT, orxMODULE_ID_SPAWNER);
   orxModule_AddOptionalDependency(orxMODULE_ID_OBJECT, orxMODULE_ID_TIMELINE);
 
@@ -3260,7 +3390,7 @@ orxSTATUS orxFASTCALL orxObject_Init()
     orxMemory_Zero(&sstObject, sizeof(orxOBJECT_STATIC));
 
     /* Registers structure type */
-    eResult = orxSTRUCTURE_REGISTER(OBJECT, orxSTRUCTURE_STORAGE_TYPE_LINKLIST, orxMEMORY_TYPE_MAIN, orxOBJECT_KU32_BANK_SIZE, orxNULL);
+    eResult = orxSTRUCTURE_REGISTER(OBJECT, orxSTRUCTURE_STORAGE_TYPE_ARRAY, orxMEMORY_TYPE_MAIN, orxOBJECT_KU32_BANK_SIZE, orxNULL);
 
     /* Initialized? */
     if(eResult != orxSTATUS_FAILURE)
@@ -3285,7 +3415,7 @@ orxSTATUS orxFASTCALL orxObject_Init()
           if((sstObject.pstGroupBank != orxNULL) && (sstObject.pstAgeBank != orxNULL))
           {
             /* Creates group table */
-            sstObject.pstGroupTable = orxHashTable_Create(orxOBJECT_KU32_GROUP_TABLE_SIZE, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+            sstObject.pstGroupTable = orxHashTable_Create(orxOBJECT_KU32_GROUP_TABLE_SIZE, orxHASHTABLE_KU32_FLAG_OPEN_ADDRESSING, orxMEMORY_TYPE_MAIN);
 
             /* Success? */
             if(sstObject.pstGroupTable != orxNULL)
@@ -3493,6 +3623,9 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
   if((orxConfig_HasSection(_zConfigID) != orxFALSE)
   && (orxConfig_PushSection(_zConfigID) != orxSTATUS_FAILURE))
   {
+    /* Records cost */
+    orxProfiler_PushCost(orxPROFILER_COST_OBJECT, _zConfigID);
+
     /* Creates object */
     pstResult = orxObject_CreateInternal();
 
@@ -3515,6 +3648,7 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
         const orxSTRING zBodyName;
         const orxSTRING zClockName;
         const orxSTRING zSpawnerName;
+        const orxSTRING zParticleSystemName;
         const orxSTRING zCameraName;
         const orxSTRING zIgnoreFromParent;
         orxFRAME       *pstFrame;
@@ -3622,6 +3756,13 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
           u32FrameFlags  |= orxFRAME_KU32_FLAG_DEPTH_SCALE;
         }
 
+        /* Static? */
+        if(orxConfig_GetBool(orxOBJECT_KZ_CONFIG_STATIC) != orxFALSE)
+        {
+          /* Updates flags */
+          u32Flags |= orxOBJECT_KU32_FLAG_STATIC;
+        }
+
         /* Ignore from parent? */
         if((zIgnoreFromParent = orxConfig_GetString(orxOBJECT_KZ_CONFIG_IGNORE_FROM_PARENT)) != orxSTRING_EMPTY)
         {
@@ -4197,6 +4338,40 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
           }
         }
 
+        /* *** Particle system *** */
+
+        /* Gets particle system name */
+        zParticleSystemName = orxConfig_GetString(orxOBJECT_KZ_CONFIG_PARTICLESYSTEM);
+
+        /* Valid? */
+        if((zParticleSystemName != orxNULL) && (zParticleSystemName != orxSTRING_EMPTY))
+        {
+          orxPARTICLESYSTEM *pstParticleSystem;
+
+          /* Creates particle system */
+          pstParticleSystem = orxParticleSystem_CreateFromConfig(zParticleSystemName);
+
+          /* Valid? */
+          if(pstParticleSystem != orxNULL)
+          {
+            /* Links it */
+            if(orxObject_LinkStructure(pstResult, orxSTRUCTURE(pstParticleSystem)) != orxSTATUS_FAILURE)
+            {
+              /* Updates flags */
+              orxFLAG_SET(pstResult->astStructureList[orxSTRUCTURE_ID_PARTICLESYSTEM].u32Flags, orxOBJECT_KU32_STORAGE_FLAG_INTERNAL, orxOBJECT_KU32_STORAGE_MASK_ALL);
+
+              /* Updates its owner */
+              orxStructure_SetOwner(pstParticleSystem, pstResult);
+            }
+            else
+            {
+              /* Deletes it */
+              orxParticleSystem_Delete(pstParticleSystem);
+              pstParticleSystem = orxNULL;
+            }
+          }
+        }
+
         /* *** Sound *** */
 
         /* Has sound? */
@@ -4285,6 +4460,13 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
         /* Updates flags */
         orxStructure_SetFlags(pstResult, u32Flags, orxOBJECT_KU32_FLAG_NONE);
 
+        /* Static? */
+        if(orxFLAG_TEST(u32Flags, orxOBJECT_KU32_FLAG_STATIC))
+        {
+          /* Updates its ancestors */
+          orxObject_SetStaticAncestors(pstResult);
+        }
+
         /* Sends event */
         orxEVENT_SEND(orxEVENT_TYPE_OBJECT, orxOBJECT_EVENT_CREATE, pstResult, orxNULL, orxNULL);
 
@@ -4341,6 +4523,9 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
       }
     }
 
+    /* Ends cost record */
+    orxProfiler_PopCost();
+
     /* Pops section */
     orxConfig_PopSection();
   }
@@ -4404,6 +4589,9 @@ orxSTATUS orxFASTCALL orxObject_LinkStructure(orxOBJECT *_pstObject, orxSTRUCTUR
     eResult = orxSTATUS_FAILURE;
   }
 
+  /* Notifies static update */
+  orxObject_NotifyStaticUpdate(_pstObject, orxFALSE);
+
   /* Done! */
   return eResult;
 }
@@ -4475,6 +4663,12 @@ void orxFASTCALL orxObject_UnlinkStructure(orxOBJECT *_pstObject, orxSTRUCTURE_I
           break;
         }
 
+        case orxSTRUCTURE_ID_PARTICLESYSTEM:
+        {
+          orxParticleSystem_Delete(orxPARTICLESYSTEM(pstStructure));
+          break;
+        }
+
         case orxSTRUCTURE_ID_SHADERPOINTER:
         {
           orxShaderPointer_Delete(orxSHADERPOINTER(pstStructure));
@@ -4515,6 +4709,9 @@ void orxFASTCALL orxObject_UnlinkStructure(orxOBJECT *_pstObject, orxSTRUCTURE_I
 
     /* Updates flags */
     orxStructure_SetFlags(_pstObject, orxOBJECT_KU32_FLAG_NONE, 1 << _eStructureID);
+
+    /* Notifies static update */
+    orxObject_NotifyStaticUpdate(_pstObject, orxFALSE);
   }
 
   return;
@@ -4668,6 +4865,98 @@ orxBOOL orxFASTCALL orxObject_IsPaused(const orxOBJECT *_pstObject)
   return(orxStructure_TestFlags(_pstObject, orxOBJECT_KU32_FLAG_PAUSED));
 }
 
+/** Sets an object as static/dynamic. Static objects are expected to (nearly) never change and can be baked by the render plugin:
+ * any change made to them, or to their ancestors, through the object API, their speed, angular velocity or dynamic bodies
+ * will send an orxOBJECT_EVENT_STATIC_UPDATE event.
+ * Modifying their frames directly (orxFrame_Set*) isn't tracked: call orxObject_SetStatic() again afterwards to get them re-baked.
+ * @param[in]   _pstObject    Concerned object
+ * @param[in]   _bStatic      Static / dynamic
+ */
+void orxFASTCALL orxObject_SetStatic(orxOBJECT *_pstObject, orxBOOL _bStatic)
+{
+  /* Checks */
+  orxASSERT(sstObject.u32Flags & orxOBJECT_KU32_STATIC_FLAG_READY);
+  orxSTRUCTURE_ASSERT(_pstObject);
+
+  /* Static? */
+  if(_bStatic != orxFALSE)
+  {
+    /* Wasn't static? */
+    if(!orxStructure_TestFlags(_pstObject, orxOBJECT_KU32_FLAG_STATIC))
+    {
+      /* Updates status flags */
+      orxStructure_SetFlags(_pstObject, orxOBJECT_KU32_FLAG_STATIC, orxOBJECT_KU32_FLAG_NONE);
+
+      /* Updates its ancestors */
+      orxObject_SetStaticAncestors(_pstObject);
+    }
+
+    /* Sends event (also used to get an already static object re-baked) */
+    orxEVENT_SEND(orxEVENT_TYPE_OBJECT, orxOBJECT_EVENT_STATIC_UPDATE, _pstObject, orxNULL, orxNULL);
+  }
+  else
+  {
+    /* Was static? */
+    if(orxStructure_TestFlags(_pstObject, orxOBJECT_KU32_FLAG_STATIC))
+    {
+      /* Sends event */
+      orxEVENT_SEND(orxEVENT_TYPE_OBJECT, orxOBJECT_EVENT_STATIC_UPDATE, _pstObject, orxNULL, orxNULL);
+
+      /* Updates status flags */
+      orxStructure_SetFlags(_pstObject, orxOBJECT_KU32_FLAG_NONE, orxOBJECT_KU32_FLAG_STATIC | orxOBJECT_KU32_FLAG_BAKED);
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Is object static?
+ * @param[in]   _pstObject    Concerned object
+ * @return      orxTRUE if static, orxFALSE otherwise
+ */
+orxBOOL orxFASTCALL orxObject_IsStatic(const orxOBJECT *_pstObject)
+{
+  /* Checks */
+  orxASSERT(sstObject.u32Flags & orxOBJECT_KU32_STATIC_FLAG_READY);
+  orxSTRUCTURE_ASSERT(_pstObject);
+
+  /* Done! */
+  return(orxStructure_TestFlags(_pstObject, orxOBJECT_KU32_FLAG_STATIC));
+}
+
+/** Sets whether a static object is currently baked by the render plugin, which then won't render it individually. Doesn't send any event.
+ * @param[in]   _pstObject    Concerned object
+ * @param[in]   _bBaked       Baked / not baked
+ */
+void orxFASTCALL orxObject_SetBaked(orxOBJECT *_pstObject, orxBOOL _bBaked)
+{
+  /* Checks */
+  orxASSERT(sstObject.u32Flags & orxOBJECT_KU32_STATIC_FLAG_READY);
+  orxSTRUCTURE_ASSERT(_pstObject);
+  orxASSERT((_bBaked == orxFALSE) || (orxStructure_TestFlags(_pstObject, orxOBJECT_KU32_FLAG_STATIC)));
+
+  /* Updates status flags */
+  orxStructure_SetFlags(_pstObject, (_bBaked != orxFALSE) ? orxOBJECT_KU32_FLAG_BAKED : orxOBJECT_KU32_FLAG_NONE, (_bBaked != orxFALSE) ? orxOBJECT_KU32_FLAG_NONE : orxOBJECT_KU32_FLAG_BAKED);
+
+  /* Done! */
+  return;
+}
+
+/** Is object baked by the render plugin?
+ * @param[in]   _pstObject    Concerned object
+ * @return      orxTRUE if baked, orxFALSE otherwise
+ */
+orxBOOL orxFASTCALL orxObject_IsBaked(const orxOBJECT *_pstObject)
+{
+  /* Checks */
+  orxASSERT(sstObject.u32Flags & orxOBJECT_KU32_STATIC_FLAG_READY);
+  orxSTRUCTURE_ASSERT(_pstObject);
+
+  /* Done! */
+  return(orxStructure_TestFlags(_pstObject, orxOBJECT_KU32_FLAG_BAKED));
+}
+
 /** Sets user data for an object. Orx ignores the user data, this is a mechanism for attaching custom
  * data to be used later by user code.
  * @param[in]   _pstObject    Concerned object
@@ -4944,6 +5233,9 @@ orxSTATUS orxFASTCALL orxObject_SetFlip(orxOBJECT *_pstObject, orxBOOL _bFlipX,
     eResult = orxSTATUS_FAILURE;
   }
 
+  /* Notifies static update */
+  orxObject_NotifyStaticUpdate(_pstObject, orxFALSE);
+
   /* Done! */
   return eResult;
 }
@@ -5022,6 +5314,9 @@ orxSTATUS orxFASTCALL orxObject_SetPivot(orxOBJECT *_pstObject, const orxVECTOR
     eResult = orxSTATUS_SUCCESS;
   }
 
+  /* Notifies static update */
+  orxObject_NotifyStaticUpdate(_pstObject, orxFALSE);
+
   /* Done! */
   return eResult;
 }
@@ -5058,6 +5353,9 @@ orxSTATUS orxFASTCALL orxObject_SetOrigin(orxOBJECT *_pstObject, const orxVECTOR
     eResult = orxSTATUS_FAILURE;
   }
 
+  /* Notifies static update */
+  orxObject_NotifyStaticUpdate(_pstObject, orxFALSE);
+
   /* Done! */
   return eResult;
 }
@@ -5102,6 +5400,9 @@ orxSTATUS orxFASTCALL orxObject_SetSize(orxOBJECT *_pstObject, const orxVECTOR *
     eResult = orxSTATUS_SUCCESS;
   }
 
+  /* Notifies static update */
+  orxObject_NotifyStaticUpdate(_pstObject, orxFALSE);
+
   /* Done! */
   return eResult;
 }
@@ -5267,6 +5568,9 @@ orxSTATUS orxFASTCALL orxObject_SetPosition(orxOBJECT *_pstObject, const orxVECT
     eResult = orxSTATUS_FAILURE;
   }
 
+  /* Notifies static update */
+  orxObject_NotifyStaticUpdate(_pstObject, orxTRUE);
+
   /* Done! */
   return eResult;
 }
@@ -5322,6 +5626,9 @@ orxSTATUS orxFASTCALL orxObject_SetWorldPosition(orxOBJECT *_pstObject, const or
     eResult = orxSTATUS_FAILURE;
   }
 
+  /* Notifies static update */
+  orxObject_NotifyStaticUpdate(_pstObject, orxTRUE);
+
   /* Done! */
   return eResult;
 }
@@ -5376,6 +5683,9 @@ orxSTATUS orxFASTCALL orxObject_SetRotation(orxOBJECT *_pstObject, orxFLOAT _fRo
     eResult = orxSTATUS_FAILURE;
   }
 
+  /* Notifies static update */
+  orxObject_NotifyStaticUpdate(_pstObject, orxTRUE);
+
   /* Done! */
   return eResult;
 }
@@ -5430,6 +5740,9 @@ orxSTATUS orxFASTCALL orxObject_SetWorldRotation(orxOBJECT *_pstObject, orxFLOAT
     eResult = orxSTATUS_FAILURE;
   }
 
+  /* Notifies static update */
+  orxObject_NotifyStaticUpdate(_pstObject, orxTRUE);
+
   /* Done! */
   return eResult;
 }
@@ -5472,6 +5785,9 @@ orxSTATUS orxFASTCALL orxObject_SetScale(orxOBJECT *_pstObject, const orxVECTOR
     eResult = orxSTATUS_FAILURE;
   }
 
+  /* Notifies static update */
+  orxObject_NotifyStaticUpdate(_pstObject, orxTRUE);
+
   /* Done! */
   return eResult;
 }
@@ -5513,6 +5829,9 @@ orxSTATUS orxFASTCALL orxObject_SetWorldScale(orxOBJECT *_pstObject, const orxVE
     eResult = orxSTATUS_FAILURE;
   }
 
+  /* Notifies static update */
+  orxObject_NotifyStaticUpdate(_pstObject, orxTRUE);
+
   /* Done! */
   return eResult;
 }
@@ -5831,6 +6150,16 @@ orxSTATUS orxFASTCALL orxObject_SetParent(orxOBJECT *_pstObject, void *_pParent)
   /* Updates body scale */
   orxObject_UpdateBodyScale(_pstObject);
 
+  /* Is or has static descendants? */
+  if(orxStructure_TestFlags(_pstObject, orxOBJECT_KU32_FLAG_STATIC | orxOBJECT_KU32_FLAG_HAS_STATIC_CHILDREN) != orxFALSE)
+  {
+    /* Updates its new ancestors */
+    orxObject_SetStaticAncestors(_pstObject);
+  }
+
+  /* Notifies static update */
+  orxObject_NotifyStaticUpdate(_pstObject, orxTRUE);
+
   /* Done! */
   return eResult;
 }
@@ -7825,6 +8154,9 @@ orxSTATUS orxFASTCALL orxObject_SetSmoothing(orxOBJECT *_pstObject, orxDISPLAY_S
   /* Updates status */
   orxStructure_SetFlags(_pstObject, u32Flags, orxOBJECT_KU32_FLAG_SMOOTHING_ON | orxOBJECT_KU32_FLAG_SMOOTHING_OFF);
 
+  /* Notifies static update */
+  orxObject_NotifyStaticUpdate(_pstObject, orxFALSE);
+
   /* Done! */
   return eResult;
 }
@@ -7948,6 +8280,9 @@ orxSTATUS orxFASTCALL orxObject_SetColor(orxOBJECT *_pstObject, const orxCOLOR *
     eResult = orxSTATUS_FAILURE;
   }
 
+  /* Notifies static update */
+  orxObject_NotifyStaticUpdate(_pstObject, orxFALSE);
+
   /* Done! */
   return eResult;
 }
@@ -8076,6 +8411,9 @@ orxSTATUS orxFASTCALL orxObject_SetRGB(orxOBJECT *_pstObject, const orxVECTOR *_
     eResult = orxSTATUS_FAILURE;
   }
 
+  /* Notifies static update */
+  orxObject_NotifyStaticUpdate(_pstObject, orxFALSE);
+
   /* Done! */
   return eResult;
 }
@@ -8135,6 +8473,9 @@ orxSTATUS orxFASTCALL orxObject_SetAlpha(orxOBJECT *_pstObject, orxFLOAT _fAlpha
     eResult = orxSTATUS_FAILURE;
   }
 
+  /* Notifies static update */
+  orxObject_NotifyStaticUpdate(_pstObject, orxFALSE);
+
   /* Done! */
   return eResult;
 }
@@ -8178,6 +8519,9 @@ orxSTATUS orxFASTCALL orxObject_SetRepeat(orxOBJECT *_pstObject, orxFLOAT _fRepe
     eResult = orxSTATUS_FAILURE;
   }
 
+  /* Notifies static update */
+  orxObject_NotifyStaticUpdate(_pstObject, orxFALSE);
+
   /* Done! */
   return eResult;
 }
@@ -8253,6 +8597,9 @@ orxSTATUS orxFASTCALL orxObject_SetBlendMode(orxOBJECT *_pstObject, orxDISPLAY_B
     eResult = orxSTATUS_FAILURE;
   }
 
+  /* Notifies static update */
+  orxObject_NotifyStaticUpdate(_pstObject, orxFALSE);
+
   /* Done! */
   return eResult;
 }
@@ -8415,6 +8762,9 @@ extern orxDLLAPI orxSTATUS orxFASTCALL orxObject_SetGroupID(orxOBJECT *_pstObjec
   orxSTRUCTURE_ASSERT(_pstObject);
   orxASSERT((_u32GroupID != 0) && (_u32GroupID != orxU32_UNDEFINED));
 
+  /* Notifies static update (previous group) */
+  orxObject_NotifyStaticUpdate(_pstObject, orxFALSE);
+
   /* Removes object from its current group */
   if(orxLinkList_GetList(&(_pstObject->stGroupNode)) != orxNULL)
   {
@@ -8448,6 +8798,9 @@ extern orxDLLAPI orxSTATUS orxFASTCALL orxObject_SetGroupID(orxOBJECT *_pstObjec
   /* Stores group ID */
   _pstObject->u32GroupID = _u32GroupID;
 
+  /* Notifies static update (new group) */
+  orxObject_NotifyStaticUpdate(_pstObject, orxFALSE);
+
   /* Done! */
   return eResult;
 }
@@ -0,0 +1,996 @@
+/* Orx - Portable Game Engine
+ *
+ * Copyright (c) 2008-2018 Orx-Project
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ *    1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ *
+ *    2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ *
+ *    3. This notice may not be removed or altered from any source
+ *    distribution.
+ */
+
+/**
+ * @file orxParticleSystem.c
+ * @date 18/10/2026
+ * @author iarwain@orx-project.org
+ *
+ */
+
+
+#include "object/orxParticleSystem.h"
+
+#include "debug/orxDebug.h"
+#include "debug/orxProfiler.h"
+#include "core/orxConfig.h"
+#include "memory/orxMemory.h"
+#include "object/orxObject.h"
+
+
+/** Module flags
+ */
+#define orxPARTICLESYSTEM_KU32_STATIC_FLAG_NONE         0x00000000  /**< No flags */
+
+#define orxPARTICLESYSTEM_KU32_STATIC_FLAG_READY        0x00000001  /**< Ready flag */
+
+#define orxPARTICLESYSTEM_KU32_STATIC_MASK_ALL          0xFFFFFFFF  /**< All mask */
+
+
+/** Flags
+ */
+#define orxPARTICLESYSTEM_KU32_FLAG_ENABLED             0x10000000  /**< Enabled flag */
+#define orxPARTICLESYSTEM_KU32_FLAG_TOTAL_LIMIT         0x20000000  /**< Total limit flag */
+#define orxPARTICLESYSTEM_KU32_FLAG_WAVE_MODE           0x40000000  /**< Wave mode flag */
+#define orxPARTICLESYSTEM_KU32_FLAG_HAS_OWNER_FRAME     0x80000000  /**< Has owner's frame values flag */
+
+#define orxPARTICLESYSTEM_KU32_MASK_ALL                 0xFFFFFFFF  /**< All mask */
+
+
+/** Misc defines
+ */
+#define orxPARTICLESYSTEM_KZ_CONFIG_GRAPHIC             "Graphic"
+#define orxPARTICLESYSTEM_KZ_CONFIG_TOTAL_PARTICLE      "TotalParticle"
+#define orxPARTICLESYSTEM_KZ_CONFIG_ACTIVE_PARTICLE     "ActiveParticle"
+#define orxPARTICLESYSTEM_KZ_CONFIG_WAVE_SIZE           "WaveSize"
+#define orxPARTICLESYSTEM_KZ_CONFIG_WAVE_DELAY          "WaveDelay"
+#define orxPARTICLESYSTEM_KZ_CONFIG_POSITION            "Position"
+#define orxPARTICLESYSTEM_KZ_CONFIG_PARTICLE_SPEED      "ParticleSpeed"
+#define orxPARTICLESYSTEM_KZ_CONFIG_ACCELERATION        "Acceleration"
+#define orxPARTICLESYSTEM_KZ_CONFIG_LIFETIME            "LifeTime"
+#define orxPARTICLESYSTEM_KZ_CONFIG_ROTATION            "Rotation"
+#define orxPARTICLESYSTEM_KZ_CONFIG_ANGULAR_VELOCITY    "AngularVelocity"
+#define orxPARTICLESYSTEM_KZ_CONFIG_START_SCALE         "StartScale"
+#define orxPARTICLESYSTEM_KZ_CONFIG_END_SCALE           "EndScale"
+#define orxPARTICLESYSTEM_KZ_CONFIG_START_COLOR         "StartColor"
+#define orxPARTICLESYSTEM_KZ_CONFIG_END_COLOR           "EndColor"
+#define orxPARTICLESYSTEM_KZ_CONFIG_START_ALPHA         "StartAlpha"
+#define orxPARTICLESYSTEM_KZ_CONFIG_END_ALPHA           "EndAlpha"
+#define orxPARTICLESYSTEM_KZ_CONFIG_USE_ROTATION        "UseRotation"
+#define orxPARTICLESYSTEM_KZ_CONFIG_USE_SCALE           "UseScale"
+#define orxPARTICLESYSTEM_KZ_CONFIG_USE_RELATIVE_SPEED  "UseRelativeSpeed"
+
+#define orxPARTICLESYSTEM_KU32_DEFAULT_ACTIVE_PARTICLE  256         /**< Default active particle limit */
+#define orxPARTICLESYSTEM_KF_DEFAULT_LIFETIME           orx2F(1.0f) /**< Default particle lifetime */
+#define orxPARTICLESYSTEM_KU32_ALIGNMENT                4           /**< Particle capacity alignment, keeps all arrays 16-byte aligned */
+
+#define orxPARTICLESYSTEM_KU32_BANK_SIZE                64          /**< Bank size */
+
+
+/***************************************************************************
+ * Structure declaration                                                   *
+ ***************************************************************************/
+
+/** Particle system structure
+ */
+struct __orxPARTICLESYSTEM_t
+{
+  orxSTRUCTURE        stStructure;                /**< Public structure, first structure member */
+  orxGRAPHIC         *pstGraphic;                 /**< Particle graphic */
+  const orxSTRING     zReference;                 /**< Config reference */
+
+  orxFLOAT           *afX;                        /**< X positions */
+  orxFLOAT           *afY;                        /**< Y positions */
+  orxFLOAT           *afSpeedX;                   /**< X speeds */
+  orxFLOAT           *afSpeedY;                   /**< Y speeds */
+  orxFLOAT           *afRotation;                 /**< Rotations */
+  orxFLOAT           *afAngularVelocity;          /**< Angular velocities */
+  orxFLOAT           *afScale;                    /**< Scales */
+  orxFLOAT           *afAge;                      /**< Ages */
+  orxFLOAT           *afInvLifeTime;              /**< Inverse lifetimes */
+  orxRGBA            *astRGBA;                    /**< Colors */
+
+  orxU32              u32Count;                   /**< Live particle count */
+  orxU32              u32ActiveParticleLimit;     /**< Live particle limit (capacity) */
+  orxU32              u32TotalParticleLimit;      /**< Total particle limit, 0 for unlimited */
+  orxU32              u32TotalParticleCount;      /**< Total emitted particle count */
+  orxU32              u32WaveSize;                /**< Particles emitted per wave */
+  orxFLOAT            fWaveDelay;                 /**< Delay between waves */
+  orxFLOAT            fWaveTimer;                 /**< Wave timer */
+
+  orxVECTOR           vAcceleration;              /**< Acceleration applied to all particles */
+  orxFLOAT            fStartScale;                /**< Scale at birth */
+  orxFLOAT            fEndScale;                  /**< Scale at death */
+  orxCOLOR            stStartColor;               /**< Color at birth */
+  orxCOLOR            stEndColor;                 /**< Color at death */
+  orxAABOX            stBox;                      /**< Bounding box of all particle positions */
+  orxFLOAT            fMaxScale;                  /**< Largest absolute particle scale */
+
+  orxVECTOR           vOwnerPosition;             /**< Owner's last world position */
+  orxVECTOR           vOwnerScale;                /**< Owner's last world scale */
+  orxFLOAT            fOwnerRotation;             /**< Owner's last world rotation */
+};
+
+/** Static structure
+ */
+typedef struct __orxPARTICLESYSTEM_STATIC_t
+{
+  orxU32              u32Flags;                   /**< Control flags */
+
+} orxPARTICLESYSTEM_STATIC;
+
+
+/***************************************************************************
+ * Static variables                                                        *
+ ***************************************************************************/
+
+/** Static data
+ */
+static orxPARTICLESYSTEM_STATIC sstParticleSystem;
+
+
+/***************************************************************************
+ * Private functions                                                       *
+ ***************************************************************************/
+
+/** Gets a color from config
+ * @param[in]   _zColorKey      Color key
+ * @param[in]   _zAlphaKey      Alpha key
+ * @param[out]  _pstColor       Color
+ */
+static orxINLINE void orxParticleSystem_GetConfigColor(const orxSTRING _zColorKey, const orxSTRING _zAlphaKey, orxCOLOR *_pstColor)
+{
+  /* Gets color */
+  if(orxConfig_GetVector(_zColorKey, &(_pstColor->vRGB)) != orxNULL)
+  {
+    /* Normalizes it */
+    orxVector_Mulf(&(_pstColor->vRGB), &(_pstColor->vRGB), orxCOLOR_NORMALIZER);
+  }
+  else
+  {
+    /* Defaults to white */
+    orxVector_Copy(&(_pstColor->vRGB), &orxVECTOR_WHITE);
+  }
+
+  /* Gets alpha */
+  _pstColor->fAlpha = (orxConfig_HasValue(_zAlphaKey) != orxFALSE) ? orxConfig_GetFloat(_zAlphaKey) : orxFLOAT_1;
+
+  /* Done! */
+  return;
+}
+
+/** Processes config data
+ * @param[in]   _pstParticleSystem      Concerned particle system
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxSTATUS orxFASTCALL orxParticleSystem_ProcessConfigData(orxPARTICLESYSTEM *_pstParticleSystem)
+{
+  const orxSTRING zGraphicName;
+  orxU32          u32Capacity, u32Flags = orxPARTICLESYSTEM_KU32_FLAG_ENABLED;
+  orxSTATUS       eResult = orxSTATUS_FAILURE;
+
+  /* Gets active particle limit */
+  _pstParticleSystem->u32ActiveParticleLimit = (orxConfig_HasValue(orxPARTICLESYSTEM_KZ_CONFIG_ACTIVE_PARTICLE) != orxFALSE) ? orxConfig_GetU32(orxPARTICLESYSTEM_KZ_CONFIG_ACTIVE_PARTICLE) : orxPARTICLESYSTEM_KU32_DEFAULT_ACTIVE_PARTICLE;
+
+  /* Gets aligned capacity */
+  u32Capacity = (orxU32)orxALIGN(_pstParticleSystem->u32ActiveParticleLimit, orxPARTICLESYSTEM_KU32_ALIGNMENT);
+
+  /* Gets graphic name */
+  zGraphicName = orxConfig_GetString(orxPARTICLESYSTEM_KZ_CONFIG_GRAPHIC);
+
+  /* Valid? */
+  if((u32Capacity > 0) && (zGraphicName != orxNULL) && (zGraphicName != orxSTRING_EMPTY))
+  {
+    orxFLOAT *afBuffer;
+
+    /* Allocates all particle arrays at once */
+    afBuffer = (orxFLOAT *)orxMemory_Allocate(10 * u32Capacity * sizeof(orxFLOAT), orxMEMORY_TYPE_MAIN);
+
+    /* Success? */
+    if(afBuffer != orxNULL)
+    {
+      /* Dispatches arrays */
+      _pstParticleSystem->afX               = afBuffer;
+      _pstParticleSystem->afY               = afBuffer + u32Capacity;
+      _pstParticleSystem->afSpeedX          = afBuffer + 2 * u32Capacity;
+      _pstParticleSystem->afSpeedY          = afBuffer + 3 * u32Capacity;
+      _pstParticleSystem->afRotation        = afBuffer + 4 * u32Capacity;
+      _pstParticleSystem->afAngularVelocity = afBuffer + 5 * u32Capacity;
+      _pstParticleSystem->afScale           = afBuffer + 6 * u32Capacity;
+      _pstParticleSystem->afAge             = afBuffer + 7 * u32Capacity;
+      _pstParticleSystem->afInvLifeTime     = afBuffer + 8 * u32Capacity;
+      _pstParticleSystem->astRGBA           = (orxRGBA *)(afBuffer + 9 * u32Capacity);
+
+      /* Creates graphic */
+      _pstParticleSystem->pstGraphic = orxGraphic_CreateFromConfig(zGraphicName);
+
+      /* Valid? */
+      if(_pstParticleSystem->pstGraphic != orxNULL)
+      {
+        /* Sets its owner */
+        orxStructure_SetOwner(_pstParticleSystem->pstGraphic, _pstParticleSystem);
+
+        /* Has total limit? */
+        if((_pstParticleSystem->u32TotalParticleLimit = orxConfig_GetU32(orxPARTICLESYSTEM_KZ_CONFIG_TOTAL_PARTICLE)) > 0)
+        {
+          /* Updates flags */
+          u32Flags |= orxPARTICLESYSTEM_KU32_FLAG_TOTAL_LIMIT;
+        }
+
+        /* Has wave size? */
+        if((_pstParticleSystem->u32WaveSize = orxConfig_GetU32(orxPARTICLESYSTEM_KZ_CONFIG_WAVE_SIZE)) > 0)
+        {
+          /* Gets wave delay */
+          _pstParticleSystem->fWaveDelay = orxMAX(orxConfig_GetFloat(orxPARTICLESYSTEM_KZ_CONFIG_WAVE_DELAY), orxFLOAT_0);
+
+          /* Updates flags */
+          u32Flags |= orxPARTICLESYSTEM_KU32_FLAG_WAVE_MODE;
+        }
+
+        /* Gets acceleration */
+        if(orxConfig_GetVector(orxPARTICLESYSTEM_KZ_CONFIG_ACCELERATION, &(_pstParticleSystem->vAcceleration)) == orxNULL)
+        {
+          orxVector_Copy(&(_pstParticleSystem->vAcceleration), &orxVECTOR_0);
+        }
+
+        /* Gets scales */
+        _pstParticleSystem->fStartScale = (orxConfig_HasValue(orxPARTICLESYSTEM_KZ_CONFIG_START_SCALE) != orxFALSE) ? orxConfig_GetFloat(orxPARTICLESYSTEM_KZ_CONFIG_START_SCALE) : orxFLOAT_1;
+        _pstParticleSystem->fEndScale   = (orxConfig_HasValue(orxPARTICLESYSTEM_KZ_CONFIG_END_SCALE) != orxFALSE) ? orxConfig_GetFloat(orxPARTICLESYSTEM_KZ_CONFIG_END_SCALE) : _pstParticleSystem->fStartScale;
+
+        /* Gets colors */
+        orxParticleSystem_GetConfigColor(orxPARTICLESYSTEM_KZ_CONFIG_START_COLOR, orxPARTICLESYSTEM_KZ_CONFIG_START_ALPHA, &(_pstParticleSystem->stStartColor));
+        if((orxConfig_HasValue(orxPARTICLESYSTEM_KZ_CONFIG_END_COLOR) != orxFALSE)
+        || (orxConfig_HasValue(orxPARTICLESYSTEM_KZ_CONFIG_END_ALPHA) != orxFALSE))
+        {
+          orxParticleSystem_GetConfigColor(orxPARTICLESYSTEM_KZ_CONFIG_END_COLOR, orxPARTICLESYSTEM_KZ_CONFIG_END_ALPHA, &(_pstParticleSystem->stEndColor));
+        }
+        else
+        {
+          orxColor_Copy(&(_pstParticleSystem->stEndColor), &(_pstParticleSystem->stStartColor));
+        }
+
+        /* Gets flags */
+        if(orxConfig_GetBool(orxPARTICLESYSTEM_KZ_CONFIG_USE_ROTATION) != orxFALSE)
+        {
+          u32Flags |= orxPARTICLESYSTEM_KU32_FLAG_USE_ROTATION;
+        }
+        if(orxConfig_GetBool(orxPARTICLESYSTEM_KZ_CONFIG_USE_SCALE) != orxFALSE)
+        {
+          u32Flags |= orxPARTICLESYSTEM_KU32_FLAG_USE_SCALE;
+        }
+        if(orxConfig_GetBool(orxPARTICLESYSTEM_KZ_CONFIG_USE_RELATIVE_SPEED) != orxFALSE)
+        {
+          u32Flags |= orxPARTICLESYSTEM_KU32_FLAG_USE_RELATIVE_SPEED;
+        }
+
+        /* Updates flags */
+        orxStructure_SetFlags(_pstParticleSystem, u32Flags, orxPARTICLESYSTEM_KU32_MASK_ALL);
+
+        /* Updates result */
+        eResult = orxSTATUS_SUCCESS;
+      }
+      else
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_OBJECT, "[%s]: Couldn't create graphic <%s> for particle system.", _pstParticleSystem->zReference, zGraphicName);
+      }
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_OBJECT, "[%s]: Couldn't allocate %u particles.", _pstParticleSystem->zReference, _pstParticleSystem->u32ActiveParticleLimit);
+    }
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_OBJECT, "[%s]: Particle system needs a " orxPARTICLESYSTEM_KZ_CONFIG_GRAPHIC " and a strictly positive " orxPARTICLESYSTEM_KZ_CONFIG_ACTIVE_PARTICLE ".", _pstParticleSystem->zReference);
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Emits particles
+ * @param[in]   _pstParticleSystem      Concerned particle system
+ * @param[in]   _u32Number              Number of particles to emit
+ * @return      Number of emitted particles
+ */
+static orxU32 orxFASTCALL orxParticleSystem_EmitInternal(orxPARTICLESYSTEM *_pstParticleSystem, orxU32 _u32Number)
+{
+  orxU32 u32Result = 0;
+
+  /* Gets number of particles to emit */
+  _u32Number = orxMIN(_u32Number, _pstParticleSystem->u32ActiveParticleLimit - _pstParticleSystem->u32Count);
+  if(orxStructure_TestFlags(_pstParticleSystem, orxPARTICLESYSTEM_KU32_FLAG_TOTAL_LIMIT))
+  {
+    _u32Number = orxMIN(_u32Number, _pstParticleSystem->u32TotalParticleLimit - _pstParticleSystem->u32TotalParticleCount);
+  }
+
+  /* Has particles to emit? */
+  if(_u32Number > 0)
+  {
+    orxFLOAT  fCos, fSin, fScaleX, fScaleY, fRotation;
+    orxU32    i;
+
+    /* Gets owner's rotation & scale */
+    fRotation = orxStructure_TestFlags(_pstParticleSystem, orxPARTICLESYSTEM_KU32_FLAG_USE_ROTATION) ? _pstParticleSystem->fOwnerRotation : orxFLOAT_0;
+    fScaleX   = orxStructure_TestFlags(_pstParticleSystem, orxPARTICLESYSTEM_KU32_FLAG_USE_SCALE) ? _pstParticleSystem->vOwnerScale.fX : orxFLOAT_1;
+    fScaleY   = orxStructure_TestFlags(_pstParticleSystem, orxPARTICLESYSTEM_KU32_FLAG_USE_SCALE) ? _pstParticleSystem->vOwnerScale.fY : orxFLOAT_1;
+    fCos      = orxMath_Cos(_pstParticleSystem->fOwnerRotation);
+    fSin      = orxMath_Sin(_pstParticleSystem->fOwnerRotation);
+
+    /* Pushes its config section: values are fetched per particle so that random ranges apply to each of them */
+    orxConfig_PushSection(_pstParticleSystem->zReference);
+
+    /* For all new particles */
+    for(i = _pstParticleSystem->u32Count; u32Result < _u32Number; u32Result++, i++)
+    {
+      orxVECTOR vOffset, vSpeed;
+      orxFLOAT  fLifeTime;
+
+      /* Gets its offset (owner space) */
+      if(orxConfig_GetVector(orxPARTICLESYSTEM_KZ_CONFIG_POSITION, &vOffset) != orxNULL)
+      {
+        /* Gets it in world space */
+        vOffset.fX *= _pstParticleSystem->vOwnerScale.fX;
+        vOffset.fY *= _pstParticleSystem->vOwnerScale.fY;
+        orxVector_2DRotate(&vOffset, &vOffset, _pstParticleSystem->fOwnerRotation);
+      }
+      else
+      {
+        orxVector_Copy(&vOffset, &orxVECTOR_0);
+      }
+
+      /* Gets its speed */
+      if(orxConfig_GetVector(orxPARTICLESYSTEM_KZ_CONFIG_PARTICLE_SPEED, &vSpeed) != orxNULL)
+      {
+        /* Relative? */
+        if(orxStructure_TestFlags(_pstParticleSystem, orxPARTICLESYSTEM_KU32_FLAG_USE_RELATIVE_SPEED))
+        {
+          orxFLOAT fX, fY;
+
+          /* Gets it in world space */
+          fX        = vSpeed.fX * _pstParticleSystem->vOwnerScale.fX;
+          fY        = vSpeed.fY * _pstParticleSystem->vOwnerScale.fY;
+          vSpeed.fX = (fCos * fX) - (fSin * fY);
+          vSpeed.fY = (fSin * fX) + (fCos * fY);
+        }
+      }
+      else
+      {
+        orxVector_Copy(&vSpeed, &orxVECTOR_0);
+      }
+
+      /* Gets its lifetime */
+      fLifeTime = (orxConfig_HasValue(orxPARTICLESYSTEM_KZ_CONFIG_LIFETIME) != orxFALSE) ? orxConfig_GetFloat(orxPARTICLESYSTEM_KZ_CONFIG_LIFETIME) : orxPARTICLESYSTEM_KF_DEFAULT_LIFETIME;
+
+      /* Inits particle */
+      _pstParticleSystem->afX[i]                = _pstParticleSystem->vOwnerPosition.fX + vOffset.fX;
+      _pstParticleSystem->afY[i]                = _pstParticleSystem->vOwnerPosition.fY + vOffset.fY;
+      _pstParticleSystem->afSpeedX[i]           = vSpeed.fX;
+      _pstParticleSystem->afSpeedY[i]           = vSpeed.fY;
+      _pstParticleSystem->afRotation[i]         = fRotation + orxMATH_KF_DEG_TO_RAD * orxConfig_GetFloat(orxPARTICLESYSTEM_KZ_CONFIG_ROTATION);
+      _pstParticleSystem->afAngularVelocity[i]  = orxMATH_KF_DEG_TO_RAD * orxConfig_GetFloat(orxPARTICLESYSTEM_KZ_CONFIG_ANGULAR_VELOCITY);
+      _pstParticleSystem->afScale[i]            = orxMAX(fScaleX, fScaleY) * _pstParticleSystem->fStartScale;
+      _pstParticleSystem->afAge[i]              = orxFLOAT_0;
+      _pstParticleSystem->afInvLifeTime[i]      = (fLifeTime > orxFLOAT_0) ? orxFLOAT_1 / fLifeTime : orxFLOAT_1 / orxMATH_KF_EPSILON;
+      _pstParticleSystem->astRGBA[i]            = orxColor_ToRGBA(&(_pstParticleSystem->stStartColor));
+
+      /* Updates bounding box */
+      _pstParticleSystem->stBox.vTL.fX = orxMIN(_pstParticleSystem->stBox.vTL.fX, _pstParticleSystem->afX[i]);
+      _pstParticleSystem->stBox.vTL.fY = orxMIN(_pstParticleSystem->stBox.vTL.fY, _pstParticleSystem->afY[i]);
+      _pstParticleSystem->stBox.vBR.fX = orxMAX(_pstParticleSystem->stBox.vBR.fX, _pstParticleSystem->afX[i]);
+      _pstParticleSystem->stBox.vBR.fY = orxMAX(_pstParticleSystem->stBox.vBR.fY, _pstParticleSystem->afY[i]);
+      _pstParticleSystem->fMaxScale    = orxMAX(_pstParticleSystem->fMaxScale, orxMath_Abs(_pstParticleSystem->afScale[i]));
+    }
+
+    /* Pops config section */
+    orxConfig_PopSection();
+
+    /* Updates counts */
+    _pstParticleSystem->u32Count              += u32Result;
+    _pstParticleSystem->u32TotalParticleCount += u32Result;
+  }
+
+  /* Done! */
+  return u32Result;
+}
+
+/** Updates all live particles
+ * @param[in]   _pstParticleSystem      Concerned particle system
+ * @param[in]   _fDT                    Delta time
+ */
+static orxINLINE void orxParticleSystem_UpdateParticles(orxPARTICLESYSTEM *_pstParticleSystem, orxFLOAT _fDT)
+{
+  orxFLOAT *afX, *afY, *afSpeedX, *afSpeedY, *afRotation, *afAngularVelocity, *afScale, *afAge, *afInvLifeTime;
+  orxFLOAT  fAccelerationX, fAccelerationY, fDeltaScale, fMinX, fMinY, fMaxX, fMaxY, fMaxScale;
+  orxVECTOR vStartRGB, vDeltaRGB;
+  orxFLOAT  fStartAlpha, fDeltaAlpha;
+  orxU32    i, u32Count;
+
+  /* Gets arrays */
+  afX               = _pstParticleSystem->afX;
+  afY               = _pstParticleSystem->afY;
+  afSpeedX          = _pstParticleSystem->afSpeedX;
+  afSpeedY          = _pstParticleSystem->afSpeedY;
+  afRotation        = _pstParticleSystem->afRotation;
+  afAngularVelocity = _pstParticleSystem->afAngularVelocity;
+  afScale           = _pstParticleSystem->afScale;
+  afAge             = _pstParticleSystem->afAge;
+  afInvLifeTime     = _pstParticleSystem->afInvLifeTime;
+
+  /* Ages all particles */
+  for(i = 0, u32Count = _pstParticleSystem->u32Count; i < u32Count; i++)
+  {
+    afAge[i] += _fDT;
+  }
+
+  /* For all particles */
+  for(i = 0; i < u32Count;)
+  {
+    /* Dead? */
+    if(afAge[i] * afInvLifeTime[i] >= orxFLOAT_1)
+    {
+      /* Replaces it with the last live particle */
+      u32Count--;
+      afX[i]                = afX[u32Count];
+      afY[i]                = afY[u32Count];
+      afSpeedX[i]           = afSpeedX[u32Count];
+      afSpeedY[i]           = afSpeedY[u32Count];
+      afRotation[i]         = afRotation[u32Count];
+      afAngularVelocity[i]  = afAngularVelocity[u32Count];
+      afAge[i]              = afAge[u32Count];
+      afInvLifeTime[i]      = afInvLifeTime[u32Count];
+    }
+    else
+    {
+      i++;
+    }
+  }
+
+  /* Stores live count */
+  _pstParticleSystem->u32Count = u32Count;
+
+  /* Gets integration constants */
+  fAccelerationX  = _pstParticleSystem->vAcceleration.fX * _fDT;
+  fAccelerationY  = _pstParticleSystem->vAcceleration.fY * _fDT;
+  fDeltaScale     = _pstParticleSystem->fEndScale - _pstParticleSystem->fStartScale;
+
+  /* Integrates all particles: branchless, vectorizable */
+  for(i = 0; i < u32Count; i++)
+  {
+    afSpeedX[i]   += fAccelerationX;
+    afSpeedY[i]   += fAccelerationY;
+    afX[i]        += afSpeedX[i] * _fDT;
+    afY[i]        += afSpeedY[i] * _fDT;
+    afRotation[i] += afAngularVelocity[i] * _fDT;
+    afScale[i]     = _pstParticleSystem->fStartScale + fDeltaScale * afAge[i] * afInvLifeTime[i];
+  }
+
+  /* Gets color interpolation constants */
+  orxVector_Copy(&vStartRGB, &(_pstParticleSystem->stStartColor.vRGB));
+  orxVector_Sub(&vDeltaRGB, &(_pstParticleSystem->stEndColor.vRGB), &vStartRGB);
+  fStartAlpha = _pstParticleSystem->stStartColor.fAlpha;
+  fDeltaAlpha = _pstParticleSystem->stEndColor.fAlpha - fStartAlpha;
+
+  /* Interpolates all colors */
+  for(i = 0; i < u32Count; i++)
+  {
+    orxFLOAT fCoef;
+
+    /* Gets interpolation coef */
+    fCoef = afAge[i] * afInvLifeTime[i];
+
+    /* Updates color */
+    _pstParticleSystem->astRGBA[i] = orx2RGBA(orxF2U(orxCOLOR_DENORMALIZER * (vStartRGB.fX + fCoef * vDeltaRGB.fX)),
+                                              orxF2U(orxCOLOR_DENORMALIZER * (vStartRGB.fY + fCoef * vDeltaRGB.fY)),
+                                              orxF2U(orxCOLOR_DENORMALIZER * (vStartRGB.fZ + fCoef * vDeltaRGB.fZ)),
+                                              orxF2U(orxCOLOR_DENORMALIZER * (fStartAlpha + fCoef * fDeltaAlpha)));
+  }
+
+  /* Updates bounding box */
+  fMinX = fMinY = orxFLOAT_MAX;
+  fMaxX = fMaxY = -orxFLOAT_MAX;
+  fMaxScale     = orxFLOAT_0;
+  for(i = 0; i < u32Count; i++)
+  {
+    fMinX     = orxMIN(fMinX, afX[i]);
+    fMinY     = orxMIN(fMinY, afY[i]);
+    fMaxX     = orxMAX(fMaxX, afX[i]);
+    fMaxY     = orxMAX(fMaxY, afY[i]);
+    fMaxScale = orxMAX(fMaxScale, orxMath_Abs(afScale[i]));
+  }
+  _pstParticleSystem->fMaxScale = fMaxScale;
+  orxVector_Set(&(_pstParticleSystem->stBox.vTL), fMinX, fMinY, _pstParticleSystem->vOwnerPosition.fZ);
+  orxVector_Set(&(_pstParticleSystem->stBox.vBR), fMaxX, fMaxY, _pstParticleSystem->vOwnerPosition.fZ);
+
+  /* Done! */
+  return;
+}
+
+/** Updates the particle system (Callback for generic structure update calling)
+ * @param[in]   _pstStructure                 Generic Structure or the concerned particle system
+ * @param[in]   _pstCaller                    Structure of the caller
+ * @param[in]   _pstClockInfo                 Clock info used for time updates
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxSTATUS orxFASTCALL orxParticleSystem_Update(orxSTRUCTURE *_pstStructure, const orxSTRUCTURE *_pstCaller, const orxCLOCK_INFO *_pstClockInfo)
+{
+  orxPARTICLESYSTEM  *pstParticleSystem;
+  orxOBJECT          *pstObject;
+
+  /* Profiles */
+  orxPROFILER_PUSH_MARKER("orxParticleSystem_Update");
+
+  /* Checks */
+  orxASSERT(sstParticleSystem.u32Flags & orxPARTICLESYSTEM_KU32_STATIC_FLAG_READY);
+  orxSTRUCTURE_ASSERT(_pstStructure);
+  orxSTRUCTURE_ASSERT(_pstCaller);
+
+  /* Gets particle system */
+  pstParticleSystem = orxPARTICLESYSTEM(_pstStructure);
+
+  /* Gets calling object */
+  pstObject = orxOBJECT(_pstCaller);
+
+  /* Valid? */
+  if(pstObject != orxNULL)
+  {
+    /* Stores its world frame values */
+    orxObject_GetWorldPosition(pstObject, &(pstParticleSystem->vOwnerPosition));
+    orxObject_GetWorldScale(pstObject, &(pstParticleSystem->vOwnerScale));
+    pstParticleSystem->fOwnerRotation = orxObject_GetWorldRotation(pstObject);
+
+    /* Updates flags */
+    orxStructure_SetFlags(pstParticleSystem, orxPARTICLESYSTEM_KU32_FLAG_HAS_OWNER_FRAME, orxPARTICLESYSTEM_KU32_FLAG_NONE);
+  }
+
+  /* Updates live particles */
+  orxParticleSystem_UpdateParticles(pstParticleSystem, _pstClockInfo->fDT);
+
+  /* Is enabled and in wave mode? */
+  if(orxStructure_TestAllFlags(pstParticleSystem, orxPARTICLESYSTEM_KU32_FLAG_ENABLED | orxPARTICLESYSTEM_KU32_FLAG_WAVE_MODE))
+  {
+    /* Updates timer */
+    pstParticleSystem->fWaveTimer -= _pstClockInfo->fDT;
+
+    /* For all pending waves */
+    while(pstParticleSystem->fWaveTimer <= orxFLOAT_0)
+    {
+      /* Emits it */
+      orxParticleSystem_EmitInternal(pstParticleSystem, pstParticleSystem->u32WaveSize);
+
+      /* No delay? */
+      if(pstParticleSystem->fWaveDelay <= orxFLOAT_0)
+      {
+        /* Resets timer */
+        pstParticleSystem->fWaveTimer = orxFLOAT_0;
+
+        break;
+      }
+
+      /* Updates timer */
+      pstParticleSystem->fWaveTimer += pstParticleSystem->fWaveDelay;
+    }
+  }
+
+  /* Profiles */
+  orxPROFILER_POP_MARKER();
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
+/** Deletes all particle systems
+ */
+static orxINLINE void orxParticleSystem_DeleteAll()
+{
+  orxPARTICLESYSTEM *pstParticleSystem;
+
+  /* Gets first particle system */
+  pstParticleSystem = orxPARTICLESYSTEM(orxStructure_GetFirst(orxSTRUCTURE_ID_PARTICLESYSTEM));
+
+  /* Non empty? */
+  while(pstParticleSystem != orxNULL)
+  {
+    /* Deletes it */
+    orxParticleSystem_Delete(pstParticleSystem);
+
+    /* Gets first particle system */
+    pstParticleSystem = orxPARTICLESYSTEM(orxStructure_GetFirst(orxSTRUCTURE_ID_PARTICLESYSTEM));
+  }
+
+  return;
+}
+
+
+/***************************************************************************
+ * Public functions                                                        *
+ ***************************************************************************/
+
+/** Particle system module setup
+ */
+void orxFASTCALL orxParticleSystem_Setup()
+{
+  /* Adds module dependencies */
+  orxModule_AddDependency(orxMODULE_ID_PARTICLESYSTEM, orxMODULE_ID_MEMORY);
+  orxModule_AddDependency(orxMODULE_ID_PARTICLESYSTEM, orxMODULE_ID_STRUCTURE);
+  orxModule_AddDependency(orxMODULE_ID_PARTICLESYSTEM, orxMODULE_ID_PROFILER);
+  orxModule_AddDependency(orxMODULE_ID_PARTICLESYSTEM, orxMODULE_ID_CONFIG);
+  orxModule_AddDependency(orxMODULE_ID_PARTICLESYSTEM, orxMODULE_ID_GRAPHIC);
+
+  return;
+}
+
+/** Inits the particle system module
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxParticleSystem_Init()
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Not already Initialized? */
+  if(!orxFLAG_TEST(sstParticleSystem.u32Flags, orxPARTICLESYSTEM_KU32_STATIC_FLAG_READY))
+  {
+    /* Cleans static controller */
+    orxMemory_Zero(&sstParticleSystem, sizeof(orxPARTICLESYSTEM_STATIC));
+
+    /* Registers structure type */
+    eResult = orxSTRUCTURE_REGISTER(PARTICLESYSTEM, orxSTRUCTURE_STORAGE_TYPE_LINKLIST, orxMEMORY_TYPE_MAIN, orxPARTICLESYSTEM_KU32_BANK_SIZE, &orxParticleSystem_Update);
+
+    /* Initialized? */
+    if(eResult != orxSTATUS_FAILURE)
+    {
+      /* Inits Flags */
+      orxFLAG_SET(sstParticleSystem.u32Flags, orxPARTICLESYSTEM_KU32_STATIC_FLAG_READY, orxPARTICLESYSTEM_KU32_STATIC_MASK_ALL);
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_OBJECT, "Failed to register link list structure.");
+    }
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_OBJECT, "Tried to initialize particle system module when it was already initialized.");
+
+    /* Already initialized */
+    eResult = orxSTATUS_SUCCESS;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Exits from the particle system module
+ */
+void orxFASTCALL orxParticleSystem_Exit()
+{
+  /* Initialized? */
+  if(orxFLAG_TEST(sstParticleSystem.u32Flags, orxPARTICLESYSTEM_KU32_STATIC_FLAG_READY))
+  {
+    /* Deletes particle system list */
+    orxParticleSystem_DeleteAll();
+
+    /* Unregisters structure type */
+    orxStructure_Unregister(orxSTRUCTURE_ID_PARTICLESYSTEM);
+
+    /* Updates flags */
+    orxFLAG_SET(sstParticleSystem.u32Flags, orxPARTICLESYSTEM_KU32_STATIC_FLAG_NONE, orxPARTICLESYSTEM_KU32_STATIC_FLAG_READY);
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_OBJECT, "Tried to exit particle system module when it wasn't initialized.");
+  }
+
+  return;
+}
+
+/** Creates a particle system from config
+ * @param[in]   _zConfigID    Config ID
+ * @return orxPARTICLESYSTEM / orxNULL
+ */
+orxPARTICLESYSTEM *orxFASTCALL orxParticleSystem_CreateFromConfig(const orxSTRING _zConfigID)
+{
+  orxPARTICLESYSTEM *pstResult;
+
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstParticleSystem.u32Flags, orxPARTICLESYSTEM_KU32_STATIC_FLAG_READY));
+  orxASSERT((_zConfigID != orxNULL) && (_zConfigID != orxSTRING_EMPTY));
+
+  /* Pushes section */
+  if((orxConfig_HasSection(_zConfigID) != orxFALSE)
+  && (orxConfig_PushSection(_zConfigID) != orxSTATUS_FAILURE))
+  {
+    /* Creates particle system */
+    pstResult = orxPARTICLESYSTEM(orxStructure_Create(orxSTRUCTURE_ID_PARTICLESYSTEM));
+
+    /* Valid? */
+    if(pstResult != orxNULL)
+    {
+      /* Stores its reference key */
+      pstResult->zReference = orxConfig_GetCurrentSection();
+
+      /* Inits owner's frame values */
+      orxVector_Copy(&(pstResult->vOwnerScale), &orxVECTOR_1);
+
+      /* Inits its bounding box */
+      orxVector_Set(&(pstResult->stBox.vTL), orxFLOAT_MAX, orxFLOAT_MAX, orxFLOAT_0);
+      orxVector_Set(&(pstResult->stBox.vBR), -orxFLOAT_MAX, -orxFLOAT_MAX, orxFLOAT_0);
+
+      /* Increases count */
+      orxStructure_IncreaseCount(pstResult);
+
+      /* Processes its config data */
+      if(orxParticleSystem_ProcessConfigData(pstResult) == orxSTATUS_FAILURE)
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_OBJECT, "Couldn't process config data for particle system <%s>.", _zConfigID);
+
+        /* Deletes it */
+        orxParticleSystem_Delete(pstResult);
+
+        /* Updates result */
+        pstResult = orxNULL;
+      }
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_OBJECT, "Failed to create structure for particle system.");
+    }
+
+    /* Pops previous section */
+    orxConfig_PopSection();
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_OBJECT, "Couldn't find config section named (%s).", _zConfigID);
+
+    /* Updates result */
+    pstResult = orxNULL;
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Deletes a particle system
+ * @param[in] _pstParticleSystem        Concerned particle system
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxParticleSystem_Delete(orxPARTICLESYSTEM *_pstParticleSystem)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstParticleSystem.u32Flags, orxPARTICLESYSTEM_KU32_STATIC_FLAG_READY));
+  orxSTRUCTURE_ASSERT(_pstParticleSystem);
+
+  /* Decreases count */
+  orxStructure_DecreaseCount(_pstParticleSystem);
+
+  /* Not referenced? */
+  if(orxStructure_GetRefCount(_pstParticleSystem) == 0)
+  {
+    /* Has graphic? */
+    if(_pstParticleSystem->pstGraphic != orxNULL)
+    {
+      /* Removes its owner */
+      orxStructure_SetOwner(_pstParticleSystem->pstGraphic, orxNULL);
+
+      /* Deletes it */
+      orxGraphic_Delete(_pstParticleSystem->pstGraphic);
+    }
+
+    /* Has particles? */
+    if(_pstParticleSystem->afX != orxNULL)
+    {
+      /* Frees them */
+      orxMemory_Free(_pstParticleSystem->afX);
+    }
+
+    /* Deletes structure */
+    orxStructure_Delete(_pstParticleSystem);
+  }
+  else
+  {
+    /* Referenced by others */
+    eResult = orxSTATUS_FAILURE;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Enables/disables a particle system (live particles keep on being updated)
+ * @param[in]   _pstParticleSystem      Concerned particle system
+ * @param[in]   _bEnable                Enable / disable
+ */
+void orxFASTCALL orxParticleSystem_Enable(orxPARTICLESYSTEM *_pstParticleSystem, orxBOOL _bEnable)
+{
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstParticleSystem.u32Flags, orxPARTICLESYSTEM_KU32_STATIC_FLAG_READY));
+  orxSTRUCTURE_ASSERT(_pstParticleSystem);
+
+  /* Enable? */
+  if(_bEnable != orxFALSE)
+  {
+    /* Updates flags */
+    orxStructure_SetFlags(_pstParticleSystem, orxPARTICLESYSTEM_KU32_FLAG_ENABLED, orxPARTICLESYSTEM_KU32_FLAG_NONE);
+  }
+  else
+  {
+    /* Updates flags */
+    orxStructure_SetFlags(_pstParticleSystem, orxPARTICLESYSTEM_KU32_FLAG_NONE, orxPARTICLESYSTEM_KU32_FLAG_ENABLED);
+  }
+
+  return;
+}
+
+/** Is particle system enabled?
+ * @param[in]   _pstParticleSystem      Concerned particle system
+ * @return      orxTRUE if enabled, orxFALSE otherwise
+ */
+orxBOOL orxFASTCALL orxParticleSystem_IsEnabled(const orxPARTICLESYSTEM *_pstParticleSystem)
+{
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstParticleSystem.u32Flags, orxPARTICLESYSTEM_KU32_STATIC_FLAG_READY));
+  orxSTRUCTURE_ASSERT(_pstParticleSystem);
+
+  /* Done! */
+  return(orxStructure_TestFlags((orxPARTICLESYSTEM *)_pstParticleSystem, orxPARTICLESYSTEM_KU32_FLAG_ENABLED));
+}
+
+/** Emits particles at the last known position of the particle system's owner
+ * @param[in]   _pstParticleSystem      Concerned particle system
+ * @param[in]   _u32Number              Number of particles to emit
+ * @return      Number of emitted particles
+ */
+orxU32 orxFASTCALL orxParticleSystem_Emit(orxPARTICLESYSTEM *_pstParticleSystem, orxU32 _u32Number)
+{
+  orxU32 u32Result;
+
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstParticleSystem.u32Flags, orxPARTICLESYSTEM_KU32_STATIC_FLAG_READY));
+  orxSTRUCTURE_ASSERT(_pstParticleSystem);
+
+  /* Has owner's frame values? */
+  if(orxStructure_TestFlags(_pstParticleSystem, orxPARTICLESYSTEM_KU32_FLAG_HAS_OWNER_FRAME))
+  {
+    /* Emits particles */
+    u32Result = orxParticleSystem_EmitInternal(_pstParticleSystem, _u32Number);
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_OBJECT, "[%s]: Can't emit particles before the particle system has been updated by its owner.", orxParticleSystem_GetName(_pstParticleSystem));
+
+    /* Updates result */
+    u32Result = 0;
+  }
+
+  /* Done! */
+  return u32Result;
+}
+
+/** Clears all live particles and resets the total emitted count
+ * @param[in]   _pstParticleSystem      Concerned particle system
+ */
+void orxFASTCALL orxParticleSystem_Clear(orxPARTICLESYSTEM *_pstParticleSystem)
+{
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstParticleSystem.u32Flags, orxPARTICLESYSTEM_KU32_STATIC_FLAG_READY));
+  orxSTRUCTURE_ASSERT(_pstParticleSystem);
+
+  /* Clears counts & timer */
+  _pstParticleSystem->u32Count              = 0;
+  _pstParticleSystem->u32TotalParticleCount = 0;
+  _pstParticleSystem->fWaveTimer            = orxFLOAT_0;
+
+  /* Clears bounding box */
+  orxVector_Set(&(_pstParticleSystem->stBox.vTL), orxFLOAT_MAX, orxFLOAT_MAX, orxFLOAT_0);
+  orxVector_Set(&(_pstParticleSystem->stBox.vBR), -orxFLOAT_MAX, -orxFLOAT_MAX, orxFLOAT_0);
+  _pstParticleSystem->fMaxScale = orxFLOAT_0;
+
+  return;
+}
+
+/** Gets particle system's graphic
+ * @param[in]   _pstParticleSystem      Concerned particle system
+ * @return      orxGRAPHIC / orxNULL
+ */
+orxGRAPHIC *orxFASTCALL orxParticleSystem_GetGraphic(const orxPARTICLESYSTEM *_pstParticleSystem)
+{
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstParticleSystem.u32Flags, orxPARTICLESYSTEM_KU32_STATIC_FLAG_READY));
+  orxSTRUCTURE_ASSERT(_pstParticleSystem);
+
+  /* Done! */
+  return _pstParticleSystem->pstGraphic;
+}
+
+/** Gets particle system's live particle count
+ * @param[in]   _pstParticleSystem      Concerned particle system
+ * @return      Live particle count
+ */
+orxU32 orxFASTCALL orxParticleSystem_GetParticleCount(const orxPARTICLESYSTEM *_pstParticleSystem)
+{
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstParticleSystem.u32Flags, orxPARTICLESYSTEM_KU32_STATIC_FLAG_READY));
+  orxSTRUCTURE_ASSERT(_pstParticleSystem);
+
+  /* Done! */
+  return _pstParticleSystem->u32Count;
+}
+
+/** Gets particle system's particle list (valid until its next update)
+ * @param[in]   _pstParticleSystem      Concerned particle system
+ * @param[out]  _pstParticleList        Particle list
+ * @return      orxPARTICLE_LIST / orxNULL
+ */
+orxPARTICLE_LIST *orxFASTCALL orxParticleSystem_GetParticleList(const orxPARTICLESYSTEM *_pstParticleSystem, orxPARTICLE_LIST *_pstParticleList)
+{
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstParticleSystem.u32Flags, orxPARTICLESYSTEM_KU32_STATIC_FLAG_READY));
+  orxSTRUCTURE_ASSERT(_pstParticleSystem);
+  orxASSERT(_pstParticleList != orxNULL);
+
+  /* Updates result */
+  _pstParticleList->afX         = _pstParticleSystem->afX;
+  _pstParticleList->afY         = _pstParticleSystem->afY;
+  _pstParticleList->afRotation  = _pstParticleSystem->afRotation;
+  _pstParticleList->afScale     = _pstParticleSystem->afScale;
+  _pstParticleList->astRGBA     = _pstParticleSystem->astRGBA;
+  _pstParticleList->fZ          = _pstParticleSystem->vOwnerPosition.fZ;
+  _pstParticleList->fMaxScale   = _pstParticleSystem->fMaxScale;
+  _pstParticleList->u32Count    = _pstParticleSystem->u32Count;
+  orxAABox_Copy(&(_pstParticleList->stBox), &(_pstParticleSystem->stBox));
+
+  /* Done! */
+  return _pstParticleList;
+}
+
+/** Gets particle system config name
+ * @param[in]   _pstParticleSystem      Concerned particle system
+ * @return      orxSTRING / orxSTRING_EMPTY
+ */
+const orxSTRING orxFASTCALL orxParticleSystem_GetName(const orxPARTICLESYSTEM *_pstParticleSystem)
+{
+  const orxSTRING zResult;
+
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstParticleSystem.u32Flags, orxPARTICLESYSTEM_KU32_STATIC_FLAG_READY));
+  orxSTRUCTURE_ASSERT(_pstParticleSystem);
+
+  /* Updates result */
+  zResult = (_pstParticleSystem->zReference != orxNULL) ? _pstParticleSystem->zReference : orxSTRING_EMPTY;
+
+  /* Done! */
+  return zResult;
+}
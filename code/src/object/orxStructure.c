@@ -39,6 +39,8 @@
 #include "utils/orxHashTable.h"
 #include "utils/orxTree.h"
 
+#include <stdlib.h>
+
 
 /** Module flags
  */
@@ -58,11 +60,25 @@
 #define orxSTRUCTURE_KU32_LOG_COLOR_MARKER    orxANSI_KZ_COLOR_FG_DEFAULT
 #define orxSTRUCTURE_KU32_LOG_COLOR_TREE      orxANSI_KZ_COLOR_FG_GREEN
 
+#define orxSTRUCTURE_KU32_ARRAY_MIN_SIZE      64          /**< Dense array minimum size */
+
 
 /***************************************************************************
  * Structure declaration                                                   *
  ***************************************************************************/
 
+/** Internal dense array structure
+ */
+typedef struct __orxSTRUCTURE_ARRAY_t
+{
+  orxSTRUCTURE            **apstList;         /**< Structure list, deleted structures leave orxNULL holes : 4 */
+  orxU32                    u32Count;         /**< Live structure count : 8 */
+  orxU32                    u32Used;          /**< Used cell count, holes included : 12 */
+  orxU32                    u32Size;          /**< Allocated cell count : 16 */
+  orxU32                    u32SortedCount;   /**< Number of leading cells sorted by address : 20 */
+
+} orxSTRUCTURE_ARRAY;
+
 /** Internal storage structure
  */
 typedef struct __orxSTRUCTURE_STORAGE_t
@@ -74,6 +90,7 @@ typedef struct __orxSTRUCTURE_STORAGE_t
   {
     orxLINKLIST             stLinkList;       /**< Linklist : 20 */
     orxTREE                 stTree;           /**< Tree : 16 */
+    orxSTRUCTURE_ARRAY      stArray;          /**< Dense array : 20 */
   };                                          /**< Storage union : 20 */
 
 } orxSTRUCTURE_STORAGE;
@@ -151,6 +168,20 @@ static orxSTRUCTURE_STATIC sstStructure;
  * Private functions                                                       *
  ***************************************************************************/
 
+/** Compares two structure addresses, used to keep dense arrays in memory order
+ */
+static int orxStructure_CompareAddresses(const void *_pElement1, const void *_pElement2)
+{
+  const orxSTRUCTURE *pstStructure1, *pstStructure2;
+
+  /* Gets structures */
+  pstStructure1 = *(const orxSTRUCTURE **)_pElement1;
+  pstStructure2 = *(const orxSTRUCTURE **)_pElement2;
+
+  /* Done! */
+  return (pstStructure1 < pstStructure2) ? -1 : (pstStructure1 > pstStructure2) ? 1 : 0;
+}
+
 static orxINLINE orxTREE_NODE *orxStructure_InsertLogNode(orxBANK *_pstBank, orxHASHTABLE *_pstTable, orxTREE_NODE *_pstRoot, orxSTRUCTURE *_pstStructure)
 {
   orxSTRUCTURE_LOG_NODE **ppstBucket;
@@ -401,6 +432,21 @@ void orxFASTCALL orxStructure_Exit()
             break;
         }
 
+        case orxSTRUCTURE_STORAGE_TYPE_ARRAY:
+        {
+          /* Has list? */
+          if(sstStructure.astStorage[i].stArray.apstList != orxNULL)
+          {
+            /* Deletes it */
+            orxMemory_Free(sstStructure.astStorage[i].stArray.apstList);
+          }
+
+          /* Cleans array */
+          orxMemory_Zero(&(sstStructure.astStorage[i].stArray), sizeof(orxSTRUCTURE_ARRAY));
+
+          break;
+        }
+
         default:
         {
           break;
@@ -502,6 +548,15 @@ orxSTATUS orxFASTCALL orxStructure_Unregister(orxSTRUCTURE_ID _eStructureID)
     /* Deletes structure storage bank */
     orxBank_Delete(sstStructure.astStorage[_eStructureID].pstStructureBank);
 
+    /* Has dense array? */
+    if((sstStructure.astStorage[_eStructureID].eType == orxSTRUCTURE_STORAGE_TYPE_ARRAY)
+    && (sstStructure.astStorage[_eStructureID].stArray.apstList != orxNULL))
+    {
+      /* Deletes it */
+      orxMemory_Free(sstStructure.astStorage[_eStructureID].stArray.apstList);
+      orxMemory_Zero(&(sstStructure.astStorage[_eStructureID].stArray), sizeof(orxSTRUCTURE_ARRAY));
+    }
+
     /* Unregisters it */
     orxMemory_Zero(&(sstStructure.astInfo[_eStructureID]), sizeof(orxSTRUCTURE_REGISTER_INFO));
     sstStructure.astStorage[_eStructureID].pstStructureBank = orxNULL;
@@ -517,6 +572,52 @@ orxSTATUS orxFASTCALL orxStructure_Unregister(orxSTRUCTURE_ID _eStructureID)
   return orxSTATUS_SUCCESS;
 }
 
+/** Changes the storage type of a registered ID, only possible when none of its structures are alive
+ * @param[in]   _eStructureID   Concerned structure ID
+ * @param[in]   _eStorageType   Storage type to use for this structure type
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxStructure_SetStorageType(orxSTRUCTURE_ID _eStructureID, orxSTRUCTURE_STORAGE_TYPE _eStorageType)
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT(sstStructure.u32Flags & orxSTRUCTURE_KU32_STATIC_FLAG_READY);
+  orxASSERT(_eStructureID < orxSTRUCTURE_ID_NUMBER);
+  orxASSERT(_eStorageType < orxSTRUCTURE_STORAGE_TYPE_NUMBER);
+
+  /* Registered and empty? */
+  if((sstStructure.astInfo[_eStructureID].u32Size != 0)
+  && (orxBank_GetCount(sstStructure.astStorage[_eStructureID].pstStructureBank) == 0))
+  {
+    /* Has dense array? */
+    if((sstStructure.astStorage[_eStructureID].eType == orxSTRUCTURE_STORAGE_TYPE_ARRAY)
+    && (sstStructure.astStorage[_eStructureID].stArray.apstList != orxNULL))
+    {
+      /* Deletes it */
+      orxMemory_Free(sstStructure.astStorage[_eStructureID].stArray.apstList);
+    }
+
+    /* Cleans storage */
+    orxMemory_Zero(&(sstStructure.astStorage[_eStructureID].stArray), orxMAX(orxMAX(sizeof(orxLINKLIST), sizeof(orxTREE)), sizeof(orxSTRUCTURE_ARRAY)));
+
+    /* Updates storage type */
+    sstStructure.astInfo[_eStructureID].eStorageType  = _eStorageType;
+    sstStructure.astStorage[_eStructureID].eType      = _eStorageType;
+
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_OBJECT, "Can't change storage type of structure ID %d: not registered or still in use.", _eStructureID);
+  }
+
+  /* Done! */
+  return eResult;
+}
+
 /** Creates a clean structure for given type
  * @param[in]   _eStructureID   Concerned structure ID
  * @return      orxSTRUCTURE / orxNULL
@@ -538,8 +639,9 @@ orxSTRUCTURE *orxFASTCALL orxStructure_Create(orxSTRUCTURE_ID _eStructureID)
     orxSTRUCTURE *pstPrevious;
     orxU32        u32ItemID;
 
-    /* Creates structure */
-    pstStructure = (orxSTRUCTURE *)orxBank_AllocateIndexed(sstStructure.astStorage[_eStructureID].pstStructureBank, &u32ItemID, (void **)&pstPrevious);
+    /* Creates structure (only linked lists need its previous neighbor, which is costly to find) */
+    pstPrevious  = orxNULL;
+    pstStructure = (orxSTRUCTURE *)orxBank_AllocateIndexed(sstStructure.astStorage[_eStructureID].pstStructureBank, &u32ItemID, (sstStructure.astStorage[_eStructureID].eType == orxSTRUCTURE_STORAGE_TYPE_LINKLIST) ? (void **)&pstPrevious : orxNULL);
 
     /* Valid? */
     if(pstStructure != orxNULL)
@@ -586,6 +688,62 @@ orxSTRUCTURE *orxFASTCALL orxStructure_Create(orxSTRUCTURE_ID _eStructureID)
           break;
         }
 
+        case orxSTRUCTURE_STORAGE_TYPE_ARRAY:
+        {
+          orxSTRUCTURE_ARRAY *pstArray;
+
+          /* Gets array */
+          pstArray = &(sstStructure.astStorage[_eStructureID].stArray);
+
+          /* Full? */
+          if(pstArray->u32Used == pstArray->u32Size)
+          {
+            orxSTRUCTURE **apstNewList;
+            orxU32         u32NewSize;
+
+            /* Gets new size */
+            u32NewSize = (pstArray->u32Size != 0) ? pstArray->u32Size << 1 : orxSTRUCTURE_KU32_ARRAY_MIN_SIZE;
+
+            /* Grows list */
+            apstNewList = (orxSTRUCTURE **)orxMemory_Reallocate(pstArray->apstList, u32NewSize * sizeof(orxSTRUCTURE *));
+
+            /* Success? */
+            if(apstNewList != orxNULL)
+            {
+              /* Stores it */
+              pstArray->apstList  = apstNewList;
+              pstArray->u32Size   = u32NewSize;
+            }
+          }
+
+          /* Has room? */
+          if(pstArray->u32Used < pstArray->u32Size)
+          {
+            /* Still in memory order? */
+            if((pstArray->u32SortedCount == pstArray->u32Used)
+            && ((pstArray->u32Used == 0) || (pstArray->apstList[pstArray->u32Used - 1] < pstStructure)))
+            {
+              /* Extends sorted cells */
+              pstArray->u32SortedCount++;
+            }
+
+            /* Appends structure */
+            pstStructure->stStorage.u32ArrayIndex     = pstArray->u32Used;
+            pstArray->apstList[pstArray->u32Used++]   = pstStructure;
+            pstArray->u32Count++;
+
+            /* Updates result */
+            eResult = orxSTATUS_SUCCESS;
+          }
+          else
+          {
+            /* Updates result */
+            eResult = orxSTATUS_FAILURE;
+          }
+
+          break;
+        }
+
         default:
         {
           /* Logs message */
@@ -682,6 +840,30 @@ orxSTATUS orxFASTCALL orxStructure_Delete(void *_pStructure)
       break;
     }
 
+    case orxSTRUCTURE_STORAGE_TYPE_ARRAY:
+    {
+      orxSTRUCTURE_ARRAY *pstArray;
+
+      /* Gets array */
+      pstArray = &(sstStructure.astStorage[orxStructure_GetID(pstStructure)].stArray);
+
+      /* Checks */
+      orxASSERT(pstArray->apstList[pstStructure->stStorage.u32ArrayIndex] == pstStructure);
+
+      /* Leaves a hole, filled by the next compaction */
+      pstArray->apstList[pstStructure->stStorage.u32ArrayIndex] = orxNULL;
+      pstArray->u32Count--;
+
+      /* Trims trailing holes */
+      while((pstArray->u32Used > 0) && (pstArray->apstList[pstArray->u32Used - 1] == orxNULL))
+      {
+        pstArray->u32Used--;
+      }
+      pstArray->u32SortedCount = orxMIN(pstArray->u32SortedCount, pstArray->u32Used);
+
+      break;
+    }
+
     default:
     {
       /* Logs message */
@@ -749,6 +931,14 @@ orxU32 orxFASTCALL orxStructure_GetCount(orxSTRUCTURE_ID _eStructureID)
       break;
     }
 
+    case orxSTRUCTURE_STORAGE_TYPE_ARRAY:
+    {
+      /* Gets count */
+      u32Result = sstStructure.astStorage[_eStructureID].stArray.u32Count;
+
+      break;
+    }
+
     default:
     {
       /* Logs message */
@@ -895,7 +1085,121 @@ orxSTATUS orxFASTCALL orxStructure_SetOwner(void *_pStructure, void *_pOwner)
   return eResult;
 }
 
-/** Gets first stored structure (first list cell or tree root depending on storage type)
+/** Compacts a structure type's storage, only needed for orxSTRUCTURE_STORAGE_TYPE_ARRAY
+ * @param[in]   _eStructureID   Concerned structure ID
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxStructure_Compact(orxSTRUCTURE_ID _eStructureID)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT(sstStructure.u32Flags & orxSTRUCTURE_KU32_STATIC_FLAG_READY);
+  orxASSERT(_eStructureID < orxSTRUCTURE_ID_NUMBER);
+
+  /* Dense array? */
+  if(sstStructure.astStorage[_eStructureID].eType == orxSTRUCTURE_STORAGE_TYPE_ARRAY)
+  {
+    orxSTRUCTURE_ARRAY *pstArray;
+
+    /* Gets array */
+    pstArray = &(sstStructure.astStorage[_eStructureID].stArray);
+
+    /* Has holes or unsorted cells? */
+    if((pstArray->u32Used != pstArray->u32Count) || (pstArray->u32SortedCount != pstArray->u32Used))
+    {
+      orxU32 i, u32Count, u32SortedCount, u32FirstMoved;
+
+      /* Squeezes out holes, keeping order */
+      for(i = 0, u32Count = 0, u32SortedCount = 0, u32FirstMoved = orxU32_UNDEFINED; i < pstArray->u32Used; i++)
+      {
+        /* Live? */
+        if(pstArray->apstList[i] != orxNULL)
+        {
+          /* Needs to move? */
+          if(u32Count != i)
+          {
+            /* Moves it */
+            pstArray->apstList[u32Count] = pstArray->apstList[i];
+            u32FirstMoved = orxMIN(u32FirstMoved, u32Count);
+          }
+
+          /* Was sorted? */
+          if(i < pstArray->u32SortedCount)
+          {
+            /* Updates sorted count */
+            u32SortedCount++;
+          }
+
+          /* Updates count */
+          u32Count++;
+        }
+      }
+
+      /* Checks */
+      orxASSERT(u32Count == pstArray->u32Count);
+
+      /* Has unsorted cells? */
+      if(u32SortedCount != u32Count)
+      {
+        orxU32 u32TailCount;
+
+        /* Gets unsorted cell count */
+        u32TailCount = u32Count - u32SortedCount;
+
+        /* Sorts them */
+        qsort(pstArray->apstList + u32SortedCount, (size_t)u32TailCount, sizeof(orxSTRUCTURE *), &orxStructure_CompareAddresses);
+
+        /* Needs merging? */
+        if((u32SortedCount != 0) && (pstArray->apstList[u32SortedCount] < pstArray->apstList[u32SortedCount - 1]))
+        {
+          orxSTRUCTURE **apstTail;
+
+          /* Backups unsorted cells */
+          apstTail = (orxSTRUCTURE **)orxMemory_Allocate(u32TailCount * sizeof(orxSTRUCTURE *), orxMEMORY_TYPE_TEMP);
+          orxASSERT(apstTail != orxNULL);
+          orxMemory_Copy(apstTail, pstArray->apstList + u32SortedCount, u32TailCount * sizeof(orxSTRUCTURE *));
+
+          /* Merges them in, from the end */
+          for(i = u32Count; u32TailCount != 0; i--)
+          {
+            /* Takes the greatest address */
+            pstArray->apstList[i - 1] = ((u32SortedCount != 0) && (pstArray->apstList[u32SortedCount - 1] > apstTail[u32TailCount - 1]))
+                                        ? pstArray->apstList[--u32SortedCount]
+                                        : apstTail[--u32TailCount];
+          }
+
+          /* Updates first moved cell */
+          u32FirstMoved = orxMIN(u32FirstMoved, i);
+
+          /* Deletes backup */
+          orxMemory_Free(apstTail);
+        }
+        else
+        {
+          /* Updates first moved cell */
+          u32FirstMoved = orxMIN(u32FirstMoved, u32SortedCount);
+        }
+      }
+
+      /* For all moved cells */
+      for(i = u32FirstMoved; i < u32Count; i++)
+      {
+        /* Updates its index */
+        pstArray->apstList[i]->stStorage.u32ArrayIndex = i;
+      }
+
+      /* Updates array */
+      pstArray->u32Used         = u32Count;
+      pstArray->u32SortedCount  = u32Count;
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Gets first stored structure (first list cell, tree root or first array cell depending on storage type)
  * @param[in]   _eStructureID   Concerned structure ID
  * @return      orxSTRUCTURE
  */
@@ -940,6 +1244,23 @@ orxSTRUCTURE *orxFASTCALL orxStructure_GetFirst(orxSTRUCTURE_ID _eStructureID)
       break;
     }
 
+    case orxSTRUCTURE_STORAGE_TYPE_ARRAY:
+    {
+      orxSTRUCTURE_ARRAY *pstArray;
+      orxU32              i;
+
+      /* Gets array */
+      pstArray = &(sstStructure.astStorage[_eStructureID].stArray);
+
+      /* Finds first live structure */
+      for(i = 0; (i < pstArray->u32Used) && (pstArray->apstList[i] == orxNULL); i++);
+
+      /* Updates result */
+      pstResult = (i < pstArray->u32Used) ? pstArray->apstList[i] : orxNULL;
+
+      break;
+    }
+
     default:
     {
       /* No node found */
@@ -953,7 +1274,7 @@ orxSTRUCTURE *orxFASTCALL orxStructure_GetFirst(orxSTRUCTURE_ID _eStructureID)
   return pstResult;
 }
 
-/** Gets last stored structure (last list cell or tree root depending on storage type)
+/** Gets last stored structure (last list cell, tree root or last array cell depending on storage type)
  * @param[in] _eStructureID      Concerned structure ID
  * return orxSTRUCTURE / orxNULL
  */
@@ -998,6 +1319,19 @@ orxSTRUCTURE *orxFASTCALL orxStructure_GetLast(orxSTRUCTURE_ID _eStructureID)
       break;
     }
 
+    case orxSTRUCTURE_STORAGE_TYPE_ARRAY:
+    {
+      const orxSTRUCTURE_ARRAY *pstArray;
+
+      /* Gets array */
+      pstArray = &(sstStructure.astStorage[_eStructureID].stArray);
+
+      /* Updates result (trailing holes are always trimmed) */
+      pstResult = (pstArray->u32Used != 0) ? pstArray->apstList[pstArray->u32Used - 1] : orxNULL;
+
+      break;
+    }
+
     default:
     {
       /* Logs message */
@@ -1115,19 +1449,37 @@ orxSTRUCTURE *orxFASTCALL orxStructure_GetPrevious(const void *_pStructure)
   /* Checks */
   orxASSERT(sstStructure.u32Flags & orxSTRUCTURE_KU32_STATIC_FLAG_READY);
   orxSTRUCTURE_ASSERT(_pStructure);
-  orxASSERT(sstStructure.astStorage[orxStructure_GetID(_pStructure)].eType == orxSTRUCTURE_STORAGE_TYPE_LINKLIST);
+  orxASSERT((sstStructure.astStorage[orxStructure_GetID(_pStructure)].eType == orxSTRUCTURE_STORAGE_TYPE_LINKLIST) || (sstStructure.astStorage[orxStructure_GetID(_pStructure)].eType == orxSTRUCTURE_STORAGE_TYPE_ARRAY));
 
   /* Gets structure */
   pstStructure = orxSTRUCTURE(_pStructure);
 
-  /* Gets previous */
-  pstResult = (orxSTRUCTURE *)orxLinkList_GetPrevious(&(pstStructure->stStorage.stLinkListNode));
-
-  /* Valid? */
-  if(pstResult != orxNULL)
+  /* Dense array? */
+  if(sstStructure.astStorage[orxStructure_GetID(pstStructure)].eType == orxSTRUCTURE_STORAGE_TYPE_ARRAY)
   {
+    const orxSTRUCTURE_ARRAY *pstArray;
+    orxU32                    i;
+
+    /* Gets array */
+    pstArray = &(sstStructure.astStorage[orxStructure_GetID(pstStructure)].stArray);
+
+    /* Finds previous live structure */
+    for(i = pstStructure->stStorage.u32ArrayIndex; (i > 0) && (pstArray->apstList[i - 1] == orxNULL); i--);
+
     /* Updates result */
-    pstResult = orxSTRUCT_GET_FROM_FIELD(orxSTRUCTURE, stStorage.stLinkListNode, pstResult);
+    pstResult = (i > 0) ? pstArray->apstList[i - 1] : orxNULL;
+  }
+  else
+  {
+    /* Gets previous */
+    pstResult = (orxSTRUCTURE *)orxLinkList_GetPrevious(&(pstStructure->stStorage.stLinkListNode));
+
+    /* Valid? */
+    if(pstResult != orxNULL)
+    {
+      /* Updates result */
+      pstResult = orxSTRUCT_GET_FROM_FIELD(orxSTRUCTURE, stStorage.stLinkListNode, pstResult);
+    }
   }
 
   /* Done! */
@@ -1145,19 +1497,37 @@ orxSTRUCTURE *orxFASTCALL orxStructure_GetNext(const void *_pStructure)
   /* Checks */
   orxASSERT(sstStructure.u32Flags & orxSTRUCTURE_KU32_STATIC_FLAG_READY);
   orxSTRUCTURE_ASSERT(_pStructure);
-  orxASSERT(sstStructure.astStorage[orxStructure_GetID(_pStructure)].eType == orxSTRUCTURE_STORAGE_TYPE_LINKLIST);
+  orxASSERT((sstStructure.astStorage[orxStructure_GetID(_pStructure)].eType == orxSTRUCTURE_STORAGE_TYPE_LINKLIST) || (sstStructure.astStorage[orxStructure_GetID(_pStructure)].eType == orxSTRUCTURE_STORAGE_TYPE_ARRAY));
 
   /* Gets structure */
   pstStructure = orxSTRUCTURE(_pStructure);
 
-  /* Gets next */
-  pstResult = (orxSTRUCTURE *)orxLinkList_GetNext(&(pstStructure->stStorage.stLinkListNode));
-
-  /* Valid? */
-  if(pstResult != orxNULL)
+  /* Dense array? */
+  if(sstStructure.astStorage[orxStructure_GetID(pstStructure)].eType == orxSTRUCTURE_STORAGE_TYPE_ARRAY)
   {
+    const orxSTRUCTURE_ARRAY *pstArray;
+    orxU32                    i;
+
+    /* Gets array */
+    pstArray = &(sstStructure.astStorage[orxStructure_GetID(pstStructure)].stArray);
+
+    /* Finds next live structure */
+    for(i = pstStructure->stStorage.u32ArrayIndex + 1; (i < pstArray->u32Used) && (pstArray->apstList[i] == orxNULL); i++);
+
     /* Updates result */
-    pstResult = orxSTRUCT_GET_FROM_FIELD(orxSTRUCTURE, stStorage.stLinkListNode, pstResult);
+    pstResult = (i < pstArray->u32Used) ? pstArray->apstList[i] : orxNULL;
+  }
+  else
+  {
+    /* Gets next */
+    pstResult = (orxSTRUCTURE *)orxLinkList_GetNext(&(pstStructure->stStorage.stLinkListNode));
+
+    /* Valid? */
+    if(pstResult != orxNULL)
+    {
+      /* Updates result */
+      pstResult = orxSTRUCT_GET_FROM_FIELD(orxSTRUCTURE, stStorage.stLinkListNode, pstResult);
+    }
   }
 
   /* Done! */
@@ -1236,7 +1606,7 @@ orxSTATUS orxFASTCALL orxStructure_LogAll()
       orxSTRUCTURE *pstStructure;
 
       /* Checks */
-      orxASSERT(orxStructure_GetStorageType(sastStructureLogInfoList[i].eID) == orxSTRUCTURE_STORAGE_TYPE_LINKLIST);
+      orxASSERT((orxStructure_GetStorageType(sastStructureLogInfoList[i].eID) == orxSTRUCTURE_STORAGE_TYPE_LINKLIST) || (orxStructure_GetStorageType(sastStructureLogInfoList[i].eID) == orxSTRUCTURE_STORAGE_TYPE_ARRAY));
 
       /* For all structures */
       for(pstStructure = orxStructure_GetFirst(sastStructureLogInfoList[i].eID);
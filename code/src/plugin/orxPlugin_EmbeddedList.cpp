@@ -64,15 +64,46 @@
 /** Includes all plugins to embed
  */
 
+/* Headless: no window, GPU nor audio device (benchmarks, replays & servers)? */
+#ifdef __orxHEADLESS__
+
+#include "../plugins/Display/Dummy/orxDisplay.c"
+
+#else /* __orxHEADLESS__ */
+
 /* GLFW, Box2D, OpenAL, stb_image, libsndfile & stb_vorbis */
 #include "../plugins/Display/GLFW/orxDisplay.c"
+
+#endif /* __orxHEADLESS__ */
+
+/* Dummy input, for headless replays? */
+#if defined(__orxDUMMY_INPUT__) || defined(__orxHEADLESS__)
+
+#include "../plugins/Joystick/Dummy/orxJoystick.c"
+#include "../plugins/Keyboard/Dummy/orxKeyboard.c"
+#include "../plugins/Mouse/Dummy/orxMouse.c"
+
+#else /* __orxDUMMY_INPUT__ */
+
 #include "../plugins/Joystick/GLFW/orxJoystick.c"
 #include "../plugins/Keyboard/GLFW/orxKeyboard.c"
 #include "../plugins/Mouse/GLFW/orxMouse.c"
+
+#endif /* __orxDUMMY_INPUT__ || __orxHEADLESS__ */
+
 #include "../plugins/Physics/LiquidFun/orxPhysics.cpp"
 #include "../plugins/Render/Home/orxRender.c"
+
+#ifdef __orxHEADLESS__
+
+#include "../plugins/Sound/Dummy/orxSoundSystem.c"
+
+#else /* __orxHEADLESS__ */
+
 #include "../plugins/Sound/OpenAL/orxSoundSystem.c"
 
+#endif /* __orxHEADLESS__ */
+
 #endif /* __orxANDROID__ || __orxANDROID_NATIVE__ */
 
 #endif /* __orxEMBEDDED__ */
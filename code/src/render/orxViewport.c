@@ -59,6 +59,8 @@
 #define orxVIEWPORT_KU32_FLAG_USE_SCREEN_SIZE   0x00000008  /**< Uses screen size flag */
 #define orxVIEWPORT_KU32_FLAG_AUTO_RESIZE       0x00000010  /**< Auto-resize flag */
 #define orxVIEWPORT_KU32_FLAG_FIXED_RATIO       0x00000020  /**< Fixed ratio flag */
+#define orxVIEWPORT_KU32_FLAG_USE_CACHE         0x00000040  /**< Use cache texture flag */
+#define orxVIEWPORT_KU32_FLAG_CACHE_DIRTY       0x00000080  /**< Cache texture dirty flag */
 #define orxVIEWPORT_KU32_FLAG_INTERNAL_TEXTURES 0x00100000  /**< Internal texture handling flag  */
 #define orxVIEWPORT_KU32_FLAG_INTERNAL_SHADER   0x00200000  /**< Internal shader pointer handling flag  */
 #define orxVIEWPORT_KU32_FLAG_INTERNAL_CAMERA   0x00400000  /**< Internal camera handling flag  */
@@ -89,6 +91,8 @@
 #define orxVIEWPORT_KZ_CONFIG_AUTO_RESIZE       "AutoResize"
 #define orxVIEWPORT_KZ_CONFIG_KEEP_IN_CACHE     "KeepInCache"
 #define orxVIEWPORT_KZ_CONFIG_NO_DEBUG          "NoDebug"
+#define orxVIEWPORT_KZ_CONFIG_USE_CACHE         "UseCache"
+#define orxVIEWPORT_KZ_CONFIG_CACHE_INTERVAL    "CacheInterval"
 
 #define orxVIEWPORT_KZ_LEFT                     "left"
 #define orxVIEWPORT_KZ_RIGHT                    "right"
@@ -122,6 +126,10 @@ struct __orxVIEWPORT_t
   orxFLOAT              fRealWidth;                                           /**< Width : 124 */
   orxFLOAT              fRealHeight;                                          /**< Height : 128 */
   orxTEXTURE           *apstTextureList[orxVIEWPORT_KU32_MAX_TEXTURE_NUMBER]; /**< Associated texture list : 192 */
+  orxTEXTURE           *pstCacheTexture;                                      /**< Cache texture : 200 */
+  orxFLOAT              fCacheInterval;                                       /**< Cache refresh interval : 204 */
+  orxFLOAT              fCacheTime;                                           /**< Cache last refresh time : 208 */
+  orxU32                u32CacheKey;                                          /**< Cache last refresh key : 212 */
 };
 
 /** Static structure
@@ -461,6 +469,16 @@ orxVIEWPORT *orxFASTCALL orxViewport_CreateFromConfig(const orxSTRING _zConfigID
         orxStructure_SetFlags(pstResult, orxVIEWPORT_KU32_FLAG_NO_DEBUG, orxVIEWPORT_KU32_FLAG_NONE);
       }
 
+      /* Uses cache? */
+      if(orxConfig_GetBool(orxVIEWPORT_KZ_CONFIG_USE_CACHE) != orxFALSE)
+      {
+        /* Enables it */
+        orxViewport_EnableCache(pstResult, orxTRUE);
+
+        /* Stores its refresh interval */
+        orxViewport_SetCacheInterval(pstResult, orxConfig_GetFloat(orxVIEWPORT_KZ_CONFIG_CACHE_INTERVAL));
+      }
+
       /* Has plain size */
       if(orxConfig_HasValue(orxVIEWPORT_KZ_CONFIG_SIZE) != orxFALSE)
       {
@@ -953,6 +971,9 @@ orxSTATUS orxFASTCALL orxViewport_Delete(orxVIEWPORT *_pstViewport)
     /* Removes camera */
     orxViewport_SetCamera(_pstViewport, orxNULL);
 
+    /* Removes cache */
+    orxViewport_EnableCache(_pstViewport, orxFALSE);
+
     /* Was linked to textures? */
     if(_pstViewport->u32TextureCount != 0)
     {
@@ -1180,6 +1201,9 @@ orxSTATUS orxFASTCALL orxViewport_SetBackgroundColor(orxVIEWPORT *_pstViewport,
   /* Updates its flag */
   orxStructure_SetFlags(_pstViewport, orxVIEWPORT_KU32_FLAG_BACKGROUND_COLOR, orxVIEWPORT_KU32_FLAG_NONE);
 
+  /* Invalidates cache */
+  orxViewport_InvalidateCache(_pstViewport);
+
   /* Done! */
   return eResult;
 }
@@ -1203,6 +1227,9 @@ orxSTATUS orxFASTCALL orxViewport_ClearBackgroundColor(orxVIEWPORT *_pstViewport
   _pstViewport->stBackgroundColor.fAlpha = orxFLOAT_1;
   orxVector_Copy(&(_pstViewport->stBackgroundColor.vRGB), &orxVECTOR_BLACK);
 
+  /* Invalidates cache */
+  orxViewport_InvalidateCache(_pstViewport);
+
   /* Done! */
   return eResult;
 }
@@ -1879,6 +1906,244 @@ orxFLOAT orxFASTCALL orxViewport_GetCorrectionRatio(const orxVIEWPORT *_pstViewp
   return fResult;
 }
 
+/** Enables / disables viewport cache: when enabled, the viewport is rendered into its own cache texture and only re-rendered when invalidated
+ * @param[in]   _pstViewport    Concerned viewport
+ * @param[in]   _bEnable        Enable / disable
+ */
+void orxFASTCALL orxViewport_EnableCache(orxVIEWPORT *_pstViewport, orxBOOL _bEnable)
+{
+  /* Checks */
+  orxASSERT(sstViewport.u32Flags & orxVIEWPORT_KU32_STATIC_FLAG_READY);
+  orxSTRUCTURE_ASSERT(_pstViewport);
+
+  /* Enable? */
+  if(_bEnable != orxFALSE)
+  {
+    /* Updates flags */
+    orxStructure_SetFlags(_pstViewport, orxVIEWPORT_KU32_FLAG_USE_CACHE | orxVIEWPORT_KU32_FLAG_CACHE_DIRTY, orxVIEWPORT_KU32_FLAG_NONE);
+  }
+  else
+  {
+    /* Has cache texture? */
+    if(_pstViewport->pstCacheTexture != orxNULL)
+    {
+      /* Deletes it */
+      orxTexture_Delete(_pstViewport->pstCacheTexture);
+      _pstViewport->pstCacheTexture = orxNULL;
+    }
+
+    /* Updates flags */
+    orxStructure_SetFlags(_pstViewport, orxVIEWPORT_KU32_FLAG_NONE, orxVIEWPORT_KU32_FLAG_USE_CACHE | orxVIEWPORT_KU32_FLAG_CACHE_DIRTY);
+  }
+
+  return;
+}
+
+/** Is viewport cache enabled?
+ * @param[in]   _pstViewport    Concerned viewport
+ * @return      orxTRUE / orxFALSE
+ */
+orxBOOL orxFASTCALL orxViewport_IsCacheEnabled(const orxVIEWPORT *_pstViewport)
+{
+  /* Checks */
+  orxASSERT(sstViewport.u32Flags & orxVIEWPORT_KU32_STATIC_FLAG_READY);
+  orxSTRUCTURE_ASSERT(_pstViewport);
+
+  /* Tests */
+  return(orxStructure_TestFlags(_pstViewport, orxVIEWPORT_KU32_FLAG_USE_CACHE));
+}
+
+/** Sets viewport cache refresh interval
+ * @param[in]   _pstViewport    Concerned viewport
+ * @param[in]   _fInterval      Interval, in seconds, after which the cache will be refreshed even if it hasn't been invalidated, 0 for no periodic refresh
+ */
+void orxFASTCALL orxViewport_SetCacheInterval(orxVIEWPORT *_pstViewport, orxFLOAT _fInterval)
+{
+  /* Checks */
+  orxASSERT(sstViewport.u32Flags & orxVIEWPORT_KU32_STATIC_FLAG_READY);
+  orxSTRUCTURE_ASSERT(_pstViewport);
+  orxASSERT(_fInterval >= orxFLOAT_0);
+
+  /* Stores it */
+  _pstViewport->fCacheInterval = _fInterval;
+
+  return;
+}
+
+/** Gets viewport cache refresh interval
+ * @param[in]   _pstViewport    Concerned viewport
+ * @return      Interval, in seconds
+ */
+orxFLOAT orxFASTCALL orxViewport_GetCacheInterval(const orxVIEWPORT *_pstViewport)
+{
+  /* Checks */
+  orxASSERT(sstViewport.u32Flags & orxVIEWPORT_KU32_STATIC_FLAG_READY);
+  orxSTRUCTURE_ASSERT(_pstViewport);
+
+  /* Done! */
+  return _pstViewport->fCacheInterval;
+}
+
+/** Invalidates viewport cache: it will be refreshed during next render
+ * @param[in]   _pstViewport    Concerned viewport
+ */
+void orxFASTCALL orxViewport_InvalidateCache(orxVIEWPORT *_pstViewport)
+{
+  /* Checks */
+  orxASSERT(sstViewport.u32Flags & orxVIEWPORT_KU32_STATIC_FLAG_READY);
+  orxSTRUCTURE_ASSERT(_pstViewport);
+
+  /* Uses cache? */
+  if(orxStructure_TestFlags(_pstViewport, orxVIEWPORT_KU32_FLAG_USE_CACHE) != orxFALSE)
+  {
+    /* Updates flags */
+    orxStructure_SetFlags(_pstViewport, orxVIEWPORT_KU32_FLAG_CACHE_DIRTY, orxVIEWPORT_KU32_FLAG_NONE);
+  }
+
+  return;
+}
+
+/** Is viewport cache still valid?
+ * @param[in]   _pstViewport    Concerned viewport
+ * @param[in]   _u32Key         Key describing the current rendering state (camera, size, ...), any change invalidates the cache
+ * @param[in]   _fTime          Current time
+ * @return      orxTRUE if the cache texture can be used as is, orxFALSE if it needs to be refreshed
+ */
+orxBOOL orxFASTCALL orxViewport_IsCacheValid(const orxVIEWPORT *_pstViewport, orxU32 _u32Key, orxFLOAT _fTime)
+{
+  orxBOOL bResult;
+
+  /* Checks */
+  orxASSERT(sstViewport.u32Flags & orxVIEWPORT_KU32_STATIC_FLAG_READY);
+  orxSTRUCTURE_ASSERT(_pstViewport);
+
+  /* Updates result */
+  bResult = ((orxStructure_GetFlags(_pstViewport, orxVIEWPORT_KU32_FLAG_USE_CACHE | orxVIEWPORT_KU32_FLAG_CACHE_DIRTY) == orxVIEWPORT_KU32_FLAG_USE_CACHE)
+          && (_pstViewport->pstCacheTexture != orxNULL)
+          && (_pstViewport->u32CacheKey == _u32Key)
+          && ((_pstViewport->fCacheInterval == orxFLOAT_0)
+           || (_fTime - _pstViewport->fCacheTime < _pstViewport->fCacheInterval))) ? orxTRUE : orxFALSE;
+
+  /* Done! */
+  return bResult;
+}
+
+/** Validates viewport cache, after it has been refreshed
+ * @param[in]   _pstViewport    Concerned viewport
+ * @param[in]   _u32Key         Key describing the rendering state used for the refresh
+ * @param[in]   _fTime          Refresh time
+ */
+void orxFASTCALL orxViewport_ValidateCache(orxVIEWPORT *_pstViewport, orxU32 _u32Key, orxFLOAT _fTime)
+{
+  /* Checks */
+  orxASSERT(sstViewport.u32Flags & orxVIEWPORT_KU32_STATIC_FLAG_READY);
+  orxSTRUCTURE_ASSERT(_pstViewport);
+
+  /* Stores key & time */
+  _pstViewport->u32CacheKey = _u32Key;
+  _pstViewport->fCacheTime  = _fTime;
+
+  /* Updates flags */
+  orxStructure_SetFlags(_pstViewport, orxVIEWPORT_KU32_FLAG_NONE, orxVIEWPORT_KU32_FLAG_CACHE_DIRTY);
+
+  return;
+}
+
+/** Gets viewport cache texture, (re-)creating it if needed so as to match viewport's size
+ * @param[in]   _pstViewport    Concerned viewport
+ * @return      orxTEXTURE / orxNULL if cache isn't enabled or couldn't be created
+ */
+orxTEXTURE *orxFASTCALL orxViewport_GetCacheTexture(orxVIEWPORT *_pstViewport)
+{
+  orxTEXTURE *pstResult = orxNULL;
+
+  /* Checks */
+  orxASSERT(sstViewport.u32Flags & orxVIEWPORT_KU32_STATIC_FLAG_READY);
+  orxSTRUCTURE_ASSERT(_pstViewport);
+
+  /* Uses cache? */
+  if(orxStructure_TestFlags(_pstViewport, orxVIEWPORT_KU32_FLAG_USE_CACHE) != orxFALSE)
+  {
+    /* Has cache texture? */
+    if(_pstViewport->pstCacheTexture != orxNULL)
+    {
+      orxFLOAT fWidth, fHeight;
+
+      /* Gets its size */
+      orxTexture_GetSize(_pstViewport->pstCacheTexture, &fWidth, &fHeight);
+
+      /* Doesn't match viewport's size? */
+      if((fWidth != _pstViewport->fWidth) || (fHeight != _pstViewport->fHeight))
+      {
+        /* Deletes it */
+        orxTexture_Delete(_pstViewport->pstCacheTexture);
+        _pstViewport->pstCacheTexture = orxNULL;
+      }
+    }
+
+    /* Needs a new cache texture? */
+    if((_pstViewport->pstCacheTexture == orxNULL)
+    && (_pstViewport->fWidth > orxFLOAT_0)
+    && (_pstViewport->fHeight > orxFLOAT_0))
+    {
+      orxBITMAP *pstBitmap;
+
+      /* Creates bitmap */
+      pstBitmap = orxDisplay_CreateBitmap(orxF2U(_pstViewport->fWidth), orxF2U(_pstViewport->fHeight));
+
+      /* Valid? */
+      if(pstBitmap != orxNULL)
+      {
+        /* Creates texture */
+        _pstViewport->pstCacheTexture = orxTexture_Create();
+
+        /* Valid? */
+        if(_pstViewport->pstCacheTexture != orxNULL)
+        {
+          orxCHAR acBuffer[256];
+
+          /* Gets its name */
+          orxString_NPrint(acBuffer, 255, "%s:%p:Cache", orxViewport_GetName(_pstViewport), _pstViewport);
+          acBuffer[255] = orxCHAR_NULL;
+
+          /* Links bitmap */
+          if(orxTexture_LinkBitmap(_pstViewport->pstCacheTexture, pstBitmap, acBuffer, orxTRUE) == orxSTATUS_FAILURE)
+          {
+            /* Logs message */
+            orxDEBUG_PRINT(orxDEBUG_LEVEL_RENDER, "Viewport [%s]: Couldn't link cache bitmap.", orxViewport_GetName(_pstViewport));
+
+            /* Deletes texture & bitmap */
+            orxTexture_Delete(_pstViewport->pstCacheTexture);
+            _pstViewport->pstCacheTexture = orxNULL;
+            orxDisplay_DeleteBitmap(pstBitmap);
+          }
+          else
+          {
+            /* Marks it as dirty */
+            orxStructure_SetFlags(_pstViewport, orxVIEWPORT_KU32_FLAG_CACHE_DIRTY, orxVIEWPORT_KU32_FLAG_NONE);
+          }
+        }
+        else
+        {
+          /* Deletes bitmap */
+          orxDisplay_DeleteBitmap(pstBitmap);
+        }
+      }
+      else
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_RENDER, "Viewport [%s]: Couldn't create cache bitmap.", orxViewport_GetName(_pstViewport));
+      }
+    }
+
+    /* Updates result */
+    pstResult = _pstViewport->pstCacheTexture;
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
 /** Gets viewport config name
  * @param[in]   _pstViewport    Concerned viewport
  * @return      orxSTRING / orxSTRING_EMPTY
@@ -213,9 +213,15 @@ static orxINLINE orxSOUND_SAMPLE *orxSound_LoadSample(const orxSTRING _zFileName
     /* Valid? */
     if(pstResult != orxNULL)
     {
+      /* Records cost */
+      orxProfiler_PushCost(orxPROFILER_COST_RESOURCE, _zFileName);
+
       /* Loads its data */
       pstResult->pstData = orxSoundSystem_LoadSample(_zFileName);
 
+      /* Ends cost record */
+      orxProfiler_PopCost();
+
       /* Adds it to sample table */
       if((pstResult->pstData != orxNULL)
       && (orxHashTable_Add(sstSound.pstSampleTable, u32ID, pstResult) != orxSTATUS_FAILURE))
@@ -427,8 +433,14 @@ static orxSTATUS orxFASTCALL orxSound_ProcessConfigData(orxSOUND *_pstSound, orx
         }
         else
         {
+          /* Records cost */
+          orxProfiler_PushCost(orxPROFILER_COST_RESOURCE, zName);
+
           /* Loads it */
           _pstSound->pstData = orxSoundSystem_CreateStreamFromFile(zName, _pstSound->zReference);
+
+          /* Ends cost record */
+          orxProfiler_PopCost();
         }
 
         /* Valid? */
@@ -37,6 +37,14 @@
 #include "utils/orxString.h"
 
 
+/** Open addressing defines
+ */
+#define orxHASHTABLE_KU8_CONTROL_EMPTY          0x80        /**< Empty slot control byte */
+#define orxHASHTABLE_KU8_CONTROL_DELETED        0xFE        /**< Deleted slot control byte, full slots store 7 bits of their hash instead */
+
+#define orxHASHTABLE_KU64_HASH_MULTIPLIER       0x9E3779B97F4A7C15ULL /**< Hash multiplier (Fibonacci hashing) */
+
+
 /***************************************************************************
  * Structure declaration                                                   *
  ***************************************************************************/
@@ -50,6 +58,14 @@ typedef struct __orxHASHTABLE_CELL_t
 
 } orxHASHTABLE_CELL;
 
+/** Hash table slot definition (open addressing).*/
+typedef struct __orxHASHTABLE_SLOT_t
+{
+  orxU64                        u64Key;                       /**< Key element of a hash table : 8 */
+  void                         *pData;                        /**< Address of data : 12 / 16 */
+
+} orxHASHTABLE_SLOT;
+
 /** Hash Table */
 #ifdef __orxMSVC__
   #pragma warning(disable : 4200)
@@ -60,7 +76,13 @@ struct __orxHASHTABLE_t
   orxBANK            *pstBank;                                /**< Bank where are stored cells : 4 */
   orxU32              u32Count;                               /**< Hashtable item count : 8 */
   orxU32              u32Size;                                /**< Hashtable size : 12 */
-  orxHASHTABLE_CELL  *apstCell[0];                            /**< Hash table */
+  orxU32              u32Flags;                               /**< Hashtable flags : 16 */
+  orxU32              u32UsedCount;                           /**< Non-empty slot count (items & deleted ones), open addressing only : 20 */
+  orxU32              u32MinSize;                             /**< Minimum size, open addressing only : 24 */
+  orxMEMORY_TYPE      eMemType;                               /**< Memory type : 28 */
+  orxHASHTABLE_SLOT  *astSlot;                                /**< Slots, open addressing only : 32 / 40 */
+  orxU8              *au8Control;                             /**< Slot control bytes, open addressing only : 36 / 48 */
+  orxHASHTABLE_CELL  *apstCell[0];                            /**< Hash table, chained only */
 };
 
 #ifdef __orxMSVC__
@@ -90,6 +112,262 @@ static orxINLINE orxU32 orxHashTable_FindIndex(const orxHASHTABLE *_pstHashTable
   return((orxU32)_u64Key & (_pstHashTable->u32Size - 1));
 }
 
+/** Gets the size an open addressing table needs to store a number of items
+ * @param[in] _pstHashTable The concerned hash table
+ * @param[in] _u32Count     Number of items
+ * @return Size (power of two)
+ */
+static orxINLINE orxU32 orxHashTable_GetOpenSize(const orxHASHTABLE *_pstHashTable, orxU32 _u32Count)
+{
+  orxU32 u32Result;
+
+  /* Keeps the load factor under 50% */
+  for(u32Result = _pstHashTable->u32MinSize; u32Result < (_u32Count << 1); u32Result <<= 1)
+  ;
+
+  /* Done! */
+  return u32Result;
+}
+
+/** Finds a slot in an open addressing table
+ * @param[in] _pstHashTable The hash table where search
+ * @param[in] _u64Key       Key to find
+ * @param[out] _pu32Free    If non-null, will contain the slot where the key should be inserted when not found
+ * @return Index of the slot holding the key, orxU32_UNDEFINED if not found
+ */
+static orxINLINE orxU32 orxHashTable_FindSlot(const orxHASHTABLE *_pstHashTable, orxU64 _u64Key, orxU32 *_pu32Free)
+{
+  orxU64  u64Hash;
+  orxU32  u32Mask, u32Index, u32Free, u32Result = orxU32_UNDEFINED;
+  orxU8   u8Tag;
+
+  /* Checks */
+  orxASSERT(_pstHashTable != orxNULL);
+
+  /* Gets hash, start index & tag */
+  u64Hash   = _u64Key * orxHASHTABLE_KU64_HASH_MULTIPLIER;
+  u32Mask   = _pstHashTable->u32Size - 1;
+  u32Index  = (orxU32)(u64Hash >> 32) & u32Mask;
+  u8Tag     = (orxU8)((u64Hash >> 25) & 0x7F);
+
+  /* Probes slots till an empty one (load factor guarantees there's always one) */
+  for(u32Free = orxU32_UNDEFINED; _pstHashTable->au8Control[u32Index] != orxHASHTABLE_KU8_CONTROL_EMPTY; u32Index = (u32Index + 1) & u32Mask)
+  {
+    orxU8 u8Control;
+
+    /* Gets control */
+    u8Control = _pstHashTable->au8Control[u32Index];
+
+    /* Found? */
+    if((u8Control == u8Tag) && (_pstHashTable->astSlot[u32Index].u64Key == _u64Key))
+    {
+      /* Updates result */
+      u32Result = u32Index;
+
+      break;
+    }
+    /* First deleted one? */
+    else if((u8Control == orxHASHTABLE_KU8_CONTROL_DELETED) && (u32Free == orxU32_UNDEFINED))
+    {
+      /* Stores it */
+      u32Free = u32Index;
+    }
+  }
+
+  /* Asked for free slot? */
+  if(_pu32Free != orxNULL)
+  {
+    /* Updates it */
+    *_pu32Free = (u32Result == orxU32_UNDEFINED) ? ((u32Free != orxU32_UNDEFINED) ? u32Free : u32Index) : orxU32_UNDEFINED;
+  }
+
+  /* Done! */
+  return u32Result;
+}
+
+/** Resizes an open addressing table, rehashing all its items
+ * @param[in] _pstHashTable The hash table to resize
+ * @param[in] _u32Size      New size (power of two)
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxSTATUS orxFASTCALL orxHashTable_ResizeOpen(orxHASHTABLE *_pstHashTable, orxU32 _u32Size)
+{
+  orxHASHTABLE_SLOT  *astSlot;
+  orxSTATUS           eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT(_pstHashTable != orxNULL);
+  orxASSERT(orxMath_IsPowerOfTwo(_u32Size) != orxFALSE);
+  orxASSERT(_u32Size > _pstHashTable->u32Count);
+
+  /* Allocates new slots & controls */
+  astSlot = (orxHASHTABLE_SLOT *)orxMemory_Allocate(_u32Size * (sizeof(orxHASHTABLE_SLOT) + sizeof(orxU8)), _pstHashTable->eMemType);
+
+  /* Success? */
+  if(astSlot != orxNULL)
+  {
+    orxHASHTABLE_SLOT  *astOldSlot;
+    orxU8              *au8OldControl;
+    orxU32              u32OldSize, i;
+
+    /* Backups old storage */
+    astOldSlot    = _pstHashTable->astSlot;
+    au8OldControl = _pstHashTable->au8Control;
+    u32OldSize    = _pstHashTable->u32Size;
+
+    /* Installs new storage */
+    _pstHashTable->astSlot      = astSlot;
+    _pstHashTable->au8Control   = (orxU8 *)(astSlot + _u32Size);
+    _pstHashTable->u32Size      = _u32Size;
+    _pstHashTable->u32UsedCount = _pstHashTable->u32Count;
+    orxMemory_Set(_pstHashTable->au8Control, orxHASHTABLE_KU8_CONTROL_EMPTY, _u32Size);
+
+    /* For all old slots */
+    for(i = 0; i < u32OldSize; i++)
+    {
+      /* Full? */
+      if(!(au8OldControl[i] & 0x80))
+      {
+        orxU32 u32Index;
+
+        /* Finds its new slot */
+        orxHashTable_FindSlot(_pstHashTable, astOldSlot[i].u64Key, &u32Index);
+
+        /* Stores it */
+        _pstHashTable->astSlot[u32Index]    = astOldSlot[i];
+        _pstHashTable->au8Control[u32Index] = au8OldControl[i];
+      }
+    }
+
+    /* Frees old storage */
+    if(astOldSlot != orxNULL)
+    {
+      orxMemory_Free(astOldSlot);
+    }
+
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Gets the slot of an item in an open addressing table, inserting it if needed
+ * @param[in] _pstHashTable The concerned hash table
+ * @param[in] _u64Key       Key to find
+ * @param[out] _pbInserted  Will be set to orxTRUE if the item has been inserted, orxFALSE otherwise
+ * @return The item's slot if found/inserted, orxNULL otherwise
+ */
+static orxHASHTABLE_SLOT *orxFASTCALL orxHashTable_RetrieveOpen(orxHASHTABLE *_pstHashTable, orxU64 _u64Key, orxBOOL *_pbInserted)
+{
+  orxU32              u32Index, u32Free;
+  orxHASHTABLE_SLOT  *pstResult = orxNULL;
+
+  /* Checks */
+  orxASSERT(_pstHashTable != orxNULL);
+  orxASSERT(_pbInserted != orxNULL);
+
+  /* Finds it */
+  u32Index = orxHashTable_FindSlot(_pstHashTable, _u64Key, &u32Free);
+
+  /* Found? */
+  if(u32Index != orxU32_UNDEFINED)
+  {
+    /* Updates result */
+    pstResult   = &(_pstHashTable->astSlot[u32Index]);
+    *_pbInserted = orxFALSE;
+  }
+  else
+  {
+    /* Over or under loaded? */
+    if((((_pstHashTable->u32UsedCount + 1) << 3) > (_pstHashTable->u32Size * 7))
+    || (((_pstHashTable->u32Count << 3) < _pstHashTable->u32Size) && (_pstHashTable->u32Size > _pstHashTable->u32MinSize)))
+    {
+      orxU32 u32Size;
+
+      /* Gets new size */
+      u32Size = ((_pstHashTable->u32Flags & orxHASHTABLE_KU32_FLAG_NOT_EXPANDABLE) != orxFALSE) ? _pstHashTable->u32Size : orxHashTable_GetOpenSize(_pstHashTable, _pstHashTable->u32Count + 1);
+
+      /* Resizes (or purges deleted slots) */
+      if(orxHashTable_ResizeOpen(_pstHashTable, u32Size) != orxSTATUS_FAILURE)
+      {
+        /* Finds new free slot */
+        orxHashTable_FindSlot(_pstHashTable, _u64Key, &u32Free);
+      }
+    }
+
+    /* Is there room left? */
+    if(((_pstHashTable->u32UsedCount + ((_pstHashTable->au8Control[u32Free] == orxHASHTABLE_KU8_CONTROL_EMPTY) ? 1 : 0)) << 3) <= (_pstHashTable->u32Size * 7))
+    {
+      /* Was empty? */
+      if(_pstHashTable->au8Control[u32Free] == orxHASHTABLE_KU8_CONTROL_EMPTY)
+      {
+        /* Updates used count */
+        _pstHashTable->u32UsedCount++;
+      }
+
+      /* Inits slot */
+      pstResult                           = &(_pstHashTable->astSlot[u32Free]);
+      pstResult->u64Key                   = _u64Key;
+      pstResult->pData                    = orxNULL;
+      _pstHashTable->au8Control[u32Free]  = (orxU8)(((_u64Key * orxHASHTABLE_KU64_HASH_MULTIPLIER) >> 25) & 0x7F);
+
+      /* Updates count */
+      _pstHashTable->u32Count++;
+
+      /* Updates status */
+      *_pbInserted = orxTRUE;
+    }
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Removes an item from an open addressing table
+ * @param[in] _pstHashTable The concerned hash table
+ * @param[in] _u64Key       Key to remove
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxSTATUS orxFASTCALL orxHashTable_RemoveOpen(orxHASHTABLE *_pstHashTable, orxU64 _u64Key)
+{
+  orxU32    u32Index;
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT(_pstHashTable != orxNULL);
+
+  /* Finds it */
+  u32Index = orxHashTable_FindSlot(_pstHashTable, _u64Key, orxNULL);
+
+  /* Found? */
+  if(u32Index != orxU32_UNDEFINED)
+  {
+    /* Is next slot empty? (no probe sequence goes through this slot) */
+    if(_pstHashTable->au8Control[(u32Index + 1) & (_pstHashTable->u32Size - 1)] == orxHASHTABLE_KU8_CONTROL_EMPTY)
+    {
+      /* Empties it */
+      _pstHashTable->au8Control[u32Index] = orxHASHTABLE_KU8_CONTROL_EMPTY;
+      _pstHashTable->u32UsedCount--;
+    }
+    else
+    {
+      /* Marks it as deleted (slots aren't moved so that iterators remain valid) */
+      _pstHashTable->au8Control[u32Index] = orxHASHTABLE_KU8_CONTROL_DELETED;
+    }
+
+    /* Updates count */
+    _pstHashTable->u32Count--;
+
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
 /***************************************************************************
  * Public functions                                                        *
  ***************************************************************************/
@@ -115,6 +393,34 @@ orxHASHTABLE *orxFASTCALL orxHashTable_Create(orxU32 _u32NbKey, orxU32 _u32Flags
   /* Gets Power of Two size */
   u32Size = orxMath_GetNextPowerOfTwo(_u32NbKey);
 
+  /* Open addressing? */
+  if(_u32Flags & orxHASHTABLE_KU32_FLAG_OPEN_ADDRESSING)
+  {
+    /* Allocate memory for a hash table */
+    pstHashTable = (orxHASHTABLE *)orxMemory_Allocate(sizeof(orxHASHTABLE), _eMemType);
+
+    /* Enough memory ? */
+    if(pstHashTable != orxNULL)
+    {
+      /* Inits it */
+      orxMemory_Zero(pstHashTable, sizeof(orxHASHTABLE));
+      pstHashTable->u32Flags    = _u32Flags;
+      pstHashTable->eMemType    = _eMemType;
+      pstHashTable->u32MinSize  = u32Size;
+
+      /* Allocates slots, keeping the load factor under 50% */
+      if(orxHashTable_ResizeOpen(pstHashTable, orxHashTable_GetOpenSize(pstHashTable, u32Size)) == orxSTATUS_FAILURE)
+      {
+        /* Allocation problem, returns orxNULL */
+        orxMemory_Free(pstHashTable);
+        pstHashTable = orxNULL;
+      }
+    }
+
+    /* Done! */
+    return pstHashTable;
+  }
+
   /* Allocate memory for a hash table */
   pstHashTable = (orxHASHTABLE *)orxMemory_Allocate(sizeof(orxHASHTABLE) + (u32Size * sizeof(orxHASHTABLE_CELL *)), _eMemType);
 
@@ -122,7 +428,7 @@ orxHASHTABLE *orxFASTCALL orxHashTable_Create(orxU32 _u32NbKey, orxU32 _u32Flags
   if(pstHashTable != orxNULL)
   {
     /* Set flags */
-    if(_u32Flags == orxHASHTABLE_KU32_FLAG_NOT_EXPANDABLE)
+    if(_u32Flags & orxHASHTABLE_KU32_FLAG_NOT_EXPANDABLE)
     {
       u32Flags = orxBANK_KU32_FLAG_NOT_EXPANDABLE;
     }
@@ -140,8 +446,10 @@ orxHASHTABLE *orxFASTCALL orxHashTable_Create(orxU32 _u32NbKey, orxU32 _u32Flags
     /* Correct bank allocation ? */
     if(pstHashTable->pstBank != orxNULL)
     {
-      /* Stores its size */
-      pstHashTable->u32Size = u32Size;
+      /* Stores its size, flags & memory type */
+      pstHashTable->u32Size   = u32Size;
+      pstHashTable->u32Flags  = _u32Flags;
+      pstHashTable->eMemType  = _eMemType;
     }
     else
     {
@@ -163,11 +471,20 @@ orxSTATUS orxFASTCALL orxHashTable_Delete(orxHASHTABLE *_pstHashTable)
   /* Checks */
   orxASSERT(_pstHashTable != orxNULL);
 
-  /* Clear hash table (unallocate cells) */
-  orxHashTable_Clear(_pstHashTable);
+  /* Open addressing? */
+  if(_pstHashTable->u32Flags & orxHASHTABLE_KU32_FLAG_OPEN_ADDRESSING)
+  {
+    /* Frees slots */
+    orxMemory_Free(_pstHashTable->astSlot);
+  }
+  else
+  {
+    /* Clear hash table (unallocate cells) */
+    orxHashTable_Clear(_pstHashTable);
 
-  /* Free bank */
-  orxBank_Delete(_pstHashTable->pstBank);
+    /* Free bank */
+    orxBank_Delete(_pstHashTable->pstBank);
+  }
 
   /* Unallocate memory */
   orxMemory_Free(_pstHashTable);
@@ -185,11 +502,21 @@ orxSTATUS orxFASTCALL orxHashTable_Clear(orxHASHTABLE *_pstHashTable)
   /* Checks */
   orxASSERT(_pstHashTable != orxNULL);
 
-  /* Clear the memory bank */
-  orxBank_Clear(_pstHashTable->pstBank);
+  /* Open addressing? */
+  if(_pstHashTable->u32Flags & orxHASHTABLE_KU32_FLAG_OPEN_ADDRESSING)
+  {
+    /* Empties all slots */
+    orxMemory_Set(_pstHashTable->au8Control, orxHASHTABLE_KU8_CONTROL_EMPTY, _pstHashTable->u32Size);
+    _pstHashTable->u32UsedCount = 0;
+  }
+  else
+  {
+    /* Clear the memory bank */
+    orxBank_Clear(_pstHashTable->pstBank);
 
-  /* Clear the hash */
-  orxMemory_Zero(_pstHashTable->apstCell, _pstHashTable->u32Size * sizeof(orxHASHTABLE_CELL *));
+    /* Clear the hash */
+    orxMemory_Zero(_pstHashTable->apstCell, _pstHashTable->u32Size * sizeof(orxHASHTABLE_CELL *));
+  }
 
   /* Clears count */
   _pstHashTable->u32Count = 0;
@@ -234,6 +561,24 @@ void *orxFASTCALL orxHashTable_Get(const orxHASHTABLE *_pstHashTable, orxU64 _u6
   /* Checks */
   orxASSERT(_pstHashTable != orxNULL);
 
+  /* Open addressing? */
+  if(_pstHashTable->u32Flags & orxHASHTABLE_KU32_FLAG_OPEN_ADDRESSING)
+  {
+    void *pResult;
+
+    /* Finds its slot */
+    u32Index = orxHashTable_FindSlot(_pstHashTable, _u64Key, orxNULL);
+
+    /* Updates result */
+    pResult = (u32Index != orxU32_UNDEFINED) ? _pstHashTable->astSlot[u32Index].pData : orxNULL;
+
+    /* Profiles */
+    orxPROFILER_POP_MARKER();
+
+    /* Done! */
+    return pResult;
+  }
+
   /* Gets the index from the key */
   u32Index = orxHashTable_FindIndex(_pstHashTable, _u64Key);
 
@@ -267,6 +612,25 @@ void **orxFASTCALL orxHashTable_Retrieve(orxHASHTABLE *_pstHashTable, orxU64 _u6
   /* Checks */
   orxASSERT(_pstHashTable != orxNULL);
 
+  /* Open addressing? */
+  if(_pstHashTable->u32Flags & orxHASHTABLE_KU32_FLAG_OPEN_ADDRESSING)
+  {
+    orxHASHTABLE_SLOT  *pstSlot;
+    orxBOOL             bInserted;
+
+    /* Gets its slot */
+    pstSlot = orxHashTable_RetrieveOpen(_pstHashTable, _u64Key, &bInserted);
+
+    /* Updates result */
+    ppResult = (pstSlot != orxNULL) ? &(pstSlot->pData) : orxNULL;
+
+    /* Profiles */
+    orxPROFILER_POP_MARKER();
+
+    /* Done! */
+    return ppResult;
+  }
+
   /* Gets the index from the key */
   u32Index = orxHashTable_FindIndex(_pstHashTable, _u64Key);
 
@@ -335,6 +699,29 @@ orxSTATUS orxFASTCALL orxHashTable_Set(orxHASHTABLE *_pstHashTable, orxU64 _u64K
   /* Checks */
   orxASSERT(_pstHashTable != orxNULL);
 
+  /* Open addressing? */
+  if(_pstHashTable->u32Flags & orxHASHTABLE_KU32_FLAG_OPEN_ADDRESSING)
+  {
+    orxHASHTABLE_SLOT  *pstSlot;
+    orxBOOL             bInserted;
+
+    /* Gets its slot */
+    pstSlot = orxHashTable_RetrieveOpen(_pstHashTable, _u64Key, &bInserted);
+
+    /* Valid? */
+    if(pstSlot != orxNULL)
+    {
+      /* Stores data */
+      pstSlot->pData = _pData;
+    }
+
+    /* Profiles */
+    orxPROFILER_POP_MARKER();
+
+    /* Done! */
+    return orxSTATUS_SUCCESS;
+  }
+
   /* Gets the index from the key */
   u32Index = orxHashTable_FindIndex(_pstHashTable, _u64Key);
 
@@ -398,6 +785,32 @@ orxSTATUS orxFASTCALL orxHashTable_Add(orxHASHTABLE *_pstHashTable, orxU64 _u64K
   orxASSERT(_pstHashTable != orxNULL);
   orxASSERT(_pData != orxNULL);
 
+  /* Open addressing? */
+  if(_pstHashTable->u32Flags & orxHASHTABLE_KU32_FLAG_OPEN_ADDRESSING)
+  {
+    orxHASHTABLE_SLOT  *pstSlot;
+    orxBOOL             bInserted;
+
+    /* Gets its slot */
+    pstSlot = orxHashTable_RetrieveOpen(_pstHashTable, _u64Key, &bInserted);
+
+    /* Inserted? */
+    if((pstSlot != orxNULL) && (bInserted != orxFALSE))
+    {
+      /* Stores data */
+      pstSlot->pData = _pData;
+
+      /* Updates result */
+      eStatus = orxSTATUS_SUCCESS;
+    }
+
+    /* Profiles */
+    orxPROFILER_POP_MARKER();
+
+    /* Done! */
+    return eStatus;
+  }
+
   /* Gets the index from the key */
   u32Index = orxHashTable_FindIndex(_pstHashTable, _u64Key);
 
@@ -456,6 +869,19 @@ orxSTATUS orxFASTCALL orxHashTable_Remove(orxHASHTABLE *_pstHashTable, orxU64 _u
   /* Checks */
   orxASSERT(_pstHashTable != orxNULL);
 
+  /* Open addressing? */
+  if(_pstHashTable->u32Flags & orxHASHTABLE_KU32_FLAG_OPEN_ADDRESSING)
+  {
+    /* Removes it */
+    eStatus = orxHashTable_RemoveOpen(_pstHashTable, _u64Key);
+
+    /* Profiles */
+    orxPROFILER_POP_MARKER();
+
+    /* Done! */
+    return eStatus;
+  }
+
   /* Get the index from the key */
   u32Index = orxHashTable_FindIndex(_pstHashTable, _u64Key);
 
@@ -534,6 +960,46 @@ orxHANDLE orxFASTCALL orxHashTable_GetNext(const orxHASHTABLE *_pstHashTable, or
   /* Checks */
   orxASSERT(_pstHashTable != orxNULL);
 
+  /* Open addressing? */
+  if(_pstHashTable->u32Flags & orxHASHTABLE_KU32_FLAG_OPEN_ADDRESSING)
+  {
+    /* Gets start index (iterators point to the current slot) */
+    u32Index = ((_hIterator != orxNULL) && (_hIterator != orxHANDLE_UNDEFINED)) ? (orxU32)((orxHASHTABLE_SLOT *)_hIterator - _pstHashTable->astSlot) + 1 : 0;
+
+    /* Finds next full slot */
+    for(; (u32Index < _pstHashTable->u32Size) && (_pstHashTable->au8Control[u32Index] & 0x80); u32Index++)
+    ;
+
+    /* Found? */
+    if(u32Index < _pstHashTable->u32Size)
+    {
+      /* Asked for key? */
+      if(_pu64Key != orxNULL)
+      {
+        /* Updates it */
+        *_pu64Key = _pstHashTable->astSlot[u32Index].u64Key;
+      }
+
+      /* Asked for data? */
+      if(_ppData != orxNULL)
+      {
+        /* Updates it */
+        *_ppData = _pstHashTable->astSlot[u32Index].pData;
+      }
+
+      /* Updates result */
+      hResult = (orxHANDLE)&(_pstHashTable->astSlot[u32Index]);
+    }
+    else
+    {
+      /* Updates result */
+      hResult = orxHANDLE_UNDEFINED;
+    }
+
+    /* Done! */
+    return hResult;
+  }
+
   /* Has iterator? */
   if((_hIterator != orxNULL) && (_hIterator != orxHANDLE_UNDEFINED))
   {
@@ -598,8 +1064,14 @@ orxSTATUS orxFASTCALL orxHashTable_Optimize(orxHASHTABLE *_pstHashTable)
   /* Checks */
   orxASSERT(_pstHashTable != orxNULL);
 
+  /* Open addressing? */
+  if(_pstHashTable->u32Flags & orxHASHTABLE_KU32_FLAG_OPEN_ADDRESSING)
+  {
+    /* Rehashes it to its ideal size, which also purges deleted slots */
+    eResult = orxHashTable_ResizeOpen(_pstHashTable, ((_pstHashTable->u32Flags & orxHASHTABLE_KU32_FLAG_NOT_EXPANDABLE) != orxFALSE) ? _pstHashTable->u32Size : orxHashTable_GetOpenSize(_pstHashTable, _pstHashTable->u32Count));
+  }
   /* Has elements? */
-  if(_pstHashTable->u32Count > 0)
+  else if(_pstHashTable->u32Count > 0)
   {
     orxHASHTABLE_CELL *astWorkBuffer;
 
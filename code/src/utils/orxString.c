@@ -32,10 +32,36 @@
 
 #include "utils/orxString.h"
 
+#include "core/orxThread.h"
 #include "debug/orxDebug.h"
 #include "debug/orxProfiler.h"
 #include "memory/orxMemory.h"
-#include "utils/orxHashTable.h"
+
+#if defined(__orxSTRING_CRC32C__) && (defined(__orxX86_64__) || defined(__orxX86__))
+
+  #define orxSTRING_HAS_HARDWARE_CRC
+
+  #ifdef __orxMSVC__
+    #include <intrin.h>
+    #include <nmmintrin.h>
+  #else /* __orxMSVC__ */
+    #include <cpuid.h>
+  #endif /* __orxMSVC__ */
+
+#elif defined(__orxARM64__) && !defined(__orxMSVC__) && (defined(__orxLINUX__) || defined(__orxANDROID__) || defined(__orxANDROID_NATIVE__) || defined(__orxMAC__) || defined(__orxIOS__))
+
+  #define orxSTRING_HAS_HARDWARE_CRC
+
+  #if defined(__orxMAC__) || defined(__orxIOS__)
+    #include <sys/sysctl.h>
+  #else /* __orxMAC__ || __orxIOS__ */
+    #include <sys/auxv.h>
+    #ifndef HWCAP_CRC32
+      #define HWCAP_CRC32 (1 << 7)
+    #endif /* !HWCAP_CRC32 */
+  #endif /* __orxMAC__ || __orxIOS__ */
+
+#endif
 
 
 /** Module flags
@@ -60,17 +86,48 @@
  ***************************************************************************/
 orxU32 saau32CRCTable[8][256];
 
+/** Hardware CRC function
+ */
+orxSTRING_CRC_FUNCTION spfnStringHardwareCRC = orxNULL;
+
 
 /***************************************************************************
  * Structure declaration                                                   *
  ***************************************************************************/
 
+/** String ID node: stored string, prefixed with its ID
+ */
+typedef struct __orxSTRING_ID_NODE_t
+{
+  orxU32                                u32ID;            /**< String ID */
+  orxCHAR                               acString[1];      /**< Stored string */
+
+} orxSTRING_ID_NODE;
+
+/** String ID table (open addressing, nodes are never moved nor deleted before exit)
+ */
+#ifdef __orxMSVC__
+  #pragma warning(disable : 4200)
+#endif /* __orxMSVC__ */
+typedef struct __orxSTRING_ID_TABLE_t
+{
+  struct __orxSTRING_ID_TABLE_t        *pstPrevious;      /**< Previous (retired) table */
+  orxU32                                u32Size;          /**< Table size (power of two) */
+  orxU32                                u32Count;         /**< Node count */
+  orxSTRING_ID_NODE * volatile          apstNodeList[0];  /**< Nodes */
+
+} orxSTRING_ID_TABLE;
+#ifdef __orxMSVC__
+  #pragma warning(default : 4200)
+#endif /* __orxMSVC__ */
+
 /** Static structure
  */
 typedef struct __orxSTRING_STATIC_t
 {
-  orxHASHTABLE *pstIDTable;                               /** String ID table */
-  orxU32        u32Flags;                                 /**< Control flags */
+  orxSTRING_ID_TABLE * volatile pstIDTable;               /**< String ID table, read without locking */
+  orxTHREAD_SEMAPHORE          *pstIDSemaphore;           /**< String ID insertion lock */
+  orxU32                        u32Flags;                 /**< Control flags */
 
 } orxSTRING_STATIC;
 
@@ -88,6 +145,385 @@ static orxSTRING_STATIC sstString;
  * Private functions                                                       *
  ***************************************************************************/
 
+#ifdef orxSTRING_HAS_HARDWARE_CRC
+
+#if defined(__orxX86_64__) || defined(__orxX86__)
+
+/** Computes a CRC32C using SSE4.2 instructions
+ * @param[in]   _pu8Data        Data to process
+ * @param[in]   _u32Size        Size of the data, in bytes
+ * @param[in]   _u32CRC         Base CRC
+ * @return      Resulting CRC
+ */
+#ifndef __orxMSVC__
+__attribute__((target("sse4.2")))
+#endif /* !__orxMSVC__ */
+static orxU32 orxFASTCALL orxString_ComputeHardwareCRC(const orxU8 *_pu8Data, orxU32 _u32Size, orxU32 _u32CRC)
+{
+  orxU32 u32CRC;
+
+  /* Inits CRC */
+  u32CRC = ~_u32CRC;
+
+#ifdef __orxX86_64__
+
+  /* For all 8-byte slices */
+  for(; _u32Size >= 8; _u32Size -= 8, _pu8Data += 8)
+  {
+    orxU64 u64Value;
+
+    /* Gets slice's data */
+    orxMemory_Copy(&u64Value, _pu8Data, sizeof(orxU64));
+
+    /* Updates CRC */
+#ifdef __orxMSVC__
+    u32CRC = (orxU32)_mm_crc32_u64(u32CRC, u64Value);
+#else /* __orxMSVC__ */
+    u32CRC = (orxU32)__builtin_ia32_crc32di(u32CRC, u64Value);
+#endif /* __orxMSVC__ */
+  }
+
+#else /* __orxX86_64__ */
+
+  /* For all 4-byte slices */
+  for(; _u32Size >= 4; _u32Size -= 4, _pu8Data += 4)
+  {
+    orxU32 u32Value;
+
+    /* Gets slice's data */
+    orxMemory_Copy(&u32Value, _pu8Data, sizeof(orxU32));
+
+    /* Updates CRC */
+#ifdef __orxMSVC__
+    u32CRC = _mm_crc32_u32(u32CRC, u32Value);
+#else /* __orxMSVC__ */
+    u32CRC = __builtin_ia32_crc32si(u32CRC, u32Value);
+#endif /* __orxMSVC__ */
+  }
+
+#endif /* __orxX86_64__ */
+
+  /* For all remaining bytes */
+  for(; _u32Size != 0; _u32Size--, _pu8Data++)
+  {
+    /* Updates CRC */
+#ifdef __orxMSVC__
+    u32CRC = _mm_crc32_u8(u32CRC, *_pu8Data);
+#else /* __orxMSVC__ */
+    u32CRC = __builtin_ia32_crc32qi(u32CRC, *_pu8Data);
+#endif /* __orxMSVC__ */
+  }
+
+  /* Done! */
+  return ~u32CRC;
+}
+
+/** Gets the hardware CRC function if supported by the CPU
+ * @return      orxSTRING_CRC_FUNCTION / orxNULL
+ */
+static orxINLINE orxSTRING_CRC_FUNCTION orxString_GetHardwareCRC()
+{
+  orxBOOL bSupported;
+
+#ifdef __orxMSVC__
+
+  int aiInfo[4];
+
+  /* Gets CPU features */
+  __cpuid(aiInfo, 1);
+
+  /* Updates status (SSE4.2) */
+  bSupported = (aiInfo[2] & (1 << 20)) ? orxTRUE : orxFALSE;
+
+#else /* __orxMSVC__ */
+
+  unsigned int uiEAX, uiEBX, uiECX, uiEDX;
+
+  /* Updates status (SSE4.2) */
+  bSupported = ((__get_cpuid(1, &uiEAX, &uiEBX, &uiECX, &uiEDX) != 0) && (uiECX & bit_SSE4_2)) ? orxTRUE : orxFALSE;
+
+#endif /* __orxMSVC__ */
+
+  /* Done! */
+  return (bSupported != orxFALSE) ? &orxString_ComputeHardwareCRC : orxNULL;
+}
+
+#else /* __orxX86_64__ || __orxX86__ */
+
+#ifdef __orxLLVM__
+  #define orxSTRING_HARDWARE_CRC_TARGET           __attribute__((target("crc")))
+  #ifdef __orxSTRING_CRC32C__
+    #define orxSTRING_HARDWARE_CRC_8(CRC, VALUE)  __builtin_arm_crc32cb(CRC, VALUE)
+    #define orxSTRING_HARDWARE_CRC_64(CRC, VALUE) __builtin_arm_crc32cd(CRC, VALUE)
+  #else /* __orxSTRING_CRC32C__ */
+    #define orxSTRING_HARDWARE_CRC_8(CRC, VALUE)  __builtin_arm_crc32b(CRC, VALUE)
+    #define orxSTRING_HARDWARE_CRC_64(CRC, VALUE) __builtin_arm_crc32d(CRC, VALUE)
+  #endif /* __orxSTRING_CRC32C__ */
+#else /* __orxLLVM__ */
+  #define orxSTRING_HARDWARE_CRC_TARGET           __attribute__((target("+crc")))
+  #ifdef __orxSTRING_CRC32C__
+    #define orxSTRING_HARDWARE_CRC_8(CRC, VALUE)  __builtin_aarch64_crc32cb(CRC, VALUE)
+    #define orxSTRING_HARDWARE_CRC_64(CRC, VALUE) __builtin_aarch64_crc32cx(CRC, VALUE)
+  #else /* __orxSTRING_CRC32C__ */
+    #define orxSTRING_HARDWARE_CRC_8(CRC, VALUE)  __builtin_aarch64_crc32b(CRC, VALUE)
+    #define orxSTRING_HARDWARE_CRC_64(CRC, VALUE) __builtin_aarch64_crc32x(CRC, VALUE)
+  #endif /* __orxSTRING_CRC32C__ */
+#endif /* __orxLLVM__ */
+
+/** Computes a CRC using ARMv8 CRC instructions
+ * @param[in]   _pu8Data        Data to process
+ * @param[in]   _u32Size        Size of the data, in bytes
+ * @param[in]   _u32CRC         Base CRC
+ * @return      Resulting CRC
+ */
+orxSTRING_HARDWARE_CRC_TARGET
+static orxU32 orxFASTCALL orxString_ComputeHardwareCRC(const orxU8 *_pu8Data, orxU32 _u32Size, orxU32 _u32CRC)
+{
+  orxU32 u32CRC;
+
+  /* Inits CRC */
+  u32CRC = ~_u32CRC;
+
+  /* For all 8-byte slices */
+  for(; _u32Size >= 8; _u32Size -= 8, _pu8Data += 8)
+  {
+    orxU64 u64Value;
+
+    /* Gets slice's data */
+    orxMemory_Copy(&u64Value, _pu8Data, sizeof(orxU64));
+
+    /* Updates CRC */
+    u32CRC = orxSTRING_HARDWARE_CRC_64(u32CRC, u64Value);
+  }
+
+  /* For all remaining bytes */
+  for(; _u32Size != 0; _u32Size--, _pu8Data++)
+  {
+    /* Updates CRC */
+    u32CRC = orxSTRING_HARDWARE_CRC_8(u32CRC, *_pu8Data);
+  }
+
+  /* Done! */
+  return ~u32CRC;
+}
+
+#undef orxSTRING_HARDWARE_CRC_TARGET
+#undef orxSTRING_HARDWARE_CRC_8
+#undef orxSTRING_HARDWARE_CRC_64
+
+/** Gets the hardware CRC function if supported by the CPU
+ * @return      orxSTRING_CRC_FUNCTION / orxNULL
+ */
+static orxINLINE orxSTRING_CRC_FUNCTION orxString_GetHardwareCRC()
+{
+  orxBOOL bSupported;
+
+#if defined(__orxMAC__) || defined(__orxIOS__)
+
+  int     iValue = 0;
+  size_t  sSize = sizeof(iValue);
+
+  /* Updates status */
+  bSupported = ((sysctlbyname("hw.optional.armv8_crc32", &iValue, &sSize, NULL, 0) == 0) && (iValue != 0)) ? orxTRUE : orxFALSE;
+
+#else /* __orxMAC__ || __orxIOS__ */
+
+  /* Updates status */
+  bSupported = (getauxval(AT_HWCAP) & HWCAP_CRC32) ? orxTRUE : orxFALSE;
+
+#endif /* __orxMAC__ || __orxIOS__ */
+
+  /* Done! */
+  return (bSupported != orxFALSE) ? &orxString_ComputeHardwareCRC : orxNULL;
+}
+
+#endif /* __orxX86_64__ || __orxX86__ */
+
+#endif /* orxSTRING_HAS_HARDWARE_CRC */
+
+/** Creates a string ID table
+ * @param[in]   _u32Size        Table size (power of two)
+ * @return      orxSTRING_ID_TABLE / orxNULL
+ */
+static orxINLINE orxSTRING_ID_TABLE *orxString_CreateIDTable(orxU32 _u32Size)
+{
+  orxSTRING_ID_TABLE *pstResult;
+
+  /* Checks */
+  orxASSERT(orxMath_IsPowerOfTwo(_u32Size) != orxFALSE);
+
+  /* Allocates it */
+  pstResult = (orxSTRING_ID_TABLE *)orxMemory_Allocate(sizeof(orxSTRING_ID_TABLE) + _u32Size * sizeof(orxSTRING_ID_NODE *), orxMEMORY_TYPE_MAIN);
+
+  /* Success? */
+  if(pstResult != orxNULL)
+  {
+    /* Inits it */
+    orxMemory_Zero(pstResult, sizeof(orxSTRING_ID_TABLE) + _u32Size * sizeof(orxSTRING_ID_NODE *));
+    pstResult->u32Size = _u32Size;
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Finds a node in a string ID table, lock-free
+ * @param[in]   _pstTable       Concerned table
+ * @param[in]   _u32ID          ID to find
+ * @return      orxSTRING_ID_NODE / orxNULL
+ */
+static orxINLINE orxSTRING_ID_NODE *orxString_FindIDNode(const orxSTRING_ID_TABLE *_pstTable, orxU32 _u32ID)
+{
+  orxSTRING_ID_NODE  *pstResult;
+  orxU32              u32Mask, i;
+
+  /* For all slots, starting from the ID's one, till an empty one */
+  for(u32Mask = _pstTable->u32Size - 1, i = _u32ID & u32Mask;
+      ((pstResult = _pstTable->apstNodeList[i]) != orxNULL) && (pstResult->u32ID != _u32ID);
+      i = (i + 1) & u32Mask)
+  ;
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Inserts a node in a string ID table (no concurrent insertion allowed)
+ * @param[in]   _pstTable       Concerned table
+ * @param[in]   _pstNode        Node to insert
+ */
+static orxINLINE void orxString_InsertIDNode(orxSTRING_ID_TABLE *_pstTable, orxSTRING_ID_NODE *_pstNode)
+{
+  orxU32 u32Mask, i;
+
+  /* Finds first empty slot */
+  for(u32Mask = _pstTable->u32Size - 1, i = _pstNode->u32ID & u32Mask;
+      _pstTable->apstNodeList[i] != orxNULL;
+      i = (i + 1) & u32Mask)
+  ;
+
+  /* Publishes node */
+  _pstTable->apstNodeList[i] = _pstNode;
+
+  /* Updates count */
+  _pstTable->u32Count++;
+
+  /* Done! */
+  return;
+}
+
+/** Gets a string's ID node, storing it if needed
+ * @param[in]   _zString        Concerned string
+ * @param[in]   _u32ID          String's ID
+ * @return      orxSTRING_ID_NODE / orxNULL
+ */
+static orxSTRING_ID_NODE *orxFASTCALL orxString_GetIDNode(const orxSTRING _zString, orxU32 _u32ID)
+{
+  orxSTRING_ID_NODE *pstResult;
+
+  /* Checks */
+  orxASSERT(_zString != orxNULL);
+
+  /* Finds node (lock-free) */
+  pstResult = orxString_FindIDNode(sstString.pstIDTable, _u32ID);
+
+  /* Not found? */
+  if(pstResult == orxNULL)
+  {
+    orxSTRING_ID_TABLE *pstTable;
+
+    /* Locks insertions */
+    orxThread_WaitSemaphore(sstString.pstIDSemaphore);
+
+    /* Gets current table */
+    pstTable = sstString.pstIDTable;
+
+    /* Finds node again, as it could have been inserted in the meantime */
+    pstResult = orxString_FindIDNode(pstTable, _u32ID);
+
+    /* Still not found? */
+    if(pstResult == orxNULL)
+    {
+      /* Table too crowded? */
+      if(((pstTable->u32Count + 1) << 1) > pstTable->u32Size)
+      {
+        orxSTRING_ID_TABLE *pstNewTable;
+
+        /* Creates a bigger table */
+        pstNewTable = orxString_CreateIDTable(pstTable->u32Size << 1);
+
+        /* Success? */
+        if(pstNewTable != orxNULL)
+        {
+          orxU32 i;
+
+          /* For all nodes */
+          for(i = 0; i < pstTable->u32Size; i++)
+          {
+            /* Valid? */
+            if(pstTable->apstNodeList[i] != orxNULL)
+            {
+              /* Inserts it */
+              orxString_InsertIDNode(pstNewTable, pstTable->apstNodeList[i]);
+            }
+          }
+
+          /* Retires previous table (concurrent readers might still be using it) */
+          pstNewTable->pstPrevious = pstTable;
+
+          /* Makes sure new table is fully initialized before being published */
+          orxMEMORY_BARRIER();
+
+          /* Publishes it */
+          sstString.pstIDTable = pstTable = pstNewTable;
+        }
+      }
+
+      /* Is there room left? */
+      if(pstTable->u32Count < pstTable->u32Size - 1)
+      {
+        orxU32 u32Length;
+
+        /* Gets string length */
+        u32Length = orxString_GetLength(_zString);
+
+        /* Allocates node */
+        pstResult = (orxSTRING_ID_NODE *)orxMemory_Allocate(sizeof(orxSTRING_ID_NODE) + u32Length * sizeof(orxCHAR), orxMEMORY_TYPE_TEXT);
+
+        /* Success? */
+        if(pstResult != orxNULL)
+        {
+          /* Inits it */
+          pstResult->u32ID = _u32ID;
+          orxMemory_Copy(pstResult->acString, _zString, (u32Length + 1) * sizeof(orxCHAR));
+
+          /* Makes sure node is fully initialized before being published */
+          orxMEMORY_BARRIER();
+
+          /* Inserts it */
+          orxString_InsertIDNode(pstTable, pstResult);
+        }
+      }
+    }
+
+    /* Unlocks insertions */
+    orxThread_SignalSemaphore(sstString.pstIDSemaphore);
+  }
+#ifdef __orxDEBUG__
+  else
+  {
+    /* Different strings? */
+    if(orxString_Compare(_zString, pstResult->acString) != 0)
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Error: string ID collision detected between <%s> and <%s>: please modify one of them or you might end up with undefined result.", pstResult->acString, _zString);
+    }
+  }
+#endif /* __orxDEBUG__ */
+
+  /* Done! */
+  return pstResult;
+}
+
 
 /***************************************************************************
  * Public functions                                                        *
@@ -134,10 +570,18 @@ void orxFASTCALL orxString_Setup()
     }
   }
 
+#ifdef orxSTRING_HAS_HARDWARE_CRC
+
+  /* Selects hardware CRC, if supported */
+  spfnStringHardwareCRC = orxString_GetHardwareCRC();
+
+#endif /* orxSTRING_HAS_HARDWARE_CRC */
+
   /* Adds module dependencies */
   orxModule_AddDependency(orxMODULE_ID_STRING, orxMODULE_ID_MEMORY);
   orxModule_AddDependency(orxMODULE_ID_STRING, orxMODULE_ID_BANK);
   orxModule_AddDependency(orxMODULE_ID_STRING, orxMODULE_ID_PROFILER);
+  orxModule_AddDependency(orxMODULE_ID_STRING, orxMODULE_ID_THREAD);
 
   /* Done! */
   return;
@@ -156,11 +600,12 @@ orxSTATUS orxFASTCALL orxString_Init()
     /* Cleans static controller */
     orxMemory_Zero(&sstString, sizeof(orxSTRING_STATIC));
 
-    /* Creates ID table */
-    sstString.pstIDTable = orxHashTable_Create(orxSTRING_KU32_ID_TABLE_SIZE, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+    /* Creates ID table & its lock */
+    sstString.pstIDTable      = orxString_CreateIDTable(orxSTRING_KU32_ID_TABLE_SIZE);
+    sstString.pstIDSemaphore  = orxThread_CreateSemaphore(1);
 
     /* Success? */
-    if(sstString.pstIDTable != orxNULL)
+    if((sstString.pstIDTable != orxNULL) && (sstString.pstIDSemaphore != orxNULL))
     {
       /* Inits Flags */
       sstString.u32Flags = orxSTRING_KU32_STATIC_FLAG_READY;
@@ -169,6 +614,18 @@ orxSTATUS orxFASTCALL orxString_Init()
     {
       /* Logs message */
       orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Couldn't create StringID table.");
+
+      /* Cleans up */
+      if(sstString.pstIDTable != orxNULL)
+      {
+        orxMemory_Free(sstString.pstIDTable);
+        sstString.pstIDTable = orxNULL;
+      }
+      if(sstString.pstIDSemaphore != orxNULL)
+      {
+        orxThread_DeleteSemaphore(sstString.pstIDSemaphore);
+        sstString.pstIDSemaphore = orxNULL;
+      }
     }
 
     /* Everything's ok */
@@ -194,21 +651,33 @@ void orxFASTCALL orxString_Exit()
   /* Initialized? */
   if(sstString.u32Flags & orxSTRING_KU32_STATIC_FLAG_READY)
   {
-    orxU64    u64Key;
-    orxHANDLE hIterator;
-    orxSTRING zString;
+    orxSTRING_ID_TABLE *pstTable;
+    orxU32              i;
 
     /* For all string IDs */
-    for(hIterator = orxHashTable_GetNext(sstString.pstIDTable, orxHANDLE_UNDEFINED, &u64Key, (void **)&zString);
-        hIterator != orxHANDLE_UNDEFINED;
-        hIterator = orxHashTable_GetNext(sstString.pstIDTable, hIterator, &u64Key, (void **)&zString))
+    for(i = 0; i < sstString.pstIDTable->u32Size; i++)
+    {
+      /* Valid? */
+      if(sstString.pstIDTable->apstNodeList[i] != orxNULL)
+      {
+        /* Deletes it */
+        orxMemory_Free(sstString.pstIDTable->apstNodeList[i]);
+      }
+    }
+
+    /* Deletes ID table and all the retired ones */
+    for(pstTable = sstString.pstIDTable; pstTable != orxNULL;)
     {
-      /* Deletes its string */
-      orxString_Delete(zString);
+      orxSTRING_ID_TABLE *pstPrevious;
+
+      /* Deletes it */
+      pstPrevious = pstTable->pstPrevious;
+      orxMemory_Free(pstTable);
+      pstTable = pstPrevious;
     }
 
-    /* Deletes ID table */
-    orxHashTable_Delete(sstString.pstIDTable);
+    /* Deletes ID lock */
+    orxThread_DeleteSemaphore(sstString.pstIDSemaphore);
 
     /* Updates flags */
     sstString.u32Flags &= ~orxSTRING_KU32_STATIC_FLAG_READY;
@@ -229,8 +698,7 @@ void orxFASTCALL orxString_Exit()
  */
 orxU32 orxFASTCALL orxString_GetID(const orxSTRING _zString)
 {
-  const orxSTRING  *pzBucket;
-  orxU32            u32Result = 0;
+  orxU32 u32Result = 0;
 
   /* Profiles */
   orxPROFILER_PUSH_MARKER("orxString_GetID");
@@ -242,29 +710,8 @@ orxU32 orxFASTCALL orxString_GetID(const orxSTRING _zString)
   /* Gets its ID */
   u32Result = orxString_ToCRC(_zString);
 
-  /* Gets stored string bucket */
-  pzBucket = (const orxSTRING *)orxHashTable_Retrieve(sstString.pstIDTable, u32Result);
-
-  /* Checks */
-  orxASSERT(pzBucket != orxNULL);
-
-  /* Not already stored? */
-  if(*pzBucket == orxNULL)
-  {
-    /* Adds it */
-    *pzBucket = orxString_Duplicate(_zString);
-  }
-#ifdef __orxDEBUG__
-  else
-  {
-    /* Different strings? */
-    if(orxString_Compare(_zString, *pzBucket) != 0)
-    {
-      /* Logs message */
-      orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Error: string ID collision detected between <%s> and <%s>: please modify one of them or you might end up with undefined result.", *pzBucket, _zString);
-    }
-  }
-#endif /* __orxDEBUG__ */
+  /* Stores it */
+  orxString_GetIDNode(_zString, u32Result);
 
   /* Profiles */
   orxPROFILER_POP_MARKER();
@@ -279,20 +726,20 @@ orxU32 orxFASTCALL orxString_GetID(const orxSTRING _zString)
  */
 const orxSTRING orxFASTCALL orxString_GetFromID(orxU32 _u32ID)
 {
-  const orxSTRING zResult;
+  orxSTRING_ID_NODE  *pstNode;
+  const orxSTRING     zResult;
 
   /* Profiles */
   orxPROFILER_PUSH_MARKER("orxString_GetFromID");
 
-  /* Gets string from table */
-  zResult = (const orxSTRING)orxHashTable_Get(sstString.pstIDTable, _u32ID);
+  /* Checks */
+  orxASSERT(sstString.u32Flags & orxSTRING_KU32_STATIC_FLAG_READY);
+
+  /* Gets node from table (lock-free) */
+  pstNode = orxString_FindIDNode(sstString.pstIDTable, _u32ID);
 
-  /* Invalid? */
-  if(zResult == orxNULL)
-  {
-    /* Updates result */
-    zResult = orxSTRING_EMPTY;
-  }
+  /* Updates result */
+  zResult = (pstNode != orxNULL) ? pstNode->acString : orxSTRING_EMPTY;
 
   /* Profiles */
   orxPROFILER_POP_MARKER();
@@ -307,9 +754,8 @@ const orxSTRING orxFASTCALL orxString_GetFromID(orxU32 _u32ID)
  */
 const orxSTRING orxFASTCALL orxString_Store(const orxSTRING _zString)
 {
-  const orxSTRING  *pzBucket;
-  const orxSTRING   zResult;
-  orxU32            u32ID;
+  orxSTRING_ID_NODE  *pstNode;
+  const orxSTRING     zResult;
 
   /* Profiles */
   orxPROFILER_PUSH_MARKER("orxString_Store");
@@ -318,38 +764,11 @@ const orxSTRING orxFASTCALL orxString_Store(const orxSTRING _zString)
   orxASSERT(sstString.u32Flags & orxSTRING_KU32_STATIC_FLAG_READY);
   orxASSERT(_zString != orxNULL);
 
-  /* Gets its ID */
-  u32ID = orxString_ToCRC(_zString);
-
-  /* Gets stored string bucket */
-  pzBucket = (const orxSTRING *)orxHashTable_Retrieve(sstString.pstIDTable, u32ID);
-
-  /* Checks */
-  orxASSERT(pzBucket != orxNULL);
-
-  /* Not already stored? */
-  if(*pzBucket == orxNULL)
-  {
-    /* Updates result */
-    zResult = orxString_Duplicate(_zString);
+  /* Gets its node */
+  pstNode = orxString_GetIDNode(_zString, orxString_ToCRC(_zString));
 
-    /* Adds it to table */
-    *pzBucket = zResult;
-  }
-  else
-  {
-    /* Gets it */
-    zResult = *pzBucket;
-
-#ifdef __orxDEBUG__
-    /* Different strings? */
-    if(orxString_Compare(_zString, zResult) != 0)
-    {
-      /* Logs message */
-      orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Error: string ID collision detected between <%s> and <%s>: please modify one of them or you might end up with undefined result.", zResult, _zString);
-    }
-#endif /* __orxDEBUG__ */
-  }
+  /* Updates result */
+  zResult = (pstNode != orxNULL) ? pstNode->acString : orxNULL;
 
   /* Profiles */
   orxPROFILER_POP_MARKER();